@@ -6,6 +6,7 @@ static char rcsid[] = "$Id: 214bbb2ff21541ff2594460a13259e21a46e9a01 $";
 #include "access.h"
 #include "list.h"
 #include "intlist.h"
+#include "snapshot.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -26,6 +27,10 @@ static char rcsid[] = "$Id: 214bbb2ff21541ff2594460a13259e21a46e9a01 $";
 #include <sys/shm.h>		/* For shmat and shmdt */
 #include "semaphore.h"
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>		/* For parallel readers */
+#endif
+
 
 #ifdef HAVE_FCNTL_H
 #include <fcntl.h>		/* For open */
@@ -65,6 +70,8 @@ static char rcsid[] = "$Id: 214bbb2ff21541ff2594460a13259e21a46e9a01 $";
 
 static bool preload_shared_memory_p = false;
 static bool unload_shared_memory_p = false;
+static int nreaders = ACCESS_DEFAULT_NREADERS;
+static char *snapshot_dir = NULL;
 
 void
 Access_setup (bool preload_shared_memory_p_in, bool unload_shared_memory_p_in) {
@@ -73,6 +80,31 @@ Access_setup (bool preload_shared_memory_p_in, bool unload_shared_memory_p_in) {
   return;
 }
 
+/* Needs to be called before any files are allocated */
+void
+Access_set_nreaders (int nreaders_in) {
+  nreaders = (nreaders_in < 1) ? 1 : nreaders_in;
+  return;
+}
+
+/* If snapshot_dir is not NULL, Access_allocate_shared uses snapshots
+   in that directory instead of SysV shared memory */
+void
+Access_set_snapshot_dir (char *snapshot_dir_in) {
+  snapshot_dir = snapshot_dir_in;
+  return;
+}
+
+/* For reporting load rates */
+double
+Access_mbps (size_t len, double seconds) {
+  if (seconds <= 0.0) {
+    return 0.0;
+  } else {
+    return (double) len/1048576.0/seconds;
+  }
+}
+
 
 
 bool
@@ -514,67 +546,133 @@ Access_deallocate_wo_semaphore (void *memory, int shmid, key_t key) {
 
 
 #define FREAD_BATCH 100000000	/* 100 million elements at a time */
+#define READ_CHUNK 67108864	/* 64 MB per pread */
 
 static void
-copy_memory_from_file (void *memory, char *filename, size_t filesize, size_t eltsize) {
-  FILE *fp;
-  void *p;
-  size_t i;
+read_range (int fd, unsigned char *p, size_t offset, size_t nbytes, char *filename) {
+  ssize_t nread;
 
-  if ((fp = FOPEN_READ_BINARY(filename)) == NULL) {
-    fprintf(stderr,"Error: can't open file %s with fopen\n",filename);
-    exit(9);
-  }
-  
-  if (eltsize == 1) {
-    for (i = 0; i + FREAD_BATCH < filesize/eltsize; i += FREAD_BATCH) {
-      p = (void *) &(((unsigned char *) memory)[i]);
-      fread(p,sizeof(unsigned char),FREAD_BATCH,fp);
-    }
-    
-    if (i < filesize/eltsize) {
-      p = (void *) &(((unsigned char *) memory)[i]);
-      fread(p,sizeof(unsigned char),filesize/eltsize - i,fp);
+  while (nbytes > 0) {
+    if ((nread = pread(fd,(void *) p,nbytes,(off_t) offset)) < 0) {
+      if (errno == EINTR) {
+	continue;
+      }
+      fprintf(stderr,"Error: can't read file %s at offset %llu: %s\n",
+	      filename,(unsigned long long) offset,strerror(errno));
+      exit(9);
+    } else if (nread == 0) {
+      fprintf(stderr,"Error: file %s ended at offset %llu, before its expected size\n",
+	      filename,(unsigned long long) offset);
+      exit(9);
     }
+    p += nread;
+    offset += (size_t) nread;
+    nbytes -= (size_t) nread;
+  }
 
-  } else if (eltsize == 2) {
-    for (i = 0; i + FREAD_BATCH < filesize/eltsize; i += FREAD_BATCH) {
-      p = (void *) &(((UINT2 *) memory)[i]);
-      fread(p,sizeof(UINT2),FREAD_BATCH,fp);
-    }
+  return;
+}
 
-    if (i < filesize/eltsize) {
-      p = (void *) &(((UINT2 *) memory)[i]);
-      fread(p,sizeof(UINT2),filesize/eltsize - i,fp);
-    }
 
-  } else if (eltsize == 4) {
-    for (i = 0; i + FREAD_BATCH < filesize/eltsize; i += FREAD_BATCH) {
-      p = (void *) &(((UINT4 *) memory)[i]);
-      fread(p,sizeof(UINT4),FREAD_BATCH,fp);
-    }
+#ifdef HAVE_PTHREAD
+/* Readers share one descriptor and claim chunks in order, so the
+   device sees several large requests in flight at once */
+typedef struct Reader_T *Reader_T;
+struct Reader_T {
+  int fd;
+  unsigned char *memory;
+  char *filename;
+  size_t filesize;
 
-    if (i < filesize/eltsize) {
-      p = (void *) &(((UINT4 *) memory)[i]);
-      fread(p,sizeof(UINT4),filesize/eltsize - i,fp);
-    }
+  pthread_mutex_t lock;
+  size_t nextpos;
+};
 
-  } else if (eltsize == 8) {
-    for (i = 0; i + FREAD_BATCH < filesize/eltsize; i += FREAD_BATCH) {
-      p = (void *) &(((UINT8 *) memory)[i]);
-      fread(p,sizeof(UINT8),FREAD_BATCH,fp);
-    }
-    
-    if (i < filesize/eltsize) {
-      p = (void *) &(((UINT8 *) memory)[i]);
-      fread(p,sizeof(UINT8),filesize/eltsize - i,fp);
+static void *
+reader_thread (void *data) {
+  Reader_T reader = (Reader_T) data;
+  size_t pos, nbytes;
+
+  while (1) {
+    pthread_mutex_lock(&reader->lock);
+    pos = reader->nextpos;
+    reader->nextpos += READ_CHUNK;
+    pthread_mutex_unlock(&reader->lock);
+
+    if (pos >= reader->filesize) {
+      return (void *) NULL;
+    } else if ((nbytes = reader->filesize - pos) > READ_CHUNK) {
+      nbytes = READ_CHUNK;
     }
+    read_range(reader->fd,&(reader->memory[pos]),pos,nbytes,reader->filename);
+  }
+}
+#endif
 
-  } else {
+
+/* Reads the raw file contents.  Element sizes are checked only for
+   consistency with the callers, since no byte-swapping is done here. */
+static void
+copy_memory_from_file (void *memory, char *filename, size_t filesize, size_t eltsize) {
+  int fd;
+#ifdef HAVE_PTHREAD
+  struct Reader_T reader;
+  pthread_t *threads;
+  pthread_attr_t thread_attr_join;
+  int nthreads, nstarted, i;
+#endif
+
+  if (eltsize != 1 && eltsize != 2 && eltsize != 4 && eltsize != 8) {
     fprintf(stderr,"Access_allocated called with an element size of %d, which is not handled\n",(int) eltsize);
     exit(9);
   }
-  fclose(fp);
+
+  if ((fd = open(filename,O_RDONLY,0764)) < 0) {
+    fprintf(stderr,"Error: can't open file %s with open for reading\n",filename);
+    exit(9);
+  }
+
+#ifdef HAVE_PTHREAD
+  if ((nthreads = nreaders) > (int) ((filesize + READ_CHUNK - 1)/READ_CHUNK)) {
+    nthreads = (int) ((filesize + READ_CHUNK - 1)/READ_CHUNK);
+  }
+  if (nthreads > 1) {
+    debug(printf("Reading %s with %d readers\n",filename,nthreads));
+    reader.fd = fd;
+    reader.memory = (unsigned char *) memory;
+    reader.filename = filename;
+    reader.filesize = filesize;
+    reader.nextpos = 0;
+    pthread_mutex_init(&reader.lock,NULL);
+
+    pthread_attr_init(&thread_attr_join);
+    pthread_attr_setdetachstate(&thread_attr_join,PTHREAD_CREATE_JOINABLE);
+    threads = (pthread_t *) MALLOC(nthreads*sizeof(pthread_t));
+    nstarted = 0;
+    while (nstarted < nthreads &&
+	   pthread_create(&(threads[nstarted]),&thread_attr_join,reader_thread,(void *) &reader) == 0) {
+      nstarted++;
+    }
+    /* Readers take chunks until the file is done, so any readers that
+       started will read all of it */
+    for (i = 0; i < nstarted; i++) {
+      pthread_join(threads[i],NULL);
+    }
+    FREE(threads);
+    pthread_attr_destroy(&thread_attr_join);
+    pthread_mutex_destroy(&reader.lock);
+
+    if (nstarted > 0) {
+      close(fd);
+      return;
+    } else {
+      debug(printf("Could not start readers for %s, so reading it in one pass\n",filename));
+    }
+  }
+#endif
+
+  read_range(fd,(unsigned char *) memory,/*offset*/0,filesize,filename);
+  close(fd);
 
   return;
 }
@@ -842,6 +940,37 @@ Access_allocate_private (Access_T *access, size_t *len, double *seconds, char *f
 }
 
 
+#ifdef HAVE_MMAP
+/* Returns a read-only mapping of a snapshot of filename, creating the
+   snapshot if necessary, or NULL if snapshots cannot be used */
+static void *
+snapshot_attach (int *fd, char *filename, size_t filesize, size_t eltsize) {
+  void *memory;
+  char *tmpfile;
+  int nusers;
+
+  if ((memory = Snapshot_attach(&(*fd),&nusers,snapshot_dir,filename,filesize,eltsize)) != NULL) {
+    if (nusers > 0) {
+      fprintf(stderr,"Attached existing snapshot (%d attached) for %s...",nusers,filename);
+    } else {
+      fprintf(stderr,"Attached existing snapshot for %s...",filename);
+    }
+
+  } else if ((memory = Snapshot_create_begin(&(*fd),&tmpfile,snapshot_dir,filename,filesize)) != NULL) {
+    copy_memory_from_file(memory,filename,filesize,eltsize);
+    if ((memory = Snapshot_create_commit(&(*fd),memory,tmpfile,snapshot_dir,filename,filesize,eltsize)) != NULL) {
+      fprintf(stderr,"Created new snapshot in %s for %s...",snapshot_dir,filename);
+    }
+  }
+
+  if (memory == NULL) {
+    fprintf(stderr,"Cannot use a snapshot in %s for %s, so using shared memory\n",snapshot_dir,filename);
+  }
+  return memory;
+}
+#endif
+
+
 /* Bigendian conversion not needed after this */
 void *
 Access_allocate_shared (Access_T *access, int *shmid, key_t *key, int *fd, size_t *len, double *seconds, char *filename, size_t eltsize) {
@@ -885,7 +1014,14 @@ Access_allocate_shared (Access_T *access, int *shmid, key_t *key, int *fd, size_
 #endif
 
 #if defined(HAVE_MMAP)
-  if ((memory = shmem_attach(&(*shmid),&(*key),filename,/*filesize*/*len,eltsize)) != NULL) {
+  if (snapshot_dir != NULL &&
+      (memory = snapshot_attach(&(*fd),filename,/*filesize*/*len,eltsize)) != NULL) {
+    /* Freed like any other memory mapping */
+    *shmid = 0;
+    *access = MMAPPED;
+    *seconds = Stopwatch_stop(stopwatch);
+
+  } else if ((memory = shmem_attach(&(*shmid),&(*key),filename,/*filesize*/*len,eltsize)) != NULL) {
     *access = ALLOCATED_SHARED;
   } else {
     fprintf(stderr,"shm_attach not working on file %s, so using memory mapping instead on %lu bytes\n",
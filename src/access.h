@@ -24,8 +24,17 @@ typedef enum {USE_ALLOCATE, USE_MMAP_ONLY, USE_MMAP_PRELOAD, USE_FILEIO} Access_
 typedef enum {NOT_USED, ALLOCATED_PRIVATE, ALLOCATED_SHARED, MMAPPED, LOADED, FILEIO} Access_T;
 #define MAX32BIT 4294967295U	/* 2^32 - 1 */
 
+/* Allocated files are read by this many threads, in 64 MB chunks */
+#define ACCESS_DEFAULT_NREADERS 4
+
 extern void
 Access_setup (bool preload_shared_memory_p_in, bool unload_shared_memory_p_in);
+extern void
+Access_set_nreaders (int nreaders_in);
+extern void
+Access_set_snapshot_dir (char *snapshot_dir_in);
+extern double
+Access_mbps (size_t len, double seconds);
 
 extern bool
 Access_file_exists_p (char *filename);
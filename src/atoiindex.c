@@ -107,6 +107,7 @@ static int region1part = 6;
 static int region1interval = 1;
 
 static char *snps_root = NULL;
+static bool combinedp = false;
 
 
 static struct option long_options[] = {
@@ -118,6 +119,9 @@ static struct option long_options[] = {
   {"db", required_argument, 0, 'd'}, /* dbroot */
   {"usesnps", required_argument, 0, 'v'}, /* snps_root */
 
+  /* Output options */
+  {"combined", no_argument, 0, 0}, /* combinedp */
+
   /* Help options */
   {"version", no_argument, 0, 0}, /* print_program_version */
   {"help", no_argument, 0, 0}, /* print_program_usage */
@@ -996,6 +1000,8 @@ main (int argc, char *argv[]) {
       } else if (!strcmp(long_name,"help")) {
 	print_program_usage();
 	exit(0);
+      } else if (!strcmp(long_name,"combined")) {
+	combinedp = true;
 
       } else {
 	/* Shouldn't reach here */
@@ -1049,6 +1055,10 @@ main (int argc, char *argv[]) {
   } else {
     coord_values_8p = Univ_IIT_coord_values_8p(chromosome_iit);
   }
+  if (combinedp == true && coord_values_8p == true) {
+    fprintf(stderr,"The --combined option is not supported for large genomes\n");
+    exit(9);
+  }
   FREE(filename);
 
 
@@ -1167,6 +1177,11 @@ main (int argc, char *argv[]) {
     fclose(sequence_fp);
 #endif
 
+    if (combinedp == true) {
+      Indexdb_write_combined(destdir,fileroot,ifilenames,"a2iag","a2itc",ATOI_COMBINED_FILESUFFIX,
+			     index1part,/*shared_xor*/1);
+    }
+
     Indexdb_free(&indexdb);
     Indexdb_filenames_free(&ifilenames);
   }
@@ -1207,6 +1222,11 @@ Usage: atoiindex [OPTIONS...] -d <genome>\n\
                                    within selected basesize and k-mer size\n\
   -v, --use-snps=STRING          Use database containing known SNPs (in <STRING>.iit, built\n\
                                    previously using snpindex) for tolerance to SNPs\n\
+\n\
+Output options\n\
+  --combined                     Also write a single a2icmb index for both conversions, which\n\
+                                   shares the k-mers unchanged by both and is used by GSNAP\n\
+                                   in place of the separate indexes.  Not for large genomes\n\
 \n\
   --version                      Show version\n\
   --help                         Show this help message\n\
@@ -0,0 +1,241 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "bitpack64-positions.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "mem.h"
+#include "assert.h"
+#include "popcount.h"
+
+#include "simd.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+
+#define HEADER_NWORDS 3		/* widths, then mask as two words */
+
+
+static int
+nbits (UINT4 x) {
+  int n = 0;
+
+  while (x != 0) {
+    n++;
+    x >>= 1;
+  }
+  return n;
+}
+
+static UINT4
+field_mask (int width) {
+  return (UINT4) (((UINT8) 1 << width) - 1);
+}
+
+static int
+popcount_low (UINT8 mask, int nlow) {
+  if (nlow == 0) {
+    return 0;
+  } else if (nlow < 64) {
+    mask &= ((UINT8) 1 << nlow) - 1;
+  }
+  return popcount_ones_32((UINT4) mask) + popcount_ones_32((UINT4) (mask >> 32));
+}
+
+
+static void
+write_field (UINT4 *data, UINT8 bitpos, int width, UINT4 value) {
+  UINT8 wordi = bitpos >> 5;
+  int shift = (int) (bitpos & 31);
+
+  if (width > 0) {
+    data[wordi] |= value << shift;
+    if (shift + width > 32) {
+      data[wordi + 1] |= value >> (32 - shift);
+    }
+  }
+  return;
+}
+
+static UINT4
+read_field (UINT4 *data, UINT8 bitpos, int width) {
+  UINT8 window;
+
+  window = (UINT8) data[bitpos >> 5] | ((UINT8) data[(bitpos >> 5) + 1] << 32);
+  return (UINT4) (window >> (bitpos & 31)) & field_mask(width);
+}
+
+
+/* startbits has one bit per entry, set at the first entry of each
+   k-mer.  Returns the stream, which the caller frees along with meta. */
+UINT4 *
+Bitpack64_positions_encode (UINT8 **meta, size_t *nmeta, size_t *nwords,
+			    UINT4 *positions, UINT8 *startbits, size_t npositions) {
+  UINT4 *strm, *data;
+  size_t nblocks, blocki, ptr, maxwords;
+  UINT8 mask, bitpos;
+  int n, i, wa, wd, na;
+
+  nblocks = (npositions + BITPACK64_POSITIONS_BLOCKSIZE - 1)/BITPACK64_POSITIONS_BLOCKSIZE;
+  maxwords = nblocks*HEADER_NWORDS + npositions + BITPACK64_POSITIONS_PAD;
+  strm = (UINT4 *) CALLOC(maxwords,sizeof(UINT4));
+  *nmeta = nblocks + 1;
+  *meta = (UINT8 *) MALLOC((*nmeta)*sizeof(UINT8));
+
+  ptr = 0;
+  for (blocki = 0; blocki < nblocks; blocki++) {
+    (*meta)[blocki] = ptr;
+    if ((n = npositions - blocki*BITPACK64_POSITIONS_BLOCKSIZE) > BITPACK64_POSITIONS_BLOCKSIZE) {
+      n = BITPACK64_POSITIONS_BLOCKSIZE;
+    }
+
+    mask = startbits[blocki] | 1;
+    if (n < 64) {
+      mask &= ((UINT8) 1 << n) - 1;
+    }
+
+    wa = wd = 0;
+    for (i = 0; i < n; i++) {
+      ptr = blocki*BITPACK64_POSITIONS_BLOCKSIZE + i;
+      if (mask & ((UINT8) 1 << i)) {
+	if (nbits(positions[ptr]) > wa) {
+	  wa = nbits(positions[ptr]);
+	}
+      } else if (positions[ptr] <= positions[ptr-1]) {
+	fprintf(stderr,"Positions at %llu are not in ascending order within their k-mer\n",
+		(unsigned long long) ptr);
+	exit(9);
+      } else if (nbits(positions[ptr] - positions[ptr-1]) > wd) {
+	wd = nbits(positions[ptr] - positions[ptr-1]);
+      }
+    }
+    ptr = (*meta)[blocki];
+
+    strm[ptr] = (UINT4) wa | ((UINT4) wd << 8);
+    strm[ptr+1] = (UINT4) mask;
+    strm[ptr+2] = (UINT4) (mask >> 32);
+    data = &(strm[ptr + HEADER_NWORDS]);
+
+    na = popcount_low(mask,64);
+    bitpos = 0;
+    for (i = 0; i < n; i++) {
+      if (mask & ((UINT8) 1 << i)) {
+	write_field(data,bitpos,wa,positions[blocki*BITPACK64_POSITIONS_BLOCKSIZE + i]);
+	bitpos += wa;
+      }
+    }
+    assert(bitpos == (UINT8) na*wa);
+    for (i = 0; i < n; i++) {
+      if ((mask & ((UINT8) 1 << i)) == 0) {
+	ptr = blocki*BITPACK64_POSITIONS_BLOCKSIZE + i;
+	write_field(data,bitpos,wd,positions[ptr] - positions[ptr-1]);
+	bitpos += wd;
+      }
+    }
+    debug(printf("Block %llu: %d entries, %d absolute at %d bits, deltas at %d bits\n",
+		 (unsigned long long) blocki,n,na,wa,wd));
+
+    ptr = (*meta)[blocki] + HEADER_NWORDS + (bitpos + 31)/32;
+  }
+  (*meta)[nblocks] = ptr;
+  *nwords = ptr + BITPACK64_POSITIONS_PAD;
+
+  return strm;
+}
+
+
+/* Unpacks n fields of the given width, starting at bitpos, and writes
+   their running sum, starting from value */
+static void
+unpack_deltas (UINT4 *out, UINT4 *data, UINT8 bitpos, int width, int n, UINT4 value) {
+  int i = 0;
+#ifdef HAVE_AVX2
+  __m256i _offsets, _idx, _shift, _lo, _hi, _v, _carry, _mask, _step, _thirtytwo;
+
+  _mask = _mm256_set1_epi32(field_mask(width));
+  _step = _mm256_set_epi32(7*width,6*width,5*width,4*width,3*width,2*width,width,0);
+  _thirtytwo = _mm256_set1_epi32(32);
+  _carry = _mm256_set1_epi32(value);
+
+  for ( ; i + 8 <= n; i += 8) {
+    _offsets = _mm256_add_epi32(_mm256_set1_epi32((int) (bitpos + i*width)),_step);
+    _idx = _mm256_srli_epi32(_offsets,5);
+    _shift = _mm256_and_si256(_offsets,_mm256_set1_epi32(31));
+    _lo = _mm256_i32gather_epi32((const int *) data,_idx,4);
+    _hi = _mm256_i32gather_epi32((const int *) data,_mm256_add_epi32(_idx,_mm256_set1_epi32(1)),4);
+    /* A left shift by 32 gives 0, as needed when the field is in one word */
+    _v = _mm256_or_si256(_mm256_srlv_epi32(_lo,_shift),
+			 _mm256_sllv_epi32(_hi,_mm256_sub_epi32(_thirtytwo,_shift)));
+    _v = _mm256_and_si256(_v,_mask);
+
+    /* Prefix sum within each 128-bit lane, then across lanes */
+    _v = _mm256_add_epi32(_v,_mm256_slli_si256(_v,4));
+    _v = _mm256_add_epi32(_v,_mm256_slli_si256(_v,8));
+    _v = _mm256_add_epi32(_v,_mm256_permute2x128_si256(_mm256_shuffle_epi32(_v,0xFF),_v,0x08));
+    _v = _mm256_add_epi32(_v,_carry);
+    _mm256_storeu_si256((__m256i *) &(out[i]),_v);
+    _carry = _mm256_permutevar8x32_epi32(_v,_mm256_set1_epi32(7));
+  }
+  value = (UINT4) _mm256_extract_epi32(_carry,0);
+#endif
+
+  for ( ; i < n; i++) {
+    value += read_field(data,bitpos + (UINT8) i*width,width);
+    out[i] = value;
+  }
+
+  return;
+}
+
+
+void
+Bitpack64_positions_read (UINT4 *out, UINT8 *meta, UINT4 *strm, UINT4 ptr0, UINT4 end0) {
+  UINT4 *block, *data, value;
+  UINT8 mask, blocki;
+  int j0, n, remaining, wa, wd, na, ai, di;
+
+  blocki = ptr0/BITPACK64_POSITIONS_BLOCKSIZE;
+  j0 = ptr0 % BITPACK64_POSITIONS_BLOCKSIZE;
+  remaining = end0 - ptr0;
+
+  while (remaining > 0) {
+    block = &(strm[meta[blocki]]);
+    wa = block[0] & 0xFF;
+    wd = (block[0] >> 8) & 0xFF;
+    mask = (UINT8) block[1] | ((UINT8) block[2] << 32);
+    data = &(block[HEADER_NWORDS]);
+    assert(mask & ((UINT8) 1 << j0));
+
+    if ((n = BITPACK64_POSITIONS_BLOCKSIZE - j0) > remaining) {
+      n = remaining;
+    }
+
+    /* First entry is absolute */
+    ai = popcount_low(mask,j0);
+    value = read_field(data,(UINT8) ai*wa,wa);
+    *out++ = value;
+
+    if (n > 1) {
+      /* Remaining entries in this block are consecutive deltas */
+      na = popcount_low(mask,64);
+      di = (j0 + 1) - popcount_low(mask,j0 + 1);
+      unpack_deltas(out,data,(UINT8) na*wa + (UINT8) di*wd,wd,n - 1,value);
+      out += n - 1;
+    }
+
+    remaining -= n;
+    blocki++;
+    j0 = 0;
+  }
+
+  return;
+}
+
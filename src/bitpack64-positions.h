@@ -0,0 +1,38 @@
+/* $Id$ */
+#ifndef BITPACK64_POSITIONS_INCLUDED
+#define BITPACK64_POSITIONS_INCLUDED
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stddef.h>
+#include "types.h"
+
+
+/* Bitpacked format for a positions file of 4-byte entries.  The
+   positions for each k-mer are sorted, so all but the first can be
+   stored as a delta from the previous one.  The array is split into
+   blocks of 64 entries.  In the stream, each block has a header word
+   with two bit widths, a 64-bit mask of the entries stored as
+   absolute values (the first entry of each k-mer and the first entry
+   of the block), and then the absolute values and the deltas, each
+   packed at its own width.  The meta array gives the stream offset,
+   in words, of each block. */
+
+#define BITPACK64_POSITIONS_BLOCKSIZE 64
+
+/* Extra words at the end of the stream, so that decoding can read
+   past the last field */
+#define BITPACK64_POSITIONS_PAD 2
+
+extern UINT4 *
+Bitpack64_positions_encode (UINT8 **meta, size_t *nmeta, size_t *nwords,
+			    UINT4 *positions, UINT8 *startbits, size_t npositions);
+
+/* Decodes entries ptr0 through end0-1, where ptr0 is the first entry
+   of a k-mer, and all entries belong to that k-mer */
+extern void
+Bitpack64_positions_read (UINT4 *out, UINT8 *meta, UINT4 *strm, UINT4 ptr0, UINT4 end0);
+
+#endif
+
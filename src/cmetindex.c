@@ -107,6 +107,7 @@ static int region1part = 6;
 static int region1interval = 1;
 
 static char *snps_root = NULL;
+static bool combinedp = false;
 
 
 static struct option long_options[] = {
@@ -118,6 +119,9 @@ static struct option long_options[] = {
   {"db", required_argument, 0, 'd'}, /* dbroot */
   {"usesnps", required_argument, 0, 'v'}, /* snps_root */
 
+  /* Output options */
+  {"combined", no_argument, 0, 0}, /* combinedp */
+
   /* Help options */
   {"version", no_argument, 0, 0}, /* print_program_version */
   {"help", no_argument, 0, 0}, /* print_program_usage */
@@ -1136,6 +1140,8 @@ main (int argc, char *argv[]) {
       } else if (!strcmp(long_name,"help")) {
 	print_program_usage();
 	exit(0);
+      } else if (!strcmp(long_name,"combined")) {
+	combinedp = true;
 
       } else {
 	/* Shouldn't reach here */
@@ -1189,6 +1195,10 @@ main (int argc, char *argv[]) {
   } else {
     coord_values_8p = Univ_IIT_coord_values_8p(chromosome_iit);
   }
+  if (combinedp == true && coord_values_8p == true) {
+    fprintf(stderr,"The --combined option is not supported for large genomes\n");
+    exit(9);
+  }
   FREE(filename);
 
 
@@ -1307,6 +1317,11 @@ main (int argc, char *argv[]) {
     fclose(sequence_fp);
 #endif
 
+    if (combinedp == true) {
+      Indexdb_write_combined(destdir,fileroot,ifilenames,"metct","metga",CMET_COMBINED_FILESUFFIX,
+			     index1part,/*shared_xor*/0);
+    }
+
     Indexdb_free(&indexdb);
     Indexdb_filenames_free(&ifilenames);
   }
@@ -1347,6 +1362,11 @@ Usage: cmetindex [OPTIONS...] -d <genome>\n\
                                    within selected basesize and k-mer size\n\
   -v, --use-snps=STRING          Use database containing known SNPs (in <STRING>.iit, built\n\
                                    previously using snpindex) for tolerance to SNPs\n\
+\n\
+Output options\n\
+  --combined                     Also write a single metcmb index for both conversions, which\n\
+                                   shares the k-mers unchanged by both and is used by GSNAP\n\
+                                   in place of the separate indexes.  Not for large genomes\n\
 \n\
   --version                      Show version\n\
   --help                         Show this help message\n\
@@ -97,6 +97,52 @@ typedef int Direction32_T;
 #define HORIZ -1
 #define DIAG 0			/* Pre-dominant case.  Directions_alloc clears to this value. */
 
+/* The SIMD procedures pack their directions, column by column (or row
+   by row for the lower matrices), straight from the comparison masks.
+   directions_nogap in the full matrix takes 2 bits per cell: 00 for
+   DIAG, 11 for HORIZ (as written by the mask), and 10 for VERT.  The
+   other matrices only distinguish DIAG from a gap, so they take 1 bit
+   per cell, set if not DIAG. */
+typedef unsigned char Dirbits_T;
+
+static inline int
+Dirbits_nogap (Dirbits_T **directions, int c, int r) {
+  switch ((directions[c][r >> 2] >> ((r & 3) << 1)) & 3) {
+  case 0: return DIAG;
+  case 2: return VERT;
+  default: return HORIZ;
+  }
+}
+
+static inline void
+Dirbits_set_nogap (Dirbits_T **directions, int c, int r, int dir) {
+  Dirbits_T *byte = &(directions[c][r >> 2]);
+  int shift = (r & 3) << 1;
+
+  *byte &= ~(3 << shift);
+  if (dir == HORIZ) {
+    *byte |= (3 << shift);
+  } else if (dir != DIAG) {
+    *byte |= (2 << shift);
+  }
+  return;
+}
+
+static inline bool
+Dirbits_gap_p (Dirbits_T **directions, int c, int r) {
+  return (directions[c][r >> 3] >> (r & 7)) & 1;
+}
+
+static inline void
+Dirbits_set_gap (Dirbits_T **directions, int c, int r, int dir) {
+  if (dir == DIAG) {
+    directions[c][r >> 3] &= ~(1 << (r & 7));
+  } else {
+    directions[c][r >> 3] |= (1 << (r & 7));
+  }
+  return;
+}
+
 #define NEG_INFINITY_8 (-128)
 #define POS_INFINITY_8 (127)
 #define MAX_CHAR (127)
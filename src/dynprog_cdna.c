@@ -805,14 +805,14 @@ Dynprog_cdna_gap (int *dynprogindex, int *traceback_score, bool *incompletep,
   
 #if defined(HAVE_SSE2)
   Score8_T **matrix8L_upper, **matrix8L_lower, **matrix8R_upper, **matrix8R_lower;
-  Direction8_T **directions8L_upper_nogap, **directions8L_upper_Egap,
+  Dirbits_T **directions8L_upper_nogap, **directions8L_upper_Egap,
     **directions8L_lower_nogap, **directions8L_lower_Egap,
     **directions8R_upper_nogap, **directions8R_upper_Egap,
     **directions8R_lower_nogap, **directions8R_lower_Egap;
   bool use8p;
 
   Score16_T **matrix16L_upper, **matrix16L_lower, **matrix16R_upper, **matrix16R_lower;
-  Direction16_T **directions16L_upper_nogap, **directions16L_upper_Egap,
+  Dirbits_T **directions16L_upper_nogap, **directions16L_upper_Egap,
     **directions16L_lower_nogap, **directions16L_lower_Egap,
     **directions16R_upper_nogap, **directions16R_upper_Egap,
     **directions16R_lower_nogap, **directions16R_lower_Egap;
@@ -21,6 +21,7 @@ static char rcsid[] = "$Id: dynprog_end.c 224700 2021-11-08 16:46:32Z twu $";
 #include "complement.h"
 #include "splicetrie.h"
 #include "dynprog_simd.h"
+#include "dynprog_xdrop.h"
 #include "scores.h"
 
 
@@ -113,6 +114,7 @@ static Triecontent_T *triecontents_max;
 static int user_open;
 static int user_extend;
 static bool user_dynprog_p;
+static int xdrop;
 /* static bool homopolymerp; */
 
 void
@@ -120,7 +122,8 @@ Dynprog_end_setup (Univcoord_T *splicesites_in, Splicetype_T *splicetypes_in,
 		   Chrpos_T *splicedists_in, int nsplicesites_in,
 		   Trieoffset_T *trieoffsets_obs_in, Triecontent_T *triecontents_obs_in,
 		   Trieoffset_T *trieoffsets_max_in, Triecontent_T *triecontents_max_in,
-		   int user_open_in, int user_extend_in, bool user_dynprog_p_in) {
+		   int user_open_in, int user_extend_in, bool user_dynprog_p_in,
+		   int xdrop_in) {
 
   splicesites = splicesites_in;
   splicetypes = splicetypes_in;
@@ -134,6 +137,7 @@ Dynprog_end_setup (Univcoord_T *splicesites_in, Splicetype_T *splicetypes_in,
   user_open = user_open_in;
   user_extend = user_extend_in;
   user_dynprog_p = user_dynprog_p_in;
+  xdrop = xdrop_in;
 
   return;
 }
@@ -727,7 +731,7 @@ traceback_nogaps (List_T pairs, int *traceback_score, int *nmatches, int *nmisma
 /* Want to keep pointers to r and c because traceback is interrupted */
 static List_T
 traceback_local_8_upper (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			 Direction8_T **directions_nogap, Direction8_T **directions_Egap,
+			 Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			 int *r, int *c, int endc, char *rsequence, char *rsequenceuc,
 			 char *genomesequence, char *genomesequencealt, int queryoffset, int genomeoffset,
 			 Genome_T genome, Genome_T genomealt, Pairpool_T pairpool, bool revp,
@@ -737,7 +741,6 @@ traceback_local_8_upper (List_T pairs, int *traceback_score, int *nmatches, int
   int dist;
   bool add_dashes_p;
   int querycoord, genomecoord;
-  Direction8_T dir;
 
   debug(printf("Starting traceback_local_8_upper at r=%d,c=%d (roffset=%d, goffset=%d)\n",
 	       *r,*c,queryoffset,genomeoffset));
@@ -745,10 +748,10 @@ traceback_local_8_upper (List_T pairs, int *traceback_score, int *nmatches, int
   /* We care only only about genomic coordinate c */
 
   while (*r > 0 && *c > endc) {
-    if ((dir = directions_nogap[*c][*r]) != DIAG) {
+    if (Dirbits_gap_p(directions_nogap,*c,*r) == true) {
       /* Must be HORIZ */
       dist = 1;
-      while (*c > endc && directions_Egap[(*c)--][*r] != DIAG) {
+      while (*c > endc && Dirbits_gap_p(directions_Egap,(*c)--,*r) == true) {
 	dist++;
       }
       /* assert(*c != endc); */
@@ -832,7 +835,7 @@ traceback_local_8_upper (List_T pairs, int *traceback_score, int *nmatches, int
 #if defined(HAVE_SSE2)
 static List_T
 traceback_local_8_lower (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			 Direction8_T **directions_nogap, Direction8_T **directions_Egap,
+			 Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			 int *r, int *c, int endc, char *rsequence, char *rsequenceuc,
 			 char *genomesequence, char *genomesequencealt,
 			 int queryoffset, int genomeoffset, Pairpool_T pairpool,
@@ -840,18 +843,17 @@ traceback_local_8_lower (List_T pairs, int *traceback_score, int *nmatches, int
   char c1, c1_uc, c2, c2_alt;
   int dist;
   int querycoord, genomecoord;
-  Direction8_T dir;
 
   debug(printf("Starting traceback_local_8_lower at r=%d,c=%d (roffset=%d, goffset=%d)\n",*r,*c,queryoffset,genomeoffset));
 
   /* We care only only about genomic coordinate c */
 
   while (*r > 0 && *c > endc) {
-    if ((dir = directions_nogap[*r][*c]) != DIAG) {
+    if (Dirbits_gap_p(directions_nogap,*r,*c) == true) {
       /* Must be VERT */
       dist = 1;
       /* Should not need to check for r > 0 if the main diagonal is populated with DIAG */
-      while (/* *r > 0 && */ directions_Egap[(*r)--][*c] != DIAG) {
+      while (/* *r > 0 && */ Dirbits_gap_p(directions_Egap,(*r)--,*c) == true) {
 	dist++;
       }
       /* assert(*r != 0); */
@@ -932,7 +934,7 @@ traceback_local_8_lower (List_T pairs, int *traceback_score, int *nmatches, int
 #if defined(HAVE_SSE2)
 static List_T
 traceback_local_16_upper (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			  Direction16_T **directions_nogap, Direction16_T **directions_Egap,
+			  Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			  int *r, int *c, int endc, char *rsequence, char *rsequenceuc,
 			  char *genomesequence, char *genomesequencealt, int queryoffset, int genomeoffset,
 			  Genome_T genome, Genome_T genomealt, Pairpool_T pairpool, bool revp,
@@ -942,17 +944,16 @@ traceback_local_16_upper (List_T pairs, int *traceback_score, int *nmatches, int
   int dist;
   bool add_dashes_p;
   int querycoord, genomecoord;
-  Direction16_T dir;
 
   debug(printf("Starting traceback_local_upper at r=%d,c=%d (roffset=%d, goffset=%d)\n",*r,*c,queryoffset,genomeoffset));
 
   /* We care only only about genomic coordinate c */
 
   while (*r > 0 && *c > endc) {
-    if ((dir = directions_nogap[*c][*r]) != DIAG) {
+    if (Dirbits_gap_p(directions_nogap,*c,*r) == true) {
       /* Must be HORIZ */
       dist = 1;
-      while (*c > endc && directions_Egap[(*c)--][*r] != DIAG) {
+      while (*c > endc && Dirbits_gap_p(directions_Egap,(*c)--,*r) == true) {
 	dist++;
       }
 
@@ -1036,7 +1037,7 @@ traceback_local_16_upper (List_T pairs, int *traceback_score, int *nmatches, int
 #if defined(HAVE_SSE2)
 static List_T
 traceback_local_16_lower (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			  Direction16_T **directions_nogap, Direction16_T **directions_Egap,
+			  Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			  int *r, int *c, int endc, char *rsequence, char *rsequenceuc,
 			  char *genomesequence, char *genomesequencealt,
 			  int queryoffset, int genomeoffset, Pairpool_T pairpool,
@@ -1044,18 +1045,17 @@ traceback_local_16_lower (List_T pairs, int *traceback_score, int *nmatches, int
   char c1, c1_uc, c2, c2_alt;
   int dist;
   int querycoord, genomecoord;
-  Direction16_T dir;
 
   debug(printf("Starting traceback_local at r=%d,c=%d (roffset=%d, goffset=%d)\n",*r,*c,queryoffset,genomeoffset));
 
   /* We care only only about genomic coordinate c */
 
   while (*r > 0 && *c > endc) {
-    if ((dir = directions_nogap[*r][*c]) != DIAG) {
+    if (Dirbits_gap_p(directions_nogap,*r,*c) == true) {
       /* Must be VERT */
       dist = 1;
       /* Should not need to check for r > 0 if the main diagonal is populated with DIAG */
-      while (/* *r > 0 && */ directions_Egap[(*r)--][*c] != DIAG) {
+      while (/* *r > 0 && */ Dirbits_gap_p(directions_Egap,(*r)--,*c) == true) {
 	dist++;
       }
       /* assert(*r != 0); */
@@ -1307,15 +1307,16 @@ Dynprog_end5_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
   int bestr, bestc, lband, uband;
   int open, extend;
   int finalscore;
+  Dynprog_xdrop_T xdropspace = NULL;
 
 #if defined(HAVE_SSE2)
   bool use8p = false;
   Score8_T **matrix8_upper, **matrix8_lower;
-  Direction8_T **directions8_upper_nogap, **directions8_upper_Egap,
+  Dirbits_T **directions8_upper_nogap, **directions8_upper_Egap,
     **directions8_lower_nogap, **directions8_lower_Egap;
 
   Score16_T **matrix16_upper, **matrix16_lower;
-  Direction16_T **directions16_upper_nogap, **directions16_upper_Egap,
+  Dirbits_T **directions16_upper_nogap, **directions16_upper_Egap,
     **directions16_lower_nogap, **directions16_lower_Egap;
 #else
   Score32_T **matrix;
@@ -1354,6 +1355,8 @@ Dynprog_end5_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     return (List_T) NULL;
   } else if (endalign == QUERYEND_NOGAPS) {
     /* Don't shorten rlength */
+  } else if (xdrop > 0 && (endalign == QUERYEND_GAP || endalign == BEST_LOCAL)) {
+    /* Adaptive band is linear in length */
   } else if (rlength > dynprog->max_rlength) {
     debug6(printf("rlength %d is too long.  Chopping to %d\n",rlength,dynprog->max_rlength));
     rlength = dynprog->max_rlength;
@@ -1372,6 +1375,8 @@ Dynprog_end5_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     return (List_T) NULL;
   } else if (endalign == QUERYEND_NOGAPS) {
     /* Don't shorten glength */
+  } else if (xdrop > 0 && (endalign == QUERYEND_GAP || endalign == BEST_LOCAL)) {
+    /* Adaptive band is linear in length */
   } else if (glength > dynprog->max_glength) {
     debug6(printf("glength %d is too long.  Chopping to %d\n",glength,dynprog->max_glength));
     glength = dynprog->max_glength;
@@ -1407,7 +1412,13 @@ Dynprog_end5_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     return (List_T) NULL;
   }
 
-  if (endalign == QUERYEND_GAP || endalign == BEST_LOCAL) {
+  if (xdrop > 0 && (endalign == QUERYEND_GAP || endalign == BEST_LOCAL)) {
+    xdropspace = Dynprog_xdrop_fill(&finalscore,&bestr,&bestc,rev_rsequence,
+				    &(rev_gsequence[glength-1]),&(rev_gsequence_alt[glength-1]),
+				    rlength,glength,mismatchtype,open,extend,xdrop,
+				    /*for revp true*/!jump_late_p,/*revp*/true);
+
+  } else if (endalign == QUERYEND_GAP || endalign == BEST_LOCAL) {
     Dynprog_compute_bands(&lband,&uband,rlength,glength,extraband_end,/*widebandp*/true);
 #if defined(HAVE_SSE2)
     /* Use || because we want the minimum length (which determines the diagonal length) to achieve a score less than 128 */
@@ -1573,6 +1584,13 @@ Dynprog_end5_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     /* Can skip traceback */
     pairs = (List_T) NULL;
 
+  } else if (xdropspace != NULL) {
+    pairs = Dynprog_xdrop_traceback(NULL,&(*traceback_score),&(*nmatches),&(*nmismatches),&(*nopens),&(*nindels),
+				    xdropspace,bestr,bestc,rev_rsequence,rev_rsequenceuc,
+				    &(rev_gsequence[glength-1]),&(rev_gsequence_alt[glength-1]),
+				    rev_roffset,rev_goffset,genome,genomealt,pairpool,/*revp*/true,
+				    chroffset,chrhigh,watsonp,genestrand,*dynprogindex);
+
 #if defined(HAVE_SSE2)
   } else if (use8p == true) {
     if (bestc >= bestr) {
@@ -1637,6 +1655,7 @@ Dynprog_end5_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     Matrix_free(matrix);
   */
   
+  Dynprog_xdrop_free(&xdropspace);
   FREEA(rev_gsequence_alt);
   FREEA(rev_gsequence);
 
@@ -1669,11 +1688,11 @@ Dynprog_end5_splicejunction (int *dynprogindex, int *traceback_score, int *misss
 #if defined(HAVE_SSE2)
   bool use8p = false;
   Score8_T **matrix8_upper, **matrix8_lower;
-  Direction8_T **directions8_upper_nogap, **directions8_upper_Egap,
+  Dirbits_T **directions8_upper_nogap, **directions8_upper_Egap,
     **directions8_lower_nogap, **directions8_lower_Egap;
 
   Score16_T **matrix16_upper, **matrix16_lower;
-  Direction16_T **directions16_upper_nogap, **directions16_upper_Egap,
+  Dirbits_T **directions16_upper_nogap, **directions16_upper_Egap,
     **directions16_lower_nogap, **directions16_lower_Egap;
 #else
   Score32_T **matrix;
@@ -1937,15 +1956,16 @@ Dynprog_end3_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
   int bestr, bestc, lband, uband;
   int open, extend;
   int finalscore;
+  Dynprog_xdrop_T xdropspace = NULL;
 
 #if defined(HAVE_SSE2)
   bool use8p = false;
   Score8_T **matrix8_upper, **matrix8_lower;
-  Direction8_T **directions8_upper_nogap, **directions8_upper_Egap,
+  Dirbits_T **directions8_upper_nogap, **directions8_upper_Egap,
     **directions8_lower_nogap, **directions8_lower_Egap;
 
   Score16_T **matrix16_upper, **matrix16_lower;
-  Direction16_T **directions16_upper_nogap, **directions16_upper_Egap,
+  Dirbits_T **directions16_upper_nogap, **directions16_upper_Egap,
     **directions16_lower_nogap, **directions16_lower_Egap;
 #else
   Score32_T **matrix;
@@ -1983,6 +2003,8 @@ Dynprog_end3_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     return (List_T) NULL;
   } else if (endalign == QUERYEND_NOGAPS) {
     /* Don't shorten rlength */
+  } else if (xdrop > 0 && (endalign == QUERYEND_GAP || endalign == BEST_LOCAL)) {
+    /* Adaptive band is linear in length */
   } else if (rlength > dynprog->max_rlength) {
     debug6(printf("rlength %d is too long.  Chopping to %d\n",rlength,dynprog->max_rlength));
     rlength = dynprog->max_rlength;
@@ -1994,6 +2016,8 @@ Dynprog_end3_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     return (List_T) NULL;
   } else if (endalign == QUERYEND_NOGAPS) {
     /* Don't shorten glength */
+  } else if (xdrop > 0 && (endalign == QUERYEND_GAP || endalign == BEST_LOCAL)) {
+    /* Adaptive band is linear in length */
   } else if (glength > dynprog->max_glength) {
     debug6(printf("glength %d is too long.  Chopping to %d\n",glength,dynprog->max_glength));
     glength = dynprog->max_glength;
@@ -2024,7 +2048,12 @@ Dynprog_end3_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     return (List_T) NULL;
   }
 
-  if (endalign == QUERYEND_GAP || endalign == BEST_LOCAL) {
+  if (xdrop > 0 && (endalign == QUERYEND_GAP || endalign == BEST_LOCAL)) {
+    xdropspace = Dynprog_xdrop_fill(&finalscore,&bestr,&bestc,rsequenceuc,gsequence,gsequence_alt,
+				    rlength,glength,mismatchtype,open,extend,xdrop,
+				    jump_late_p,/*revp*/false);
+
+  } else if (endalign == QUERYEND_GAP || endalign == BEST_LOCAL) {
     Dynprog_compute_bands(&lband,&uband,rlength,glength,extraband_end,/*widebandp*/true);
 #if defined(HAVE_SSE2)
     /* Use || because we want the minimum length (which determines the diagonal length) to achieve a score less than 128 */
@@ -2172,6 +2201,12 @@ Dynprog_end3_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     /* Can skip traceback */
     pairs = (List_T) NULL;
     
+  } else if (xdropspace != NULL) {
+    pairs = Dynprog_xdrop_traceback(NULL,&(*traceback_score),&(*nmatches),&(*nmismatches),&(*nopens),&(*nindels),
+				    xdropspace,bestr,bestc,rsequence,rsequenceuc,gsequence,gsequence_alt,
+				    roffset,goffset,genome,genomealt,pairpool,/*revp*/false,
+				    chroffset,chrhigh,watsonp,genestrand,*dynprogindex);
+
 #if defined(HAVE_SSE2)
   } else if (use8p == true) {
     if (bestc >= bestr) {
@@ -2234,6 +2269,7 @@ Dynprog_end3_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *n
     Matrix_free(matrix);
   */
 
+  Dynprog_xdrop_free(&xdropspace);
   FREEA(gsequence_alt);
   FREEA(gsequence);
 
@@ -2265,11 +2301,11 @@ Dynprog_end3_splicejunction (int *dynprogindex, int *traceback_score, int *misss
 #if defined(HAVE_SSE2)
   bool use8p = false;
   Score8_T **matrix8_upper, **matrix8_lower;
-  Direction8_T **directions8_upper_nogap, **directions8_upper_Egap,
+  Dirbits_T **directions8_upper_nogap, **directions8_upper_Egap,
     **directions8_lower_nogap, **directions8_lower_Egap;
 
   Score16_T **matrix16_upper, **matrix16_lower;
-  Direction16_T **directions16_upper_nogap, **directions16_upper_Egap,
+  Dirbits_T **directions16_upper_nogap, **directions16_upper_Egap,
     **directions16_lower_nogap, **directions16_lower_Egap;
 #else
   Score32_T **matrix;
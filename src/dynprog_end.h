@@ -19,7 +19,8 @@ Dynprog_end_setup (Univcoord_T *splicesites_in, Splicetype_T *splicetypes_in,
 		   Chrpos_T *splicedists_in, int nsplicesites_in,
 		   Trieoffset_T *trieoffsets_obs_in, Triecontent_T *triecontents_obs_in,
 		   Trieoffset_T *trieoffsets_max_in, Triecontent_T *triecontents_max_in,
-		   int user_open_in, int user_extend_in, bool user_dynprog_p_in);
+		   int user_open_in, int user_extend_in, bool user_dynprog_p_in,
+		   int xdrop_in);
 
 
 extern List_T
@@ -25,6 +25,11 @@ static char rcsid[] = "$Id: dynprog_genome.c 225439 2022-12-08 17:36:36Z twu $";
 #include "dynprog.h"		/* For parameters */
 #include "dynprog_simd.h"
 #include "scores.h"
+#include "simd.h"
+
+#ifdef DYNPROG_GENOME_BENCH
+#include <time.h>
+#endif
 
 
 #ifdef DEBUG
@@ -187,6 +192,32 @@ intron_score_setup () {
 }
 
 
+#ifdef DYNPROG_GENOME_BENCH
+/* For "make dynprog_genome_bench", which builds GMAP with every gap
+   closure timed in thread CPU time, so that the rate can be compared
+   between versions on the same cDNA reads.  The totals are printed
+   when the program exits.  Run with -t 1 for a per-thread rate. */
+static unsigned long long bench_nclosures = 0;
+static unsigned long long bench_nsec = 0;
+
+static unsigned long long
+bench_thread_nsec () {
+  struct timespec ts;
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID,&ts);
+  return (unsigned long long) ts.tv_sec * 1000000000ULL + (unsigned long long) ts.tv_nsec;
+}
+
+static void
+bench_report () {
+  double seconds = (double) bench_nsec/1.0e9;
+
+  fprintf(stderr,"Dynprog_genome_gap: %llu gap closures in %.3f sec (%.0f closures/sec)\n",
+	  bench_nclosures,seconds,(seconds > 0.0) ? (double) bench_nclosures/seconds : 0.0);
+  return;
+}
+#endif
+
 
 void
 Dynprog_genome_setup (bool novelsplicingp_in,
@@ -211,6 +242,10 @@ Dynprog_genome_setup (bool novelsplicingp_in,
 
   intron_score_setup();
 
+#ifdef DYNPROG_GENOME_BENCH
+  atexit(bench_report);
+#endif
+
   return;
 }
 
@@ -610,14 +645,183 @@ get_known_splicesites (int *left_known, int *right_known, int glengthL, int glen
 }
 
 
+#if defined(HAVE_SSE2)
+/* Candidate scan for the site-level intron searches.  For one fixed
+   splice site on a given row, each candidate site c on the other side
+   scores fixedscore + bonus[c] + its matrix score, where bonus[c] is
+   the intron score of the dinucleotide pair.  The maximum over the
+   contiguous lower-matrix part of the row is found with SIMD, and only
+   when it can improve the best so far are the candidates revisited in
+   order to break ties by splice-site probability, giving the same
+   result as testing each candidate in turn. */
+
+#define NDINUCL_CLASSES 5
+#define NO_CANDIDATE (-1000000)
+
+static int
+leftdi_class (int leftdi) {
+  switch (leftdi) {
+  case LEFT_GT: return 1;
+  case LEFT_GC: return 2;
+  case LEFT_AT: return 3;
+  case LEFT_CT: return 4;
+  default: return 0;
+  }
+}
+
+static int
+rightdi_class (int rightdi) {
+  switch (rightdi) {
+  case RIGHT_AG: return 1;
+  case RIGHT_AC: return 2;
+  case RIGHT_GC: return 3;
+  case RIGHT_AT: return 4;
+  default: return 0;
+  }
+}
+
+/* Returns the intron score of each candidate site c < ncols against
+   a fixed site with dinucleotide fixeddi in class k.  Other sites of
+   the same class share the array, which is filled on first use. */
+static int *
+intron_bonus (int **bonus, int *storage, int k, int fixeddi, int *di, int ncols,
+	      int *intron_score_array) {
+  int c;
+
+  if (bonus[k] == NULL) {
+    bonus[k] = &(storage[k * ncols]);
+    for (c = 0; c < ncols; c++) {
+#ifdef USE_SCOREI
+      bonus[k][c] = intron_score_array[fixeddi & di[c]];
+#else
+      bonus[k][c] = 0;
+#endif
+    }
+  }
+  return bonus[k];
+}
+
+#if defined(HAVE_AVX2)
+static int
+hmax_256 (__m256i _x) {
+  __m128i _y;
+
+  _y = _mm_max_epi32(_mm256_castsi256_si128(_x),_mm256_extracti128_si256(_x,1));
+  _y = _mm_max_epi32(_y,_mm_shuffle_epi32(_y,_MM_SHUFFLE(1,0,3,2)));
+  _y = _mm_max_epi32(_y,_mm_shuffle_epi32(_y,_MM_SHUFFLE(2,3,0,1)));
+  return _mm_cvtsi128_si32(_y);
+}
+#elif defined(HAVE_SSE4_1)
+static int
+hmax_128 (__m128i _y) {
+  _y = _mm_max_epi32(_y,_mm_shuffle_epi32(_y,_MM_SHUFFLE(1,0,3,2)));
+  _y = _mm_max_epi32(_y,_mm_shuffle_epi32(_y,_MM_SHUFFLE(2,3,0,1)));
+  return _mm_cvtsi128_si32(_y);
+}
+#endif
+
+/* Returns max of bonus[c] + row[c] over [start,end), or NO_CANDIDATE */
+static int
+max_candidate_8 (int *bonus, Score8_T *row, int start, int end) {
+  int best = NO_CANDIDATE, c = start;
+#if defined(HAVE_AVX2)
+  __m256i _best, _x;
+
+  if (c + 8 <= end) {
+    _best = _mm256_set1_epi32(NO_CANDIDATE);
+    for ( ; c + 8 <= end; c += 8) {
+      _x = _mm256_cvtepi8_epi32(_mm_loadl_epi64((__m128i *) &(row[c])));
+      _x = _mm256_add_epi32(_x,_mm256_loadu_si256((__m256i *) &(bonus[c])));
+      _best = _mm256_max_epi32(_best,_x);
+    }
+    best = hmax_256(_best);
+  }
+#elif defined(HAVE_SSE4_1)
+  __m128i _best, _x;
+
+  if (c + 4 <= end) {
+    _best = _mm_set1_epi32(NO_CANDIDATE);
+    for ( ; c + 4 <= end; c += 4) {
+      _x = _mm_cvtepi8_epi32(_mm_cvtsi32_si128(*((int *) &(row[c]))));
+      _x = _mm_add_epi32(_x,_mm_loadu_si128((__m128i *) &(bonus[c])));
+      _best = _mm_max_epi32(_best,_x);
+    }
+    best = hmax_128(_best);
+  }
+#endif
+
+  for ( ; c < end; c++) {
+    if (bonus[c] + (int) row[c] > best) {
+      best = bonus[c] + (int) row[c];
+    }
+  }
+  return best;
+}
+
+/* Returns max of bonus[c] + row[c] over [start,end), or NO_CANDIDATE */
+static int
+max_candidate_16 (int *bonus, Score16_T *row, int start, int end) {
+  int best = NO_CANDIDATE, c = start;
+#if defined(HAVE_AVX2)
+  __m256i _best, _x;
+
+  if (c + 8 <= end) {
+    _best = _mm256_set1_epi32(NO_CANDIDATE);
+    for ( ; c + 8 <= end; c += 8) {
+      _x = _mm256_cvtepi16_epi32(_mm_loadu_si128((__m128i *) &(row[c])));
+      _x = _mm256_add_epi32(_x,_mm256_loadu_si256((__m256i *) &(bonus[c])));
+      _best = _mm256_max_epi32(_best,_x);
+    }
+    best = hmax_256(_best);
+  }
+#elif defined(HAVE_SSE4_1)
+  __m128i _best, _x;
+
+  if (c + 4 <= end) {
+    _best = _mm_set1_epi32(NO_CANDIDATE);
+    for ( ; c + 4 <= end; c += 4) {
+      _x = _mm_cvtepi16_epi32(_mm_loadl_epi64((__m128i *) &(row[c])));
+      _x = _mm_add_epi32(_x,_mm_loadu_si128((__m128i *) &(bonus[c])));
+      _best = _mm_max_epi32(_best,_x);
+    }
+    best = hmax_128(_best);
+  }
+#endif
+
+  for ( ; c < end; c++) {
+    if (bonus[c] + (int) row[c] > best) {
+      best = bonus[c] + (int) row[c];
+    }
+  }
+  return best;
+}
+
+/* Same test as the scalar loops: a higher score, or the same score
+   with a higher probability */
+static bool
+better_candidate_p (int *bestscore, double *bestprob, int score, double prob) {
+  if (score > *bestscore) {
+    *bestscore = score;
+    *bestprob = prob;
+    return true;
+  } else if (score == *bestscore && prob > *bestprob) {
+    *bestprob = prob;
+    return true;
+  } else {
+    return false;
+  }
+}
+#endif
+
+
 #if defined(HAVE_SSE2)
 /* Returns finalscore */
 static int
 bridge_intron_gap_8_intron_level (int *bestrL, int *bestrR, int *bestcL, int *bestcR, int *best_introntype,
 				  Score8_T **matrixL_upper, Score8_T **matrixL_lower,
 				  Score8_T **matrixR_upper, Score8_T **matrixR_lower,
-				  Direction8_T **directionsL_upper_nogap, Direction8_T **directionsL_lower_nogap, 
-				  Direction8_T **directionsR_upper_nogap, Direction8_T **directionsR_lower_nogap,
+				  Dirbits_T **directionsL_upper_nogap, Dirbits_T **directionsL_lower_nogap, 
+				  Dirbits_T **directionsR_upper_nogap, Dirbits_T **directionsR_lower_nogap,
 				  int *left_known, int *right_known,
 				  int rlength, int glengthL, int glengthR,
 				  int cdna_direction, bool watsonp, int lbandL, int ubandL, int lbandR, int ubandR,
@@ -868,8 +1072,8 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
 				Score8_T **matrixL_upper, Score8_T **matrixL_lower,
 				Score8_T **matrixR_upper, Score8_T **matrixR_lower,
 #if 0
-				Direction8_T **directionsL_upper_nogap, Direction8_T **directionsL_lower_nogap, 
-				Direction8_T **directionsR_upper_nogap, Direction8_T **directionsR_lower_nogap,
+				Dirbits_T **directionsL_upper_nogap, Dirbits_T **directionsL_lower_nogap, 
+				Dirbits_T **directionsR_upper_nogap, Dirbits_T **directionsR_lower_nogap,
 				int goffsetL, int rev_goffsetR, int canonical_reward,
 #endif
 				char *gsequenceL, char *gsequenceL_alt, char *rev_gsequenceR, char *rev_gsequenceR_alt,
@@ -888,6 +1092,9 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
   Univcoord_T splicesitepos;
   char left1, left2, right2, right1, left1_alt, left2_alt, right2_alt, right1_alt;
   int *leftdi, *rightdi;
+  int *intronL[NDINUCL_CLASSES], *intronR[NDINUCL_CLASSES], *intronL_storage, *intronR_storage;
+  int *bonus, maxscore;
+  int k, cend, cend_upper, ncolsL, ncolsR;
   bool use_dinucl_p;
 
   int *intron_score_array;
@@ -966,6 +1173,20 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
   }
   rightdi[glengthR-1] = rightdi[glengthR] = 0x00;
 
+  /* Candidate sites lie within the band, so splice-site probabilities
+     and intron bonuses are needed only up to the last row plus uband.
+     The per-class intron bonus arrays are filled on first use. */
+  if ((ncolsL = rlength + ubandL) > glengthL - 1) {
+    ncolsL = glengthL - 1;
+  }
+  if ((ncolsR = rlength + ubandR) > glengthR - 1) {
+    ncolsR = glengthR - 1;
+  }
+  intronL_storage = (int *) MALLOCA(NDINUCL_CLASSES * ncolsL * sizeof(int));
+  intronR_storage = (int *) MALLOCA(NDINUCL_CLASSES * ncolsR * sizeof(int));
+  for (k = 0; k < NDINUCL_CLASSES; k++) {
+    intronL[k] = intronR[k] = (int *) NULL;
+  }
 
   left_probabilities = (double *) MALLOCA(glengthL * sizeof(double));
   right_probabilities = (double *) MALLOCA(glengthR * sizeof(double));
@@ -973,7 +1194,7 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
   debug3(printf("watsonp is %d.  cdna_direction is %d\n",watsonp,cdna_direction));
   if (watsonp == true) {
     if (cdna_direction > 0) {
-      for (cL = 0; cL < glengthL - 1; cL++) {
+      for (cL = 0; cL < ncolsL; cL++) {
 	splicesitepos = chroffset + leftoffset + cL;
 	if (left_known[cL]) {
 	  left_probabilities[cL] = 1.0;
@@ -983,7 +1204,7 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
 	}
       }
 
-      for (cR = 0; cR < glengthR - 1; cR++) {
+      for (cR = 0; cR < ncolsR; cR++) {
 	splicesitepos = chroffset + rightoffset - cR + 1;
 	if (right_known[cR]) {
 	  right_probabilities[cR] = 1.0;
@@ -994,7 +1215,7 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
       }
 
     } else {
-      for (cL = 0; cL < glengthL - 1; cL++) {
+      for (cL = 0; cL < ncolsL; cL++) {
 	splicesitepos = chroffset + leftoffset + cL;
 	if (left_known[cL]) {
 	  left_probabilities[cL] = 1.0;
@@ -1004,7 +1225,7 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
 	}
       }
 
-      for (cR = 0; cR < glengthR - 1; cR++) {
+      for (cR = 0; cR < ncolsR; cR++) {
 	splicesitepos = chroffset + rightoffset - cR + 1;
 	if (right_known[cR]) {
 	  right_probabilities[cR] = 1.0;
@@ -1017,7 +1238,7 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
 
   } else {
     if (cdna_direction > 0) {
-      for (cL = 0; cL < glengthL - 1; cL++) {
+      for (cL = 0; cL < ncolsL; cL++) {
 	splicesitepos = chrhigh - leftoffset - cL + 1;
 	if (left_known[cL]) {
 	  left_probabilities[cL] = 1.0;
@@ -1027,7 +1248,7 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
 	}
       }
 
-      for (cR = 0; cR < glengthR - 1; cR++) {
+      for (cR = 0; cR < ncolsR; cR++) {
 	splicesitepos = chrhigh - rightoffset + cR;
 	if (right_known[cR]) {
 	  right_probabilities[cR] = 1.0;
@@ -1038,7 +1259,7 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
       }
 
     } else {
-      for (cL = 0; cL < glengthL - 1; cL++) {
+      for (cL = 0; cL < ncolsL; cL++) {
 	splicesitepos = chrhigh - leftoffset - cL + 1;
 	if (left_known[cL]) {
 	  left_probabilities[cL] = 1.0;
@@ -1048,7 +1269,7 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
 	}
       }
 
-      for (cR = 0; cR < glengthR - 1; cR++) {
+      for (cR = 0; cR < ncolsR; cR++) {
 	splicesitepos = chrhigh - rightoffset + cR;
 	if (right_known[cR]) {
 	  right_probabilities[cR] = 1.0;
@@ -1147,90 +1368,40 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
 #endif
 
     /* Disallow leftoffset + cL >= rightoffset - cR, or cR >= rightoffset - leftoffset - cL */
-    for (cR = cloR; cR < /*to main diagonal*/rR && cR < rightoffset-leftoffset-cL; cR++) {
-      probR = right_probabilities[cR];
-      scoreR = (int) matrixR_lower[rR][cR];
-#if 0
-      if (directionsR_lower_nogap[rR][cR] != DIAG) {
-	/* Favor gaps away from intron if possible */
-	scoreR -= 100;
-      }
-#endif
-	
-#ifdef USE_SCOREI
-      /* scoreI = intron_score(&introntype,leftdi[cL],rightdi[cR],cdna_direction,canonical_reward,finalp); */
-      scoreI = intron_score_array[leftdi[cL] & rightdi[cR]];
-#else
-      scoreI = 0;
-#endif
-	
-      if ((score = scoreL + scoreI + scoreR) > bestscore) {
-	debug3(printf("Best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	bestscore = score;
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else if (score == bestscore && probL + probR > bestprob_with_score) {
-	debug3(printf("Improved prob: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else {
-	debug3a(printf("Not best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		       cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3a(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
+    if ((cend = /*to main diagonal*/rR) > rightoffset-leftoffset-cL) {
+      cend = rightoffset-leftoffset-cL;
+    }
+    if ((cend_upper = chighR) > rightoffset-leftoffset-cL) {
+      cend_upper = rightoffset-leftoffset-cL;
+    }
+    bonus = intron_bonus(intronR,intronR_storage,leftdi_class(leftdi[cL]),leftdi[cL],rightdi,ncolsR,intron_score_array);
+    maxscore = max_candidate_8(bonus,matrixR_lower[rR],cloR,cend);
+    for (/*skip main diagonal*/cR = rR + 1; cR < cend_upper; cR++) {
+      if ((score = bonus[cR] + (int) matrixR_upper[cR][rR]) > maxscore) {
+	maxscore = score;
       }
     }
 
-    debug3(printf("Skip main diagonal\n"));
-    for (/*skip main diagonal*/cR++; cR < chighR && cR < rightoffset-leftoffset-cL; cR++) {
-      probR = right_probabilities[cR];
-      scoreR = (int) matrixR_upper[cR][rR];
-#if 0
-      if (directionsR_upper_nogap[cR][rR] != DIAG) {
-	/* Favor gaps away from intron if possible */
-	scoreR -= 100;
+    if ((maxscore += scoreL) >= bestscore) {
+      for (cR = cloR; cR < cend; cR++) {
+	if (scoreL + bonus[cR] + (int) matrixR_lower[rR][cR] == maxscore &&
+	    better_candidate_p(&bestscore,&bestprob_with_score,maxscore,probL + right_probabilities[cR]) == true) {
+	  debug3(printf("Best score: At %d left to %d right, score is %d (prob %f)\n",cL,cR,bestscore,bestprob_with_score));
+	  *bestrL = rL;
+	  *bestrR = rR;
+	  *bestcL = cL;
+	  *bestcR = cR;
+	}
       }
-#endif
-	
-#ifdef USE_SCOREI
-      /* scoreI = intron_score(&introntype,leftdi[cL],rightdi[cR],cdna_direction,canonical_reward,finalp); */
-      scoreI = intron_score_array[leftdi[cL] & rightdi[cR]];
-#else
-      scoreI = 0;
-#endif
-	
-      if ((score = scoreL + scoreI + scoreR) > bestscore) {
-	debug3(printf("Best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	bestscore = score;
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else if (score == bestscore && probL + probR > bestprob_with_score) {
-	debug3(printf("Improved prob: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else {
-	debug3a(printf("Not best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		       cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3a(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
+      for (cR = rR + 1; cR < cend_upper; cR++) {
+	if (scoreL + bonus[cR] + (int) matrixR_upper[cR][rR] == maxscore &&
+	    better_candidate_p(&bestscore,&bestprob_with_score,maxscore,probL + right_probabilities[cR]) == true) {
+	  debug3(printf("Best score: At %d left to %d right, score is %d (prob %f)\n",cL,cR,bestscore,bestprob_with_score));
+	  *bestrL = rL;
+	  *bestrR = rR;
+	  *bestcL = cL;
+	  *bestcR = cR;
+	}
       }
     }
 
@@ -1247,90 +1418,40 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
 #endif
 
     /* Disallow leftoffset + cL >= rightoffset - cR, or cR >= rightoffset - leftoffset - cL */
-    for (cL = cloL; cL < /*to main diagonal*/rL && cL < rightoffset-leftoffset-cR; cL++) {
-      probL = left_probabilities[cL];
-      scoreL = (int) matrixL_lower[rL][cL];
-#if 0
-      if (directionsL_lower_nogap[rL][cL] != DIAG) {
-	/* Favor gaps away from intron if possible */
-	scoreL -= 100;
-      }
-#endif
-
-#ifdef USE_SCOREI
-      /* scoreI = intron_score(&introntype,leftdi[cL],rightdi[cR],cdna_direction,canonical_reward,finalp); */
-      scoreI = intron_score_array[leftdi[cL] & rightdi[cR]];
-#else
-      scoreI = 0;
-#endif
-
-      if ((score = scoreL + scoreI + scoreR) > bestscore) {
-	debug3(printf("Best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	bestscore = score;
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else if (score == bestscore && probL + probR > bestprob_with_score) {
-	debug3(printf("Improved prob: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else {
-	debug3a(printf("Not best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		       cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3a(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
+    if ((cend = /*to main diagonal*/rL) > rightoffset-leftoffset-cR) {
+      cend = rightoffset-leftoffset-cR;
+    }
+    if ((cend_upper = chighL) > rightoffset-leftoffset-cR) {
+      cend_upper = rightoffset-leftoffset-cR;
+    }
+    bonus = intron_bonus(intronL,intronL_storage,rightdi_class(rightdi[cR]),rightdi[cR],leftdi,ncolsL,intron_score_array);
+    maxscore = max_candidate_8(bonus,matrixL_lower[rL],cloL,cend);
+    for (/*skip main diagonal*/cL = rL + 1; cL < cend_upper; cL++) {
+      if ((score = bonus[cL] + (int) matrixL_upper[cL][rL]) > maxscore) {
+	maxscore = score;
       }
     }
 
-    debug3(printf("Skip main diagonal\n"));
-    for (/*Skip main diagonal*/cL++; cL < chighL && cL < rightoffset-leftoffset-cR; cL++) {
-      probL = left_probabilities[cL];
-      scoreL = (int) matrixL_upper[cL][rL];
-#if 0
-      if (directionsL_upper_nogap[cL][rL] != DIAG) {
-	/* Favor gaps away from intron if possible */
-	scoreL -= 100;
+    if ((maxscore += scoreR) >= bestscore) {
+      for (cL = cloL; cL < cend; cL++) {
+	if (scoreR + bonus[cL] + (int) matrixL_lower[rL][cL] == maxscore &&
+	    better_candidate_p(&bestscore,&bestprob_with_score,maxscore,left_probabilities[cL] + probR) == true) {
+	  debug3(printf("Best score: At %d left to %d right, score is %d (prob %f)\n",cL,cR,bestscore,bestprob_with_score));
+	  *bestrL = rL;
+	  *bestrR = rR;
+	  *bestcL = cL;
+	  *bestcR = cR;
+	}
       }
-#endif
-
-#ifdef USE_SCOREI
-      /* scoreI = intron_score(&introntype,leftdi[cL],rightdi[cR],cdna_direction,canonical_reward,finalp); */
-      scoreI = intron_score_array[leftdi[cL] & rightdi[cR]];
-#else
-      scoreI = 0;
-#endif
-
-      if ((score = scoreL + scoreI + scoreR) > bestscore) {
-	debug3(printf("Best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	bestscore = score;
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else if (score == bestscore && probL + probR > bestprob_with_score) {
-	debug3(printf("Improved prob: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else {
-	debug3a(printf("Not best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		       cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3a(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
+      for (cL = rL + 1; cL < cend_upper; cL++) {
+	if (scoreR + bonus[cL] + (int) matrixL_upper[cL][rL] == maxscore &&
+	    better_candidate_p(&bestscore,&bestprob_with_score,maxscore,left_probabilities[cL] + probR) == true) {
+	  debug3(printf("Best score: At %d left to %d right, score is %d (prob %f)\n",cL,cR,bestscore,bestprob_with_score));
+	  *bestrL = rL;
+	  *bestrR = rR;
+	  *bestcL = cL;
+	  *bestcR = cR;
+	}
       }
     }
   }
@@ -1367,6 +1488,8 @@ bridge_intron_gap_8_site_level (int *bestrL, int *bestrR, int *bestcL, int *best
     bestscore = bestscore_with_dinucl;
   }
     
+  FREEA(intronR_storage);
+  FREEA(intronL_storage);
   FREEA(rightdi);
   FREEA(leftdi);
   FREEA(left_probabilities);
@@ -1389,8 +1512,8 @@ bridge_intron_gap_8_ud (int *bestrL, int *bestrR, int *bestcL, int *bestcR,
 			int *best_introntype, double *left_prob, double *right_prob,
 			Score8_T **matrixL_upper, Score8_T **matrixL_lower,
 			Score8_T **matrixR_upper, Score8_T **matrixR_lower,
-			Direction8_T **directionsL_upper_nogap, Direction8_T **directionsL_lower_nogap, 
-			Direction8_T **directionsR_upper_nogap, Direction8_T **directionsR_lower_nogap,
+			Dirbits_T **directionsL_upper_nogap, Dirbits_T **directionsL_lower_nogap, 
+			Dirbits_T **directionsR_upper_nogap, Dirbits_T **directionsR_lower_nogap,
 			char *gsequenceL, char *gsequenceL_alt, char *rev_gsequenceR, char *rev_gsequenceR_alt,
 			int goffsetL, int rev_goffsetR, int rlength, int glengthL, int glengthR,
 			int cdna_direction, bool watsonp, int lbandL, int ubandL, int lbandR, int ubandR,
@@ -1491,8 +1614,8 @@ bridge_intron_gap_16_intron_level (int *bestrL, int *bestrR, int *bestcL, int *b
 				  int *best_introntype,
 				  Score16_T **matrixL_upper, Score16_T **matrixL_lower,
 				  Score16_T **matrixR_upper, Score16_T **matrixR_lower,
-				  Direction16_T **directionsL_upper_nogap, Direction16_T **directionsL_lower_nogap, 
-				  Direction16_T **directionsR_upper_nogap, Direction16_T **directionsR_lower_nogap,
+				  Dirbits_T **directionsL_upper_nogap, Dirbits_T **directionsL_lower_nogap, 
+				  Dirbits_T **directionsR_upper_nogap, Dirbits_T **directionsR_lower_nogap,
 				  int *left_known, int *right_known,
 				  int rlength, int glengthL, int glengthR,
 				  int cdna_direction, bool watsonp, int lbandL, int ubandL, int lbandR, int ubandR,
@@ -1743,8 +1866,8 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
 				 Score16_T **matrixL_upper, Score16_T **matrixL_lower,
 				 Score16_T **matrixR_upper, Score16_T **matrixR_lower,
 #if 0
-				 Direction16_T **directionsL_upper_nogap, Direction16_T **directionsL_lower_nogap, 
-				 Direction16_T **directionsR_upper_nogap, Direction16_T **directionsR_lower_nogap,
+				 Dirbits_T **directionsL_upper_nogap, Dirbits_T **directionsL_lower_nogap, 
+				 Dirbits_T **directionsR_upper_nogap, Dirbits_T **directionsR_lower_nogap,
 				 int goffsetL, int rev_goffsetR, int canonical_reward,
 #endif
 				 char *gsequenceL, char *gsequenceL_alt, char *rev_gsequenceR, char *rev_gsequenceR_alt,
@@ -1763,6 +1886,9 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
   Univcoord_T splicesitepos;
   char left1, left2, right2, right1, left1_alt, left2_alt, right2_alt, right1_alt;
   int *leftdi, *rightdi;
+  int *intronL[NDINUCL_CLASSES], *intronR[NDINUCL_CLASSES], *intronL_storage, *intronR_storage;
+  int *bonus, maxscore;
+  int k, cend, cend_upper, ncolsL, ncolsR;
   bool use_dinucl_p;
 
   int *intron_score_array;
@@ -1842,6 +1968,20 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
   }
   rightdi[glengthR-1] = rightdi[glengthR] = 0x00;
 
+  /* Candidate sites lie within the band, so splice-site probabilities
+     and intron bonuses are needed only up to the last row plus uband.
+     The per-class intron bonus arrays are filled on first use. */
+  if ((ncolsL = rlength + ubandL) > glengthL - 1) {
+    ncolsL = glengthL - 1;
+  }
+  if ((ncolsR = rlength + ubandR) > glengthR - 1) {
+    ncolsR = glengthR - 1;
+  }
+  intronL_storage = (int *) MALLOCA(NDINUCL_CLASSES * ncolsL * sizeof(int));
+  intronR_storage = (int *) MALLOCA(NDINUCL_CLASSES * ncolsR * sizeof(int));
+  for (k = 0; k < NDINUCL_CLASSES; k++) {
+    intronL[k] = intronR[k] = (int *) NULL;
+  }
 
   left_probabilities = (double *) MALLOCA(glengthL * sizeof(double));
   right_probabilities = (double *) MALLOCA(glengthR * sizeof(double));
@@ -1849,7 +1989,7 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
   debug3(printf("watsonp is %d.  cdna_direction is %d\n",watsonp,cdna_direction));
   if (watsonp == true) {
     if (cdna_direction > 0) {
-      for (cL = 0; cL < glengthL - 1; cL++) {
+      for (cL = 0; cL < ncolsL; cL++) {
 	splicesitepos = chroffset + leftoffset + cL;
 	if (left_known[cL]) {
 	  left_probabilities[cL] = 1.0;
@@ -1859,7 +1999,7 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
 	}
       }
 
-      for (cR = 0; cR < glengthR - 1; cR++) {
+      for (cR = 0; cR < ncolsR; cR++) {
 	splicesitepos = chroffset + rightoffset - cR + 1;
 	if (right_known[cR]) {
 	  right_probabilities[cR] = 1.0;
@@ -1870,7 +2010,7 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
       }
 
     } else {
-      for (cL = 0; cL < glengthL - 1; cL++) {
+      for (cL = 0; cL < ncolsL; cL++) {
 	splicesitepos = chroffset + leftoffset + cL;
 	if (left_known[cL]) {
 	  left_probabilities[cL] = 1.0;
@@ -1880,7 +2020,7 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
 	}
       }
 
-      for (cR = 0; cR < glengthR - 1; cR++) {
+      for (cR = 0; cR < ncolsR; cR++) {
 	splicesitepos = chroffset + rightoffset - cR + 1;
 	if (right_known[cR]) {
 	  right_probabilities[cR] = 1.0;
@@ -1893,7 +2033,7 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
 
   } else {
     if (cdna_direction > 0) {
-      for (cL = 0; cL < glengthL - 1; cL++) {
+      for (cL = 0; cL < ncolsL; cL++) {
 	splicesitepos = chrhigh - leftoffset - cL + 1;
 	if (left_known[cL]) {
 	  left_probabilities[cL] = 1.0;
@@ -1903,7 +2043,7 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
 	}
       }
 
-      for (cR = 0; cR < glengthR - 1; cR++) {
+      for (cR = 0; cR < ncolsR; cR++) {
 	splicesitepos = chrhigh - rightoffset + cR;
 	if (right_known[cR]) {
 	  right_probabilities[cR] = 1.0;
@@ -1914,7 +2054,7 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
       }
 
     } else {
-      for (cL = 0; cL < glengthL - 1; cL++) {
+      for (cL = 0; cL < ncolsL; cL++) {
 	splicesitepos = chrhigh - leftoffset - cL + 1;
 	if (left_known[cL]) {
 	  left_probabilities[cL] = 1.0;
@@ -1924,7 +2064,7 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
 	}
       }
 
-      for (cR = 0; cR < glengthR - 1; cR++) {
+      for (cR = 0; cR < ncolsR; cR++) {
 	splicesitepos = chrhigh - rightoffset + cR;
 	if (right_known[cR]) {
 	  right_probabilities[cR] = 1.0;
@@ -2023,88 +2163,40 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
 #endif
 
     /* Disallow leftoffset + cL >= rightoffset - cR, or cR >= rightoffset - leftoffset - cL */
-    for (cR = cloR; cR < /*to main diagonal*/rR && cR < rightoffset-leftoffset-cL; cR++) {
-      probR = right_probabilities[cR];
-      scoreR = (int) matrixR_lower[rR][cR];
-#if 0
-      if (directionsR_lower_nogap[rR][cR] != DIAG) {
-	/* Favor gaps away from intron if possible */
-	scoreR -= 100;
-      }
-#endif
-	
-#ifdef USE_SCOREI
-      /* scoreI = intron_score(&introntype,leftdi[cL],rightdi[cR],cdna_direction,canonical_reward,finalp); */
-      scoreI = intron_score_array[leftdi[cL] & rightdi[cR]];
-#else
-      scoreI = 0;
-#endif
-	
-      if ((score = scoreL + scoreI + scoreR) > bestscore) {
-	debug3(printf("Best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	bestscore = score;
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else if (score == bestscore && probL + probR > bestprob_with_score) {
-	debug3(printf("Improved prob: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else {
-	debug3a(printf("Not best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		       cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
+    if ((cend = /*to main diagonal*/rR) > rightoffset-leftoffset-cL) {
+      cend = rightoffset-leftoffset-cL;
+    }
+    if ((cend_upper = chighR) > rightoffset-leftoffset-cL) {
+      cend_upper = rightoffset-leftoffset-cL;
+    }
+    bonus = intron_bonus(intronR,intronR_storage,leftdi_class(leftdi[cL]),leftdi[cL],rightdi,ncolsR,intron_score_array);
+    maxscore = max_candidate_16(bonus,matrixR_lower[rR],cloR,cend);
+    for (/*skip main diagonal*/cR = rR + 1; cR < cend_upper; cR++) {
+      if ((score = bonus[cR] + (int) matrixR_upper[cR][rR]) > maxscore) {
+	maxscore = score;
       }
     }
 
-    debug3(printf("Skip main diagonal\n"));
-    for (/*Skip main diagonal*/cR++; cR < chighR && cR < rightoffset-leftoffset-cL; cR++) {
-      probR = right_probabilities[cR];
-      scoreR = (int) matrixR_upper[cR][rR];
-#if 0
-      if (directionsR_upper_nogap[cR][rR] != DIAG) {
-	/* Favor gaps away from intron if possible */
-	scoreR -= 100;
+    if ((maxscore += scoreL) >= bestscore) {
+      for (cR = cloR; cR < cend; cR++) {
+	if (scoreL + bonus[cR] + (int) matrixR_lower[rR][cR] == maxscore &&
+	    better_candidate_p(&bestscore,&bestprob_with_score,maxscore,probL + right_probabilities[cR]) == true) {
+	  debug3(printf("Best score: At %d left to %d right, score is %d (prob %f)\n",cL,cR,bestscore,bestprob_with_score));
+	  *bestrL = rL;
+	  *bestrR = rR;
+	  *bestcL = cL;
+	  *bestcR = cR;
+	}
       }
-#endif
-	
-#ifdef USE_SCOREI
-      /* scoreI = intron_score(&introntype,leftdi[cL],rightdi[cR],cdna_direction,canonical_reward,finalp); */
-      scoreI = intron_score_array[leftdi[cL] & rightdi[cR]];
-#else
-      scoreI = 0;
-#endif
-	
-      if ((score = scoreL + scoreI + scoreR) > bestscore) {
-	debug3(printf("Best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	bestscore = score;
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else if (score == bestscore && probL + probR > bestprob_with_score) {
-	debug3(printf("Improved prob: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else {
-	debug3a(printf("Not best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		       cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
+      for (cR = rR + 1; cR < cend_upper; cR++) {
+	if (scoreL + bonus[cR] + (int) matrixR_upper[cR][rR] == maxscore &&
+	    better_candidate_p(&bestscore,&bestprob_with_score,maxscore,probL + right_probabilities[cR]) == true) {
+	  debug3(printf("Best score: At %d left to %d right, score is %d (prob %f)\n",cL,cR,bestscore,bestprob_with_score));
+	  *bestrL = rL;
+	  *bestrR = rR;
+	  *bestcL = cL;
+	  *bestcR = cR;
+	}
       }
     }
 
@@ -2122,88 +2214,40 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
 #endif
 
     /* Disallow leftoffset + cL >= rightoffset - cR, or cR >= rightoffset - leftoffset - cL */
-    for (cL = cloL; cL < /*to main diagonal*/rL && cL < rightoffset-leftoffset-cR; cL++) {
-      probL = left_probabilities[cL];
-      scoreL = (int) matrixL_lower[rL][cL];
-#if 0
-      if (directionsL_lower_nogap[rL][cL] != DIAG) {
-	/* Favor gaps away from intron if possible */
-	scoreL -= 100;
-      }
-#endif
-
-#ifdef USE_SCOREI
-      /* scoreI = intron_score(&introntype,leftdi[cL],rightdi[cR],cdna_direction,canonical_reward,finalp); */
-      scoreI = intron_score_array[leftdi[cL] & rightdi[cR]];
-#else
-      scoreI = 0;
-#endif
-
-      if ((score = scoreL + scoreI + scoreR) > bestscore) {
-	debug3(printf("Best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	bestscore = score;
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else if (score == bestscore && probL + probR > bestprob_with_score) {
-	debug3(printf("Improved prob: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else {
-	debug3a(printf("Not best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		       cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
+    if ((cend = /*to main diagonal*/rL) > rightoffset-leftoffset-cR) {
+      cend = rightoffset-leftoffset-cR;
+    }
+    if ((cend_upper = chighL) > rightoffset-leftoffset-cR) {
+      cend_upper = rightoffset-leftoffset-cR;
+    }
+    bonus = intron_bonus(intronL,intronL_storage,rightdi_class(rightdi[cR]),rightdi[cR],leftdi,ncolsL,intron_score_array);
+    maxscore = max_candidate_16(bonus,matrixL_lower[rL],cloL,cend);
+    for (/*skip main diagonal*/cL = rL + 1; cL < cend_upper; cL++) {
+      if ((score = bonus[cL] + (int) matrixL_upper[cL][rL]) > maxscore) {
+	maxscore = score;
       }
     }
 
-    debug3(printf("Skip main diagonal\n"));
-    for (/*Skip main diagonal*/cL++; cL < chighL && cL < rightoffset-leftoffset-cR; cL++) {
-      probL = left_probabilities[cL];
-      scoreL = (int) matrixL_upper[cL][rL];
-#if 0
-      if (directionsL_upper_nogap[cL][rL] != DIAG) {
-	/* Favor gaps away from intron if possible */
-	scoreL -= 100;
+    if ((maxscore += scoreR) >= bestscore) {
+      for (cL = cloL; cL < cend; cL++) {
+	if (scoreR + bonus[cL] + (int) matrixL_lower[rL][cL] == maxscore &&
+	    better_candidate_p(&bestscore,&bestprob_with_score,maxscore,left_probabilities[cL] + probR) == true) {
+	  debug3(printf("Best score: At %d left to %d right, score is %d (prob %f)\n",cL,cR,bestscore,bestprob_with_score));
+	  *bestrL = rL;
+	  *bestrR = rR;
+	  *bestcL = cL;
+	  *bestcR = cR;
+	}
       }
-#endif
-
-#ifdef USE_SCOREI
-      /* scoreI = intron_score(&introntype,leftdi[cL],rightdi[cR],cdna_direction,canonical_reward,finalp); */
-      scoreI = intron_score_array[leftdi[cL] & rightdi[cR]];
-#else
-      scoreI = 0;
-#endif
-
-      if ((score = scoreL + scoreI + scoreR) > bestscore) {
-	debug3(printf("Best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	bestscore = score;
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else if (score == bestscore && probL + probR > bestprob_with_score) {
-	debug3(printf("Improved prob: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		      cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
-	debug3(printf("probL %f, probR %f\n",left_probabilities[cL],right_probabilities[cR]));
-	*bestrL = rL;
-	*bestrR = rR;
-	*bestcL = cL;
-	*bestcR = cR;
-	bestprob_with_score = probL + probR;
-      } else {
-	debug3a(printf("Not best score: At %d left to %d right, score is (%d)+(%d)+(%d) = %d (bestscore, prob %f + %f)\n",
-		       cL,cR,scoreL,scoreI,scoreR,scoreL+scoreI+scoreR,probL,probR));
+      for (cL = rL + 1; cL < cend_upper; cL++) {
+	if (scoreR + bonus[cL] + (int) matrixL_upper[cL][rL] == maxscore &&
+	    better_candidate_p(&bestscore,&bestprob_with_score,maxscore,left_probabilities[cL] + probR) == true) {
+	  debug3(printf("Best score: At %d left to %d right, score is %d (prob %f)\n",cL,cR,bestscore,bestprob_with_score));
+	  *bestrL = rL;
+	  *bestrR = rR;
+	  *bestcL = cL;
+	  *bestcR = cR;
+	}
       }
     }
   }
@@ -2241,6 +2285,8 @@ bridge_intron_gap_16_site_level (int *bestrL, int *bestrR, int *bestcL, int *bes
     bestscore = bestscore_with_dinucl;
   }
     
+  FREEA(intronR_storage);
+  FREEA(intronL_storage);
   FREEA(rightdi);
   FREEA(leftdi);
   FREEA(left_probabilities);
@@ -2264,8 +2310,8 @@ bridge_intron_gap_16_ud (int *bestrL, int *bestrR, int *bestcL, int *bestcR,
 			 int *best_introntype, double *left_prob, double *right_prob,
 			 Score16_T **matrixL_upper, Score16_T **matrixL_lower,
 			 Score16_T **matrixR_upper, Score16_T **matrixR_lower,
-			 Direction16_T **directionsL_upper_nogap, Direction16_T **directionsL_lower_nogap, 
-			 Direction16_T **directionsR_upper_nogap, Direction16_T **directionsR_lower_nogap,
+			 Dirbits_T **directionsL_upper_nogap, Dirbits_T **directionsL_lower_nogap, 
+			 Dirbits_T **directionsR_upper_nogap, Dirbits_T **directionsR_lower_nogap,
 			 char *gsequenceL, char *gsequenceL_alt, char *rev_gsequenceR, char *rev_gsequenceR_alt,
 			 int goffsetL, int rev_goffsetR, int rlength, int glengthL, int glengthR,
 			 int cdna_direction, bool watsonp, int lbandL, int ubandL, int lbandR, int ubandR,
@@ -3282,6 +3328,11 @@ genome_gap_simple (int *best_introntype, int *new_leftgenomepos, int *new_rightg
 
 
 
+#ifdef DYNPROG_GENOME_BENCH
+/* The timed Dynprog_genome_gap at the end of this file calls this */
+#define Dynprog_genome_gap genome_gap_untimed
+#endif
+
 /* A genome gap is usually an intron.  Sequence 2L and 2R represent
    the two genomic ends of the intron. */
 List_T
@@ -3311,14 +3362,14 @@ Dynprog_genome_gap (int *dynprogindex, int *new_leftgenomepos, int *new_rightgen
 
 #if defined(HAVE_SSE2)
   Score8_T **matrix8L_upper, **matrix8L_lower, **matrix8R_upper, **matrix8R_lower;
-  Direction8_T **directions8L_upper_nogap, **directions8L_upper_Egap,
+  Dirbits_T **directions8L_upper_nogap, **directions8L_upper_Egap,
     **directions8L_lower_nogap, **directions8L_lower_Egap,
     **directions8R_upper_nogap, **directions8R_upper_Egap,
     **directions8R_lower_nogap, **directions8R_lower_Egap;
   bool use8p;
 
   Score16_T **matrix16L_upper, **matrix16L_lower, **matrix16R_upper, **matrix16R_lower;
-  Direction16_T **directions16L_upper_nogap, **directions16L_upper_Egap,
+  Dirbits_T **directions16L_upper_nogap, **directions16L_upper_Egap,
     **directions16L_lower_nogap, **directions16L_lower_Egap,
     **directions16R_upper_nogap, **directions16R_upper_Egap,
     **directions16R_lower_nogap, **directions16R_lower_Egap;
@@ -3900,4 +3951,36 @@ Dynprog_genome_gap (int *dynprogindex, int *new_leftgenomepos, int *new_rightgen
 
 }
 
+#ifdef DYNPROG_GENOME_BENCH
+#undef Dynprog_genome_gap
+
+List_T
+Dynprog_genome_gap (int *dynprogindex, int *new_leftgenomepos, int *new_rightgenomepos,
+		    double *left_prob, double *right_prob,
+
+		    int *traceback_score, int *nmatches, int *nmismatches,
+		    int *nopens, int *nindels, int *exonhead, int *introntype,
+
+		    T dynprogL, T dynprogR,
+		    char *rsequence, char *rsequenceuc, int rlength, int glengthL, int glengthR, 
+		    int roffset, int goffsetL, int rev_goffsetR, 
+		    Chrnum_T chrnum, Univcoord_T chroffset, Univcoord_T chrhigh,
+		    int cdna_direction, bool watsonp, int genestrand, bool jump_late_p,
+		    Genome_T genome, Genome_T genomealt, Pairpool_T pairpool, int extraband_paired,
+		    double defect_rate, int maxpeelback, bool halfp, bool finalp) {
+  List_T pairs;
+  unsigned long long start = bench_thread_nsec();
+
+  pairs = genome_gap_untimed(&(*dynprogindex),&(*new_leftgenomepos),&(*new_rightgenomepos),
+			     &(*left_prob),&(*right_prob),&(*traceback_score),&(*nmatches),&(*nmismatches),
+			     &(*nopens),&(*nindels),&(*exonhead),&(*introntype),dynprogL,dynprogR,
+			     rsequence,rsequenceuc,rlength,glengthL,glengthR,roffset,goffsetL,rev_goffsetR,
+			     chrnum,chroffset,chrhigh,cdna_direction,watsonp,genestrand,jump_late_p,
+			     genome,genomealt,pairpool,extraband_paired,defect_rate,maxpeelback,halfp,finalp);
+
+  __sync_fetch_and_add(&bench_nsec,bench_thread_nsec() - start);
+  __sync_fetch_and_add(&bench_nclosures,1ULL);
+  return pairs;
+}
+#endif
 
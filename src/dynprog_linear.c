@@ -0,0 +1,503 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "dynprog_linear.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "mem.h"
+#include "assert.h"
+#include "comp.h"
+#include "scores.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+/* Checkpoints and block recomputation */
+#ifdef DEBUG2
+#define debug2(x) x
+#else
+#define debug2(x)
+#endif
+
+
+#define LAZY_INDEL 1		/* Don't advance to next coordinate on final indel, since could go over chromosome bounds. */
+
+/* Long gaps can go well below NEG_INFINITY_32, so use a lower bound
+   that still leaves room for adding penalties */
+#define NEG_INFINITY_LINEAR (-(1 << 29))
+
+
+#define T Dynprog_linear_T
+struct T {
+  int rlength;
+  int glength;
+  int lband;
+  int uband;
+  int width;			/* Most rows in one column */
+
+  Mismatchtype_T mismatchtype;
+  int open;
+  int extend;
+  bool jump_late_p;
+
+  /* Current column */
+  Score32_T *nogap;
+  Score32_T *r_gap;
+  Score32_T first_nogap;
+  Score32_T penalty;
+
+  /* Checkpoint j holds the state after column j*blocksize, for rows
+     rlo(j*blocksize+1) through rhigh(j*blocksize) */
+  int blocksize;
+  int nblocks;
+  Score32_T *checkpoint_nogap;
+  Score32_T *checkpoint_r_gap;
+  Score32_T *checkpoint_first_nogap;
+  Score32_T *checkpoint_penalty;
+
+  /* Directions for columns block_cstart..block_cend, stored as
+     [c - block_cstart][r - rlo(c)] */
+  int block_cstart;
+  int block_cend;
+  char *directions_nogap;
+  char *directions_Egap;
+  char *directions_Fgap;
+};
+
+
+void
+Dynprog_linear_free (T *old) {
+  if (*old) {
+    FREE((*old)->directions_Fgap);
+    FREE((*old)->directions_Egap);
+    FREE((*old)->directions_nogap);
+    FREE((*old)->checkpoint_penalty);
+    FREE((*old)->checkpoint_first_nogap);
+    FREE((*old)->checkpoint_r_gap);
+    FREE((*old)->checkpoint_nogap);
+    FREE((*old)->r_gap);
+    FREE((*old)->nogap);
+    FREE(*old);
+  }
+  return;
+}
+
+
+/* Same initialization as Dynprog_standard */
+static void
+init_columns (T this) {
+  Score32_T penalty;
+  int r;
+
+  this->nogap[0] = 0;
+  penalty = this->open;
+  for (r = 1; r <= this->lband && r <= this->rlength; r++) {
+    penalty += this->extend;
+    this->r_gap[r] = NEG_INFINITY_LINEAR;
+    this->nogap[r] = penalty;
+  }
+  for ( ; r <= this->rlength; r++) {
+    this->r_gap[r] = NEG_INFINITY_LINEAR;
+    this->nogap[r] = NEG_INFINITY_LINEAR;
+  }
+
+  this->first_nogap = 0;
+  this->penalty = this->open + this->extend;
+  return;
+}
+
+
+static void
+save_checkpoint (T this, int j) {
+  int c0 = j * this->blocksize, rlo, rhigh;
+
+  if ((rlo = c0 + 1 - this->uband) < 1) {
+    rlo = 1;
+  }
+  if ((rhigh = c0 + this->lband) > this->rlength) {
+    rhigh = this->rlength;
+  }
+  if (rlo <= rhigh) {
+    memcpy(&(this->checkpoint_nogap[j*this->width]),&(this->nogap[rlo]),(rhigh-rlo+1)*sizeof(Score32_T));
+    memcpy(&(this->checkpoint_r_gap[j*this->width]),&(this->r_gap[rlo]),(rhigh-rlo+1)*sizeof(Score32_T));
+  }
+  this->checkpoint_first_nogap[j] = this->first_nogap;
+  this->checkpoint_penalty[j] = this->penalty;
+  return;
+}
+
+/* Rows above rhigh have not been reached yet, so they still hold
+   their initial values */
+static void
+restore_checkpoint (T this, int j) {
+  int c0 = j * this->blocksize, rlo, rhigh;
+
+  init_columns(this);
+  if ((rlo = c0 + 1 - this->uband) < 1) {
+    rlo = 1;
+  }
+  if ((rhigh = c0 + this->lband) > this->rlength) {
+    rhigh = this->rlength;
+  }
+  if (rlo <= rhigh) {
+    memcpy(&(this->nogap[rlo]),&(this->checkpoint_nogap[j*this->width]),(rhigh-rlo+1)*sizeof(Score32_T));
+    memcpy(&(this->r_gap[rlo]),&(this->checkpoint_r_gap[j*this->width]),(rhigh-rlo+1)*sizeof(Score32_T));
+  }
+  this->first_nogap = this->checkpoint_first_nogap[j];
+  this->penalty = this->checkpoint_penalty[j];
+  return;
+}
+
+
+/* Computes columns cstart..cend from the state after column cstart-1,
+   following the inner loop of Dynprog_standard.  Records directions
+   if recordp is true.  Callers pass constants for jump_late_p and
+   recordp, so each combination gets its own inner loop. */
+static inline void
+fill_columns (T this, int cstart, int cend, char *rsequence, char *gsequence, char *gsequence_alt,
+	      bool jump_late_p, bool recordp) {
+  Score32_T c_gap, *r_gap = this->r_gap, *nogap = this->nogap, last_nogap, prev_nogap, first_nogap;
+  Score32_T score, pairscore;
+  Score32_T open = this->open, extend = this->extend;
+  int r, c, na1, na2, rlo, rhigh, rlength = this->rlength, lband = this->lband, uband = this->uband;
+  char na2_alt, *dir_nogap = NULL, *dir_Egap = NULL, *dir_Fgap = NULL;
+  Pairdistance_T **pairdistance_array_type;
+
+  pairdistance_array_type = pairdistance_array[this->mismatchtype];
+  first_nogap = this->first_nogap;
+
+  for (c = cstart; c <= cend; c++) {
+    na2 = gsequence[c-1];
+    na2_alt = gsequence_alt[c-1];
+
+    c_gap = NEG_INFINITY_LINEAR;
+    if (c == 1) {
+      rlo = 1;
+      prev_nogap = 0;
+      last_nogap = NEG_INFINITY_LINEAR - open + 1;
+    } else if ((rlo = c - uband) < 1) {
+      rlo = 1;
+      prev_nogap = this->penalty;
+      this->penalty += extend;
+      last_nogap = this->penalty;
+    } else if (rlo == 1) {
+      prev_nogap = this->penalty;
+      last_nogap = NEG_INFINITY_LINEAR;
+    } else {
+      prev_nogap = first_nogap;
+      last_nogap = NEG_INFINITY_LINEAR;
+    }
+
+    if ((rhigh = c + lband) > rlength) {
+      rhigh = rlength;
+    }
+
+    if (recordp == true) {
+      dir_nogap = &(this->directions_nogap[(c - cstart)*this->width - rlo]);
+      dir_Egap = &(this->directions_Egap[(c - cstart)*this->width - rlo]);
+      dir_Fgap = &(this->directions_Fgap[(c - cstart)*this->width - rlo]);
+    }
+
+    for (r = rlo; r <= rhigh; r++) {
+      na1 = rsequence[r-1];
+
+      /* FGAP */
+      score = last_nogap + open;
+      if (jump_late_p ? (c_gap >= score) : (c_gap > score)) {
+	c_gap += extend;
+	if (recordp) dir_Fgap[r] = VERT;
+      } else {
+	c_gap = score + extend;
+	if (recordp) dir_Fgap[r] = DIAG;
+      }
+
+      /* EGAP */
+      score = nogap[r] + open;
+      if (jump_late_p ? (r_gap[r] >= score) : (r_gap[r] > score)) {
+	r_gap[r] += extend;
+	if (recordp) dir_Egap[r] = HORIZ;
+      } else {
+	r_gap[r] = score + extend;
+	if (recordp) dir_Egap[r] = DIAG;
+      }
+
+      /* NOGAP */
+      pairscore = pairdistance_array_type[na1][na2];
+      if ((score = pairdistance_array_type[na1][(int) na2_alt]) > pairscore) {
+	pairscore = score;
+      }
+      last_nogap = prev_nogap + pairscore;
+      if (recordp) dir_nogap[r] = DIAG;
+      if (jump_late_p ? (r_gap[r] >= last_nogap) : (r_gap[r] > last_nogap)) {
+	last_nogap = r_gap[r];
+	if (recordp) dir_nogap[r] = HORIZ;
+      }
+      if (jump_late_p ? (c_gap >= last_nogap) : (c_gap > last_nogap)) {
+	last_nogap = c_gap;
+	if (recordp) dir_nogap[r] = VERT;
+      }
+
+      prev_nogap = nogap[r];
+      nogap[r] = last_nogap;
+      if (r == rlo) {
+	first_nogap = last_nogap;
+      }
+    }
+  }
+
+  this->first_nogap = first_nogap;
+  return;
+}
+
+
+T
+Dynprog_linear_fill (int *finalscore, char *rsequence, char *gsequence, char *gsequence_alt,
+		     int rlength, int glength, Mismatchtype_T mismatchtype,
+		     int open, int extend, int lband, int uband, bool jump_late_p) {
+  T new;
+  int j, cend;
+
+  if (rlength <= 0 || glength <= 0 ||
+      glength + lband < rlength || glength - uband > rlength) {
+    /* Final cell lies outside the band */
+    return (T) NULL;
+  } else if (lband + uband + 1 > DYNPROG_LINEAR_MAXBAND) {
+    return (T) NULL;
+  } else if ((double) glength * (double) (lband + uband + 1) > DYNPROG_LINEAR_MAXCELLS) {
+    return (T) NULL;
+  }
+
+  new = (T) MALLOC(sizeof(*new));
+  new->rlength = rlength;
+  new->glength = glength;
+  new->lband = lband;
+  new->uband = uband;
+  if ((new->width = lband + uband + 1) > rlength) {
+    new->width = rlength;
+  }
+  new->mismatchtype = mismatchtype;
+  new->open = open;
+  new->extend = extend;
+  new->jump_late_p = jump_late_p;
+
+  if ((new->blocksize = (int) sqrt((double) glength)) < 1) {
+    new->blocksize = 1;
+  }
+  new->nblocks = (glength + new->blocksize - 1) / new->blocksize;
+
+  new->nogap = (Score32_T *) MALLOC((rlength+1)*sizeof(Score32_T));
+  new->r_gap = (Score32_T *) MALLOC((rlength+1)*sizeof(Score32_T));
+  new->checkpoint_nogap = (Score32_T *) MALLOC(new->nblocks*new->width*sizeof(Score32_T));
+  new->checkpoint_r_gap = (Score32_T *) MALLOC(new->nblocks*new->width*sizeof(Score32_T));
+  new->checkpoint_first_nogap = (Score32_T *) MALLOC(new->nblocks*sizeof(Score32_T));
+  new->checkpoint_penalty = (Score32_T *) MALLOC(new->nblocks*sizeof(Score32_T));
+  new->directions_nogap = (char *) MALLOC(new->blocksize*new->width*sizeof(char));
+  new->directions_Egap = (char *) MALLOC(new->blocksize*new->width*sizeof(char));
+  new->directions_Fgap = (char *) MALLOC(new->blocksize*new->width*sizeof(char));
+  new->block_cstart = new->block_cend = -1;
+
+  debug2(printf("Linear fill of %d x %d, bands %d and %d, %d blocks of %d columns\n",
+		rlength,glength,lband,uband,new->nblocks,new->blocksize));
+
+  init_columns(new);
+  for (j = 0; j < new->nblocks; j++) {
+    save_checkpoint(new,j);
+    if ((cend = (j + 1) * new->blocksize) > glength) {
+      cend = glength;
+    }
+    if (jump_late_p == true) {
+      fill_columns(new,j * new->blocksize + 1,cend,rsequence,gsequence,gsequence_alt,
+		   /*jump_late_p*/true,/*recordp*/false);
+    } else {
+      fill_columns(new,j * new->blocksize + 1,cend,rsequence,gsequence,gsequence_alt,
+		   /*jump_late_p*/false,/*recordp*/false);
+    }
+  }
+
+  *finalscore = new->nogap[rlength];
+  return new;
+}
+
+
+/* Returns DIAG outside the band, as in the cleared matrices of
+   Dynprog_standard */
+static char
+get_direction (T this, char *directions, int c, int r, char *rsequence, char *gsequence, char *gsequence_alt) {
+  int j, cend, rlo;
+
+  if (c < 1 || r < 1 || r > c + this->lband) {
+    return DIAG;
+  } else if ((rlo = c - this->uband) < 1) {
+    rlo = 1;
+  } else if (r < rlo) {
+    return DIAG;
+  }
+
+  if (c < this->block_cstart || c > this->block_cend) {
+    j = (c - 1) / this->blocksize;
+    if ((cend = (j + 1) * this->blocksize) > this->glength) {
+      cend = this->glength;
+    }
+    debug2(printf("Recomputing columns %d..%d\n",j * this->blocksize + 1,cend));
+    restore_checkpoint(this,j);
+    this->block_cstart = j * this->blocksize + 1;
+    this->block_cend = cend;
+    if (this->jump_late_p == true) {
+      fill_columns(this,this->block_cstart,this->block_cend,rsequence,gsequence,gsequence_alt,
+		   /*jump_late_p*/true,/*recordp*/true);
+    } else {
+      fill_columns(this,this->block_cstart,this->block_cend,rsequence,gsequence,gsequence_alt,
+		   /*jump_late_p*/false,/*recordp*/true);
+    }
+  }
+
+  return directions[(c - this->block_cstart)*this->width + r - rlo];
+}
+
+#define DIR_NOGAP(c,r) get_direction(this,this->directions_nogap,c,r,rsequence,gsequence,gsequence_alt)
+#define DIR_EGAP(c,r) get_direction(this,this->directions_Egap,c,r,rsequence,gsequence,gsequence_alt)
+#define DIR_FGAP(c,r) get_direction(this,this->directions_Fgap,c,r,rsequence,gsequence,gsequence_alt)
+
+
+/* Same as Dynprog_traceback_std, starting from the final cell, except
+   that directions are recomputed one block at a time */
+List_T
+Dynprog_linear_traceback (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
+			  T this, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
+			  int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt, Pairpool_T pairpool,
+			  Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp, int genestrand,
+			  int dynprogindex) {
+  char c1, c1_uc, c2, c2_alt;
+  int r = this->rlength, c = this->glength;
+  int dist;
+  bool add_dashes_p;
+  int querycoord, genomecoord;
+  char dir;
+
+  debug(printf("Starting linear traceback at r=%d,c=%d (roffset=%d, goffset=%d)\n",r,c,queryoffset,genomeoffset));
+
+  while (r > 0 && c > 0) {  /* dir != STOP */
+    if ((dir = DIR_NOGAP(c,r)) == HORIZ) {
+      dist = 1;
+      while (c > 0 && DIR_EGAP(c,r) != DIAG) {
+	c--;
+	dist++;
+      }
+      if (c > 0) {
+	c--;
+      }
+
+      debug(printf("H%d: ",dist));
+      pairs = Pairpool_add_genomeskip(&add_dashes_p,pairs,r,c+dist,dist,/*genomesequence*/NULL,
+				      queryoffset,genomeoffset,genome,genomealt,
+				      pairpool,/*revp*/false,chroffset,chrhigh,watsonp,dynprogindex);
+      if (add_dashes_p == true) {
+	*traceback_score += TOPEN + dist*TINDEL;
+	*nopens += 1;
+	*nindels += dist;
+      }
+      debug(printf("\n"));
+
+    } else if (dir == VERT) {
+      dist = 1;
+      while (r > 0 && DIR_FGAP(c,r) != DIAG) {
+	r--;
+	dist++;
+      }
+      if (r > 0) {
+	r--;
+      }
+
+      debug(printf("V%d: ",dist));
+      pairs = Pairpool_add_queryskip(pairs,r+dist,c,dist,rsequence,
+				     queryoffset,genomeoffset,pairpool,/*revp*/false,
+				     dynprogindex);
+      *traceback_score += QOPEN + dist*QINDEL;
+      *nopens += 1;
+      *nindels += dist;
+      debug(printf("\n"));
+
+    } else {
+      querycoord = r-1;
+      genomecoord = c-1;
+
+      c1 = rsequence[querycoord];
+      c1_uc = rsequenceuc[querycoord];
+      c2 = gsequence[genomecoord];
+      c2_alt = gsequence_alt[genomecoord];
+
+      if (c2 == '*') {
+	/* Don't push pairs past end of chromosome */
+	debug(printf("Don't push pairs past end of chromosome: genomeoffset %u, genomecoord %u, chroffset %u, chrhigh %u, watsonp %d\n",
+		     genomeoffset,genomecoord,chroffset,chrhigh,watsonp));
+
+      } else if (c1_uc == c2 || c1_uc == c2_alt) {
+	debug(printf("Pushing %d,%d [%d,%d] (%c,%c) - match\n",
+		     r,c,queryoffset+querycoord,genomeoffset+genomecoord,c1_uc,c2));
+	*traceback_score += MATCH;
+	*nmatches += 1;
+	pairs = Pairpool_push(pairs,pairpool,queryoffset+querycoord,genomeoffset+genomecoord,
+			      c1,DYNPROG_MATCH_COMP,c2,c2_alt,dynprogindex);
+
+      } else if (Dynprog_consistent_p(c1_uc,/*g*/c2,/*g_alt*/c2_alt,genestrand) == true) {
+	debug(printf("Pushing %d,%d [%d,%d] (%c,%c) - ambiguous\n",
+		     r,c,queryoffset+querycoord,genomeoffset+genomecoord,c1_uc,c2));
+	*traceback_score += MATCH;
+	*nmatches += 1;
+	pairs = Pairpool_push(pairs,pairpool,queryoffset+querycoord,genomeoffset+genomecoord,
+			      c1,AMBIGUOUS_COMP,c2,c2_alt,dynprogindex);
+
+      } else {
+	debug(printf("Pushing %d,%d [%d,%d] (%c,%c) - mismatch\n",
+		     r,c,queryoffset+querycoord,genomeoffset+genomecoord,c1_uc,c2));
+	*traceback_score += MISMATCH;
+	*nmismatches += 1;
+	pairs = Pairpool_push(pairs,pairpool,queryoffset+querycoord,genomeoffset+genomecoord,
+			      c1,MISMATCH_COMP,c2,c2_alt,dynprogindex);
+      }
+
+      r--; c--;
+    }
+  }
+
+  if (r == 0 && c == 0) {
+    /* Finished with a diagonal step */
+
+  } else if (c == 0) {
+    dist = r;
+    debug(printf("V%d: ",dist));
+    pairs = Pairpool_add_queryskip(pairs,r,/*c*/0+LAZY_INDEL,dist,rsequence,
+				   queryoffset,genomeoffset,pairpool,/*revp*/false,
+				   dynprogindex);
+    *traceback_score += QOPEN + dist*QINDEL;
+    *nopens += 1;
+    *nindels += dist;
+    debug(printf("\n"));
+
+  } else {
+    assert(r == 0);
+    dist = c;
+    debug(printf("H%d: ",dist));
+    pairs = Pairpool_add_genomeskip(&add_dashes_p,pairs,/*r*/0+LAZY_INDEL,c,dist,/*genomesequence*/NULL,
+				    queryoffset,genomeoffset,genome,genomealt,
+				    pairpool,/*revp*/false,chroffset,chrhigh,watsonp,dynprogindex);
+    if (add_dashes_p == true) {
+      *traceback_score += TOPEN + dist*TINDEL;
+      *nopens += 1;
+      *nindels += dist;
+    }
+    debug(printf("\n"));
+  }
+
+  return pairs;
+}
+
@@ -0,0 +1,53 @@
+/* $Id$ */
+#ifndef DYNPROG_LINEAR_INCLUDED
+#define DYNPROG_LINEAR_INCLUDED
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "bool.h"
+#include "list.h"
+#include "genomicpos.h"
+#include "pairpool.h"
+#include "genome.h"
+#include "types.h"
+#include "dynprog.h"
+
+
+/* Banded global alignment in memory proportional to the band, for
+   gaps larger than the matrices preallocated by Dynprog_new.  The
+   fill keeps only the current column, plus a checkpoint of the band
+   every blocksize columns.  The traceback recomputes the directions
+   of one block of columns at a time from its checkpoint, so memory is
+   O(sqrt(glength) * band) and time is about twice that of one fill.
+   Recurrence and tie-breaking follow Dynprog_standard with upperp and
+   lowerp true, but scores are not limited to NEG_INFINITY_32. */
+
+/* Meant for long segments near the diagonal.  A wider band means a
+   large length difference, which is an intron for Dynprog_genome_gap
+   rather than a single gap, so such gaps are left unaligned as
+   before, as are those with more banded cells than the limit. */
+#define DYNPROG_LINEAR_MAXBAND 1000
+#define DYNPROG_LINEAR_MAXCELLS 50000000
+
+#define T Dynprog_linear_T
+typedef struct T *T;
+
+extern void
+Dynprog_linear_free (T *old);
+
+extern T
+Dynprog_linear_fill (int *finalscore, char *rsequence, char *gsequence, char *gsequence_alt,
+		     int rlength, int glength, Mismatchtype_T mismatchtype,
+		     int open, int extend, int lband, int uband, bool jump_late_p);
+
+extern List_T
+Dynprog_linear_traceback (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
+			  T this, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
+			  int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt, Pairpool_T pairpool,
+			  Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp, int genestrand,
+			  int dynprogindex);
+
+#undef T
+#endif
+
@@ -614,7 +614,7 @@ Matrix16_print_ud (Score16_T **matrix, int rlength, int glength, char *rsequence
 
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD) || defined(DEBUG2)
 static void
-Directions8_print (Direction8_T **directions_nogap, Direction8_T **directions_Egap, Direction8_T **directions_Fgap,
+Directions8_print (Dirbits_T **directions_nogap, Dirbits_T **directions_Egap, Dirbits_T **directions_Fgap,
 		   int rlength, int glength, char *rsequence, char *gsequence, char *gsequencealt,
 		   bool revp, int lband, int uband) {
   int i, j;
@@ -677,23 +677,23 @@ Directions8_print (Direction8_T **directions_nogap, Direction8_T **directions_Eg
       } else if (j > i + uband) {
 	printf("     ");
       } else {
-	if (directions_Egap[j][i] == DIAG) {
+	if (Dirbits_gap_p(directions_Egap,j,i) == false) {
 	  printf("D");
 	} else {
 	  /* Must be HORIZ */
 	  printf("H");
 	}
 	printf("|");
-	if (directions_nogap[j][i] == DIAG) {
+	if (Dirbits_nogap(directions_nogap,j,i) == DIAG) {
 	  printf("D");
-	} else if (directions_nogap[j][i] == HORIZ) {
+	} else if (Dirbits_nogap(directions_nogap,j,i) == HORIZ) {
 	  printf("H");
 	} else {
 	  /* Must be VERT */
 	  printf("V");
 	}
 	printf("|");
-	if (directions_Fgap[j][i] == DIAG) {
+	if (Dirbits_gap_p(directions_Fgap,j,i) == false) {
 	  printf("D");
 	} else {
 	  /* Must be VERT */
@@ -710,7 +710,7 @@ Directions8_print (Direction8_T **directions_nogap, Direction8_T **directions_Eg
 }
 
 static void
-Directions8_print_ud (Direction8_T **directions_nogap, Direction8_T **directions_Egap,
+Directions8_print_ud (Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 		      int rlength, int glength, char *rsequence, char *gsequence, char *gsequencealt,
 		      bool revp, int band, bool upperp) {
   int i, j;
@@ -774,13 +774,13 @@ Directions8_print_ud (Direction8_T **directions_nogap, Direction8_T **directions
 	} else if (j > i + band) {
 	  printf("     ");
 	} else {
-	  if (directions_Egap[j][i] == DIAG) {
+	  if (Dirbits_gap_p(directions_Egap,j,i) == false) {
 	    printf("D");
 	  } else {
 	    printf("-");
 	  }
 	  printf("|");
-	  if (directions_nogap[j][i] == DIAG) {
+	  if (Dirbits_gap_p(directions_nogap,j,i) == false) {
 	    printf("D");
 	  } else {
 	    printf("-");
@@ -797,13 +797,13 @@ Directions8_print_ud (Direction8_T **directions_nogap, Direction8_T **directions
 	  printf("     ");
 	} else {
 	  printf(" |");		/* For Fgap */
-	  if (directions_nogap[i][j] == DIAG) {
+	  if (Dirbits_gap_p(directions_nogap,i,j) == false) {
 	    printf("D");
 	  } else {
 	    printf("-");
 	  }
 	  printf("|");
-	  if (directions_Egap[i][j] == DIAG) {
+	  if (Dirbits_gap_p(directions_Egap,i,j) == false) {
 	    printf("D");
 	  } else {
 	    printf("-");
@@ -821,7 +821,7 @@ Directions8_print_ud (Direction8_T **directions_nogap, Direction8_T **directions
 
 
 static void
-Directions16_print (Direction16_T **directions_nogap, Direction16_T **directions_Egap, Direction16_T **directions_Fgap,
+Directions16_print (Dirbits_T **directions_nogap, Dirbits_T **directions_Egap, Dirbits_T **directions_Fgap,
 		    int rlength, int glength, char *rsequence, char *gsequence, char *gsequencealt,
 		    bool revp, int lband, int uband) {
   int i, j;
@@ -884,23 +884,23 @@ Directions16_print (Direction16_T **directions_nogap, Direction16_T **directions
       } else if (j > i + uband) {
 	printf("     ");
       } else {
-	if (directions_Egap[j][i] == DIAG) {
+	if (Dirbits_gap_p(directions_Egap,j,i) == false) {
 	  printf("D");
 	} else {
 	  /* Must be HORIZ */
 	  printf("H");
 	}
 	printf("|");
-	if (directions_nogap[j][i] == DIAG) {
+	if (Dirbits_nogap(directions_nogap,j,i) == DIAG) {
 	  printf("D");
-	} else if (directions_nogap[j][i] == HORIZ) {
+	} else if (Dirbits_nogap(directions_nogap,j,i) == HORIZ) {
 	  printf("H");
 	} else {
 	  /* Must be VERT */
 	  printf("V");
 	}
 	printf("|");
-	if (directions_Fgap[j][i] == DIAG) {
+	if (Dirbits_gap_p(directions_Fgap,j,i) == false) {
 	  printf("D");
 	} else {
 	  /* Must be VERT */
@@ -917,7 +917,7 @@ Directions16_print (Direction16_T **directions_nogap, Direction16_T **directions
 }
 
 static void
-Directions16_print_ud (Direction16_T **directions_nogap, Direction16_T **directions_Egap,
+Directions16_print_ud (Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 		       int rlength, int glength, char *rsequence, char *gsequence, char *gsequencealt,
 		       bool revp, int band, bool upperp) {
   int i, j;
@@ -981,13 +981,13 @@ Directions16_print_ud (Direction16_T **directions_nogap, Direction16_T **directi
 	} else if (j > i + band) {
 	  printf("   ");
 	} else {
-	  if (directions_Egap[j][i] == DIAG) {
+	  if (Dirbits_gap_p(directions_Egap,j,i) == false) {
 	    printf("D");
 	  } else {
 	    printf("-");
 	  }
 	  printf("|");
-	  if (directions_nogap[j][i] == DIAG) {
+	  if (Dirbits_gap_p(directions_nogap,j,i) == false) {
 	    printf("D");
 	  } else {
 	    printf("-");
@@ -1004,13 +1004,13 @@ Directions16_print_ud (Direction16_T **directions_nogap, Direction16_T **directi
 	} else if (i > j + band) {
 	  printf("   ");
 	} else {
-	  if (directions_nogap[i][j] == DIAG) {
+	  if (Dirbits_gap_p(directions_nogap,i,j) == false) {
 	    printf("D");
 	  } else {
 	    printf("-");
 	  }
 	  printf("|");
-	  if (directions_Egap[i][j] == DIAG) {
+	  if (Dirbits_gap_p(directions_Egap,i,j) == false) {
 	    printf("D");
 	  } else {
 	    printf("-");
@@ -1320,10 +1320,20 @@ banded_matrix16_compare_lower (Score16_T **matrix1,
 #endif
 
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
+/* The directions being checked are always packed, but the standard
+   ones are packed only when comparing against the non-AVX2 code */
+#ifdef DEBUG_AVX2
+#define STD_NOGAP(directions,c,r) Dirbits_nogap(directions,c,r)
+#define STD_GAP(directions,c,r) Dirbits_gap_p(directions,c,r)
+#else
+#define STD_NOGAP(directions,c,r) (directions)[c][r]
+#define STD_GAP(directions,c,r) ((directions)[c][r] != DIAG)
+#endif
+
 static void
-banded_directions8_compare_nogap (Score8_T **matrix, Direction8_T **directions1,
+banded_directions8_compare_nogap (Score8_T **matrix, Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-				  Direction8_T **directions2,
+				  Dirbits_T **directions2,
 #elif defined(DEBUG_SIMD)
 				  Direction32_T **directions2,
 #endif
@@ -1343,23 +1353,23 @@ banded_directions8_compare_nogap (Score8_T **matrix, Direction8_T **directions1,
       if (matrix[c][r] < NEG_INFINITY_8 + 30) {
 	/* Don't check */
 
-      } else if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      } else if (Dirbits_nogap(directions1,c,r) == 0) {
+	if (STD_NOGAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_nogap(directions1,c,r),STD_NOGAP(directions2,c,r));
 	  abort();
 	}
 
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_nogap(directions1,c,r) == 1) {
+	if (STD_NOGAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_nogap(directions1,c,r),STD_NOGAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	if (STD_NOGAP(directions2,c,r) == 0 || STD_NOGAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_nogap(directions1,c,r),STD_NOGAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1370,9 +1380,9 @@ banded_directions8_compare_nogap (Score8_T **matrix, Direction8_T **directions1,
 }
 
 static void
-banded_directions8_compare_nogap_upper (Score8_T **matrix, Direction8_T **directions1,
+banded_directions8_compare_nogap_upper (Score8_T **matrix, Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-					Direction8_T **directions2,
+					Dirbits_T **directions2,
 #elif defined(DEBUG_SIMD)
 					Direction32_T **directions2,
 #endif
@@ -1392,23 +1402,23 @@ banded_directions8_compare_nogap_upper (Score8_T **matrix, Direction8_T **direct
       if (matrix[c][r] < NEG_INFINITY_8 + 30) {
 	/* Don't check */
 
-      } else if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1419,9 +1429,9 @@ banded_directions8_compare_nogap_upper (Score8_T **matrix, Direction8_T **direct
 }
 
 static void
-banded_directions8_compare_nogap_lower (Score8_T **matrix, Direction8_T **directions1,
+banded_directions8_compare_nogap_lower (Score8_T **matrix, Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-					Direction8_T **directions2,
+					Dirbits_T **directions2,
 #elif defined(DEBUG_SIMD)
 					Direction32_T **directions2,
 #endif
@@ -1442,23 +1452,23 @@ banded_directions8_compare_nogap_lower (Score8_T **matrix, Direction8_T **direct
       if (matrix[c][r] < NEG_INFINITY_8 + 30) {
 	/* Don't check */
 
-      } else if (directions1[r][c] == 0) {
-	if (directions2[r][c] == 0) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 0) {
+	if (STD_GAP(directions2,r,c) == 0) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
 
-      } else if (directions1[r][c] == 1) {
-	if (directions2[r][c] == 1) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 1) {
+	if (STD_GAP(directions2,r,c) == 1) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
 
       } else {
-	if (directions2[r][c] == 0 || directions2[r][c] == 0) {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	if (STD_GAP(directions2,r,c) == 0 || STD_GAP(directions2,r,c) == 0) {
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
       }
@@ -1469,23 +1479,23 @@ banded_directions8_compare_nogap_lower (Score8_T **matrix, Direction8_T **direct
       if (matrix[c][r] < NEG_INFINITY_8 + 30) {
 	/* Don't check */
 
-      } else if (directions1[r][c] == 0) {
-	if (directions2[c][r] == 0) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
-      } else if (directions1[r][c] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1499,9 +1509,9 @@ banded_directions8_compare_nogap_lower (Score8_T **matrix, Direction8_T **direct
 
 
 static void
-banded_directions16_compare_nogap (Direction16_T **directions1,
+banded_directions16_compare_nogap (Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-				   Direction16_T **directions2,
+				   Dirbits_T **directions2,
 #elif defined(DEBUG_SIMD)
 				   Direction32_T **directions2,
 #endif
@@ -1518,23 +1528,23 @@ banded_directions16_compare_nogap (Direction16_T **directions1,
     }
 
     for (r = rlo; r <= rhigh; r++) {
-      if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      if (Dirbits_nogap(directions1,c,r) == 0) {
+	if (STD_NOGAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_nogap(directions1,c,r),STD_NOGAP(directions2,c,r));
 	  abort();
 	}
 
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_nogap(directions1,c,r) == 1) {
+	if (STD_NOGAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_nogap(directions1,c,r),STD_NOGAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	if (STD_NOGAP(directions2,c,r) == 0 || STD_NOGAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_nogap(directions1,c,r),STD_NOGAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1545,9 +1555,9 @@ banded_directions16_compare_nogap (Direction16_T **directions1,
 }
 
 static void
-banded_directions16_compare_nogap_upper (Direction16_T **directions1,
+banded_directions16_compare_nogap_upper (Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-					 Direction16_T **directions2,
+					 Dirbits_T **directions2,
 #else
 					 Direction32_T **directions2,
 #endif
@@ -1564,23 +1574,23 @@ banded_directions16_compare_nogap_upper (Direction16_T **directions1,
     }
 
     for (r = rlo; r <= rhigh; r++) {
-      if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      if (Dirbits_gap_p(directions1,c,r) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1591,9 +1601,9 @@ banded_directions16_compare_nogap_upper (Direction16_T **directions1,
 }
 
 static void
-banded_directions16_compare_nogap_lower (Direction16_T **directions1,
+banded_directions16_compare_nogap_lower (Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-					 Direction16_T **directions2,
+					 Dirbits_T **directions2,
 #else
 					 Direction32_T **directions2,
 #endif
@@ -1611,44 +1621,44 @@ banded_directions16_compare_nogap_lower (Direction16_T **directions1,
 
     for (r = rlo; r <= rhigh; r++) {
 #ifdef DEBUG_AVX2
-      if (directions1[r][c] == 0) {
-	if (directions2[r][c] == 0) {
+      if (Dirbits_gap_p(directions1,r,c) == 0) {
+	if (STD_GAP(directions2,r,c) == 0) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
 
-      } else if (directions1[r][c] == 1) {
-	if (directions2[r][c] == 1) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 1) {
+	if (STD_GAP(directions2,r,c) == 1) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
 
       } else {
-	if (directions2[r][c] == 0 || directions2[r][c] == 0) {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	if (STD_GAP(directions2,r,c) == 0 || STD_GAP(directions2,r,c) == 0) {
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
       }
 #else
-      if (directions1[r][c] == 0) {
-	if (directions2[c][r] == 0) {
+      if (Dirbits_gap_p(directions1,r,c) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
-      } else if (directions1[r][c] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, nogap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1662,9 +1672,9 @@ banded_directions16_compare_nogap_lower (Direction16_T **directions1,
 
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
 static void
-banded_directions8_compare_Egap (Score8_T **matrix1, Direction8_T **directions1,
+banded_directions8_compare_Egap (Score8_T **matrix1, Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-				 Direction8_T **directions2,
+				 Dirbits_T **directions2,
 #else
 				 Direction32_T **directions2,
 #endif
@@ -1692,23 +1702,23 @@ banded_directions8_compare_Egap (Score8_T **matrix1, Direction8_T **directions1,
       if (matrix1[c][r] < NEG_INFINITY_8 + 30) {
 	/* Don't check */
 
-      } else if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1719,9 +1729,9 @@ banded_directions8_compare_Egap (Score8_T **matrix1, Direction8_T **directions1,
 }
 
 static void
-banded_directions8_compare_Egap_upper (Score8_T **matrix1, Direction8_T **directions1,
+banded_directions8_compare_Egap_upper (Score8_T **matrix1, Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-				       Direction8_T **directions2,
+				       Dirbits_T **directions2,
 #else
 				       Direction32_T **directions2,
 #endif
@@ -1750,23 +1760,23 @@ banded_directions8_compare_Egap_upper (Score8_T **matrix1, Direction8_T **direct
       if (matrix1[c][r] < NEG_INFINITY_8 + 30) {
 	/* Don't check */
 
-      } else if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1777,9 +1787,9 @@ banded_directions8_compare_Egap_upper (Score8_T **matrix1, Direction8_T **direct
 }
 
 static void
-banded_directions8_compare_Egap_lower (Score8_T **matrix1, Direction8_T **directions1,
+banded_directions8_compare_Egap_lower (Score8_T **matrix1, Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-				       Direction8_T **directions2,
+				       Dirbits_T **directions2,
 #else
 				       Direction32_T **directions2,
 #endif
@@ -1809,23 +1819,23 @@ banded_directions8_compare_Egap_lower (Score8_T **matrix1, Direction8_T **direct
       if (matrix1[r][c] < NEG_INFINITY_8 + 30) {
 	/* Don't check */
 
-      } else if (directions1[r][c] == 0) {
-	if (directions2[r][c] == 0) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 0) {
+	if (STD_GAP(directions2,r,c) == 0) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
 
-      } else if (directions1[r][c] == 1) {
-	if (directions2[r][c] == 1) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 1) {
+	if (STD_GAP(directions2,r,c) == 1) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
 
       } else {
-	if (directions2[r][c] == 0 || directions2[r][c] == 0) {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	if (STD_GAP(directions2,r,c) == 0 || STD_GAP(directions2,r,c) == 0) {
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
       }
@@ -1833,23 +1843,23 @@ banded_directions8_compare_Egap_lower (Score8_T **matrix1, Direction8_T **direct
       if (matrix1[r][c] < NEG_INFINITY_8 + 30) {
 	/* Don't check */
 
-      } else if (directions1[r][c] == 0) {
-	if (directions2[c][r] == 0) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
-      } else if (directions1[r][c] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1862,9 +1872,9 @@ banded_directions8_compare_Egap_lower (Score8_T **matrix1, Direction8_T **direct
 
 
 static void
-banded_directions16_compare_Egap (Direction16_T **directions1,
+banded_directions16_compare_Egap (Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-				  Direction16_T **directions2,
+				  Dirbits_T **directions2,
 #else
 				  Direction32_T **directions2,
 #endif
@@ -1889,22 +1899,22 @@ banded_directions16_compare_Egap (Direction16_T **directions1,
     }
 
     for (r = rlo; r <= last_check; r++) {
-      if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      if (Dirbits_gap_p(directions1,c,r) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1915,9 +1925,9 @@ banded_directions16_compare_Egap (Direction16_T **directions1,
 }
 
 static void
-banded_directions16_compare_Egap_upper (Direction16_T **directions1,
+banded_directions16_compare_Egap_upper (Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-					Direction16_T **directions2,
+					Dirbits_T **directions2,
 #else
 					Direction32_T **directions2,
 #endif
@@ -1943,22 +1953,22 @@ banded_directions16_compare_Egap_upper (Direction16_T **directions1,
     }
 
     for (r = rlo; r <= last_check; r++) {
-      if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      if (Dirbits_gap_p(directions1,c,r) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -1969,9 +1979,9 @@ banded_directions16_compare_Egap_upper (Direction16_T **directions1,
 }
 
 static void
-banded_directions16_compare_Egap_lower (Direction16_T **directions1,
+banded_directions16_compare_Egap_lower (Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-					Direction16_T **directions2,
+					Dirbits_T **directions2,
 #else
 					Direction32_T **directions2,
 #endif
@@ -1998,42 +2008,42 @@ banded_directions16_compare_Egap_lower (Direction16_T **directions1,
 
     for (r = rlo; r <= last_check; r++) {
 #ifdef DEBUG_AVX2
-      if (directions1[r][c] == 0) {
-	if (directions2[r][c] == 0) {
+      if (Dirbits_gap_p(directions1,r,c) == 0) {
+	if (STD_GAP(directions2,r,c) == 0) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
-      } else if (directions1[r][c] == 1) {
-	if (directions2[r][c] == 1) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 1) {
+	if (STD_GAP(directions2,r,c) == 1) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
 
       } else {
-	if (directions2[r][c] == 0 || directions2[r][c] == 0) {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[r][c]);
+	if (STD_GAP(directions2,r,c) == 0 || STD_GAP(directions2,r,c) == 0) {
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,r,c));
 	  abort();
 	}
       }
 #else
-      if (directions1[r][c] == 0) {
-	if (directions2[c][r] == 0) {
+      if (Dirbits_gap_p(directions1,r,c) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
-      } else if (directions1[r][c] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,r,c) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,directions1[r][c],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, Egap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,r,c),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -2048,9 +2058,9 @@ banded_directions16_compare_Egap_lower (Direction16_T **directions1,
 
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
 static void
-banded_directions8_compare_Fgap (Score8_T **matrix1, Direction8_T **directions1,
+banded_directions8_compare_Fgap (Score8_T **matrix1, Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-				 Direction8_T **directions2,
+				 Dirbits_T **directions2,
 #else
 				 Direction32_T **directions2,
 #endif
@@ -2072,26 +2082,26 @@ banded_directions8_compare_Fgap (Score8_T **matrix1, Direction8_T **directions1,
       if (matrix1[c][r] < NEG_INFINITY_8 + 30) {
 	/* Don't check */
 
-      } else if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
 	  printf("At %d,%d, Fgap dir %d != dir %d.  Score is %d\n",
-		 r,c,directions1[c][r],directions2[c][r],matrix1[c][r]);
+		 r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r),matrix1[c][r]);
 	  abort();
 	}
 
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
 	  printf("At %d,%d, Fgap dir %d != dir %d.  Score is %d\n",
-		 r,c,directions1[c][r],directions2[c][r],matrix1[c][r]);
+		 r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r),matrix1[c][r]);
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
 	  printf("At %d,%d, Fgap dir %d != dir %d.  Score is %d\n",
-		 r,c,directions1[c][r],directions2[c][r],matrix1[c][r]);
+		 r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r),matrix1[c][r]);
 	  abort();
 	}
       }
@@ -2102,9 +2112,9 @@ banded_directions8_compare_Fgap (Score8_T **matrix1, Direction8_T **directions1,
 }
 
 static void
-banded_directions16_compare_Fgap (Direction16_T **directions1,
+banded_directions16_compare_Fgap (Dirbits_T **directions1,
 #ifdef DEBUG_AVX2
-				  Direction16_T **directions2,
+				  Dirbits_T **directions2,
 #else
 				  Direction32_T **directions2,
 #endif
@@ -2123,22 +2133,22 @@ banded_directions16_compare_Fgap (Direction16_T **directions1,
     }
 
     for (r = first_check; r <= rhigh; r++) {
-      if (directions1[c][r] == 0) {
-	if (directions2[c][r] == 0) {
+      if (Dirbits_gap_p(directions1,c,r) == 0) {
+	if (STD_GAP(directions2,c,r) == 0) {
 	} else {
-	  printf("At %d,%d, Fgap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Fgap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
-      } else if (directions1[c][r] == 1) {
-	if (directions2[c][r] == 1) {
+      } else if (Dirbits_gap_p(directions1,c,r) == 1) {
+	if (STD_GAP(directions2,c,r) == 1) {
 	} else {
-	  printf("At %d,%d, Fgap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	  printf("At %d,%d, Fgap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
 
       } else {
-	if (directions2[c][r] == 0 || directions2[c][r] == 0) {
-	  printf("At %d,%d, Fgap dir %d != dir %d\n",r,c,directions1[c][r],directions2[c][r]);
+	if (STD_GAP(directions2,c,r) == 0 || STD_GAP(directions2,c,r) == 0) {
+	  printf("At %d,%d, Fgap dir %d != dir %d\n",r,c,Dirbits_gap_p(directions1,c,r),STD_GAP(directions2,c,r));
 	  abort();
 	}
       }
@@ -2178,46 +2188,6 @@ aligned_score8_alloc (int rlength, int glength, void **ptrs, void *space) {
   return matrix;
 }
 
-/* No initialization to DIAG (0), for directions_Egap and directions_nogap */
-static Score8_T **
-aligned_directions8_alloc (int rlength, int glength, void **ptrs, void *space) {
-  Score8_T **matrix, *ptr;
-  int c;
-
-  matrix = (Score8_T **) ptrs;
-
-  ptr = (Score8_T *) space;
-  matrix[0] = ptr;	   /* Want aligned row to be r = 0, 16, ... */
-  for (c = 1; c <= glength; c++) {
-    ptr += rlength;
-    matrix[c] = ptr;	   /* Want aligned row to be r = 0, 16, ... */
-  }
-#if defined(DEBUG2) && (defined(DEBUG_AVX2) || defined(DEBUG_SIMD))
-  memset((void *) matrix[0],/*DIAG*/0,(glength+1)*rlength*sizeof(Score8_T));
-#endif
-
-  return matrix;
-}
-
-/* Initialization to DIAG (0), for directions_Fgap */
-static Score8_T **
-aligned_directions8_calloc (int rlength, int glength, void **ptrs, void *space) {
-  Score8_T **matrix, *ptr;
-  int c;
-
-  matrix = (Score8_T **) ptrs;
-
-  ptr = (Score8_T *) space;
-  matrix[0] = ptr;	/* Want aligned row to be r = 0, 16, ... */
-  for (c = 1; c <= glength; c++) {
-    ptr += rlength;
-    matrix[c] = ptr;	/* Want aligned row to be r = 0, 16, ... */
-  }
-  memset((void *) matrix[0],/*DIAG*/0,(glength+1)*rlength*sizeof(Score8_T));
-
-  return matrix;
-}
-
 
 
 /* Makes a matrix of dimensions 0..rlength x 0..glength inclusive */
@@ -2241,45 +2211,111 @@ aligned_score16_alloc (int rlength, int glength, void **ptrs, void *space) {
   return matrix;
 }
 
+/* Packed directions (see Dirbits_T in dynprog.h).  Column c holds
+   rlength * nbits bits, so each block of rows written by one SIMD
+   store starts on a byte boundary */
+
 /* No initialization to DIAG (0), for directions_Egap and directions_nogap */
-static Score16_T **
-aligned_directions16_alloc (int rlength, int glength, void **ptrs, void *space) {
-  Score16_T **matrix, *ptr;
+static Dirbits_T **
+aligned_dirbits_alloc (int rlength, int glength, int nbits, void **ptrs, void *space) {
+  Dirbits_T **matrix, *ptr;
   int c;
 
-  matrix = (Score16_T **) ptrs;
+  matrix = (Dirbits_T **) ptrs;
 
-  ptr = (Score16_T *) space;
-  matrix[0] = ptr;	/* Want aligned row to be r = 0, 8, 16, ... */
+  ptr = (Dirbits_T *) space;
+  matrix[0] = ptr;
   for (c = 1; c <= glength; c++) {
-    ptr += rlength;
-    matrix[c] = ptr;	/* Want aligned row to be r = 0, 8, 16, ... */
+    ptr += rlength * nbits / 8;
+    matrix[c] = ptr;
   }
-#ifdef DEBUG2
-  memset((void *) matrix[0],/*DIAG*/0,(glength+1)*rlength*sizeof(Score16_T));
+#if defined(DEBUG2) && (defined(DEBUG_AVX2) || defined(DEBUG_SIMD))
+  memset((void *) matrix[0],/*DIAG*/0,(glength+1)*(rlength*nbits/8)*sizeof(Dirbits_T));
 #endif
 
   return matrix;
 }
 
 /* Initialization to DIAG (0), for directions_Fgap */
-static Score16_T **
-aligned_directions16_calloc (int rlength, int glength, void **ptrs, void *space) {
-  Score16_T **matrix, *ptr;
+static Dirbits_T **
+aligned_dirbits_calloc (int rlength, int glength, int nbits, void **ptrs, void *space) {
+  Dirbits_T **matrix, *ptr;
   int c;
 
-  matrix = (Score16_T **) ptrs;
+  matrix = (Dirbits_T **) ptrs;
 
-  ptr = (Score16_T *) space;
-  matrix[0] = ptr;	/* Want aligned row to be r = 0, 8, 16, ... */
+  ptr = (Dirbits_T *) space;
+  matrix[0] = ptr;
   for (c = 1; c <= glength; c++) {
-    ptr += rlength;
-    matrix[c] = ptr;	/* Want aligned row to be r = 0, 8, 16, ... */
+    ptr += rlength * nbits / 8;
+    matrix[c] = ptr;
   }
-  memset((void *) matrix[0],/*DIAG*/0,(glength+1)*rlength*sizeof(Score16_T));
+  memset((void *) matrix[0],/*DIAG*/0,(glength+1)*(rlength*nbits/8)*sizeof(Dirbits_T));
 
   return matrix;
 }
+
+
+/* Each procedure below stores the comparison mask for rows rlo and
+   up of one column, where rlo is a multiple of the number of lanes.
+   A lane of all ones means not DIAG.  The _nogap versions give each
+   row 2 bits, which movemask produces directly for 16-bit lanes */
+
+static inline void
+dirbits8_store_128 (Dirbits_T *column, int rlo, __m128i dir) {
+  *((UINT2 *) &(column[rlo >> 3])) = (UINT2) _mm_movemask_epi8(dir);
+  return;
+}
+
+static inline void
+dirbits8_store_nogap_128 (Dirbits_T *column, int rlo, __m128i dir) {
+  *((UINT4 *) &(column[rlo >> 2])) =
+    (UINT4) _mm_movemask_epi8(_mm_unpacklo_epi8(dir,dir)) |
+    ((UINT4) _mm_movemask_epi8(_mm_unpackhi_epi8(dir,dir)) << 16);
+  return;
+}
+
+static inline void
+dirbits16_store_128 (Dirbits_T *column, int rlo, __m128i dir) {
+  column[rlo >> 3] = (Dirbits_T) _mm_movemask_epi8(_mm_packs_epi16(dir,_mm_setzero_si128()));
+  return;
+}
+
+static inline void
+dirbits16_store_nogap_128 (Dirbits_T *column, int rlo, __m128i dir) {
+  *((UINT2 *) &(column[rlo >> 2])) = (UINT2) _mm_movemask_epi8(dir);
+  return;
+}
+
+#ifdef HAVE_AVX2
+static inline void
+dirbits8_store_256 (Dirbits_T *column, int rlo, __m256i dir) {
+  *((UINT4 *) &(column[rlo >> 3])) = (UINT4) _mm256_movemask_epi8(dir);
+  return;
+}
+
+static inline void
+dirbits8_store_nogap_256 (Dirbits_T *column, int rlo, __m256i dir) {
+  UINT4 *words = (UINT4 *) &(column[rlo >> 2]);
+
+  words[0] = (UINT4) _mm256_movemask_epi8(_mm256_cvtepi8_epi16(_mm256_castsi256_si128(dir)));
+  words[1] = (UINT4) _mm256_movemask_epi8(_mm256_cvtepi8_epi16(_mm256_extracti128_si256(dir,1)));
+  return;
+}
+
+static inline void
+dirbits16_store_256 (Dirbits_T *column, int rlo, __m256i dir) {
+  *((UINT2 *) &(column[rlo >> 3])) =
+    (UINT2) _mm_movemask_epi8(_mm_packs_epi16(_mm256_castsi256_si128(dir),_mm256_extracti128_si256(dir,1)));
+  return;
+}
+
+static inline void
+dirbits16_store_nogap_256 (Dirbits_T *column, int rlo, __m256i dir) {
+  *((UINT4 *) &(column[rlo >> 2])) = (UINT4) _mm256_movemask_epi8(dir);
+  return;
+}
+#endif
 #endif
 
 
@@ -2288,8 +2324,8 @@ aligned_directions16_calloc (int rlength, int glength, void **ptrs, void *space)
 
 #ifdef DEBUG_AVX2
 Score8_T **
-Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***directions_Egap,
-			Direction8_T ***directions_Fgap,
+Dynprog_simd_8_nonavx2 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
+			Dirbits_T ***directions_Fgap,
 			T this, char *rsequence, char *gsequence, char *gsequence_alt,
 			int rlength, int glength,
 			int goffset, Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp,
@@ -2333,27 +2369,27 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 
   matrix = aligned_score8_alloc(rlength_ceil,glength,
 				this->aligned_std.one.matrix_ptrs,this->aligned_std.one.matrix_space);
-  *directions_nogap = aligned_directions8_alloc(rlength_ceil,glength,
-						this->aligned_std.one.directions_ptrs_0,this->aligned_std.one.directions_space_0);
-  *directions_Egap = aligned_directions8_alloc(rlength_ceil,glength,
-					       this->aligned_std.one.directions_ptrs_1,this->aligned_std.one.directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/2,
+					    this->aligned_std.one.directions_ptrs_0,this->aligned_std.one.directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					   this->aligned_std.one.directions_ptrs_1,this->aligned_std.one.directions_space_1);
   /* Need to calloc to save time in F loop */
-  *directions_Fgap = aligned_directions8_calloc(rlength_ceil,glength,
-						this->aligned_std.one.directions_ptrs_2,this->aligned_std.one.directions_space_2);
+  *directions_Fgap = aligned_dirbits_calloc(rlength_ceil,glength,/*nbits*/1,
+					    this->aligned_std.one.directions_ptrs_2,this->aligned_std.one.directions_space_2);
 
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= uband && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_Egap)[c][0] = HORIZ;
-    (*directions_nogap)[c][0] = HORIZ;
+    Dirbits_set_gap(*directions_Egap,c,0,HORIZ);
+    Dirbits_set_nogap(*directions_nogap,c,0,HORIZ);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_nogap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 
 #if 0
@@ -2361,7 +2397,7 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
   /* penalty = open; */
   for (r = 1; r <= SIMD_NCHARS_NONAVX2 && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][r] = VERT;
+    Dirbits_set_nogap(*directions_nogap,0,r,VERT);
   }
 #endif
 
@@ -2564,7 +2600,7 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 	T1 = _mm_adds_epi8(H_nogap_r, gap_open);
 	dir_horiz = _mm_cmplt_epi8(E_r_gap,T1); /* E < H */
 	dir_horiz = _mm_andnot_si128(dir_horiz,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_Egap)[c],rlo,dir_horiz);
 	debug15(print_vector_8(T1,rlo,c,"T1"));
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_Egap"));
 
@@ -2599,7 +2635,7 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 
 	dir_horiz = _mm_cmplt_epi8(E_r_gap,H_nogap_r); /* E < H */
 	dir_horiz = _mm_andnot_si128(dir_horiz,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_nogap_128((*directions_nogap)[c],rlo,dir_horiz);
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_nogap"));
 
 
@@ -2636,8 +2672,8 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 	    } else {
 	      score_column[rhigh_calc] = (Score8_T) score;
 	    }
-	    (*directions_Egap)[c][rhigh_calc] = DIAG;
-	    (*directions_nogap)[c][rhigh_calc] = DIAG;
+	    Dirbits_set_gap(*directions_Egap,c,rhigh_calc,DIAG);
+	    Dirbits_set_nogap(*directions_nogap,c,rhigh_calc,DIAG);
 	  }
 	}
 
@@ -2677,7 +2713,7 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 			r,c,c_gap + extend,last_nogap + open + extend));
 	  if (c_gap /* + extend */ >= (score = last_nogap + open /* + extend */)) {  /* Use >= for jump late */
 	    c_gap += extend;
-	    (*directions_Fgap)[c][r] = VERT;
+	    Dirbits_set_gap(*directions_Fgap,c,r,VERT);
 	  } else {
 	    c_gap = score + extend;
 	    /* (*directions_Fgap)[c][r] = DIAG: -- Already initialized to DIAG */
@@ -2689,7 +2725,7 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 	  if (c_gap >= last_nogap) {  /* Use >= for jump late */
 	    last_nogap = c_gap;
 	    score_column[r] = (c_gap < NEG_INFINITY_8) ? NEG_INFINITY_8 : (Score8_T) c_gap; /* Saturation */
-	    (*directions_nogap)[c][r] = VERT;
+	    Dirbits_set_nogap(*directions_nogap,c,r,VERT);
 	  }
 	}
 
@@ -2790,7 +2826,7 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 	/* EGAP */
 	T1 = _mm_adds_epi8(H_nogap_r, gap_open);
 	dir_horiz = _mm_cmpgt_epi8(E_r_gap,T1); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_Egap)[c],rlo,dir_horiz);
 	debug15(print_vector_8(T1,rlo,c,"T1"));
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_Egap"));
 
@@ -2825,7 +2861,7 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 	debug15(print_vector_8(H_nogap_r,rlo,c,"H"));
 
 	dir_horiz = _mm_cmpgt_epi8(E_r_gap,H_nogap_r); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_nogap_128((*directions_nogap)[c],rlo,dir_horiz);
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_nogap"));
 
 
@@ -2862,8 +2898,8 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 	    } else {
 	      score_column[rhigh_calc] = (Score8_T) score;
 	    }
-	    (*directions_Egap)[c][rhigh_calc] = DIAG;
-	    (*directions_nogap)[c][rhigh_calc] = DIAG;
+	    Dirbits_set_gap(*directions_Egap,c,rhigh_calc,DIAG);
+	    Dirbits_set_nogap(*directions_nogap,c,rhigh_calc,DIAG);
 	  }
 	}
 
@@ -2903,7 +2939,7 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 			r,c,c_gap + extend,last_nogap + open + extend));
 	  if (c_gap /* + extend */ > (score = last_nogap + open /* + extend */)) {  /* Use > for jump early */
 	    c_gap += extend;
-	    (*directions_Fgap)[c][r] = VERT;
+	    Dirbits_set_gap(*directions_Fgap,c,r,VERT);
 	  } else {
 	    c_gap = score + extend;
 	    /* (*directions_Fgap)[c][r] = DIAG: -- Already initialized to DIAG */
@@ -2916,7 +2952,7 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 	    last_nogap = c_gap;
 	    score_column[r] = (c_gap < NEG_INFINITY_8) ? NEG_INFINITY_8 : (Score8_T) c_gap; /* Saturation */
 	    debug3(printf("Stored at score_column[%d]: %d\n",r,(Score8_T) score_column[r]));
-	    (*directions_nogap)[c][r] = VERT;
+	    Dirbits_set_nogap(*directions_nogap,c,r,VERT);
 	  }
 	}
 
@@ -2931,8 +2967,8 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = HORIZ;
-  (*directions_Fgap)[0][1] = VERT;
+  Dirbits_set_gap(*directions_Egap,1,0,HORIZ);
+  Dirbits_set_gap(*directions_Fgap,0,1,VERT);
 #endif  
 
 #ifdef DEBUG2
@@ -2947,13 +2983,13 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 #ifdef CHECK1
   /* Check for row 0 directions */
   for (c = 1; c <= uband && c <= glength; c++) {
-    assert((*directions_Egap)[c][0] != DIAG);
-    assert((*directions_nogap)[c][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,c,0) == true);
+    assert(Dirbits_nogap(*directions_nogap,c,0) != DIAG);
   }
   /* Check for column 0 directions */
   for (r = 1; r <= lband && r <= rlength; r++) {
-    assert((*directions_Fgap)[0][r] != DIAG);
-    assert((*directions_nogap)[0][r] != DIAG);
+    assert(Dirbits_gap_p(*directions_Fgap,0,r) == true);
+    assert(Dirbits_nogap(*directions_nogap,0,r) != DIAG);
   }
 #endif
 
@@ -2984,8 +3020,8 @@ Dynprog_simd_8_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***direct
 #if defined(HAVE_SSE2)
 /* Modified from Dynprog_simd_8_upper.  Operates by columns. */
 Score8_T **
-Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Egap,
-		Direction8_T ***directions_Fgap,
+Dynprog_simd_8 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
+		Dirbits_T ***directions_Fgap,
 		T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -3031,7 +3067,7 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 
 #ifdef DEBUG_AVX2
   Score8_T **matrix_std;
-  Direction8_T **directions_nogap_std, **directions_Egap_std, **directions_Fgap_std;
+  Dirbits_T **directions_nogap_std, **directions_Egap_std, **directions_Fgap_std;
 #elif defined(DEBUG_SIMD)
   Score32_T **matrix_std;
   Direction32_T **directions_nogap_std, **directions_Egap_std, **directions_Fgap_std;
@@ -3058,27 +3094,27 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 
   matrix = aligned_score8_alloc(rlength_ceil,glength,
 				this->aligned.one.matrix_ptrs,this->aligned.one.matrix_space);
-  *directions_nogap = aligned_directions8_alloc(rlength_ceil,glength,
-						this->aligned.one.directions_ptrs_0,this->aligned.one.directions_space_0);
-  *directions_Egap = aligned_directions8_alloc(rlength_ceil,glength,
-					       this->aligned.one.directions_ptrs_1,this->aligned.one.directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/2,
+					    this->aligned.one.directions_ptrs_0,this->aligned.one.directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					   this->aligned.one.directions_ptrs_1,this->aligned.one.directions_space_1);
   /* Need to calloc to save time in F loop */
-  *directions_Fgap = aligned_directions8_calloc(rlength_ceil,glength,
-						this->aligned.one.directions_ptrs_2,this->aligned.one.directions_space_2);
+  *directions_Fgap = aligned_dirbits_calloc(rlength_ceil,glength,/*nbits*/1,
+					    this->aligned.one.directions_ptrs_2,this->aligned.one.directions_space_2);
 
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= uband && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_Egap)[c][0] = HORIZ;
-    (*directions_nogap)[c][0] = HORIZ;
+    Dirbits_set_gap(*directions_Egap,c,0,HORIZ);
+    Dirbits_set_nogap(*directions_nogap,c,0,HORIZ);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_nogap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 
 #if 0
@@ -3086,7 +3122,7 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
   /* penalty = open; */
   for (r = 1; r <= SIMD_NCHARS && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][r] = VERT;
+    Dirbits_set_nogap(*directions_nogap,0,r,VERT);
   }
 #endif
 
@@ -3319,9 +3355,9 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 	dir_horiz = _MM_CMPLT_EPI8(E_r_gap,T1); /* E < H */
 	dir_horiz = _MM_ANDNOT_SI(dir_horiz,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_256((*directions_Egap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_Egap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_8(T1,rlo,c,"T1"));
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_Egap"));
@@ -3368,9 +3404,9 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 	dir_horiz = _MM_CMPLT_EPI8(E_r_gap,H_nogap_r); /* E < H */
 	dir_horiz = _MM_ANDNOT_SI(dir_horiz,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_nogap_256((*directions_nogap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_nogap_128((*directions_nogap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_nogap"));
 
@@ -3411,8 +3447,8 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 	    } else {
 	      score_column[rhigh_calc] = (Score8_T) score;
 	    }
-	    (*directions_Egap)[c][rhigh_calc] = DIAG;
-	    (*directions_nogap)[c][rhigh_calc] = DIAG;
+	    Dirbits_set_gap(*directions_Egap,c,rhigh_calc,DIAG);
+	    Dirbits_set_nogap(*directions_nogap,c,rhigh_calc,DIAG);
 	  }
 	}
 
@@ -3452,7 +3488,7 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 			r,c,c_gap + extend,last_nogap + open + extend));
 	  if (c_gap /* + extend */ >= (score = last_nogap + open /* + extend */)) {  /* Use >= for jump late */
 	    c_gap += extend;
-	    (*directions_Fgap)[c][r] = VERT;
+	    Dirbits_set_gap(*directions_Fgap,c,r,VERT);
 	  } else {
 	    c_gap = score + extend;
 	    /* (*directions_Fgap)[c][r] = DIAG: -- Already initialized to DIAG */
@@ -3464,7 +3500,7 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 	  if (c_gap >= last_nogap) {  /* Use >= for jump late */
 	    last_nogap = c_gap;
 	    score_column[r] = (c_gap < NEG_INFINITY_8) ? NEG_INFINITY_8 : (Score8_T) c_gap; /* Saturation */
-	    (*directions_nogap)[c][r] = VERT;
+	    Dirbits_set_nogap(*directions_nogap,c,r,VERT);
 	  }
 	}
 
@@ -3591,9 +3627,9 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 	T1 = _MM_ADDS_EPI8(H_nogap_r, gap_open);
 	dir_horiz = _MM_CMPGT_EPI8(E_r_gap,T1); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_256((*directions_Egap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_Egap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_8(T1,rlo,c,"T1"));
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_Egap"));
@@ -3640,9 +3676,9 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 
 	dir_horiz = _MM_CMPGT_EPI8(E_r_gap,H_nogap_r); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_nogap_256((*directions_nogap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_nogap_128((*directions_nogap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_nogap"));
 
@@ -3684,8 +3720,8 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 	    } else {
 	      score_column[rhigh_calc] = (Score8_T) score;
 	    }
-	    (*directions_Egap)[c][rhigh_calc] = DIAG;
-	    (*directions_nogap)[c][rhigh_calc] = DIAG;
+	    Dirbits_set_gap(*directions_Egap,c,rhigh_calc,DIAG);
+	    Dirbits_set_nogap(*directions_nogap,c,rhigh_calc,DIAG);
 	  }
 	}
 
@@ -3725,7 +3761,7 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 			r,c,c_gap + extend,last_nogap + open + extend));
 	  if (c_gap /* + extend */ > (score = last_nogap + open /* + extend */)) {  /* Use > for jump early */
 	    c_gap += extend;
-	    (*directions_Fgap)[c][r] = VERT;
+	    Dirbits_set_gap(*directions_Fgap,c,r,VERT);
 	  } else {
 	    c_gap = score + extend;
 	    /* (*directions_Fgap)[c][r] = DIAG: -- Already initialized to DIAG */
@@ -3738,7 +3774,7 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 	    last_nogap = c_gap;
 	    score_column[r] = (c_gap < NEG_INFINITY_8) ? NEG_INFINITY_8 : (Score8_T) c_gap; /* Saturation */
 	    debug3(printf("Stored at score_column[%d]: %d\n",r,(Score8_T) score_column[r]));
-	    (*directions_nogap)[c][r] = VERT;
+	    Dirbits_set_nogap(*directions_nogap,c,r,VERT);
 	  }
 	}
 
@@ -3757,8 +3793,8 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = HORIZ;
-  (*directions_Fgap)[0][1] = VERT;
+  Dirbits_set_gap(*directions_Egap,1,0,HORIZ);
+  Dirbits_set_gap(*directions_Fgap,0,1,VERT);
 #endif  
 
 #ifdef DEBUG2
@@ -3773,13 +3809,13 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 #ifdef CHECK1
   /* Check for row 0 directions */
   for (c = 1; c <= uband && c <= glength; c++) {
-    assert((*directions_Egap)[c][0] != DIAG);
-    assert((*directions_nogap)[c][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,c,0) == true);
+    assert(Dirbits_nogap(*directions_nogap,c,0) != DIAG);
   }
   /* Check for column 0 directions */
   for (r = 1; r <= lband && r <= rlength; r++) {
-    assert((*directions_Fgap)[0][r] != DIAG);
-    assert((*directions_nogap)[0][r] != DIAG);
+    assert(Dirbits_gap_p(*directions_Fgap,0,r) == true);
+    assert(Dirbits_nogap(*directions_nogap,0,r) != DIAG);
   }
 #endif
 
@@ -3840,7 +3876,7 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 /* Designed for computation above the main diagonal, so no F loop or bottom masking needed */
 /* Operates by columns */
 Score8_T **
-Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***directions_Egap,
+Dynprog_simd_8_upper_nonavx2 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 			      T this, char *rsequence, char *gsequence, char *gsequence_alt,
 			      int rlength, int glength,
 			      int goffset, Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp,
@@ -3883,31 +3919,31 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 
   matrix = aligned_score8_alloc(rlength_ceil,glength,
 				this->aligned_std.two.upper_matrix_ptrs,this->aligned_std.two.upper_matrix_space);
-  *directions_nogap = aligned_directions8_alloc(rlength_ceil,glength,
-						this->aligned_std.two.upper_directions_ptrs_0,this->aligned_std.two.upper_directions_space_0);
-  *directions_Egap = aligned_directions8_alloc(rlength_ceil,glength,
-					       this->aligned_std.two.upper_directions_ptrs_1,this->aligned_std.two.upper_directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					    this->aligned_std.two.upper_directions_ptrs_0,this->aligned_std.two.upper_directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					   this->aligned_std.two.upper_directions_ptrs_1,this->aligned_std.two.upper_directions_space_1);
 
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= uband && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_Egap)[c][0] = HORIZ;
-    (*directions_nogap)[c][0] = HORIZ;
+    Dirbits_set_gap(*directions_Egap,c,0,HORIZ);
+    Dirbits_set_gap(*directions_nogap,c,0,HORIZ);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_gap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= SIMD_NCHARS_NONAVX2 && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][r] = VERT;
+    Dirbits_set_gap(*directions_nogap,0,r,VERT);
   }
 #endif
 
@@ -4039,7 +4075,7 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 	T1 = _mm_adds_epi8(H_nogap_r, gap_open);
 	dir_horiz = _mm_cmplt_epi8(E_r_gap,T1); /* E < H */
 	dir_horiz = _mm_andnot_si128(dir_horiz,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_Egap)[c],rlo,dir_horiz);
 	debug15(print_vector_8(T1,rlo,c,"T1"));
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_Egap"));
 
@@ -4084,7 +4120,7 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 
 	dir_horiz = _mm_cmplt_epi8(E_r_gap,H_nogap_r); /* E < H */
 	dir_horiz = _mm_andnot_si128(dir_horiz,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_nogap)[c],rlo,dir_horiz);
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_nogap"));
 
 #ifdef HAVE_SSE4_1
@@ -4099,8 +4135,8 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 
 	/* Fix gaps along diagonal to prevent going into lower triangle, which can happen with ties between E and H */
 	if (rhigh >= c) {
-	  (*directions_Egap)[c][c] = DIAG;
-	  (*directions_nogap)[c][c] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,c,c,DIAG);
+	  Dirbits_set_gap(*directions_nogap,c,c,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -4162,7 +4198,7 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 	/* EGAP */
 	T1 = _mm_adds_epi8(H_nogap_r, gap_open);
 	dir_horiz = _mm_cmpgt_epi8(E_r_gap,T1); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_Egap)[c],rlo,dir_horiz);
 	debug15(print_vector_8(T1,rlo,c,"T1"));
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_Egap"));
 
@@ -4207,7 +4243,7 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 	debug15(print_vector_8(H_nogap_r,rlo,c,"H"));
 
 	dir_horiz = _mm_cmpgt_epi8(E_r_gap,H_nogap_r); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_nogap)[c],rlo,dir_horiz);
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_nogap"));
 
 
@@ -4222,8 +4258,8 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 
 	/* Fix gaps along diagonal to prevent going into lower triangle, which can happen with ties between E and H */
 	if (rhigh >= c) {
-	  (*directions_Egap)[c][c] = DIAG;
-	  (*directions_nogap)[c][c] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,c,c,DIAG);
+	  Dirbits_set_gap(*directions_nogap,c,c,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -4235,7 +4271,7 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = HORIZ;
+  Dirbits_set_gap(*directions_Egap,1,0,HORIZ);
 #endif
 
 #ifdef DEBUG2
@@ -4250,8 +4286,8 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 #ifdef CHECK1
   /* Check for row 0 directions */
   for (c = 1; c <= uband && c <= glength; c++) {
-    assert((*directions_Egap)[c][0] != DIAG);
-    assert((*directions_nogap)[c][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,c,0) == true);
+    assert(Dirbits_gap_p(*directions_nogap,c,0) == true);
   }
 #endif
 
@@ -4301,7 +4337,7 @@ Dynprog_simd_8_upper_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 /* Designed for computation above the main diagonal, so no F loop or bottom masking needed */
 /* Operates by columns */
 Score8_T **
-Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directions_Egap,
+Dynprog_simd_8_upper (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 		      T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		      int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -4338,7 +4374,7 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 
 #ifdef DEBUG_AVX2
   Score8_T **matrix_std;
-  Direction8_T **directions_nogap_std, **directions_Egap_std;
+  Dirbits_T **directions_nogap_std, **directions_Egap_std;
   char na2_single;
 #elif defined(DEBUG_SIMD)
   Score32_T **matrix_std;
@@ -4366,31 +4402,31 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 
   matrix = aligned_score8_alloc(rlength_ceil,glength,
 				this->aligned.two.upper_matrix_ptrs,this->aligned.two.upper_matrix_space);
-  *directions_nogap = aligned_directions8_alloc(rlength_ceil,glength,
-						this->aligned.two.upper_directions_ptrs_0,this->aligned.two.upper_directions_space_0);
-  *directions_Egap = aligned_directions8_alloc(rlength_ceil,glength,
-					       this->aligned.two.upper_directions_ptrs_1,this->aligned.two.upper_directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					    this->aligned.two.upper_directions_ptrs_0,this->aligned.two.upper_directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					   this->aligned.two.upper_directions_ptrs_1,this->aligned.two.upper_directions_space_1);
 
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= uband && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_Egap)[c][0] = HORIZ;
-    (*directions_nogap)[c][0] = HORIZ;
+    Dirbits_set_gap(*directions_Egap,c,0,HORIZ);
+    Dirbits_set_gap(*directions_nogap,c,0,HORIZ);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_gap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= SIMD_NCHARS && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][r] = VERT;
+    Dirbits_set_gap(*directions_nogap,0,r,VERT);
   }
 #endif
 
@@ -4531,9 +4567,9 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 	dir_horiz = _MM_CMPLT_EPI8(E_r_gap,T1); /* E < H */
 	dir_horiz = _MM_ANDNOT_SI(dir_horiz,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_256((*directions_Egap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_Egap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_8(T1,rlo,c,"T1"));
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_Egap"));
@@ -4591,9 +4627,9 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 	dir_horiz = _MM_CMPLT_EPI8(E_r_gap,H_nogap_r); /* E < H */
 	dir_horiz = _MM_ANDNOT_SI(dir_horiz,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_256((*directions_nogap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_nogap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_nogap"));
 
@@ -4613,8 +4649,8 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 
 	/* Fix gaps along diagonal to prevent going into lower triangle, which can happen with ties between E and H */
 	if (rhigh >= c) {
-	  (*directions_Egap)[c][c] = DIAG;
-	  (*directions_nogap)[c][c] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,c,c,DIAG);
+	  Dirbits_set_gap(*directions_nogap,c,c,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -4692,9 +4728,9 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 	T1 = _MM_ADDS_EPI8(H_nogap_r, gap_open);
 	dir_horiz = _MM_CMPGT_EPI8(E_r_gap,T1); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_256((*directions_Egap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_Egap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_8(T1,rlo,c,"T1"));
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_Egap"));
@@ -4752,9 +4788,9 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 
 	dir_horiz = _MM_CMPGT_EPI8(E_r_gap,H_nogap_r); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_256((*directions_nogap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits8_store_128((*directions_nogap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_8(dir_horiz,rlo,c,"dir_nogap"));
 
@@ -4774,8 +4810,8 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 
 	/* Fix gaps along diagonal to prevent going into lower triangle, which can happen with ties between E and H */
 	if (rhigh >= c) {
-	  (*directions_Egap)[c][c] = DIAG;
-	  (*directions_nogap)[c][c] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,c,c,DIAG);
+	  Dirbits_set_gap(*directions_nogap,c,c,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -4794,7 +4830,7 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = HORIZ;
+  Dirbits_set_gap(*directions_Egap,1,0,HORIZ);
 #endif
 
 #ifdef DEBUG2
@@ -4809,8 +4845,8 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 #ifdef CHECK1
   /* Check for row 0 directions */
   for (c = 1; c <= uband && c <= glength; c++) {
-    assert((*directions_Egap)[c][0] != DIAG);
-    assert((*directions_nogap)[c][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,c,0) == true);
+    assert(Dirbits_gap_p(*directions_nogap,c,0) == true);
   }
 #endif
 
@@ -4869,7 +4905,7 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 /* Designed for computation below the main diagonal, so no F loop or bottom masking needed */
 /* Operates by rows */
 Score8_T **
-Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***directions_Egap,
+Dynprog_simd_8_lower_nonavx2 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 			      T this, char *rsequence, char *gsequence, char *gsequence_alt,
 			      int rlength, int glength,
 			      int goffset, Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp,
@@ -4911,31 +4947,31 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 
   matrix = aligned_score8_alloc(glength_ceil,rlength,
 				this->aligned_std.two.lower_matrix_ptrs,this->aligned_std.two.lower_matrix_space);
-  *directions_nogap = aligned_directions8_alloc(glength_ceil,rlength,
-						this->aligned_std.two.lower_directions_ptrs_0,this->aligned_std.two.lower_directions_space_0);
-  *directions_Egap = aligned_directions8_alloc(glength_ceil,rlength,
-					       this->aligned_std.two.lower_directions_ptrs_1,this->aligned_std.two.lower_directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(glength_ceil,rlength,/*nbits*/1,
+					    this->aligned_std.two.lower_directions_ptrs_0,this->aligned_std.two.lower_directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(glength_ceil,rlength,/*nbits*/1,
+					   this->aligned_std.two.lower_directions_ptrs_1,this->aligned_std.two.lower_directions_space_1);
 
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= lband && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_Egap)[r][0] = VERT;
-    (*directions_nogap)[r][0] = VERT;
+    Dirbits_set_gap(*directions_Egap,r,0,VERT);
+    Dirbits_set_gap(*directions_nogap,r,0,VERT);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_gap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= SIMD_NCHARS_NONAVX2 && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][c] = HORIZ;
+    Dirbits_set_gap(*directions_nogap,0,c,HORIZ);
   }
 #endif
 
@@ -5103,7 +5139,7 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 	T1 = _mm_adds_epi8(H_nogap_c, gap_open);
 	dir_vert = _mm_cmplt_epi8(E_c_gap,T1); /* E < H */
 	dir_vert = _mm_andnot_si128(dir_vert,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits8_store_128((*directions_Egap)[r],clo,dir_vert);
 	debug15(print_vector_8(T1,clo,r,"T1"));
 	debug15(print_vector_8(dir_vert,clo,r,"dir_Egap"));
 
@@ -5146,7 +5182,7 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 
 	dir_vert = _mm_cmplt_epi8(E_c_gap,H_nogap_c); /* E < H */
 	dir_vert = _mm_andnot_si128(dir_vert,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits8_store_128((*directions_nogap)[r],clo,dir_vert);
 	debug15(print_vector_8(dir_vert,clo,r,"dir_nogap"));
 
 
@@ -5162,8 +5198,8 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 
 	/* Fix gaps along diagonal to prevent going into upper triangle, which can happen with ties between E and H */
 	if (chigh >= r) {
-	  (*directions_Egap)[r][r] = DIAG;
-	  (*directions_nogap)[r][r] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,r,r,DIAG);
+	  Dirbits_set_gap(*directions_nogap,r,r,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -5222,7 +5258,7 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 	/* EGAP */
 	T1 = _mm_adds_epi8(H_nogap_c, gap_open);
 	dir_vert = _mm_cmpgt_epi8(E_c_gap,T1); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits8_store_128((*directions_Egap)[r],clo,dir_vert);
 	debug15(print_vector_8(T1,clo,r,"T1"));
 	debug15(print_vector_8(dir_vert,clo,r,"dir_Egap"));
 
@@ -5265,7 +5301,7 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 	debug15(print_vector_8(H_nogap_c,clo,r,"H"));
 
 	dir_vert = _mm_cmpgt_epi8(E_c_gap,H_nogap_c); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits8_store_128((*directions_nogap)[r],clo,dir_vert);
 	debug15(print_vector_8(dir_vert,clo,r,"dir_nogap"));
 
 
@@ -5280,8 +5316,8 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 
 	/* Fix gaps along diagonal to prevent going into upper triangle, which can happen with ties between E and H */
 	if (chigh >= r) {
-	  (*directions_Egap)[r][r] = DIAG;
-	  (*directions_nogap)[r][r] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,r,r,DIAG);
+	  Dirbits_set_gap(*directions_nogap,r,r,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -5293,7 +5329,7 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = VERT;
+  Dirbits_set_gap(*directions_Egap,1,0,VERT);
 #endif
 
 #ifdef DEBUG2
@@ -5308,8 +5344,8 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 #ifdef CHECK1
   /* Check for column 0 directions */
   for (r = 1; r <= lband && r <= rlength; r++) {
-    assert((*directions_Egap)[r][0] != DIAG);
-    assert((*directions_nogap)[r][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,r,0) == true);
+    assert(Dirbits_gap_p(*directions_nogap,r,0) == true);
   }
 #endif
 
@@ -5337,7 +5373,7 @@ Dynprog_simd_8_lower_nonavx2 (Direction8_T ***directions_nogap, Direction8_T ***
 /* Designed for computation below the main diagonal, so no F loop or bottom masking needed */
 /* Operates by rows */
 Score8_T **
-Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directions_Egap,
+Dynprog_simd_8_lower (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 		      T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		      int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -5373,7 +5409,7 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 
 #ifdef DEBUG_AVX2
   Score8_T **matrix_std;
-  Direction8_T **directions_nogap_std, **directions_Egap_std;
+  Dirbits_T **directions_nogap_std, **directions_Egap_std;
   char na2_single;
 #elif defined(DEBUG_SIMD)
   Score32_T **matrix_std;
@@ -5401,31 +5437,31 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 
   matrix = aligned_score8_alloc(glength_ceil,rlength,
 				this->aligned.two.lower_matrix_ptrs,this->aligned.two.lower_matrix_space);
-  *directions_nogap = aligned_directions8_alloc(glength_ceil,rlength,
-						this->aligned.two.lower_directions_ptrs_0,this->aligned.two.lower_directions_space_0);
-  *directions_Egap = aligned_directions8_alloc(glength_ceil,rlength,
-					       this->aligned.two.lower_directions_ptrs_1,this->aligned.two.lower_directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(glength_ceil,rlength,/*nbits*/1,
+					    this->aligned.two.lower_directions_ptrs_0,this->aligned.two.lower_directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(glength_ceil,rlength,/*nbits*/1,
+					   this->aligned.two.lower_directions_ptrs_1,this->aligned.two.lower_directions_space_1);
 
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= lband && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_Egap)[r][0] = VERT;
-    (*directions_nogap)[r][0] = VERT;
+    Dirbits_set_gap(*directions_Egap,r,0,VERT);
+    Dirbits_set_gap(*directions_nogap,r,0,VERT);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_gap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= SIMD_NCHARS && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][c] = HORIZ;
+    Dirbits_set_gap(*directions_nogap,0,c,HORIZ);
   }
 #endif
 
@@ -5603,9 +5639,9 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 	dir_vert = _MM_CMPLT_EPI8(E_c_gap,T1); /* E < H */
 	dir_vert = _MM_ANDNOT_SI(dir_vert,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits8_store_256((*directions_Egap)[r],clo,dir_vert);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits8_store_128((*directions_Egap)[r],clo,dir_vert);
 #endif
 	debug15(print_vector_8(T1,clo,r,"T1"));
 	debug15(print_vector_8(dir_vert,clo,r,"dir_Egap"));
@@ -5660,9 +5696,9 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 	dir_vert = _MM_CMPLT_EPI8(E_c_gap,H_nogap_c); /* E < H */
 	dir_vert = _MM_ANDNOT_SI(dir_vert,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits8_store_256((*directions_nogap)[r],clo,dir_vert);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits8_store_128((*directions_nogap)[r],clo,dir_vert);
 #endif
 	debug15(print_vector_8(dir_vert,clo,r,"dir_nogap"));
 
@@ -5683,8 +5719,8 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 
 	/* Fix gaps along diagonal to prevent going into upper triangle, which can happen with ties between E and H */
 	if (chigh >= r) {
-	  (*directions_Egap)[r][r] = DIAG;
-	  (*directions_nogap)[r][r] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,r,r,DIAG);
+	  Dirbits_set_gap(*directions_nogap,r,r,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -5759,9 +5795,9 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 	T1 = _MM_ADDS_EPI8(H_nogap_c, gap_open);
 	dir_vert = _MM_CMPGT_EPI8(E_c_gap,T1); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits8_store_256((*directions_Egap)[r],clo,dir_vert);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits8_store_128((*directions_Egap)[r],clo,dir_vert);
 #endif
 	debug15(print_vector_8(T1,clo,r,"T1"));
 	debug15(print_vector_8(dir_vert,clo,r,"dir_Egap"));
@@ -5816,9 +5852,9 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 
 	dir_vert = _MM_CMPGT_EPI8(E_c_gap,H_nogap_c); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits8_store_256((*directions_nogap)[r],clo,dir_vert);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits8_store_128((*directions_nogap)[r],clo,dir_vert);
 #endif
 	debug15(print_vector_8(dir_vert,clo,r,"dir_nogap"));
 
@@ -5838,8 +5874,8 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 
 	/* Fix gaps along diagonal to prevent going into upper triangle, which can happen with ties between E and H */
 	if (chigh >= r) {
-	  (*directions_Egap)[r][r] = DIAG;
-	  (*directions_nogap)[r][r] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,r,r,DIAG);
+	  Dirbits_set_gap(*directions_nogap,r,r,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -5857,7 +5893,7 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = VERT;
+  Dirbits_set_gap(*directions_Egap,1,0,VERT);
 #endif
 
 #ifdef DEBUG2
@@ -5872,8 +5908,8 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 #ifdef CHECK1
   /* Check for column 0 directions */
   for (r = 1; r <= lband && r <= rlength; r++) {
-    assert((*directions_Egap)[r][0] != DIAG);
-    assert((*directions_nogap)[r][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,r,0) == true);
+    assert(Dirbits_gap_p(*directions_nogap,r,0) == true);
   }
 #endif
 
@@ -5931,8 +5967,8 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 
 #ifdef DEBUG_AVX2
 Score16_T **
-Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***directions_Egap,
-			 Direction16_T ***directions_Fgap,
+Dynprog_simd_16_nonavx2 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
+			 Dirbits_T ***directions_Fgap,
 			 T this, char *rsequence, char *gsequence, char *gsequence_alt,
 			 int rlength, int glength,
 			 int goffset, Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp,
@@ -5966,34 +6002,34 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 
   matrix = aligned_score16_alloc(rlength_ceil,glength,
 				 this->aligned_std.one.matrix_ptrs,this->aligned_std.one.matrix_space);
-  *directions_nogap = aligned_directions16_alloc(rlength_ceil,glength,
-						 this->aligned_std.one.directions_ptrs_0,this->aligned_std.one.directions_space_0);
-  *directions_Egap = aligned_directions16_alloc(rlength_ceil,glength,
-						this->aligned_std.one.directions_ptrs_1,this->aligned_std.one.directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/2,
+					    this->aligned_std.one.directions_ptrs_0,this->aligned_std.one.directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					   this->aligned_std.one.directions_ptrs_1,this->aligned_std.one.directions_space_1);
   /* Need to calloc to save time in F loop */
-  *directions_Fgap = aligned_directions16_calloc(rlength_ceil,glength,
-						 this->aligned_std.one.directions_ptrs_2,this->aligned_std.one.directions_space_2);
+  *directions_Fgap = aligned_dirbits_calloc(rlength_ceil,glength,/*nbits*/1,
+					    this->aligned_std.one.directions_ptrs_2,this->aligned_std.one.directions_space_2);
 
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= uband && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_Egap)[c][0] = HORIZ;
-    (*directions_nogap)[c][0] = HORIZ;
+    Dirbits_set_gap(*directions_Egap,c,0,HORIZ);
+    Dirbits_set_nogap(*directions_nogap,c,0,HORIZ);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually, no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_nogap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= SIMD_NSHORTS_NONAVX2 && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][r] = VERT;
+    Dirbits_set_nogap(*directions_nogap,0,r,VERT);
   }
 #endif
 
@@ -6180,7 +6216,7 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 	T1 = _mm_adds_epi16(H_nogap_r, gap_open);
 	dir_horiz = _mm_cmplt_epi16(E_r_gap,T1); /* E < H */
 	dir_horiz = _mm_andnot_si128(dir_horiz,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_Egap)[c],rlo,dir_horiz);
 	debug15(print_vector_16(T1,rlo,c,"T1"));
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_Egap"));
 
@@ -6204,7 +6240,7 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 
 	dir_horiz = _mm_cmplt_epi16(E_r_gap,H_nogap_r); /* E < H */
 	dir_horiz = _mm_andnot_si128(dir_horiz,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_nogap_128((*directions_nogap)[c],rlo,dir_horiz);
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_nogap"));
 
 	H_nogap_r = _mm_max_epi16(H_nogap_r, E_r_gap); /* Compare H + pairscores with horiz + extend */
@@ -6232,8 +6268,8 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 	    } else {
 	      score_column[rhigh_calc] = (Score16_T) score;
 	    }
-	    (*directions_Egap)[c][rhigh_calc] = DIAG;
-	    (*directions_nogap)[c][rhigh_calc] = DIAG;
+	    Dirbits_set_gap(*directions_Egap,c,rhigh_calc,DIAG);
+	    Dirbits_set_nogap(*directions_nogap,c,rhigh_calc,DIAG);
 	  }
 	}
 
@@ -6273,7 +6309,7 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 			r,c,c_gap + extend,last_nogap + open + extend));
 	  if (c_gap /* + extend */ >= (score = last_nogap + open /* + extend */)) {  /* Use >= for jump late */
 	    c_gap += extend;
-	    (*directions_Fgap)[c][r] = VERT;
+	    Dirbits_set_gap(*directions_Fgap,c,r,VERT);
 	  } else {
 	    c_gap = score + extend;
 	    /* (*directions_Fgap)[c][r] = DIAG: -- Already initialized to DIAG */
@@ -6285,7 +6321,7 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 	  if (c_gap >= last_nogap) {  /* Use >= for jump late */
 	    last_nogap = c_gap;
 	    score_column[r] = (c_gap < NEG_INFINITY_16) ? NEG_INFINITY_16 : (Score16_T) c_gap; /* Saturation */
-	    (*directions_nogap)[c][r] = VERT;
+	    Dirbits_set_nogap(*directions_nogap,c,r,VERT);
 	  }
 	}
 
@@ -6387,7 +6423,7 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 	/* EGAP */
 	T1 = _mm_adds_epi16(H_nogap_r, gap_open);
 	dir_horiz = _mm_cmpgt_epi16(E_r_gap,T1); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_Egap)[c],rlo,dir_horiz);
 	debug15(print_vector_16(T1,rlo,c,"T1"));
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_Egap"));
 
@@ -6410,7 +6446,7 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 	debug15(print_vector_16(H_nogap_r,rlo,c,"H"));
 
 	dir_horiz = _mm_cmpgt_epi16(E_r_gap,H_nogap_r); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_nogap_128((*directions_nogap)[c],rlo,dir_horiz);
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_nogap"));
 
 	H_nogap_r = _mm_max_epi16(H_nogap_r, E_r_gap); /* Compare H + pairscores with horiz + extend */
@@ -6438,8 +6474,8 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 	    } else {
 	      score_column[rhigh_calc] = (Score16_T) score;
 	    }
-	    (*directions_Egap)[c][rhigh_calc] = DIAG;
-	    (*directions_nogap)[c][rhigh_calc] = DIAG;
+	    Dirbits_set_gap(*directions_Egap,c,rhigh_calc,DIAG);
+	    Dirbits_set_nogap(*directions_nogap,c,rhigh_calc,DIAG);
 	  }
 	}
 
@@ -6478,7 +6514,7 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 			r,c,c_gap + extend,last_nogap + open + extend));
 	  if (c_gap /* + extend */ > (score = last_nogap + open /* + extend */)) {  /* Use > for jump early */
 	    c_gap += extend;
-	    (*directions_Fgap)[c][r] = VERT;
+	    Dirbits_set_gap(*directions_Fgap,c,r,VERT);
 	  } else {
 	    c_gap = score + extend;
 	    /* (*directions_Fgap)[c][r] = DIAG: -- Already initialized to DIAG */
@@ -6490,7 +6526,7 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 	  if (c_gap > last_nogap) {  /* Use > for jump early */
 	    last_nogap = c_gap;
 	    score_column[r] = (c_gap < NEG_INFINITY_16) ? NEG_INFINITY_16 : (Score16_T) c_gap; /* Saturation */
-	    (*directions_nogap)[c][r] = VERT;
+	    Dirbits_set_nogap(*directions_nogap,c,r,VERT);
 	  }
 	}
 
@@ -6505,8 +6541,8 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = HORIZ;
-  (*directions_Fgap)[0][1] = VERT;
+  Dirbits_set_gap(*directions_Egap,1,0,HORIZ);
+  Dirbits_set_gap(*directions_Fgap,0,1,VERT);
 #endif
 
 
@@ -6521,13 +6557,13 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 #ifdef CHECK1
   /* Check for row 0 directions */
   for (c = 1; c <= uband && c <= glength; c++) {
-    assert((*directions_Egap)[c][0] != DIAG);
-    assert((*directions_nogap)[c][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,c,0) == true);
+    assert(Dirbits_nogap(*directions_nogap,c,0) != DIAG);
   }
   /* Check for column 0 directions */
   for (r = 1; r <= lband && r <= rlength; r++) {
-    assert((*directions_Fgap)[0][r] != DIAG);
-    assert((*directions_nogap)[0][r] != DIAG);
+    assert(Dirbits_gap_p(*directions_Fgap,0,r) == true);
+    assert(Dirbits_nogap(*directions_nogap,0,r) != DIAG);
   }
 #endif
 
@@ -6559,8 +6595,8 @@ Dynprog_simd_16_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***dir
 #if defined(HAVE_SSE2)
 /* Modified from Dynprog_simd_16_upper.  Operates by columns. */
 Score16_T **
-Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_Egap,
-		 Direction16_T ***directions_Fgap,
+Dynprog_simd_16 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
+		 Dirbits_T ***directions_Fgap,
 		 T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		 int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -6605,7 +6641,7 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 
 #if defined(DEBUG_AVX2)
   Score16_T **matrix_std;
-  Direction16_T **directions_nogap_std, **directions_Egap_std, **directions_Fgap_std;
+  Dirbits_T **directions_nogap_std, **directions_Egap_std, **directions_Fgap_std;
 #elif defined(DEBUG_SIMD)
   Score32_T **matrix_std;
   Direction32_T **directions_nogap_std, **directions_Egap_std, **directions_Fgap_std;
@@ -6625,34 +6661,34 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 
   matrix = aligned_score16_alloc(rlength_ceil,glength,
 				 this->aligned.one.matrix_ptrs,this->aligned.one.matrix_space);
-  *directions_nogap = aligned_directions16_alloc(rlength_ceil,glength,
-						 this->aligned.one.directions_ptrs_0,this->aligned.one.directions_space_0);
-  *directions_Egap = aligned_directions16_alloc(rlength_ceil,glength,
-						this->aligned.one.directions_ptrs_1,this->aligned.one.directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/2,
+					    this->aligned.one.directions_ptrs_0,this->aligned.one.directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					   this->aligned.one.directions_ptrs_1,this->aligned.one.directions_space_1);
   /* Need to calloc to save time in F loop */
-  *directions_Fgap = aligned_directions16_calloc(rlength_ceil,glength,
-						 this->aligned.one.directions_ptrs_2,this->aligned.one.directions_space_2);
+  *directions_Fgap = aligned_dirbits_calloc(rlength_ceil,glength,/*nbits*/1,
+					    this->aligned.one.directions_ptrs_2,this->aligned.one.directions_space_2);
 
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= uband && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_Egap)[c][0] = HORIZ;
-    (*directions_nogap)[c][0] = HORIZ;
+    Dirbits_set_gap(*directions_Egap,c,0,HORIZ);
+    Dirbits_set_nogap(*directions_nogap,c,0,HORIZ);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually, no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_nogap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= SIMD_NSHORTS && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][r] = VERT;
+    Dirbits_set_nogap(*directions_nogap,0,r,VERT);
   }
 #endif
 
@@ -6865,9 +6901,9 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 	dir_horiz = _MM_CMPLT_EPI16(E_r_gap,T1); /* E < H */
 	dir_horiz = _MM_ANDNOT_SI(dir_horiz,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_256((*directions_Egap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_Egap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_16(T1,rlo,c,"T1"));
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_Egap"));
@@ -6905,9 +6941,9 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 	dir_horiz = _MM_CMPLT_EPI16(E_r_gap,H_nogap_r); /* E < H */
 	dir_horiz = _MM_ANDNOT_SI(dir_horiz,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_nogap_256((*directions_nogap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_nogap_128((*directions_nogap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_nogap"));
 
@@ -6940,8 +6976,8 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 	    } else {
 	      score_column[rhigh_calc] = (Score16_T) score;
 	    }
-	    (*directions_Egap)[c][rhigh_calc] = DIAG;
-	    (*directions_nogap)[c][rhigh_calc] = DIAG;
+	    Dirbits_set_gap(*directions_Egap,c,rhigh_calc,DIAG);
+	    Dirbits_set_nogap(*directions_nogap,c,rhigh_calc,DIAG);
 	  }
 	}
 
@@ -6981,7 +7017,7 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 			r,c,c_gap + extend,last_nogap + open + extend));
 	  if (c_gap /* + extend */ >= (score = last_nogap + open /* + extend */)) {  /* Use >= for jump late */
 	    c_gap += extend;
-	    (*directions_Fgap)[c][r] = VERT;
+	    Dirbits_set_gap(*directions_Fgap,c,r,VERT);
 	  } else {
 	    c_gap = score + extend;
 	    /* (*directions_Fgap)[c][r] = DIAG: -- Already initialized to DIAG */
@@ -6993,7 +7029,7 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 	  if (c_gap >= last_nogap) {  /* Use >= for jump late */
 	    last_nogap = c_gap;
 	    score_column[r] = (c_gap < NEG_INFINITY_16) ? NEG_INFINITY_16 : (Score16_T) c_gap; /* Saturation */
-	    (*directions_nogap)[c][r] = VERT;
+	    Dirbits_set_nogap(*directions_nogap,c,r,VERT);
 	  }
 	}
 
@@ -7120,9 +7156,9 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 	T1 = _MM_ADDS_EPI16(H_nogap_r, gap_open);
 	dir_horiz = _MM_CMPGT_EPI16(E_r_gap,T1); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_256((*directions_Egap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_Egap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_16(T1,rlo,c,"T1"));
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_Egap"));
@@ -7159,9 +7195,9 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 
 	dir_horiz = _MM_CMPGT_EPI16(E_r_gap,H_nogap_r); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_nogap_256((*directions_nogap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_nogap_128((*directions_nogap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_nogap"));
 
@@ -7194,8 +7230,8 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 	    } else {
 	      score_column[rhigh_calc] = (Score16_T) score;
 	    }
-	    (*directions_Egap)[c][rhigh_calc] = DIAG;
-	    (*directions_nogap)[c][rhigh_calc] = DIAG;
+	    Dirbits_set_gap(*directions_Egap,c,rhigh_calc,DIAG);
+	    Dirbits_set_nogap(*directions_nogap,c,rhigh_calc,DIAG);
 	  }
 	}
 
@@ -7234,7 +7270,7 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 			r,c,c_gap + extend,last_nogap + open + extend));
 	  if (c_gap /* + extend */ > (score = last_nogap + open /* + extend */)) {  /* Use > for jump early */
 	    c_gap += extend;
-	    (*directions_Fgap)[c][r] = VERT;
+	    Dirbits_set_gap(*directions_Fgap,c,r,VERT);
 	  } else {
 	    c_gap = score + extend;
 	    /* (*directions_Fgap)[c][r] = DIAG: -- Already initialized to DIAG */
@@ -7246,7 +7282,7 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 	  if (c_gap > last_nogap) {  /* Use > for jump early */
 	    last_nogap = c_gap;
 	    score_column[r] = (c_gap < NEG_INFINITY_16) ? NEG_INFINITY_16 : (Score16_T) c_gap; /* Saturation */
-	    (*directions_nogap)[c][r] = VERT;
+	    Dirbits_set_nogap(*directions_nogap,c,r,VERT);
 	  }
 	}
 
@@ -7265,8 +7301,8 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = HORIZ;
-  (*directions_Fgap)[0][1] = VERT;
+  Dirbits_set_gap(*directions_Egap,1,0,HORIZ);
+  Dirbits_set_gap(*directions_Fgap,0,1,VERT);
 #endif
 
 
@@ -7282,13 +7318,13 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 #ifdef CHECK1
   /* Check for row 0 directions */
   for (c = 1; c <= uband && c <= glength; c++) {
-    assert((*directions_Egap)[c][0] != DIAG);
-    assert((*directions_nogap)[c][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,c,0) == true);
+    assert(Dirbits_nogap(*directions_nogap,c,0) != DIAG);
   }
   /* Check for column 0 directions */
   for (r = 1; r <= lband && r <= rlength; r++) {
-    assert((*directions_Fgap)[0][r] != DIAG);
-    assert((*directions_nogap)[0][r] != DIAG);
+    assert(Dirbits_gap_p(*directions_Fgap,0,r) == true);
+    assert(Dirbits_nogap(*directions_nogap,0,r) != DIAG);
   }
 #endif
 
@@ -7350,7 +7386,7 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 /* Designed for computation above the diagonal, so no F loop or bottom masking needed */
 /* Operates by columns */
 Score16_T **
-Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***directions_Egap,
+Dynprog_simd_16_upper_nonavx2 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 			       T this, char *rsequence, char *gsequence, char *gsequence_alt,
 			       int rlength, int glength,
 			       int goffset, Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp,
@@ -7380,31 +7416,31 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 
   matrix = aligned_score16_alloc(rlength_ceil,glength,
 				 this->aligned_std.two.upper_matrix_ptrs,this->aligned_std.two.upper_matrix_space);
-  *directions_nogap = aligned_directions16_alloc(rlength_ceil,glength,
-						 this->aligned_std.two.upper_directions_ptrs_0,this->aligned_std.two.upper_directions_space_0);
-  *directions_Egap = aligned_directions16_alloc(rlength_ceil,glength,
-						this->aligned_std.two.upper_directions_ptrs_1,this->aligned_std.two.upper_directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					    this->aligned_std.two.upper_directions_ptrs_0,this->aligned_std.two.upper_directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					   this->aligned_std.two.upper_directions_ptrs_1,this->aligned_std.two.upper_directions_space_1);
 
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= uband && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_Egap)[c][0] = HORIZ;
-    (*directions_nogap)[c][0] = HORIZ;
+    Dirbits_set_gap(*directions_Egap,c,0,HORIZ);
+    Dirbits_set_gap(*directions_nogap,c,0,HORIZ);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually, no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_gap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= SIMD_NSHORTS_NONAVX2 && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][r] = VERT;
+    Dirbits_set_gap(*directions_nogap,0,r,VERT);
   }
 #endif
 
@@ -7526,7 +7562,7 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 	T1 = _mm_adds_epi16(H_nogap_r, gap_open);
 	dir_horiz = _mm_cmplt_epi16(E_r_gap,T1); /* E < H */
 	dir_horiz = _mm_andnot_si128(dir_horiz,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_Egap)[c],rlo,dir_horiz);
 	debug15(print_vector_16(T1,rlo,c,"T1"));
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_Egap"));
 
@@ -7551,7 +7587,7 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 
 	dir_horiz = _mm_cmplt_epi16(E_r_gap,H_nogap_r); /* E < H */
 	dir_horiz = _mm_andnot_si128(dir_horiz,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_nogap)[c],rlo,dir_horiz);
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_nogap"));
 
 	H_nogap_r = _mm_max_epi16(H_nogap_r, E_r_gap); /* Compare H + pairscores with horiz + extend */
@@ -7561,8 +7597,8 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 
 	/* Fix gaps along diagonal to prevent going into lower triangle, which can happen with ties between E and H */
 	if (rhigh >= c) {
-	  (*directions_Egap)[c][c] = DIAG;
-	  (*directions_nogap)[c][c] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,c,c,DIAG);
+	  Dirbits_set_gap(*directions_nogap,c,c,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -7620,7 +7656,7 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 	/* EGAP */
 	T1 = _mm_adds_epi16(H_nogap_r, gap_open);
 	dir_horiz = _mm_cmpgt_epi16(E_r_gap,T1); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_Egap)[c],rlo,dir_horiz);
 	debug15(print_vector_16(T1,rlo,c,"T1"));
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_Egap"));
 
@@ -7644,7 +7680,7 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 	debug15(print_vector_16(H_nogap_r,rlo,c,"H"));
 
 	dir_horiz = _mm_cmpgt_epi16(E_r_gap,H_nogap_r); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_nogap)[c],rlo,dir_horiz);
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_nogap"));
 
 	H_nogap_r = _mm_max_epi16(H_nogap_r, E_r_gap); /* Compare H + pairscores with horiz + extend */
@@ -7654,8 +7690,8 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 
 	/* Fix gaps along diagonal to prevent going into lower triangle, which can happen with ties between E and H */
 	if (rhigh >= c) {
-	  (*directions_Egap)[c][c] = DIAG;
-	  (*directions_nogap)[c][c] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,c,c,DIAG);
+	  Dirbits_set_gap(*directions_nogap,c,c,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -7667,7 +7703,7 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = HORIZ;
+  Dirbits_set_gap(*directions_Egap,1,0,HORIZ);
 #endif
 
 #ifdef DEBUG2
@@ -7682,8 +7718,8 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 #ifdef CHECK1
   /* Check for row 0 directions */
   for (c = 1; c <= uband && c <= glength; c++) {
-    assert((*directions_Egap)[c][0] != DIAG);
-    assert((*directions_nogap)[c][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,c,0) == true);
+    assert(Dirbits_gap_p(*directions_nogap,c,0) == true);
   }
 #endif
 
@@ -7711,7 +7747,7 @@ Dynprog_simd_16_upper_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 /* Designed for computation above the diagonal, so no F loop or bottom masking needed */
 /* Operates by columns */
 Score16_T **
-Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***directions_Egap,
+Dynprog_simd_16_upper (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 		       T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		       int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -7740,7 +7776,7 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 
 #ifdef DEBUG_AVX2
   Score16_T **matrix_std;
-  Direction16_T **directions_nogap_std, **directions_Egap_std;
+  Dirbits_T **directions_nogap_std, **directions_Egap_std;
   char na2_single;
 #elif defined(DEBUG_SIMD)
   Score32_T **matrix_std;
@@ -7761,31 +7797,31 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 
   matrix = aligned_score16_alloc(rlength_ceil,glength,
 				 this->aligned.two.upper_matrix_ptrs,this->aligned.two.upper_matrix_space);
-  *directions_nogap = aligned_directions16_alloc(rlength_ceil,glength,
-						 this->aligned.two.upper_directions_ptrs_0,this->aligned.two.upper_directions_space_0);
-  *directions_Egap = aligned_directions16_alloc(rlength_ceil,glength,
-						this->aligned.two.upper_directions_ptrs_1,this->aligned.two.upper_directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					    this->aligned.two.upper_directions_ptrs_0,this->aligned.two.upper_directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(rlength_ceil,glength,/*nbits*/1,
+					   this->aligned.two.upper_directions_ptrs_1,this->aligned.two.upper_directions_space_1);
 
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= uband && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_Egap)[c][0] = HORIZ;
-    (*directions_nogap)[c][0] = HORIZ;
+    Dirbits_set_gap(*directions_Egap,c,0,HORIZ);
+    Dirbits_set_gap(*directions_nogap,c,0,HORIZ);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually, no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_gap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= SIMD_NSHORTS && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][r] = VERT;
+    Dirbits_set_gap(*directions_nogap,0,r,VERT);
   }
 #endif
 
@@ -7917,9 +7953,9 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 	dir_horiz = _MM_CMPLT_EPI16(E_r_gap,T1); /* E < H */
 	dir_horiz = _MM_ANDNOT_SI(dir_horiz,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_256((*directions_Egap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_Egap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_16(T1,rlo,c,"T1"));
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_Egap"));
@@ -7958,9 +7994,9 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 	dir_horiz = _MM_CMPLT_EPI16(E_r_gap,H_nogap_r); /* E < H */
 	dir_horiz = _MM_ANDNOT_SI(dir_horiz,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_256((*directions_nogap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_nogap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_nogap"));
 
@@ -7974,8 +8010,8 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 
 	/* Fix gaps along diagonal to prevent going into lower triangle, which can happen with ties between E and H */
 	if (rhigh >= c) {
-	  (*directions_Egap)[c][c] = DIAG;
-	  (*directions_nogap)[c][c] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,c,c,DIAG);
+	  Dirbits_set_gap(*directions_nogap,c,c,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -8047,9 +8083,9 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 	T1 = _MM_ADDS_EPI16(H_nogap_r, gap_open);
 	dir_horiz = _MM_CMPGT_EPI16(E_r_gap,T1); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_256((*directions_Egap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_Egap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_16(T1,rlo,c,"T1"));
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_Egap"));
@@ -8087,9 +8123,9 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 
 	dir_horiz = _MM_CMPGT_EPI16(E_r_gap,H_nogap_r); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_256((*directions_nogap)[c],rlo,dir_horiz);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[c][rlo]),dir_horiz);
+	dirbits16_store_128((*directions_nogap)[c],rlo,dir_horiz);
 #endif
 	debug15(print_vector_16(dir_horiz,rlo,c,"dir_nogap"));
 
@@ -8103,8 +8139,8 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 
 	/* Fix gaps along diagonal to prevent going into lower triangle, which can happen with ties between E and H */
 	if (rhigh >= c) {
-	  (*directions_Egap)[c][c] = DIAG;
-	  (*directions_nogap)[c][c] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,c,c,DIAG);
+	  Dirbits_set_gap(*directions_nogap,c,c,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -8122,7 +8158,7 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = HORIZ;
+  Dirbits_set_gap(*directions_Egap,1,0,HORIZ);
 #endif
 
 #ifdef DEBUG2
@@ -8137,8 +8173,8 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 #ifdef CHECK1
   /* Check for row 0 directions */
   for (c = 1; c <= uband && c <= glength; c++) {
-    assert((*directions_Egap)[c][0] != DIAG);
-    assert((*directions_nogap)[c][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,c,0) == true);
+    assert(Dirbits_gap_p(*directions_nogap,c,0) == true);
   }
 #endif
 
@@ -8198,7 +8234,7 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 /* Designed for computation below the diagonal, so no F loop or bottom masking needed */
 /* Operates by rows */
 Score16_T **
-Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T ***directions_Egap,
+Dynprog_simd_16_lower_nonavx2 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 			       T this, char *rsequence, char *gsequence, char *gsequence_alt,
 			       int rlength, int glength,
 			       int goffset, Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp,
@@ -8227,31 +8263,31 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 
   matrix = aligned_score16_alloc(glength_ceil,rlength,
 				 this->aligned_std.two.lower_matrix_ptrs,this->aligned_std.two.lower_matrix_space);
-  *directions_nogap = aligned_directions16_alloc(glength_ceil,rlength,
-						 this->aligned_std.two.lower_directions_ptrs_0,this->aligned_std.two.lower_directions_space_0);
-  *directions_Egap = aligned_directions16_alloc(glength_ceil,rlength,
-						this->aligned_std.two.lower_directions_ptrs_1,this->aligned_std.two.lower_directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(glength_ceil,rlength,/*nbits*/1,
+					    this->aligned_std.two.lower_directions_ptrs_0,this->aligned_std.two.lower_directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(glength_ceil,rlength,/*nbits*/1,
+					   this->aligned_std.two.lower_directions_ptrs_1,this->aligned_std.two.lower_directions_space_1);
 
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= lband && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_Egap)[r][0] = VERT;
-    (*directions_nogap)[r][0] = VERT;
+    Dirbits_set_gap(*directions_Egap,r,0,VERT);
+    Dirbits_set_gap(*directions_nogap,r,0,VERT);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually, no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_gap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= SIMD_NSHORTS_NONAVX2 && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][c] = HORIZ;
+    Dirbits_set_gap(*directions_nogap,0,c,HORIZ);
   }
 #endif
 
@@ -8402,7 +8438,7 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 	T1 = _mm_adds_epi16(H_nogap_c, gap_open);
 	dir_vert = _mm_cmplt_epi16(E_c_gap,T1); /* E < H */
 	dir_vert = _mm_andnot_si128(dir_vert,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits16_store_128((*directions_Egap)[r],clo,dir_vert);
 	debug15(print_vector_16(T1,clo,r,"T1"));
 	debug15(print_vector_16(dir_vert,clo,r,"dir_Egap"));
 
@@ -8426,7 +8462,7 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 
 	dir_vert = _mm_cmplt_epi16(E_c_gap,H_nogap_c); /* E < H */
 	dir_vert = _mm_andnot_si128(dir_vert,complement_dummy);	/* E >= H, for jump late */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits16_store_128((*directions_nogap)[r],clo,dir_vert);
 	debug15(print_vector_16(dir_vert,clo,r,"dir_nogap"));
 
 	H_nogap_c = _mm_max_epi16(H_nogap_c, E_c_gap); /* Compare H + pairscores with horiz + extend */
@@ -8436,8 +8472,8 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 
 	/* Fix gaps along diagonal to prevent going into upper triangle, which can happen with ties between E and H */
 	if (chigh >= r) {
-	  (*directions_Egap)[r][r] = DIAG;
-	  (*directions_nogap)[r][r] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,r,r,DIAG);
+	  Dirbits_set_gap(*directions_nogap,r,r,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -8492,7 +8528,7 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 	/* EGAP */
 	T1 = _mm_adds_epi16(H_nogap_c, gap_open);
 	dir_vert = _mm_cmpgt_epi16(E_c_gap,T1); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits16_store_128((*directions_Egap)[r],clo,dir_vert);
 	debug15(print_vector_16(T1,clo,r,"T1"));
 	debug15(print_vector_16(dir_vert,clo,r,"dir_Egap"));
 
@@ -8515,7 +8551,7 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 	debug15(print_vector_16(H_nogap_c,clo,r,"H"));
 
 	dir_vert = _mm_cmpgt_epi16(E_c_gap,H_nogap_c); /* E > H, for jump early */
-	_mm_store_si128((__m128i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits16_store_128((*directions_nogap)[r],clo,dir_vert);
 	debug15(print_vector_16(dir_vert,clo,r,"dir_nogap"));
 
 	H_nogap_c = _mm_max_epi16(H_nogap_c, E_c_gap); /* Compare H + pairscores with horiz + extend */
@@ -8525,8 +8561,8 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 
 	/* Fix gaps along diagonal to prevent going into upper triangle, which can happen with ties between E and H */
 	if (chigh >= r) {
-	  (*directions_Egap)[r][r] = DIAG;
-	  (*directions_nogap)[r][r] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,r,r,DIAG);
+	  Dirbits_set_gap(*directions_nogap,r,r,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -8539,7 +8575,7 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = VERT;
+  Dirbits_set_gap(*directions_Egap,1,0,VERT);
 #endif
 
 #ifdef DEBUG2
@@ -8554,8 +8590,8 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 #ifdef CHECK1
   /* Check for column 0 directions */
   for (r = 1; r <= lband && r <= rlength; r++) {
-    assert((*directions_Egap)[r][0] != DIAG);
-    assert((*directions_nogap)[r][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,r,0) == true);
+    assert(Dirbits_gap_p(*directions_nogap,r,0) == true);
   }
 #endif
 
@@ -8583,7 +8619,7 @@ Dynprog_simd_16_lower_nonavx2 (Direction16_T ***directions_nogap, Direction16_T
 /* Designed for computation below the diagonal, so no F loop or bottom masking needed */
 /* Operates by rows */
 Score16_T **
-Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***directions_Egap,
+Dynprog_simd_16_lower (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 		       T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		       int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -8612,7 +8648,7 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 
 #ifdef DEBUG_AVX2
   Score16_T **matrix_std;
-  Direction16_T **directions_nogap_std, **directions_Egap_std;
+  Dirbits_T **directions_nogap_std, **directions_Egap_std;
   char na2_single;
 #elif defined(DEBUG_SIMD)
   Score32_T **matrix_std;
@@ -8633,31 +8669,31 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 
   matrix = aligned_score16_alloc(glength_ceil,rlength,
 				 this->aligned.two.lower_matrix_ptrs,this->aligned.two.lower_matrix_space);
-  *directions_nogap = aligned_directions16_alloc(glength_ceil,rlength,
-						 this->aligned.two.lower_directions_ptrs_0,this->aligned.two.lower_directions_space_0);
-  *directions_Egap = aligned_directions16_alloc(glength_ceil,rlength,
-						this->aligned.two.lower_directions_ptrs_1,this->aligned.two.lower_directions_space_1);
+  *directions_nogap = aligned_dirbits_alloc(glength_ceil,rlength,/*nbits*/1,
+					    this->aligned.two.lower_directions_ptrs_0,this->aligned.two.lower_directions_space_0);
+  *directions_Egap = aligned_dirbits_alloc(glength_ceil,rlength,/*nbits*/1,
+					   this->aligned.two.lower_directions_ptrs_1,this->aligned.two.lower_directions_space_1);
 
 #if 0
   /* Column 0 initialization */
   /* penalty = open; */
   for (r = 1; r <= lband && r <= rlength; r++) {
     /* penalty += extend; */
-    (*directions_Egap)[r][0] = VERT;
-    (*directions_nogap)[r][0] = VERT;
+    Dirbits_set_gap(*directions_Egap,r,0,VERT);
+    Dirbits_set_gap(*directions_nogap,r,0,VERT);
   }
 #endif
 #if 0
   /* Already initialized to DIAG.  Actually, no longer initializing directions_Egap */
-  (*directions_Egap)[1][0] = DIAG; /* previously used STOP */
-  (*directions_nogap)[0][0] = DIAG; /* previously used STOP */
+  Dirbits_set_gap(*directions_Egap,1,0,DIAG); /* previously used STOP */
+  Dirbits_set_gap(*directions_nogap,0,0,DIAG); /* previously used STOP */
 #endif
 #if 0
   /* Row 0 initialization */
   /* penalty = open; */
   for (c = 1; c <= SIMD_NSHORTS && c <= glength; c++) {
     /* penalty += extend; */
-    (*directions_nogap)[0][c] = HORIZ;
+    Dirbits_set_gap(*directions_nogap,0,c,HORIZ);
   }
 #endif
 
@@ -8818,9 +8854,9 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 	dir_vert = _MM_CMPLT_EPI16(E_c_gap,T1); /* E < H */
 	dir_vert = _MM_ANDNOT_SI(dir_vert,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits16_store_256((*directions_Egap)[r],clo,dir_vert);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits16_store_128((*directions_Egap)[r],clo,dir_vert);
 #endif
 	debug15(print_vector_16(T1,clo,r,"T1"));
 	debug15(print_vector_16(dir_vert,clo,r,"dir_Egap"));
@@ -8857,9 +8893,9 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 	dir_vert = _MM_CMPLT_EPI16(E_c_gap,H_nogap_c); /* E < H */
 	dir_vert = _MM_ANDNOT_SI(dir_vert,complement_dummy);	/* E >= H, for jump late */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits16_store_256((*directions_nogap)[r],clo,dir_vert);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits16_store_128((*directions_nogap)[r],clo,dir_vert);
 #endif
 	debug15(print_vector_16(dir_vert,clo,r,"dir_nogap"));
 
@@ -8874,8 +8910,8 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 
 	/* Fix gaps along diagonal to prevent going into upper triangle, which can happen with ties between E and H */
 	if (chigh >= r) {
-	  (*directions_Egap)[r][r] = DIAG;
-	  (*directions_nogap)[r][r] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,r,r,DIAG);
+	  Dirbits_set_gap(*directions_nogap,r,r,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -8946,9 +8982,9 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 	T1 = _MM_ADDS_EPI16(H_nogap_c, gap_open);
 	dir_vert = _MM_CMPGT_EPI16(E_c_gap,T1); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits16_store_256((*directions_Egap)[r],clo,dir_vert);
 #else
-	_mm_store_si128((__m128i *) &((*directions_Egap)[r][clo]),dir_vert);
+	dirbits16_store_128((*directions_Egap)[r],clo,dir_vert);
 #endif
 	debug15(print_vector_16(T1,clo,r,"T1"));
 	debug15(print_vector_16(dir_vert,clo,r,"dir_Egap"));
@@ -8984,9 +9020,9 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 
 	dir_vert = _MM_CMPGT_EPI16(E_c_gap,H_nogap_c); /* E > H, for jump early */
 #ifdef HAVE_AVX2
-	_mm256_store_si256((__m256i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits16_store_256((*directions_nogap)[r],clo,dir_vert);
 #else
-	_mm_store_si128((__m128i *) &((*directions_nogap)[r][clo]),dir_vert);
+	dirbits16_store_128((*directions_nogap)[r],clo,dir_vert);
 #endif
 	debug15(print_vector_16(dir_vert,clo,r,"dir_nogap"));
 
@@ -9001,8 +9037,8 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 
 	/* Fix gaps along diagonal to prevent going into upper triangle, which can happen with ties between E and H */
 	if (chigh >= r) {
-	  (*directions_Egap)[r][r] = DIAG;
-	  (*directions_nogap)[r][r] = DIAG;
+	  Dirbits_set_gap(*directions_Egap,r,r,DIAG);
+	  Dirbits_set_gap(*directions_nogap,r,r,DIAG);
 	}
 
 	/* No need for F loop here */
@@ -9021,7 +9057,7 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 #ifdef CHECK1
   /* Row 0 and column 0 directions fail anyway due to saturation */
   /* Handle (0,1) and (1,0) directions, otherwise DIAG */
-  (*directions_Egap)[1][0] = VERT;
+  Dirbits_set_gap(*directions_Egap,1,0,VERT);
 #endif
 
 #ifdef DEBUG2
@@ -9036,8 +9072,8 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 #ifdef CHECK1
   /* Check for column 0 directions */
   for (r = 1; r <= lband && r <= rlength; r++) {
-    assert((*directions_Egap)[r][0] != DIAG);
-    assert((*directions_nogap)[r][0] != DIAG);
+    assert(Dirbits_gap_p(*directions_Egap,r,0) == true);
+    assert(Dirbits_gap_p(*directions_nogap,r,0) == true);
   }
 #endif
 
@@ -9152,7 +9188,7 @@ get_genomic_nt (char *g_alt, Genome_T genome, Genome_T genomealt, int genomicpos
 #if defined(HAVE_SSE4_1) || defined(HAVE_SSE2)
 List_T
 Dynprog_traceback_8 (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-		     Direction8_T **directions_nogap, Direction8_T **directions_Egap, Direction8_T **directions_Fgap,
+		     Dirbits_T **directions_nogap, Dirbits_T **directions_Egap, Dirbits_T **directions_Fgap,
 		     int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 		     int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt,
 		     Pairpool_T pairpool, bool revp,
@@ -9170,9 +9206,9 @@ Dynprog_traceback_8 (List_T pairs, int *traceback_score, int *nmatches, int *nmi
   debug(printf("Starting traceback_8 at r=%d,c=%d (roffset=%d, goffset=%d)\n",r,c,queryoffset,genomeoffset));
 
   while (r > 0 && c > 0) {  /* dir != STOP */
-    if ((dir = directions_nogap[c][r]) == HORIZ) {
+    if ((dir = Dirbits_nogap(directions_nogap,c,r)) == HORIZ) {
       dist = 1;
-      while (c > 0 && directions_Egap[c--][r] != DIAG) {
+      while (c > 0 && Dirbits_gap_p(directions_Egap,c--,r) == true) {
 	dist++;
       }
 #if 0
@@ -9181,7 +9217,7 @@ Dynprog_traceback_8 (List_T pairs, int *traceback_score, int *nmatches, int *nmi
 	dir = VERT;
       } else {
 	printf("| ");		/* For Fgap */
-	dir = directions_nogap[c][r];
+	dir = Dirbits_nogap(directions_nogap,c,r);
       }
 #endif
 
@@ -9198,7 +9234,7 @@ Dynprog_traceback_8 (List_T pairs, int *traceback_score, int *nmatches, int *nmi
 
     } else if (dir == VERT) {
       dist = 1;
-      while (r > 0 && directions_Fgap[c][r--] != DIAG) {
+      while (r > 0 && Dirbits_gap_p(directions_Fgap,c,r--) == true) {
 	dist++;
       }
 #if 0
@@ -9206,7 +9242,7 @@ Dynprog_traceback_8 (List_T pairs, int *traceback_score, int *nmatches, int *nmi
 	/* Directions in row 0 can sometimes be DIAG */
 	dir = HORIZ;
       } else {
-	dir = directions_nogap[c][r];
+	dir = Dirbits_nogap(directions_nogap,c,r);
       }
 #endif
 
@@ -9317,7 +9353,7 @@ Dynprog_traceback_8 (List_T pairs, int *traceback_score, int *nmatches, int *nmi
 #if defined(HAVE_SSE4_1) || defined(HAVE_SSE2)
 List_T
 Dynprog_traceback_8_upper (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			   Direction8_T **directions_nogap, Direction8_T **directions_Egap,
+			   Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			   int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 			   int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt,
 			   Pairpool_T pairpool, bool revp,
@@ -9327,7 +9363,6 @@ Dynprog_traceback_8_upper (List_T pairs, int *traceback_score, int *nmatches, in
   int dist;
   bool add_dashes_p;
   int querycoord, genomecoord;
-  Direction8_T dir;
 #ifdef DEBUG17
   char c2_single;
 #endif
@@ -9335,11 +9370,11 @@ Dynprog_traceback_8_upper (List_T pairs, int *traceback_score, int *nmatches, in
   debug(printf("Starting traceback_8_upper at r=%d,c=%d (roffset=%d, goffset=%d)\n",r,c,queryoffset,genomeoffset));
 
   while (r > 0 && c > 0) {  /* dir != STOP */
-    if ((dir = directions_nogap[c][r]) != DIAG) {
+    if (Dirbits_gap_p(directions_nogap,c,r) == true) {
       /* Must be HORIZ */
       dist = 1;
       /* Should not need to check for c > r if the Egap diagonal above the main is populated with DIAG */
-      while (/* c > r && */ directions_Egap[c--][r] != DIAG) {
+      while (/* c > r && */ Dirbits_gap_p(directions_Egap,c--,r) == true) {
 	dist++;
       }
       assert(c >= r);
@@ -9437,14 +9472,13 @@ Dynprog_traceback_8_upper (List_T pairs, int *traceback_score, int *nmatches, in
 
 List_T
 Dynprog_traceback_8_lower (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			   Direction8_T **directions_nogap, Direction8_T **directions_Egap,
+			   Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			   int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 			   int queryoffset, int genomeoffset,
 			   Pairpool_T pairpool, int genestrand, bool revp, int dynprogindex) {
   char c1, c1_uc, c2, c2_alt;
   int dist;
   int querycoord, genomecoord;
-  Direction8_T dir;
 #ifdef DEBUG17
   char c2_single;
 #endif
@@ -9452,11 +9486,11 @@ Dynprog_traceback_8_lower (List_T pairs, int *traceback_score, int *nmatches, in
   debug(printf("Starting traceback_8_lower at r=%d,c=%d (roffset=%d, goffset=%d)\n",r,c,queryoffset,genomeoffset));
 
   while (r > 0 && c > 0) {  /* dir != STOP */
-    if ((dir = directions_nogap[r][c]) != DIAG) {
+    if (Dirbits_gap_p(directions_nogap,r,c) == true) {
       /* Must be VERT */
       dist = 1;
       /* Should not need to check for r > c if the Egap diagonal below the main is populated with DIAG */
-      while (/* r > c && */ directions_Egap[r--][c] != DIAG) {
+      while (/* r > c && */ Dirbits_gap_p(directions_Egap,r--,c) == true) {
 	dist++;
       }
       assert(r >= c);
@@ -9551,7 +9585,7 @@ Dynprog_traceback_8_lower (List_T pairs, int *traceback_score, int *nmatches, in
 
 List_T
 Dynprog_traceback_16 (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-		      Direction16_T **directions_nogap, Direction16_T **directions_Egap, Direction16_T **directions_Fgap,
+		      Dirbits_T **directions_nogap, Dirbits_T **directions_Egap, Dirbits_T **directions_Fgap,
 		      int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 		      int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt,
 		      Pairpool_T pairpool, bool revp,
@@ -9569,9 +9603,9 @@ Dynprog_traceback_16 (List_T pairs, int *traceback_score, int *nmatches, int *nm
   debug(printf("Starting traceback_16 at r=%d,c=%d (roffset=%d, goffset=%d)\n",r,c,queryoffset,genomeoffset));
 
   while (r > 0 && c > 0) {  /* dir != STOP */
-    if ((dir = directions_nogap[c][r]) == HORIZ) {
+    if ((dir = Dirbits_nogap(directions_nogap,c,r)) == HORIZ) {
       dist = 1;
-      while (c > 0 && directions_Egap[c--][r] != DIAG) {
+      while (c > 0 && Dirbits_gap_p(directions_Egap,c--,r) == true) {
 	dist++;
       }
 #if 0
@@ -9579,7 +9613,7 @@ Dynprog_traceback_16 (List_T pairs, int *traceback_score, int *nmatches, int *nm
 	/* Directions in column 0 can sometimes be DIAG */
 	dir = VERT;
       } else {
-	dir = directions_nogap[c][r];
+	dir = Dirbits_nogap(directions_nogap,c,r);
       }
 #endif
 
@@ -9596,7 +9630,7 @@ Dynprog_traceback_16 (List_T pairs, int *traceback_score, int *nmatches, int *nm
       
     } else if (dir == VERT) {
       dist = 1;
-      while (r > 0 && directions_Fgap[c][r--] != DIAG) {
+      while (r > 0 && Dirbits_gap_p(directions_Fgap,c,r--) == true) {
 	dist++;
       }
 #if 0
@@ -9604,7 +9638,7 @@ Dynprog_traceback_16 (List_T pairs, int *traceback_score, int *nmatches, int *nm
 	/* Directions in row 0 can sometimes be DIAG */
 	dir = HORIZ;
       } else {
-	dir = directions_nogap[c][r];
+	dir = Dirbits_nogap(directions_nogap,c,r);
       }
 #endif
 
@@ -9714,7 +9748,7 @@ Dynprog_traceback_16 (List_T pairs, int *traceback_score, int *nmatches, int *nm
 
 List_T
 Dynprog_traceback_16_upper (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			    Direction16_T **directions_nogap, Direction16_T **directions_Egap,
+			    Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			    int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 			    int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt,
 			    Pairpool_T pairpool, bool revp,
@@ -9724,7 +9758,6 @@ Dynprog_traceback_16_upper (List_T pairs, int *traceback_score, int *nmatches, i
   int dist;
   bool add_dashes_p;
   int querycoord, genomecoord;
-  Direction16_T dir;
 #ifdef DEBUG17
   char c2_single;
 #endif
@@ -9732,11 +9765,11 @@ Dynprog_traceback_16_upper (List_T pairs, int *traceback_score, int *nmatches, i
   debug(printf("Starting traceback_16_upper at r=%d,c=%d (roffset=%d, goffset=%d)\n",r,c,queryoffset,genomeoffset));
 
   while (r > 0 && c > 0) {  /* dir != STOP */
-    if ((dir = directions_nogap[c][r]) != DIAG) {
+    if (Dirbits_gap_p(directions_nogap,c,r) == true) {
       /* Must be HORIZ */
       dist = 1;
       /* Should not need to check for c > r if the Egap diagonal above the main is populated with DIAG */
-      while (/* c > r && */ directions_Egap[c--][r] != DIAG) {
+      while (/* c > r && */ Dirbits_gap_p(directions_Egap,c--,r) == true) {
 	dist++;
       }
       assert(c >= r);
@@ -9834,14 +9867,13 @@ Dynprog_traceback_16_upper (List_T pairs, int *traceback_score, int *nmatches, i
 
 List_T
 Dynprog_traceback_16_lower (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			    Direction16_T **directions_nogap, Direction16_T **directions_Egap,
+			    Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			    int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 			    int queryoffset, int genomeoffset,
 			    Pairpool_T pairpool, int genestrand, bool revp, int dynprogindex) {
   char c1, c1_uc, c2, c2_alt;
   int dist;
   int querycoord, genomecoord;
-  Direction16_T dir;
 #ifdef DEBUG17
   char c2_single;
 #endif
@@ -9849,11 +9881,11 @@ Dynprog_traceback_16_lower (List_T pairs, int *traceback_score, int *nmatches, i
   debug(printf("Starting traceback_16_lower at r=%d,c=%d (roffset=%d, goffset=%d)\n",r,c,queryoffset,genomeoffset));
 
   while (r > 0 && c > 0) {  /* dir != STOP */
-    if ((dir = directions_nogap[r][c]) != DIAG) {
+    if (Dirbits_gap_p(directions_nogap,r,c) == true) {
       /* Must be VERT */
       dist = 1;
       /* Should not need to check for r > c if the Egap diagonal below the main is populated with DIAG */
-      while (/* r > c && */ directions_Egap[r--][c] != DIAG) {
+      while (/* r > c && */ Dirbits_gap_p(directions_Egap,r--,c) == true) {
 	dist++;
       }
       assert(r >= c);
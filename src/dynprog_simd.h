@@ -14,8 +14,8 @@
 #define T Dynprog_T
 
 extern Score8_T **
-Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Egap,
-		Direction8_T ***directions_Fgap,
+Dynprog_simd_8 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
+		Dirbits_T ***directions_Fgap,
 		T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -25,7 +25,7 @@ Dynprog_simd_8 (Direction8_T ***directions_nogap, Direction8_T ***directions_Ega
 		int lband, int uband, bool jump_late_p, bool revp);
 
 extern Score8_T **
-Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directions_Egap,
+Dynprog_simd_8_upper (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 		      T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		      int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -35,7 +35,7 @@ Dynprog_simd_8_upper (Direction8_T ***directions_nogap, Direction8_T ***directio
 		      int uband, bool jump_late_p, bool revp);
 
 extern Score8_T **
-Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directions_Egap,
+Dynprog_simd_8_lower (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 		      T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		      int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -45,8 +45,8 @@ Dynprog_simd_8_lower (Direction8_T ***directions_nogap, Direction8_T ***directio
 		      int lband, bool jump_late_p, bool revp);
 
 extern Score16_T **
-Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_Egap,
-		 Direction16_T ***directions_Fgap,
+Dynprog_simd_16 (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
+		 Dirbits_T ***directions_Fgap,
 		 T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		 int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -56,7 +56,7 @@ Dynprog_simd_16 (Direction16_T ***directions_nogap, Direction16_T ***directions_
 		 int lband, int uband, bool jump_late_p, bool revp);
 
 extern Score16_T **
-Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***directions_Egap,
+Dynprog_simd_16_upper (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 		       T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		       int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -66,7 +66,7 @@ Dynprog_simd_16_upper (Direction16_T ***directions_nogap, Direction16_T ***direc
 		       int uband, bool jump_late_p, bool revp);
 
 extern Score16_T **
-Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***directions_Egap,
+Dynprog_simd_16_lower (Dirbits_T ***directions_nogap, Dirbits_T ***directions_Egap,
 		       T this, char *rsequence, char *gsequence, char *gsequence_alt,
 		       int rlength, int glength,
 #if defined(DEBUG_AVX2) || defined(DEBUG_SIMD)
@@ -77,7 +77,7 @@ Dynprog_simd_16_lower (Direction16_T ***directions_nogap, Direction16_T ***direc
 
 extern List_T
 Dynprog_traceback_8 (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-		     Direction8_T **directions_nogap, Direction8_T **directions_Egap, Direction8_T **directions_Fgap,
+		     Dirbits_T **directions_nogap, Dirbits_T **directions_Egap, Dirbits_T **directions_Fgap,
 		     int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 		     int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt,
 		     Pairpool_T pairpool, bool revp,
@@ -86,7 +86,7 @@ Dynprog_traceback_8 (List_T pairs, int *traceback_score, int *nmatches, int *nmi
 
 extern List_T
 Dynprog_traceback_8_upper (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			   Direction8_T **directions_nogap, Direction8_T **directions_Egap,
+			   Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			   int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 			   int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt,
 			   Pairpool_T pairpool, bool revp,
@@ -95,14 +95,14 @@ Dynprog_traceback_8_upper (List_T pairs, int *traceback_score, int *nmatches, in
 
 extern List_T
 Dynprog_traceback_8_lower (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			   Direction8_T **directions_nogap, Direction8_T **directions_Egap,
+			   Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			   int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 			   int queryoffset, int genomeoffset,
 			   Pairpool_T pairpool, int genestrand, bool revp, int dynprogindex);
 
 extern List_T
 Dynprog_traceback_16 (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-		      Direction16_T **directions_nogap, Direction16_T **directions_Egap, Direction16_T **directions_Fgap,
+		      Dirbits_T **directions_nogap, Dirbits_T **directions_Egap, Dirbits_T **directions_Fgap,
 		      int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 		      int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt,
 		      Pairpool_T pairpool, bool revp,
@@ -111,7 +111,7 @@ Dynprog_traceback_16 (List_T pairs, int *traceback_score, int *nmatches, int *nm
 
 extern List_T
 Dynprog_traceback_16_upper (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			    Direction16_T **directions_nogap, Direction16_T **directions_Egap,
+			    Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			    int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 			    int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt,
 			    Pairpool_T pairpool, bool revp,
@@ -120,7 +120,7 @@ Dynprog_traceback_16_upper (List_T pairs, int *traceback_score, int *nmatches, i
 
 extern List_T
 Dynprog_traceback_16_lower (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
-			    Direction16_T **directions_nogap, Direction16_T **directions_Egap,
+			    Dirbits_T **directions_nogap, Dirbits_T **directions_Egap,
 			    int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
 			    int queryoffset, int genomeoffset,
 			    Pairpool_T pairpool, int genestrand, bool revp, int dynprogindex);
@@ -25,6 +25,7 @@ static char rcsid[] = "$Id: dynprog_single.c 224700 2021-11-08 16:46:32Z twu $";
 #include "maxent_hr.h"
 #include "fastlog.h"
 #include "dynprog_simd.h"
+#include "dynprog_linear.h"
 #include "scores.h"
 
 
@@ -425,6 +426,84 @@ single_gap_simple (int *traceback_score, int *nmatches, int *nmismatches,
 }
 
 
+static void
+single_gap_penalties (Mismatchtype_T *mismatchtype, int *open, int *extend, double defect_rate) {
+  if (defect_rate < DEFECT_HIGHQ) {
+    *mismatchtype = HIGHQ;
+    /* onesidegapp = false; */
+  } else if (defect_rate < DEFECT_MEDQ) {
+    *mismatchtype = MEDQ;
+    /* onesidegapp = true; */
+  } else {
+    *mismatchtype = LOWQ;
+    /* onesidegapp = true; */
+  }
+
+  if (user_dynprog_p == true) {
+    *open = user_open;
+    *extend = user_extend;
+  } else if (defect_rate < DEFECT_HIGHQ) {
+    *open = SINGLE_OPEN_HIGHQ;
+    *extend = SINGLE_EXTEND_HIGHQ;
+  } else if (defect_rate < DEFECT_MEDQ) {
+    *open = SINGLE_OPEN_MEDQ;
+    *extend = SINGLE_EXTEND_MEDQ;
+  } else {
+    *open = SINGLE_OPEN_LOWQ;
+    *extend = SINGLE_EXTEND_LOWQ;
+  }
+  return;
+}
+
+
+/* For gaps larger than the preallocated matrices */
+static List_T
+single_gap_linear (int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
+		   char *rsequence, char *rsequenceuc, int rlength, int glength, int roffset, int goffset,
+		   Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp, int genestrand, bool jump_late_p,
+		   Genome_T genome, Genome_T genomealt, Pairpool_T pairpool,
+		   int extraband_single, bool widebandp, double defect_rate, int dynprogindex) {
+  List_T pairs = NULL;
+  Dynprog_linear_T linear;
+  char *gsequence, *gsequence_alt;
+  Mismatchtype_T mismatchtype;
+  int lband, uband;
+  int open, extend;
+  int finalscore;
+
+  single_gap_penalties(&mismatchtype,&open,&extend,defect_rate);
+  Dynprog_compute_bands(&lband,&uband,rlength,glength,extraband_single,widebandp);
+
+  gsequence = (char *) MALLOC((glength+1) * sizeof(char));
+  gsequence_alt = (char *) MALLOC((glength+1) * sizeof(char));
+  if (watsonp) {
+    Genome_get_segment_right(gsequence,gsequence_alt,genome,genomealt,
+			     /*left*/chroffset+goffset,glength,chrhigh,/*revcomp*/false);
+  } else {
+    Genome_get_segment_left(gsequence,gsequence_alt,genome,genomealt,
+			    /*right*/chrhigh-goffset+1,glength,chroffset,/*revcomp*/true);
+  }
+
+  if (gsequence[0] == '\0') {
+    /* Skip */
+  } else if ((linear = Dynprog_linear_fill(&finalscore,rsequence,gsequence,gsequence_alt,rlength,glength,
+					   mismatchtype,open,extend,lband,uband,jump_late_p)) != NULL) {
+    debug(printf("Linear-memory fill for rlength %d, glength %d gives finalscore %d\n",
+		 rlength,glength,finalscore));
+    *traceback_score = 0;
+    *nmatches = *nmismatches = *nopens = *nindels = 0;
+    pairs = Dynprog_linear_traceback(NULL,&(*traceback_score),&(*nmatches),&(*nmismatches),&(*nopens),&(*nindels),
+				     linear,rsequence,rsequenceuc,gsequence,gsequence_alt,roffset,goffset,
+				     genome,genomealt,pairpool,chroffset,chrhigh,watsonp,genestrand,dynprogindex);
+    Dynprog_linear_free(&linear);
+  }
+
+  FREE(gsequence_alt);
+  FREE(gsequence);
+  return pairs;
+}
+
+
 List_T
 Dynprog_single_gap (int *dynprogindex, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
 		    T dynprog, char *rsequence, char *rsequenceuc,
@@ -446,40 +525,17 @@ Dynprog_single_gap (int *dynprogindex, int *traceback_score, int *nmatches, int
   int open, extend;
 #if defined(HAVE_SSE2)
   Score8_T **matrix8;
-  Direction8_T **directions8_nogap, **directions8_Egap, **directions8_Fgap;
+  Dirbits_T **directions8_nogap, **directions8_Egap, **directions8_Fgap;
 
   Score16_T **matrix16;
-  Direction16_T **directions16_nogap, **directions16_Egap, **directions16_Fgap;
+  Dirbits_T **directions16_nogap, **directions16_Egap, **directions16_Fgap;
 #else
   Score32_T **matrix;
   Direction32_T **directions_nogap, **directions_Egap, **directions_Fgap;
 #endif
   /* bool onesidegapp; */
 
-  if (defect_rate < DEFECT_HIGHQ) {
-    mismatchtype = HIGHQ;
-    /* onesidegapp = false; */
-  } else if (defect_rate < DEFECT_MEDQ) {
-    mismatchtype = MEDQ;
-    /* onesidegapp = true; */
-  } else {
-    mismatchtype = LOWQ;
-    /* onesidegapp = true; */
-  }
-
-  if (user_dynprog_p == true) {
-    open = user_open;
-    extend = user_extend;
-  } else if (defect_rate < DEFECT_HIGHQ) {
-    open = SINGLE_OPEN_HIGHQ;
-    extend = SINGLE_EXTEND_HIGHQ;
-  } else if (defect_rate < DEFECT_MEDQ) {
-    open = SINGLE_OPEN_MEDQ;
-    extend = SINGLE_EXTEND_MEDQ;
-  } else {
-    open = SINGLE_OPEN_LOWQ;
-    extend = SINGLE_EXTEND_LOWQ;
-  }
+  single_gap_penalties(&mismatchtype,&open,&extend,defect_rate);
 
 #if 0
   if (close_indels_mode == +1) {
@@ -506,8 +562,18 @@ Dynprog_single_gap (int *dynprogindex, int *traceback_score, int *nmatches, int
   assert(glength > 0);
 #endif
 
-  if (rlength <= 0 || glength <= 0 ||
-      rlength > dynprog->max_rlength || glength > dynprog->max_glength) {
+  if (rlength > 0 && glength > 0 && homopolymerp == false &&
+      (rlength > dynprog->max_rlength || glength > dynprog->max_glength) &&
+      (pairs = single_gap_linear(&(*traceback_score),&(*nmatches),&(*nmismatches),&(*nopens),&(*nindels),
+				 rsequence,rsequenceuc,rlength,glength,roffset,goffset,
+				 chroffset,chrhigh,watsonp,genestrand,jump_late_p,
+				 genome,genomealt,pairpool,extraband_single,widebandp,defect_rate,
+				 *dynprogindex)) != NULL) {
+    *dynprogindex += (*dynprogindex > 0 ? +1 : -1);
+    return List_reverse(pairs);
+
+  } else if (rlength <= 0 || glength <= 0 ||
+	     rlength > dynprog->max_rlength || glength > dynprog->max_glength) {
     debug(printf("rlength %d or glength %d is too long.  Returning NULL\n",rlength,glength));
     *traceback_score = NEG_INFINITY_32;
     *nmatches = *nmismatches = *nopens = *nindels = 0;
@@ -0,0 +1,525 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "dynprog_xdrop.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "simd.h"
+#include "mem.h"
+#include "assert.h"
+#include "comp.h"
+#include "scores.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+/* Band movement */
+#ifdef DEBUG2
+#define debug2(x) x
+#else
+#define debug2(x)
+#endif
+
+
+#define LAZY_INDEL 1		/* Don't advance to next coordinate on final indel, since could go over chromosome bounds. */
+
+#define BANDWIDTH XDROP_BANDWIDTH
+#define PAD (BANDWIDTH + 2)	/* Band cells never lie more than a bandwidth outside the matrix */
+
+/* Scores are 32-bit, so long gaps cannot saturate.  Unreachable
+   cells are reset to NEG_INFINITY_XDROP on every anti-diagonal, so
+   adding penalties to it cannot wrap around */
+#define NEG_INFINITY_XDROP (-(1 << 29))
+
+
+#if defined(HAVE_AVX2)
+#define NLANES 8
+typedef __m256i Vec_T;
+
+static inline Vec_T vec_set1 (int x) {return _mm256_set1_epi32(x);}
+static inline Vec_T vec_load (int *values) {return _mm256_loadu_si256((__m256i *) values);}
+static inline void vec_store (int *values, Vec_T x) {_mm256_storeu_si256((__m256i *) values,x);}
+static inline Vec_T vec_iota () {return _mm256_setr_epi32(0,1,2,3,4,5,6,7);}
+static inline Vec_T vec_add (Vec_T a, Vec_T b) {return _mm256_add_epi32(a,b);}
+static inline Vec_T vec_sub (Vec_T a, Vec_T b) {return _mm256_sub_epi32(a,b);}
+static inline Vec_T vec_max (Vec_T a, Vec_T b) {return _mm256_max_epi32(a,b);}
+static inline Vec_T vec_cmpgt (Vec_T a, Vec_T b) {return _mm256_cmpgt_epi32(a,b);}
+static inline Vec_T vec_cmpeq (Vec_T a, Vec_T b) {return _mm256_cmpeq_epi32(a,b);}
+static inline Vec_T vec_and (Vec_T a, Vec_T b) {return _mm256_and_si256(a,b);}
+static inline Vec_T vec_or (Vec_T a, Vec_T b) {return _mm256_or_si256(a,b);}
+static inline Vec_T vec_andnot (Vec_T a, Vec_T b) {return _mm256_andnot_si256(a,b);}
+static inline UINT8 vec_lanemask (Vec_T x) {return (UINT8) _mm256_movemask_ps(_mm256_castsi256_ps(x));}
+
+#elif defined(HAVE_SSE2)
+#define NLANES 4
+typedef __m128i Vec_T;
+
+static inline Vec_T vec_set1 (int x) {return _mm_set1_epi32(x);}
+static inline Vec_T vec_load (int *values) {return _mm_loadu_si128((__m128i *) values);}
+static inline void vec_store (int *values, Vec_T x) {_mm_storeu_si128((__m128i *) values,x);}
+static inline Vec_T vec_iota () {return _mm_setr_epi32(0,1,2,3);}
+static inline Vec_T vec_add (Vec_T a, Vec_T b) {return _mm_add_epi32(a,b);}
+static inline Vec_T vec_sub (Vec_T a, Vec_T b) {return _mm_sub_epi32(a,b);}
+static inline Vec_T vec_cmpgt (Vec_T a, Vec_T b) {return _mm_cmpgt_epi32(a,b);}
+static inline Vec_T vec_cmpeq (Vec_T a, Vec_T b) {return _mm_cmpeq_epi32(a,b);}
+static inline Vec_T vec_and (Vec_T a, Vec_T b) {return _mm_and_si128(a,b);}
+static inline Vec_T vec_or (Vec_T a, Vec_T b) {return _mm_or_si128(a,b);}
+static inline Vec_T vec_andnot (Vec_T a, Vec_T b) {return _mm_andnot_si128(a,b);}
+static inline UINT8 vec_lanemask (Vec_T x) {return (UINT8) _mm_movemask_ps(_mm_castsi128_ps(x));}
+#ifdef HAVE_SSE4_1
+static inline Vec_T vec_max (Vec_T a, Vec_T b) {return _mm_max_epi32(a,b);}
+#else
+static inline Vec_T vec_max (Vec_T a, Vec_T b) {
+  Vec_T mask = _mm_cmpgt_epi32(a,b);
+  return _mm_or_si128(_mm_and_si128(mask,a),_mm_andnot_si128(mask,b));
+}
+#endif
+
+#else
+/* One cell at a time, with masks of 0 or -1 */
+#define NLANES 1
+typedef int Vec_T;
+
+static inline Vec_T vec_set1 (int x) {return x;}
+static inline Vec_T vec_load (int *values) {return *values;}
+static inline void vec_store (int *values, Vec_T x) {*values = x;}
+static inline Vec_T vec_iota () {return 0;}
+static inline Vec_T vec_add (Vec_T a, Vec_T b) {return a + b;}
+static inline Vec_T vec_sub (Vec_T a, Vec_T b) {return a - b;}
+static inline Vec_T vec_max (Vec_T a, Vec_T b) {return (a > b) ? a : b;}
+static inline Vec_T vec_cmpgt (Vec_T a, Vec_T b) {return (a > b) ? -1 : 0;}
+static inline Vec_T vec_cmpeq (Vec_T a, Vec_T b) {return (a == b) ? -1 : 0;}
+static inline Vec_T vec_and (Vec_T a, Vec_T b) {return a & b;}
+static inline Vec_T vec_or (Vec_T a, Vec_T b) {return a | b;}
+static inline Vec_T vec_andnot (Vec_T a, Vec_T b) {return (~a) & b;}
+static inline UINT8 vec_lanemask (Vec_T x) {return (UINT8) (x & 1);}
+#endif
+
+/* Returns a where mask is set, and b elsewhere */
+static inline Vec_T
+vec_blend (Vec_T mask, Vec_T a, Vec_T b) {
+  return vec_or(vec_and(mask,a),vec_andnot(mask,b));
+}
+
+
+/* Directions for one anti-diagonal r + c, with bit i for the cell at
+   r = rstart + i.  A cell has HORIZ if horiz is set and vert is not,
+   VERT if vert is set, and DIAG otherwise. */
+typedef struct Diag_T *Diag_T;
+struct Diag_T {
+  int rstart;
+  UINT8 horiz;
+  UINT8 vert;
+  UINT8 Egap;
+  UINT8 Fgap;
+};
+
+#define T Dynprog_xdrop_T
+struct T {
+  int ndiags;
+  struct Diag_T *diags;
+};
+
+
+void
+Dynprog_xdrop_free (T *old) {
+  if (*old) {
+    FREE((*old)->diags);
+    FREE(*old);
+  }
+  return;
+}
+
+
+T
+Dynprog_xdrop_fill (int *finalscore, int *bestr, int *bestc,
+		    char *rsequence, char *gsequence, char *gsequence_alt,
+		    int rlength, int glength, Mismatchtype_T mismatchtype,
+		    int open, int extend, int xdrop, bool jump_late_p, bool revp) {
+  T new = (T) MALLOC(sizeof(*new));
+  Diag_T diag;
+  static const char acgtn[5] = {'A','C','G','T','N'};
+  Pairdistance_T **pairdistance_array_type;
+  int *profile[5], *profile_space, *gcodes, *gcodes_alt;
+  int Hspace[3][BANDWIDTH+2], Espace[2][BANDWIDTH+2], Fspace[2][BANDWIDTH+2];
+  int *Hcur, *Hprev, *Hpp, *Ecur, *Eprev, *Fcur, *Fprev, *temp;
+  Vec_T neg, ones, gap_open, gap_extend, rlength_v, glength_v, one_v, iota, codes[5];
+  Vec_T rv, cv, inactive, Hleft, Eleft, Hup, Fup, T1, Enew, Fnew, Hdiag, best;
+  Vec_T gcode, gcode_alt, pairscore, pairscore_alt;
+  Vec_T dir_horiz, dir_vert, dir_Egap, dir_Fgap;
+  int maxd, d, r, c, k, i, i0, delta1, delta2, rstart, diagmax, diagi;
+  int bestscore, score;
+  bool altp = false;
+
+  pairdistance_array_type = pairdistance_array[mismatchtype];
+
+  /* Query profile, indexed by r from -PAD to rlength + PAD */
+  profile_space = (int *) MALLOC(5 * (rlength + 1 + 2*PAD) * sizeof(int));
+  for (k = 0; k < 5; k++) {
+    profile[k] = &(profile_space[k * (rlength + 1 + 2*PAD) + PAD]);
+    for (r = -PAD; r <= rlength + PAD; r++) {
+      if (r < 1 || r > rlength) {
+	profile[k][r] = 0;
+      } else {
+	profile[k][r] = pairdistance_array_type[(int) (revp ? rsequence[1-r] : rsequence[r-1])][(int) acgtn[k]];
+      }
+    }
+  }
+
+  /* Genomic codes, reversed so that the cells of an anti-diagonal,
+     which have increasing r and decreasing c, are contiguous.  Index
+     glength + 1 - c runs from -PAD to glength + 1 + PAD. */
+  gcodes = (int *) MALLOC((glength + 2 + 2*PAD) * sizeof(int));
+  gcodes_alt = (int *) MALLOC((glength + 2 + 2*PAD) * sizeof(int));
+  gcodes += PAD;
+  gcodes_alt += PAD;
+  for (i = -PAD; i <= glength + 1 + PAD; i++) {
+    c = glength + 1 - i;
+    if (c < 1 || c > glength) {
+      gcodes[i] = gcodes_alt[i] = 4;
+    } else {
+      gcodes[i] = nt_to_int_array[(int) (revp ? gsequence[1-c] : gsequence[c-1])];
+      gcodes_alt[i] = nt_to_int_array[(int) (revp ? gsequence_alt[1-c] : gsequence_alt[c-1])];
+      if (gcodes_alt[i] != gcodes[i]) {
+	altp = true;
+      }
+    }
+  }
+
+  neg = vec_set1(NEG_INFINITY_XDROP);
+  ones = vec_cmpeq(neg,neg);
+  one_v = vec_set1(1);
+  iota = vec_iota();
+  gap_open = vec_set1(open);
+  gap_extend = vec_set1(extend);
+  rlength_v = vec_set1(rlength);
+  glength_v = vec_set1(glength);
+  for (k = 0; k < 5; k++) {
+    codes[k] = vec_set1(k);
+  }
+
+  /* Element 0 and BANDWIDTH+1 of each row are padding, and stay at
+     NEG_INFINITY_XDROP */
+  for (i = 0; i < BANDWIDTH+2; i++) {
+    Hspace[0][i] = Hspace[1][i] = Hspace[2][i] = NEG_INFINITY_XDROP;
+    Espace[0][i] = Espace[1][i] = NEG_INFINITY_XDROP;
+    Fspace[0][i] = Fspace[1][i] = NEG_INFINITY_XDROP;
+  }
+  Hpp = Hspace[0];		/* Anti-diagonal -1 */
+  Hprev = Hspace[1];
+  Hcur = Hspace[2];
+  Eprev = Espace[0];
+  Ecur = Espace[1];
+  Fprev = Fspace[0];
+  Fcur = Fspace[1];
+
+  /* Anti-diagonal 0 holds only cell (0,0), centered in the band.
+     With INFINITE_INITIAL_GAP_PENALTY, no other cell in row 0 or
+     column 0 is reachable. */
+  maxd = rlength + glength;
+  new->diags = (struct Diag_T *) MALLOC((maxd + 2) * sizeof(struct Diag_T));
+  new->diags[0].rstart = new->diags[1].rstart = -(BANDWIDTH/2);
+  new->diags[0].horiz = new->diags[0].vert = new->diags[0].Egap = new->diags[0].Fgap = 0;
+  Hprev[1 + BANDWIDTH/2] = 0;
+
+  bestscore = 0;
+  *bestr = *bestc = 0;
+
+  for (d = 1; d <= maxd; d++) {
+    diag = &(new->diags[d]);
+    rstart = diag->rstart;
+    delta1 = rstart - new->diags[d-1].rstart;
+    delta2 = (d == 1) ? 0 : new->diags[d-1].rstart - new->diags[d-2].rstart;
+    diag->horiz = diag->vert = diag->Egap = diag->Fgap = 0;
+
+    /* For the cell at band position i, its left neighbor (r,c-1) is
+       at position i + delta1 of anti-diagonal d-1, its upper
+       neighbor (r-1,c) at i - 1 + delta1, and its diagonal neighbor
+       (r-1,c-1) at i - 1 + delta1 + delta2 of anti-diagonal d-2.
+       The row arrays are offset by 1 for padding. */
+    for (i0 = 0; i0 < BANDWIDTH; i0 += NLANES) {
+      rv = vec_add(vec_set1(rstart + i0),iota);
+      cv = vec_sub(vec_set1(d),rv);
+      inactive = vec_or(vec_or(vec_cmpgt(one_v,rv),vec_cmpgt(rv,rlength_v)),
+			vec_or(vec_cmpgt(one_v,cv),vec_cmpgt(cv,glength_v)));
+
+      /* EGAP */
+      Hleft = vec_load(&(Hprev[1 + i0 + delta1]));
+      Eleft = vec_load(&(Eprev[1 + i0 + delta1]));
+      T1 = vec_add(Hleft,gap_open);
+      if (jump_late_p) {
+	dir_Egap = vec_andnot(vec_cmpgt(T1,Eleft),ones); /* E >= H + open */
+      } else {
+	dir_Egap = vec_cmpgt(Eleft,T1);
+      }
+      Enew = vec_add(vec_max(Eleft,T1),gap_extend);
+
+      /* FGAP */
+      Hup = vec_load(&(Hprev[i0 + delta1]));
+      Fup = vec_load(&(Fprev[i0 + delta1]));
+      T1 = vec_add(Hup,gap_open);
+      if (jump_late_p) {
+	dir_Fgap = vec_andnot(vec_cmpgt(T1,Fup),ones);
+      } else {
+	dir_Fgap = vec_cmpgt(Fup,T1);
+      }
+      Fnew = vec_add(vec_max(Fup,T1),gap_extend);
+
+      /* NOGAP */
+      gcode = vec_load(&(gcodes[glength + 1 - d + rstart + i0]));
+      pairscore = vec_and(vec_cmpeq(gcode,codes[0]),vec_load(&(profile[0][rstart + i0])));
+      for (k = 1; k < 5; k++) {
+	pairscore = vec_or(pairscore,vec_and(vec_cmpeq(gcode,codes[k]),vec_load(&(profile[k][rstart + i0]))));
+      }
+      if (altp == true) {
+	gcode_alt = vec_load(&(gcodes_alt[glength + 1 - d + rstart + i0]));
+	pairscore_alt = vec_and(vec_cmpeq(gcode_alt,codes[0]),vec_load(&(profile[0][rstart + i0])));
+	for (k = 1; k < 5; k++) {
+	  pairscore_alt = vec_or(pairscore_alt,vec_and(vec_cmpeq(gcode_alt,codes[k]),vec_load(&(profile[k][rstart + i0]))));
+	}
+	pairscore = vec_max(pairscore,pairscore_alt);
+      }
+      Hdiag = vec_add(vec_load(&(Hpp[i0 + delta1 + delta2])),pairscore);
+
+      if (jump_late_p) {
+	dir_horiz = vec_andnot(vec_cmpgt(Hdiag,Enew),ones);
+	best = vec_max(Hdiag,Enew);
+	dir_vert = vec_andnot(vec_cmpgt(best,Fnew),ones);
+      } else {
+	dir_horiz = vec_cmpgt(Enew,Hdiag);
+	best = vec_max(Hdiag,Enew);
+	dir_vert = vec_cmpgt(Fnew,best);
+      }
+      best = vec_max(best,Fnew);
+
+      vec_store(&(Hcur[1 + i0]),vec_blend(inactive,neg,best));
+      vec_store(&(Ecur[1 + i0]),vec_blend(inactive,neg,Enew));
+      vec_store(&(Fcur[1 + i0]),vec_blend(inactive,neg,Fnew));
+
+      diag->horiz |= vec_lanemask(dir_horiz) << i0;
+      diag->vert |= vec_lanemask(dir_vert) << i0;
+      diag->Egap |= vec_lanemask(dir_Egap) << i0;
+      diag->Fgap |= vec_lanemask(dir_Fgap) << i0;
+    }
+
+    /* The best cell breaks ties as find_best_endpoint does, which
+       scans r and then c in increasing order */
+    diagmax = Hcur[1];
+    diagi = 0;
+    for (i = 0; i < BANDWIDTH; i++) {
+      if ((score = Hcur[1 + i]) > diagmax) {
+	diagmax = score;
+	diagi = i;
+      }
+      if (score > bestscore) {
+	bestscore = score;
+	*bestr = rstart + i;
+	*bestc = d - *bestr;
+      } else if (score == bestscore && (jump_late_p ? (rstart + i >= *bestr) : (rstart + i < *bestr))) {
+	*bestr = rstart + i;
+	*bestc = d - *bestr;
+      }
+    }
+
+    if (diagmax > NEG_INFINITY_XDROP/2) {
+      if (diagmax < bestscore - xdrop) {
+	debug(printf("X-drop on anti-diagonal %d: %d < %d - %d\n",d,diagmax,bestscore,xdrop));
+	break;
+      }
+    } else if (d == 1) {
+      /* Only (1,0) and (0,1), which are unreachable */
+      diagi = BANDWIDTH/2;
+    } else {
+      debug(printf("No reachable cells on anti-diagonal %d\n",d));
+      break;
+    }
+
+    /* Move down if the best cell is below the center, and right if
+       it is above.  Alternating when it is at the center keeps the
+       band on a diagonal. */
+    if (diagi > BANDWIDTH/2 || (diagi == BANDWIDTH/2 && (d & 1))) {
+      new->diags[d+1].rstart = rstart + 1;
+    } else {
+      new->diags[d+1].rstart = rstart;
+    }
+    debug2(printf("Anti-diagonal %d: rstart %d, max %d at %d, best %d at (%d,%d)\n",
+		  d,rstart,diagmax,diagi,bestscore,*bestr,*bestc));
+
+    temp = Hpp; Hpp = Hprev; Hprev = Hcur; Hcur = temp;
+    temp = Eprev; Eprev = Ecur; Ecur = temp;
+    temp = Fprev; Fprev = Fcur; Fcur = temp;
+  }
+  new->ndiags = d;
+
+  debug(printf("Dynprog_xdrop_fill: rlength %d, glength %d, %d anti-diagonals, best %d at (%d,%d)\n",
+	       rlength,glength,new->ndiags,bestscore,*bestr,*bestc));
+
+  gcodes_alt -= PAD;
+  gcodes -= PAD;
+  FREE(gcodes_alt);
+  FREE(gcodes);
+  FREE(profile_space);
+
+  *finalscore = bestscore;
+  return new;
+}
+
+
+static inline int
+band_bit (UINT8 masks, T this, int r, int c) {
+  int i = r - this->diags[r+c].rstart;
+
+  assert(r + c < this->ndiags);
+  assert(i >= 0 && i < BANDWIDTH);
+  return (int) ((masks >> i) & 1);
+}
+
+#define HORIZ_BIT(r,c) band_bit(this->diags[(r)+(c)].horiz,this,r,c)
+#define VERT_BIT(r,c) band_bit(this->diags[(r)+(c)].vert,this,r,c)
+#define EGAP_BIT(r,c) band_bit(this->diags[(r)+(c)].Egap,this,r,c)
+#define FGAP_BIT(r,c) band_bit(this->diags[(r)+(c)].Fgap,this,r,c)
+
+
+/* Same as Dynprog_traceback_std, except that directions are read
+   from the anti-diagonal bands */
+List_T
+Dynprog_xdrop_traceback (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
+			 T this, int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
+			 int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt, Pairpool_T pairpool,
+			 bool revp, Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp, int genestrand,
+			 int dynprogindex) {
+  char c1, c1_uc, c2, c2_alt;
+  int dist;
+  bool add_dashes_p;
+  int querycoord, genomecoord;
+
+  debug(printf("Starting xdrop traceback at r=%d,c=%d (roffset=%d, goffset=%d)\n",r,c,queryoffset,genomeoffset));
+
+  while (r > 0 && c > 0) {  /* dir != STOP */
+    if (VERT_BIT(r,c) == 0 && HORIZ_BIT(r,c) == 1) {
+      dist = 1;
+      while (c > 0 && EGAP_BIT(r,c) == 1) {
+	c--;
+	dist++;
+      }
+      if (c > 0) {
+	c--;
+      }
+
+      debug(printf("H%d: ",dist));
+      pairs = Pairpool_add_genomeskip(&add_dashes_p,pairs,r,c+dist,dist,/*genomesequence*/NULL,
+				      queryoffset,genomeoffset,genome,genomealt,
+				      pairpool,revp,chroffset,chrhigh,watsonp,dynprogindex);
+      if (add_dashes_p == true) {
+	*traceback_score += TOPEN + dist*TINDEL;
+	*nopens += 1;
+	*nindels += dist;
+      }
+      debug(printf("\n"));
+
+    } else if (VERT_BIT(r,c) == 1) {
+      dist = 1;
+      while (r > 0 && FGAP_BIT(r,c) == 1) {
+	r--;
+	dist++;
+      }
+      if (r > 0) {
+	r--;
+      }
+
+      debug(printf("V%d: ",dist));
+      pairs = Pairpool_add_queryskip(pairs,r+dist,c,dist,rsequence,
+				     queryoffset,genomeoffset,pairpool,revp,
+				     dynprogindex);
+      *traceback_score += QOPEN + dist*QINDEL;
+      *nopens += 1;
+      *nindels += dist;
+      debug(printf("\n"));
+
+    } else {
+      querycoord = r-1;
+      genomecoord = c-1;
+      if (revp == true) {
+	querycoord = -querycoord;
+	genomecoord = -genomecoord;
+      }
+
+      c1 = rsequence[querycoord];
+      c1_uc = rsequenceuc[querycoord];
+      c2 = gsequence[genomecoord];
+      c2_alt = gsequence_alt[genomecoord];
+
+      if (c2 == '*') {
+	/* Don't push pairs past end of chromosome */
+	debug(printf("Don't push pairs past end of chromosome: genomeoffset %u, genomecoord %u, chroffset %u, chrhigh %u, watsonp %d\n",
+		     genomeoffset,genomecoord,chroffset,chrhigh,watsonp));
+
+      } else if (c1_uc == c2 || c1_uc == c2_alt) {
+	debug(printf("Pushing %d,%d [%d,%d] (%c,%c) - match\n",
+		     r,c,queryoffset+querycoord,genomeoffset+genomecoord,c1_uc,c2));
+	*traceback_score += MATCH;
+	*nmatches += 1;
+	pairs = Pairpool_push(pairs,pairpool,queryoffset+querycoord,genomeoffset+genomecoord,
+			      c1,DYNPROG_MATCH_COMP,c2,c2_alt,dynprogindex);
+
+      } else if (Dynprog_consistent_p(c1_uc,/*g*/c2,/*g_alt*/c2_alt,genestrand) == true) {
+	debug(printf("Pushing %d,%d [%d,%d] (%c,%c) - ambiguous\n",
+		     r,c,queryoffset+querycoord,genomeoffset+genomecoord,c1_uc,c2));
+	*traceback_score += MATCH;
+	*nmatches += 1;
+	pairs = Pairpool_push(pairs,pairpool,queryoffset+querycoord,genomeoffset+genomecoord,
+			      c1,AMBIGUOUS_COMP,c2,c2_alt,dynprogindex);
+
+      } else {
+	debug(printf("Pushing %d,%d [%d,%d] (%c,%c) - mismatch\n",
+		     r,c,queryoffset+querycoord,genomeoffset+genomecoord,c1_uc,c2));
+	*traceback_score += MISMATCH;
+	*nmismatches += 1;
+	pairs = Pairpool_push(pairs,pairpool,queryoffset+querycoord,genomeoffset+genomecoord,
+			      c1,MISMATCH_COMP,c2,c2_alt,dynprogindex);
+      }
+
+      r--; c--;
+    }
+  }
+
+  if (r == 0 && c == 0) {
+    /* Finished with a diagonal step */
+
+  } else if (c == 0) {
+    dist = r;
+    debug(printf("V%d: ",dist));
+    pairs = Pairpool_add_queryskip(pairs,r,/*c*/0+LAZY_INDEL,dist,rsequence,
+				   queryoffset,genomeoffset,pairpool,revp,
+				   dynprogindex);
+    *traceback_score += QOPEN + dist*QINDEL;
+    *nopens += 1;
+    *nindels += dist;
+    debug(printf("\n"));
+
+  } else {
+    assert(r == 0);
+    dist = c;
+    debug(printf("H%d: ",dist));
+    pairs = Pairpool_add_genomeskip(&add_dashes_p,pairs,/*r*/0+LAZY_INDEL,c,dist,/*genomesequence*/NULL,
+				    queryoffset,genomeoffset,genome,genomealt,
+				    pairpool,revp,chroffset,chrhigh,watsonp,dynprogindex);
+    if (add_dashes_p == true) {
+      *traceback_score += TOPEN + dist*TINDEL;
+      *nopens += 1;
+      *nindels += dist;
+    }
+    debug(printf("\n"));
+  }
+
+  return pairs;
+}
+
@@ -0,0 +1,50 @@
+/* $Id$ */
+#ifndef DYNPROG_XDROP_INCLUDED
+#define DYNPROG_XDROP_INCLUDED
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "bool.h"
+#include "list.h"
+#include "genomicpos.h"
+#include "pairpool.h"
+#include "genome.h"
+#include "types.h"
+#include "dynprog.h"
+
+
+/* Adaptive-band dynamic programming for long end gaps.  Cells are
+   computed one anti-diagonal at a time, over a band of
+   XDROP_BANDWIDTH cells that moves right or down after each
+   anti-diagonal to stay centered on its best cell, so the work grows
+   with rlength + glength instead of rlength * glength.  The fill
+   stops once the best score on an anti-diagonal falls more than xdrop
+   below the best score seen so far.  Recurrence, tie-breaking, and
+   INFINITE_INITIAL_GAP_PENALTY follow Dynprog_standard, and the best
+   cell is a local endpoint as in find_best_endpoint. */
+
+#define XDROP_BANDWIDTH 64	/* Bits in UINT8 */
+
+#define T Dynprog_xdrop_T
+typedef struct T *T;
+
+extern void
+Dynprog_xdrop_free (T *old);
+
+extern T
+Dynprog_xdrop_fill (int *finalscore, int *bestr, int *bestc,
+		    char *rsequence, char *gsequence, char *gsequence_alt,
+		    int rlength, int glength, Mismatchtype_T mismatchtype,
+		    int open, int extend, int xdrop, bool jump_late_p, bool revp);
+
+extern List_T
+Dynprog_xdrop_traceback (List_T pairs, int *traceback_score, int *nmatches, int *nmismatches, int *nopens, int *nindels,
+			 T this, int r, int c, char *rsequence, char *rsequenceuc, char *gsequence, char *gsequence_alt,
+			 int queryoffset, int genomeoffset, Genome_T genome, Genome_T genomealt, Pairpool_T pairpool,
+			 bool revp, Univcoord_T chroffset, Univcoord_T chrhigh, bool watsonp, int genestrand,
+			 int dynprogindex);
+
+#undef T
+#endif
+
@@ -2331,12 +2331,10 @@ Extension_search (Univcoord_T **_univdiagonals_gplus, Auxinfo_T **auxinfo_gplus,
   check_ascending(*_univdiagonals_gminus,*nunivdiagonals_gminus);
 #endif
 
+  Stage1_reserve_extension(stage1,*nunivdiagonals_gplus,*nunivdiagonals_gminus);
+
   if (*nunivdiagonals_gplus > 0) {
-    stage1->extension_gplus = (Univcoord_T *) MALLOC((*nunivdiagonals_gplus)*sizeof(Univcoord_T));
     memcpy(stage1->extension_gplus,*_univdiagonals_gplus,(*nunivdiagonals_gplus)*sizeof(Univcoord_T));
-
-    stage1->extension_qstart_gplus = (int *) MALLOC((*nunivdiagonals_gplus)*sizeof(int));
-    stage1->extension_qend_gplus = (int *) MALLOC((*nunivdiagonals_gplus)*sizeof(int));
     for (i = 0; i < *nunivdiagonals_gplus; i++) {
       auxinfo = (*auxinfo_gplus)[i];
       stage1->extension_qstart_gplus[i] = auxinfo->qstart;
@@ -2347,11 +2345,7 @@ Extension_search (Univcoord_T **_univdiagonals_gplus, Auxinfo_T **auxinfo_gplus,
   }
 
   if (*nunivdiagonals_gminus > 0) {
-    stage1->extension_gminus = (Univcoord_T *) MALLOC((*nunivdiagonals_gminus)*sizeof(Univcoord_T));
     memcpy(stage1->extension_gminus,*_univdiagonals_gminus,(*nunivdiagonals_gminus)*sizeof(Univcoord_T));
-
-    stage1->extension_qstart_gminus = (int *) MALLOC((*nunivdiagonals_gminus)*sizeof(int));
-    stage1->extension_qend_gminus = (int *) MALLOC((*nunivdiagonals_gminus)*sizeof(int));
     for (i = 0; i < *nunivdiagonals_gminus; i++) {
       auxinfo = (*auxinfo_gminus)[i];
       stage1->extension_qstart_gminus[i] = auxinfo->qstart;
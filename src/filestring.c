@@ -35,6 +35,7 @@ static bool split_simple_p;
 #define T Filestring_T
 
 struct T {
+  unsigned int id;		/* Input id of the read, used for --part-index */
   SAM_split_output_type split_output;
 
   List_T blocks;
@@ -53,6 +54,18 @@ Filestring_setup (bool split_simple_p_in) {
 }
 
 
+unsigned int
+Filestring_id (T this) {
+  return this->id;
+}
+
+void
+Filestring_set_id (T this, unsigned int id) {
+  this->id = id;
+  return;
+}
+
+
 #if !defined(GFILTER)
 void
 Filestring_set_split_output (T this, bool concordant_softclipped_p, int split_output) {
@@ -90,6 +103,8 @@ T
 Filestring_new () {
   T new = (T) MALLOC_OUT(sizeof(*new));
 
+  new->id = 0;
+
   /* Output procedures in samprint.c and output.c are expecting an initial value for split_output */
   if (split_simple_p == true) {
     new->split_output = OUTPUT_OTHER;
@@ -221,6 +236,20 @@ Filestring_print (FILE *fp, T this) {
 
   return;
 }
+
+
+/* Returns NULL if there is nothing to print */
+char *
+Filestring_get (int *strlength, T this) {
+  if (this == NULL || (this->string == NULL && this->blocks == NULL)) {
+    *strlength = 0;
+    return (char *) NULL;
+  } else {
+    Filestring_stringify(this);
+    *strlength = this->strlength;
+    return this->string;
+  }
+}
       
 
 static void
@@ -386,6 +415,90 @@ transfer_string_revcomp (T this, char *string, int stringlen) {
 }
 
 
+/* Copies exactly nbytes, without looking for a terminating character */
+static void
+transfer_bytes (T this, char *string, int nbytes) {
+  char *block;
+
+  while (this->nleft < nbytes) {
+    if (this->nleft > 0) {
+      memcpy(this->ptr,string,this->nleft);
+      string += this->nleft;
+      nbytes -= this->nleft;
+    }
+
+    block = (char *) MALLOC_OUT(BLOCKSIZE * sizeof(char));
+    this->blocks = List_push_out(this->blocks,(void *) block);
+    this->nleft = BLOCKSIZE;
+    this->ptr = &(block[0]);
+  }
+
+  if (nbytes > 0) {
+    memcpy(this->ptr,string,nbytes);
+    this->ptr += nbytes;
+    this->nleft -= nbytes;
+  }
+
+  return;
+}
+
+
+/* Enough for the digits and sign of a 64-bit integer, plus one character */
+#define DIGITBUFLEN 24
+
+static const char digit_pairs[201] =
+  "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+  "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+  "8081828384858687888990919293949596979899";
+
+/* Writes the decimal digits of x so that they end just before end,
+   two at a time, and returns a pointer to the first digit */
+static char *
+digits_backward (char *end, unsigned long long x) {
+  char *p = end;
+  unsigned int i;
+
+  while (x >= 100) {
+    i = (unsigned int) (x % 100) * 2;
+    x /= 100;
+    *--p = digit_pairs[i+1];
+    *--p = digit_pairs[i];
+  }
+  if (x >= 10) {
+    i = (unsigned int) x * 2;
+    *--p = digit_pairs[i+1];
+    *--p = digit_pairs[i];
+  } else {
+    *--p = (char) ('0' + x);
+  }
+
+  return p;
+}
+
+static void
+transfer_unsigned (T this, unsigned long long x) {
+  char buffer[DIGITBUFLEN], *end = &(buffer[DIGITBUFLEN]), *p;
+
+  p = digits_backward(end,x);
+  transfer_bytes(this,p,end - p);
+  return;
+}
+
+static void
+transfer_signed (T this, long long x) {
+  char buffer[DIGITBUFLEN], *end = &(buffer[DIGITBUFLEN]), *p;
+
+  if (x < 0) {
+    p = digits_backward(end,0ULL - (unsigned long long) x);
+    *--p = '-';
+  } else {
+    p = digits_backward(end,(unsigned long long) x);
+  }
+  transfer_bytes(this,p,end - p);
+  return;
+}
+
+
 
 #define BUFFERLEN 1024
 
@@ -394,7 +507,6 @@ Filestring_put (T this, const char *format, ...) {
   va_list values;
 
   char BUFFER[BUFFERLEN];
-  char *block;
   const char *p;
   char *q, c;
   char *string;
@@ -535,8 +647,7 @@ Filestring_put (T this, const char *format, ...) {
 	break;
 
       case 'd':			/* int */
-	sprintf(BUFFER,"%d",va_arg(values, int));
-	transfer_buffer(this,BUFFER,BUFFERLEN);
+	transfer_signed(this,(long long) va_arg(values, int));
 	break;
 
       case 'f':			/* float */
@@ -545,32 +656,27 @@ Filestring_put (T this, const char *format, ...) {
 	break;
 
       case 'u':			/* unsigned int */
-	sprintf(BUFFER,"%u",va_arg(values, unsigned int));
-	transfer_buffer(this,BUFFER,BUFFERLEN);
+	transfer_unsigned(this,(unsigned long long) va_arg(values, unsigned int));
 	break;
       
       case 'l':
 	switch (*++p) {
 	case 'd':			/* long int */
-	  sprintf(BUFFER,"%ld",va_arg(values, long int));
-	  transfer_buffer(this,BUFFER,BUFFERLEN);
+	  transfer_signed(this,(long long) va_arg(values, long int));
 	  break;
 
 	case 'u':			/* unsigned long */
-	  sprintf(BUFFER,"%lu",va_arg(values, unsigned long));
-	  transfer_buffer(this,BUFFER,BUFFERLEN);
+	  transfer_unsigned(this,(unsigned long long) va_arg(values, unsigned long));
 	  break;
 
 	case 'l':
 	  switch (*++p) {
 	  case 'd':			/* long long int */
-	    sprintf(BUFFER,"%lld",va_arg(values, long long int));
-	    transfer_buffer(this,BUFFER,BUFFERLEN);
+	    transfer_signed(this,va_arg(values, long long int));
 	    break;
 
 	  case 'u':			/* unsigned long long */
-	    sprintf(BUFFER,"%llu",va_arg(values, unsigned long long));
-	    transfer_buffer(this,BUFFER,BUFFERLEN);
+	    transfer_unsigned(this,va_arg(values, unsigned long long));
 	    break;
 
 	  default: fprintf(stderr,"Cannot parse %%ll%c\n",*p); abort();
@@ -585,15 +691,12 @@ Filestring_put (T this, const char *format, ...) {
       }
 
     } else {
-      /* transfer_char(this,c); -- effectively inlined here */
-      if (this->nleft == 0) {
-	block = (char *) MALLOC_OUT(BLOCKSIZE * sizeof(char));
-	this->blocks = List_push_out(this->blocks,(void *) block);
-	this->nleft = BLOCKSIZE;
-	this->ptr = &(block[0]);
+      /* Copy the run of literal characters up to the next conversion */
+      q = (char *) p;
+      while (p[1] != '\0' && p[1] != '%' && p[1] != '\\') {
+	p++;
       }
-      *this->ptr++ = c;
-      this->nleft -= 1;
+      transfer_bytes(this,q,p + 1 - q);
     }
 
     p++;
@@ -619,22 +722,48 @@ Filestring_putc (char c, T this) {
 }
 
 
-/* Modified from transfer_string */
 void
 Filestring_puts (T this, char *string, int strlength) {
-  char *block, *q;
+  transfer_bytes(this,string,strlength);
+  return;
+}
 
-  for (q = string; --strlength >= 0; q++) {
-    if (this->nleft == 0) {
-      block = (char *) MALLOC_OUT(BLOCKSIZE * sizeof(char));
-      this->blocks = List_push_out(this->blocks,(void *) block);
-      this->nleft = BLOCKSIZE;
-      this->ptr = &(block[0]);
-    }
-    *this->ptr++ = *q;
-    this->nleft -= 1;
-  }
 
+/* Typed emitters.  These write the same characters as the
+   corresponding FPRINTF conversions, without parsing a format. */
+
+void
+Filestring_put_string (T this, char *string) {
+  transfer_bytes(this,string,strlen(string));
+  return;
+}
+
+void
+Filestring_put_int (T this, int x) {
+  transfer_signed(this,(long long) x);
+  return;
+}
+
+void
+Filestring_put_uint (T this, unsigned int x) {
+  transfer_unsigned(this,(unsigned long long) x);
+  return;
+}
+
+/* A CIGAR operation, such as 76M.  A negative length is written
+   with its sign, as "%d%c" would, so a bad CIGAR stays visible. */
+void
+Filestring_put_cigar (T this, int length, char op) {
+  char buffer[DIGITBUFLEN], *end = &(buffer[DIGITBUFLEN-1]), *p;
+
+  if (length < 0) {
+    p = digits_backward(end,0ULL - (unsigned long long) (long long) length);
+    *--p = '-';
+  } else {
+    p = digits_backward(end,(unsigned long long) length);
+  }
+  *end = op;
+  transfer_bytes(this,p,end + 1 - p);
   return;
 }
 
@@ -18,6 +18,8 @@ Filestring_setup (bool split_simple_p_in);
 extern unsigned int
 Filestring_id (T this);
 extern void
+Filestring_set_id (T this, unsigned int id);
+extern void
 Filestring_set_split_output (T this, bool concordant_softclipped_p, int split_output);
 extern SAM_split_output_type
 Filestring_split_output (T this);
@@ -40,6 +42,14 @@ Filestring_putc (char c, T this);
 extern void
 Filestring_puts (T this, char *string, int strlength);
 extern void
+Filestring_put_string (T this, char *string);
+extern void
+Filestring_put_int (T this, int x);
+extern void
+Filestring_put_uint (T this, unsigned int x);
+extern void
+Filestring_put_cigar (T this, int length, char op);
+extern void
 Filestring_merge (T dest, T source);
 
 
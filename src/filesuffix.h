@@ -16,6 +16,17 @@
 #define POSITIONS_HIGH_FILESUFFIX "positionsh"
 #define POSITIONS_FILESUFFIX "positions"
 
+/* Appended to the positions filename for the bitpacked format */
+#define POSITIONS_BITPACK_META_SUFFIX "64meta"
+#define POSITIONS_BITPACK_STRM_SUFFIX "64strm"
+
+/* Combined indexes for both conversions, from cmetindex or atoiindex
+   --combined.  The splits suffix is appended to the positions
+   filename. */
+#define CMET_COMBINED_FILESUFFIX "metcmb"
+#define ATOI_COMBINED_FILESUFFIX "a2icmb"
+#define COMBINED_SPLITS_SUFFIX "splits"
+
 #define LOCAL_OFFSETS_FILESUFFIX "locoffsets"
 /* #define LOCAL_POSITIONS_HIGH_FILESUFFIX "locpositionsh" */
 #define LOCAL_POSITIONS_FILESUFFIX "locpositions"
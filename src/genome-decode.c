@@ -0,0 +1,125 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+/* Throughput benchmark for the decoders in genome-decode.h.  Built
+   only on request, by "make genome_decode_bench", using the highest
+   SIMD level that the compiler supports.  Each decoder compiled in is
+   checked against the standard one and then timed, if the processor
+   supports it. */
+
+#include "genome-decode.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem.h"
+#include "stopwatch.h"
+
+
+#define NBLOCKS (1 << 20)	/* 32 MB of decoded genome per round */
+#define NROUNDS 32
+#define N_PER_1000 10		/* Flagged positions */
+
+
+typedef void (*Decoder_T) (char *dest, Genomecomp_T high, Genomecomp_T low, Genomecomp_T flags);
+
+
+static Genomecomp_T *
+make_blocks (int nblocks) {
+  Genomecomp_T *blocks, flags;
+  int blocki, i;
+
+  blocks = (Genomecomp_T *) MALLOC(3*nblocks*sizeof(Genomecomp_T));
+  srand(42);
+  for (blocki = 0; blocki < nblocks; blocki++) {
+    flags = 0U;
+    for (i = 0; i < 32; i++) {
+      if (rand() % 1000 < N_PER_1000) {
+	flags |= (1U << i);
+      }
+    }
+    blocks[3*blocki] = ((Genomecomp_T) rand() << 16) ^ (Genomecomp_T) rand();
+    blocks[3*blocki+1] = ((Genomecomp_T) rand() << 16) ^ (Genomecomp_T) rand();
+    blocks[3*blocki+2] = flags;
+  }
+
+  return blocks;
+}
+
+static void
+decode_all (Decoder_T decoder, char *gbuffer, Genomecomp_T *blocks, int nblocks) {
+  int blocki;
+
+  for (blocki = 0; blocki < nblocks; blocki++) {
+    (*decoder)(&(gbuffer[32*blocki]),blocks[3*blocki],blocks[3*blocki+1],blocks[3*blocki+2]);
+  }
+  return;
+}
+
+static void
+benchmark (char *name, Decoder_T decoder, char *gbuffer, char *expected,
+	   Genomecomp_T *blocks, int nblocks) {
+  Stopwatch_T stopwatch;
+  double runtime;
+  int round;
+
+  memset(gbuffer,0,32*nblocks);
+  decode_all(decoder,gbuffer,blocks,nblocks);
+  if (memcmp(gbuffer,expected,32*nblocks) != 0) {
+    fprintf(stderr,"%s: decoded genome differs from std\n",name);
+    exit(9);
+  }
+
+  stopwatch = Stopwatch_new();
+  Stopwatch_start(stopwatch);
+  for (round = 0; round < NROUNDS; round++) {
+    decode_all(decoder,gbuffer,blocks,nblocks);
+  }
+  runtime = Stopwatch_stop(stopwatch);
+  Stopwatch_free(&stopwatch);
+
+  printf("%-8s %8.2f GB/s\n",name,(double) NROUNDS * 32.0 * (double) nblocks / runtime / 1e9);
+  return;
+}
+
+
+int
+main (int argc, char *argv[]) {
+  Genomecomp_T *blocks;
+  char *gbuffer, *expected;
+
+  blocks = make_blocks(NBLOCKS);
+  gbuffer = (char *) MALLOC(32*NBLOCKS*sizeof(char));
+  expected = (char *) MALLOC(32*NBLOCKS*sizeof(char));
+  decode_all(Genome_decode_block_std,expected,blocks,NBLOCKS);
+
+  benchmark("std",Genome_decode_block_std,gbuffer,expected,blocks,NBLOCKS);
+#if defined(HAVE_SSSE3)
+#if defined(HAVE_ARM)
+  benchmark("neon",Genome_decode_block_ssse3,gbuffer,expected,blocks,NBLOCKS);
+#else
+  if (__builtin_cpu_supports("ssse3")) {
+    benchmark("ssse3",Genome_decode_block_ssse3,gbuffer,expected,blocks,NBLOCKS);
+  }
+#endif
+#endif
+#if defined(HAVE_AVX2)
+  if (__builtin_cpu_supports("avx2")) {
+    benchmark("avx2",Genome_decode_block_avx2,gbuffer,expected,blocks,NBLOCKS);
+  }
+#endif
+#if defined(HAVE_AVX512BW)
+  if (__builtin_cpu_supports("avx512bw") && __builtin_cpu_supports("avx512vl")) {
+    benchmark("avx512",Genome_decode_block_avx512,gbuffer,expected,blocks,NBLOCKS);
+  }
+#endif
+
+  FREE(expected);
+  FREE(gbuffer);
+  FREE(blocks);
+
+  return 0;
+}
+
@@ -0,0 +1,153 @@
+/* $Id$ */
+#ifndef GENOME_DECODE_INCLUDED
+#define GENOME_DECODE_INCLUDED
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "simd.h"
+#include "types.h"
+
+
+/* Decodes one block of the compressed genome (32 nucleotides, given
+   by the high, low, and flags words) into ASCII, with N wherever the
+   flag is set.  Nucleotide i comes from bits 2i and 2i+1 of low for i
+   < 16, and of high otherwise.  The SIMD versions expand the words
+   with byte shuffles, so no lookup table is needed.  On ARM, the SSSE3
+   version is translated to NEON by simde. */
+
+
+static inline void
+Genome_decode_block_std (char *dest, Genomecomp_T high, Genomecomp_T low, Genomecomp_T flags) {
+  static const char acgt[4] = {'A','C','G','T'};
+  int i;
+
+  for (i = 0; i < 16; i++) {
+    dest[i] = acgt[low & 3U];
+    low >>= 2;
+  }
+  for ( ; i < 32; i++) {
+    dest[i] = acgt[high & 3U];
+    high >>= 2;
+  }
+
+  if (flags) {
+    for (i = 0; i < 32; i++) {
+      if (flags & 1U) {
+	dest[i] = 'N';
+      }
+      flags >>= 1;
+    }
+  }
+
+  return;
+}
+
+
+#if defined(HAVE_SSSE3)
+/* Returns the 16 nucleotides of word.  Byte j holds the nucleotide in
+   byte j/4 of word, so each byte is reduced to the nibble containing
+   that nucleotide and masked to its two bits, leaving a value in
+   {0,1,2,3} or {0,4,8,12} to look up */
+static inline __m128i
+decode_16_ssse3 (Genomecomp_T word, Genomecomp_T flags16) {
+  __m128i bytes, nibbles, codes, chars, nmask;
+  __m128i bits;
+
+  bytes = _mm_shuffle_epi8(_mm_cvtsi32_si128((int) word),
+			   _mm_set_epi8(3,3,3,3,2,2,2,2,1,1,1,1,0,0,0,0));
+  nibbles = _mm_or_si128(_mm_andnot_si128(_mm_set_epi8(-1,-1,0,0,-1,-1,0,0,-1,-1,0,0,-1,-1,0,0),bytes),
+			 _mm_and_si128(_mm_set_epi8(-1,-1,0,0,-1,-1,0,0,-1,-1,0,0,-1,-1,0,0),
+				       _mm_srli_epi16(bytes,4)));
+  codes = _mm_and_si128(nibbles,_mm_set_epi8(0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03,
+					     0x0C,0x03,0x0C,0x03,0x0C,0x03,0x0C,0x03));
+  chars = _mm_shuffle_epi8(_mm_setr_epi8('A','C','G','T','C','A','A','A','G','A','A','A','T','A','A','A'),
+			   codes);
+
+  if (flags16) {
+    bits = _mm_set_epi8(-128,64,32,16,8,4,2,1,-128,64,32,16,8,4,2,1);
+    nmask = _mm_shuffle_epi8(_mm_cvtsi32_si128((int) flags16),
+			     _mm_set_epi8(1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0));
+    nmask = _mm_cmpeq_epi8(_mm_and_si128(nmask,bits),bits);
+    chars = _mm_or_si128(_mm_andnot_si128(nmask,chars),_mm_and_si128(nmask,_mm_set1_epi8('N')));
+  }
+
+  return chars;
+}
+
+static inline void
+Genome_decode_block_ssse3 (char *dest, Genomecomp_T high, Genomecomp_T low, Genomecomp_T flags) {
+  _mm_storeu_si128((__m128i *) dest,decode_16_ssse3(low,flags & 0x0000FFFF));
+  _mm_storeu_si128((__m128i *) &(dest[16]),decode_16_ssse3(high,flags >> 16));
+  return;
+}
+#endif
+
+
+#if defined(HAVE_AVX2)
+/* Same as the SSSE3 version, but with low in the lower 128-bit lane
+   and high in the upper one */
+static inline __m256i
+decode_32_avx2 (Genomecomp_T high, Genomecomp_T low) {
+  __m256i bytes, nibbles, codes, select;
+
+  bytes = _mm256_shuffle_epi8(_mm256_set_epi32(0,0,0,high,0,0,0,low),
+			      _mm256_set_epi8(3,3,3,3,2,2,2,2,1,1,1,1,0,0,0,0,
+					      3,3,3,3,2,2,2,2,1,1,1,1,0,0,0,0));
+  select = _mm256_set_epi8(-1,-1,0,0,-1,-1,0,0,-1,-1,0,0,-1,-1,0,0,
+			   -1,-1,0,0,-1,-1,0,0,-1,-1,0,0,-1,-1,0,0);
+  nibbles = _mm256_or_si256(_mm256_andnot_si256(select,bytes),
+			    _mm256_and_si256(select,_mm256_srli_epi16(bytes,4)));
+  codes = _mm256_and_si256(nibbles,_mm256_set1_epi16(0x0C03));
+  return _mm256_shuffle_epi8(_mm256_setr_epi8('A','C','G','T','C','A','A','A','G','A','A','A','T','A','A','A',
+					      'A','C','G','T','C','A','A','A','G','A','A','A','T','A','A','A'),
+			     codes);
+}
+
+static inline void
+Genome_decode_block_avx2 (char *dest, Genomecomp_T high, Genomecomp_T low, Genomecomp_T flags) {
+  __m256i chars, nmask, bits;
+
+  chars = decode_32_avx2(high,low);
+  if (flags) {
+    bits = _mm256_set1_epi64x(0x8040201008040201LL);
+    nmask = _mm256_shuffle_epi8(_mm256_set1_epi32((int) flags),
+				_mm256_set_epi8(3,3,3,3,3,3,3,3,2,2,2,2,2,2,2,2,
+						1,1,1,1,1,1,1,1,0,0,0,0,0,0,0,0));
+    nmask = _mm256_cmpeq_epi8(_mm256_and_si256(nmask,bits),bits);
+    chars = _mm256_blendv_epi8(chars,_mm256_set1_epi8('N'),nmask);
+  }
+  _mm256_storeu_si256((__m256i *) dest,chars);
+
+  return;
+}
+#endif
+
+
+#if defined(HAVE_AVX512BW)
+/* flags serves directly as the byte mask for the Ns */
+static inline void
+Genome_decode_block_avx512 (char *dest, Genomecomp_T high, Genomecomp_T low, Genomecomp_T flags) {
+  _mm256_storeu_si256((__m256i *) dest,
+		      _mm256_mask_blend_epi8((__mmask32) flags,decode_32_avx2(high,low),_mm256_set1_epi8('N')));
+  return;
+}
+#endif
+
+
+static inline void
+Genome_decode_block (char *dest, Genomecomp_T high, Genomecomp_T low, Genomecomp_T flags) {
+#if defined(HAVE_AVX512BW)
+  Genome_decode_block_avx512(dest,high,low,flags);
+#elif defined(HAVE_AVX2)
+  Genome_decode_block_avx2(dest,high,low,flags);
+#elif defined(HAVE_SSSE3)
+  Genome_decode_block_ssse3(dest,high,low,flags);
+#else
+  Genome_decode_block_std(dest,high,low,flags);
+#endif
+  return;
+}
+
+#endif
+
@@ -17,6 +17,8 @@
 
 #ifndef GSNAP
 #include "sequence.h"
+#else
+#include "snpoverlay.h"
 #endif
 
 #define OUTOFBOUNDS '*'
@@ -67,6 +69,10 @@ Genome_setup (
 	      Genome_T genome_in, Genome_T genomealt_in,
 #endif
 	      int circular_typeint_in);
+#ifdef GSNAP
+extern void
+Genome_setup_snpoverlay (Snpoverlay_T snpoverlay_in);
+#endif
 
 #ifdef UTILITYP
 extern void
@@ -149,6 +149,9 @@ Genomebits_free (T *old) {
 #endif
     }
 
+    if ((*old)->snpoverlay != NULL) {
+      Snpoverlay_free(&(*old)->snpoverlay);
+    }
     FREE(*old);
   }
   return;
@@ -250,7 +253,8 @@ Genomebits_new (char *genomesubdir, char *fileroot, char *alt_suffix,
     } else {
 #ifndef UTILITYP
       comma = Genomicpos_commafmt(new->high_len + new->low_len + new->flags_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds0 + seconds1 + seconds2);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds0 + seconds1 + seconds2,
+	      Access_mbps(new->high_len + new->low_len + new->flags_len,seconds0 + seconds1 + seconds2));
       FREE(comma);
 #endif
     }
@@ -293,6 +297,7 @@ Genomebits_new (char *genomesubdir, char *fileroot, char *alt_suffix,
 #endif
     
   }
+  new->snpoverlay = (Snpoverlay_T) NULL;
   
   FREE(flags_filename);
   FREE(low_filename);
@@ -301,6 +306,97 @@ Genomebits_new (char *genomesubdir, char *fileroot, char *alt_suffix,
   return new;
 }
 
+
+/* Represents the SNP genome alt by the blocks of ref plus an overlay
+   of the positions where alt differs, so alt can be freed afterwards */
+T
+Genomebits_new_snpoverlay (T ref, T alt) {
+  T new = (T) MALLOC(sizeof(*new));
+  Univcoord_T nblocks;
+#ifndef UTILITYP
+  char *comma1, *comma2;
+#endif
+
+  nblocks = ref->high_len/sizeof(Genomecomp_T);
+  if (alt->high_len/sizeof(Genomecomp_T) < nblocks) {
+    nblocks = alt->high_len/sizeof(Genomecomp_T);
+  }
+
+  new->access = NOT_USED;	/* Blocks belong to ref */
+  new->high_len = ref->high_len;
+  new->low_len = ref->low_len;
+  new->flags_len = ref->flags_len;
+  new->high_blocks = ref->high_blocks;
+  new->low_blocks = ref->low_blocks;
+  new->flags_blocks = ref->flags_blocks;
+  new->snpoverlay = Snpoverlay_new(ref->high_blocks,ref->low_blocks,ref->flags_blocks,
+				   alt->high_blocks,alt->low_blocks,alt->flags_blocks,nblocks);
+
+#ifndef UTILITYP
+  comma1 = Genomicpos_commafmt(Snpoverlay_nsnps(new->snpoverlay));
+  comma2 = Genomicpos_commafmt(Snpoverlay_nbytes(new->snpoverlay));
+  fprintf(stderr,"Built SNP overlay with %s SNPs (%s bytes)\n",comma1,comma2);
+  FREE(comma2);
+  FREE(comma1);
+#endif
+
+  return new;
+}
+
+
+/* Returns space for Genomebits_alt_blocks over any region within a
+   query, or NULL if alt has its own blocks */
+Genomecomp_T *
+Genomebits_alt_space (Genomecomp_T *stack_space, T alt, int querylength) {
+  int nblocks = querylength/32 + 2;
+
+  if (alt->snpoverlay == NULL) {
+    return (Genomecomp_T *) NULL;
+  } else if (nblocks <= GENOMEBITS_ALT_STACK_NBLOCKS) {
+    return stack_space;
+  } else {
+    return (Genomecomp_T *) MALLOC(3*nblocks*sizeof(Genomecomp_T));
+  }
+}
+
+void
+Genomebits_alt_space_free (Genomecomp_T **space, Genomecomp_T *stack_space) {
+  if (*space != NULL && *space != stack_space) {
+    FREE(*space);
+  }
+  return;
+}
+
+
+/* Sets pointers to block startblocki of the SNP genome alt, for reading
+   through endblocki.  These are the reference blocks, unless a SNP
+   falls in that range, in which case the blocks are copied to space
+   and patched. */
+void
+Genomebits_alt_blocks (Genomecomp_T **high_ptr, Genomecomp_T **low_ptr, Genomecomp_T **flags_ptr,
+		       Genomecomp_T *space, T alt, Univcoord_T startblocki, Univcoord_T endblocki) {
+  int nblocks;
+
+  if (Snpoverlay_blocks_p(alt->snpoverlay,startblocki,endblocki) == false) {
+    *high_ptr = &(alt->high_blocks[startblocki]);
+    *low_ptr = &(alt->low_blocks[startblocki]);
+    *flags_ptr = &(alt->flags_blocks[startblocki]);
+
+  } else {
+    nblocks = endblocki - startblocki + 1;
+    *high_ptr = &(space[0]);
+    *low_ptr = &(space[nblocks]);
+    *flags_ptr = &(space[2*nblocks]);
+    memcpy(*high_ptr,&(alt->high_blocks[startblocki]),nblocks*sizeof(Genomecomp_T));
+    memcpy(*low_ptr,&(alt->low_blocks[startblocki]),nblocks*sizeof(Genomecomp_T));
+    memcpy(*flags_ptr,&(alt->flags_blocks[startblocki]),nblocks*sizeof(Genomecomp_T));
+    Snpoverlay_patch_bits(alt->snpoverlay,*high_ptr,*low_ptr,*flags_ptr,
+			  /*startpos*/startblocki*32,nblocks);
+  }
+
+  return;
+}
+
 static char CHARTABLE[] = "ACGTXXXX";
 
 char
@@ -34,6 +34,7 @@
 #include "bool.h"
 #include "univcoord.h"
 #include "popcount.h"
+#include "snpoverlay.h"
 
 
 typedef struct Genomebits_T *Genomebits_T;
@@ -58,6 +59,8 @@ struct Genomebits_T {
   Genomecomp_T *high_blocks;
   Genomecomp_T *low_blocks;
   Genomecomp_T *flags_blocks;
+
+  Snpoverlay_T snpoverlay;	/* If not NULL, blocks alias the reference and SNPs come from here */
 };
 
 
@@ -77,9 +80,24 @@ Genomebits_free (T *old);
 extern T
 Genomebits_new (char *genomesubdir, char *fileroot, char *alt_suffix,
 		Access_mode_T access, bool sharedp, bool revcompp);
+extern T
+Genomebits_new_snpoverlay (T ref, T alt);
 extern char
 Genomebits_get_char (T this, Univcoord_T pos);
 
+/* Words of stack space for Genomebits_alt_blocks, enough for regions
+   of up to 32*(GENOMEBITS_ALT_STACK_NBLOCKS - 2) positions */
+#define GENOMEBITS_ALT_STACK_NBLOCKS 320
+#define GENOMEBITS_ALT_STACK_NWORDS (3*GENOMEBITS_ALT_STACK_NBLOCKS)
+
+extern Genomecomp_T *
+Genomebits_alt_space (Genomecomp_T *stack_space, T alt, int querylength);
+extern void
+Genomebits_alt_space_free (Genomecomp_T **space, Genomecomp_T *stack_space);
+extern void
+Genomebits_alt_blocks (Genomecomp_T **high_ptr, Genomecomp_T **low_ptr, Genomecomp_T **flags_ptr,
+		       Genomecomp_T *space, T alt, Univcoord_T startblocki, Univcoord_T endblocki);
+
 #undef T
 
 
@@ -1048,6 +1066,87 @@ block_diff_standard_masked_128 (Genomecomp_T *query_high_shifted, Genomecomp_T *
 #endif
 
 
+/* Wider versions of block_diff_standard_128, for 256 or 512 genome
+   positions at a time.  The pointers need not be aligned. */
+#ifdef HAVE_AVX2
+static inline __m256i
+block_diff_standard_256 (Genomecomp_T *query_high_shifted, Genomecomp_T *query_low_shifted,
+			 Genomecomp_T *query_flags_shifted, Genomecomp_T *ref_high_ptr,
+			 Genomecomp_T *ref_low_ptr, Genomecomp_T *ref_flags_ptr,
+			 bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
+  __m256i _diff, _query_flags, _ref_flags;
+
+  _diff = _mm256_or_si256(_mm256_xor_si256(_mm256_loadu_si256((__m256i *) query_high_shifted),
+					   _mm256_loadu_si256((__m256i *) ref_high_ptr)),
+			  _mm256_xor_si256(_mm256_loadu_si256((__m256i *) query_low_shifted),
+					   _mm256_loadu_si256((__m256i *) ref_low_ptr)));
+
+  _query_flags = _mm256_loadu_si256((__m256i *) query_flags_shifted);
+  if (query_unk_mismatch_p) {
+    _diff = _mm256_or_si256(_query_flags, _diff);
+  } else {
+    _diff = _mm256_andnot_si256(_query_flags, _diff);
+  }
+
+  _ref_flags = _mm256_loadu_si256((__m256i *) ref_flags_ptr);
+  if (genome_unk_mismatch_p) {
+    _diff = _mm256_or_si256(_ref_flags, _diff);
+  } else {
+    _diff = _mm256_andnot_si256(_ref_flags, _diff);
+  }
+
+  return _diff;
+}
+
+static inline int
+popcount_ones_256 (__m256i _diff) {
+  return popcount_ones_64((UINT8) _mm256_extract_epi64(_diff,0)) +
+    popcount_ones_64((UINT8) _mm256_extract_epi64(_diff,1)) +
+    popcount_ones_64((UINT8) _mm256_extract_epi64(_diff,2)) +
+    popcount_ones_64((UINT8) _mm256_extract_epi64(_diff,3));
+}
+#endif
+
+#ifdef HAVE_AVX512
+static inline __m512i
+block_diff_standard_512 (Genomecomp_T *query_high_shifted, Genomecomp_T *query_low_shifted,
+			 Genomecomp_T *query_flags_shifted, Genomecomp_T *ref_high_ptr,
+			 Genomecomp_T *ref_low_ptr, Genomecomp_T *ref_flags_ptr,
+			 bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
+  __m512i _diff, _query_flags, _ref_flags;
+
+  _diff = _mm512_or_si512(_mm512_xor_si512(_mm512_loadu_si512((void *) query_high_shifted),
+					   _mm512_loadu_si512((void *) ref_high_ptr)),
+			  _mm512_xor_si512(_mm512_loadu_si512((void *) query_low_shifted),
+					   _mm512_loadu_si512((void *) ref_low_ptr)));
+
+  _query_flags = _mm512_loadu_si512((void *) query_flags_shifted);
+  if (query_unk_mismatch_p) {
+    _diff = _mm512_or_si512(_query_flags, _diff);
+  } else {
+    _diff = _mm512_andnot_si512(_query_flags, _diff);
+  }
+
+  _ref_flags = _mm512_loadu_si512((void *) ref_flags_ptr);
+  if (genome_unk_mismatch_p) {
+    _diff = _mm512_or_si512(_ref_flags, _diff);
+  } else {
+    _diff = _mm512_andnot_si512(_ref_flags, _diff);
+  }
+
+  return _diff;
+}
+
+/* configure does not enable AVX-512 VPOPCNTDQ, so the lanes are
+   counted with scalar popcnt */
+static inline int
+popcount_ones_512 (__m512i _diff) {
+  return popcount_ones_256(_mm512_castsi512_si256(_diff)) +
+    popcount_ones_256(_mm512_extracti64x4_epi64(_diff,1));
+}
+#endif
+
+
 
 /************************************************************************
  *   CMET
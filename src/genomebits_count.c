@@ -25,6 +25,11 @@ static char rcsid[] = "$Id: 60c5707090c1aa0c79a99267135a1d4436bd0ab9 $";
 #endif
 
 
+/* For the specialized standard-mode procedures, which rely on
+   constant propagation of the unk flags */
+#define ALWAYS_INLINE __attribute__ ((always_inline))
+
+
 #define T Genomebits_T
 
 static T ref;
@@ -32,6 +37,7 @@ static T alt;
 
 static bool md_report_snps_p;
 static bool maskedp;
+static bool standardp;		/* Use count_standard_procs and mark_standard_procs */
 static bool query_unk_mismatch_p = false;
 static bool genome_unk_mismatch_p = false; /* Needs to be false for path-eval assertions, but needs to be true for circular alignments and mark_mismatches */
 
@@ -185,7 +191,7 @@ count_mismatches_substring (T ref, Compress_T query_compress,
 }
 
 static int
-count_mismatches_substring_snps (T ref, T alt, Compress_T query_compress,
+count_mismatches_substring_snps (T ref, T alt, Genomecomp_T *alt_space, Compress_T query_compress,
 				 Univcoord_T univdiagonal, int querylength,
 				 int pos5, int pos3, bool plusp, int genestrand,
 				 bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
@@ -228,9 +234,13 @@ count_mismatches_substring_snps (T ref, T alt, Compress_T query_compress,
   ref_high_ptr = &(ref->high_blocks[startblocki]);
   ref_low_ptr = &(ref->low_blocks[startblocki]);
   ref_flags_ptr = &(ref->flags_blocks[startblocki]);
-  alt_high_ptr = &(alt->high_blocks[startblocki]);
-  alt_low_ptr = &(alt->low_blocks[startblocki]);
-  alt_flags_ptr = &(alt->flags_blocks[startblocki]);
+  if (alt_space == NULL) {
+    alt_high_ptr = &(alt->high_blocks[startblocki]);
+    alt_low_ptr = &(alt->low_blocks[startblocki]);
+    alt_flags_ptr = &(alt->flags_blocks[startblocki]);
+  } else {
+    Genomebits_alt_blocks(&alt_high_ptr,&alt_low_ptr,&alt_flags_ptr,alt_space,alt,startblocki,endblocki);
+  }
 
   startdiscard = (left+pos5) % 32U;
   enddiscard = (left+pos3) % 32U;
@@ -320,6 +330,160 @@ count_mismatches_substring_snps (T ref, T alt, Compress_T query_compress,
 }
 
 
+/* Versions of count_mismatches_substring for standard mode, with
+   block_diff_standard inlined and the unk flags fixed at compile
+   time, one per combination of flags.  plusp and genestrand do not
+   affect standard mode.  The middle words are compared 512 or 256
+   genome positions at a time where available. */
+static inline ALWAYS_INLINE int
+count_mismatches_standard (T ref, Compress_T query_compress,
+			   Univcoord_T univdiagonal, int querylength,
+			   int pos5, int pos3, bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
+  int nmismatches = 0, nshift;
+  int startdiscard, enddiscard;
+  Univcoord_T left, startblocki, endblocki;
+  Genomecomp_T *query_high_shifted, *query_low_shifted, *query_flags_shifted;
+  Genomecomp_T *ref_high_ptr, *ref_low_ptr, *ref_flags_ptr, *end_ptr;
+  UINT4 diff_32;
+  UINT8 diff_64;
+
+  /* Check for alignments before genome start */
+  left = univdiagonal - querylength;
+  if (univdiagonal + pos5 < (Univcoord_T) querylength) {
+    pos5 = querylength - univdiagonal;
+  }
+
+  startblocki = (left+pos5)/32U;
+  endblocki = (left+pos3)/32U;
+
+  nshift = left % 32U;
+  Compress_shift(&query_high_shifted,&query_low_shifted,&query_flags_shifted,query_compress,
+		 nshift,/*initpos*/pos5);
+
+  ref_high_ptr = &(ref->high_blocks[startblocki]);
+  ref_low_ptr = &(ref->low_blocks[startblocki]);
+  ref_flags_ptr = &(ref->flags_blocks[startblocki]);
+
+  startdiscard = (left+pos5) % 32;
+  enddiscard = (left+pos3) % 32;
+
+  if (endblocki == startblocki) {
+    /* Single 32-bit */
+    diff_32 = block_diff_standard_32(query_high_shifted,query_low_shifted,
+				     query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				     /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+    diff_32 = clear_start_32(diff_32,startdiscard);
+    diff_32 = clear_end_32(diff_32,enddiscard);
+    return popcount_ones_32(diff_32);
+
+  } else if (endblocki == startblocki + 1) {
+    /* Single 64-bit */
+    diff_64 = block_diff_standard_64(query_high_shifted,query_low_shifted,
+				     query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				     /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+    diff_64 = clear_start_64(diff_64,startdiscard);
+    diff_64 = clear_end_64(diff_64,enddiscard + 32);
+    return popcount_ones_64(diff_64);
+
+  } else {
+    /* Multiple words */
+    end_ptr = &(ref->high_blocks[endblocki]);
+
+    /* Start word */
+    diff_64 = block_diff_standard_64(query_high_shifted,query_low_shifted,
+				     query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				     /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+    diff_64 = clear_start_64(diff_64,startdiscard);
+    nmismatches = popcount_ones_64(diff_64);
+
+    query_high_shifted += 2; query_low_shifted += 2; query_flags_shifted += 2;
+    ref_high_ptr += 2; ref_low_ptr += 2; ref_flags_ptr += 2;
+
+    /* Middle words */
+#ifdef HAVE_AVX512
+    while (ref_high_ptr + 16 <= end_ptr) {
+      nmismatches += popcount_ones_512(block_diff_standard_512(query_high_shifted,query_low_shifted,
+							       query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+							       query_unk_mismatch_p,genome_unk_mismatch_p));
+      query_high_shifted += 16; query_low_shifted += 16; query_flags_shifted += 16;
+      ref_high_ptr += 16; ref_low_ptr += 16; ref_flags_ptr += 16;
+    }
+#endif
+#ifdef HAVE_AVX2
+    while (ref_high_ptr + 8 <= end_ptr) {
+      nmismatches += popcount_ones_256(block_diff_standard_256(query_high_shifted,query_low_shifted,
+							       query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+							       query_unk_mismatch_p,genome_unk_mismatch_p));
+      query_high_shifted += 8; query_low_shifted += 8; query_flags_shifted += 8;
+      ref_high_ptr += 8; ref_low_ptr += 8; ref_flags_ptr += 8;
+    }
+#endif
+    while (ref_high_ptr + 2 <= end_ptr) {
+      diff_64 = block_diff_standard_64(query_high_shifted,query_low_shifted,
+				       query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				       /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+      nmismatches += popcount_ones_64(diff_64);
+
+      query_high_shifted += 2; query_low_shifted += 2; query_flags_shifted += 2;
+      ref_high_ptr += 2; ref_low_ptr += 2; ref_flags_ptr += 2;
+    }
+
+    if (ref_high_ptr + 1 == end_ptr) {
+      /* End 64-bit */
+      diff_64 = block_diff_standard_64(query_high_shifted,query_low_shifted,
+				       query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				       /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+      diff_64 = clear_end_64(diff_64,enddiscard + 32);
+      return nmismatches + popcount_ones_64(diff_64);
+
+    } else {
+      /* End 32-bit */
+      diff_32 = block_diff_standard_32(query_high_shifted,query_low_shifted,
+				       query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				       /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+      diff_32 = clear_end_32(diff_32,enddiscard);
+      return nmismatches + popcount_ones_32(diff_32);
+    }
+  }
+}
+
+/* Names give the query and genome unk flags: m for mismatch, w for wildcard */
+static int
+count_mismatches_standard_qm_gm (T ref, Compress_T query_compress,
+				 Univcoord_T univdiagonal, int querylength, int pos5, int pos3) {
+  return count_mismatches_standard(ref,query_compress,univdiagonal,querylength,pos5,pos3,
+				   /*query_unk_mismatch_p*/true,/*genome_unk_mismatch_p*/true);
+}
+
+static int
+count_mismatches_standard_qm_gw (T ref, Compress_T query_compress,
+				 Univcoord_T univdiagonal, int querylength, int pos5, int pos3) {
+  return count_mismatches_standard(ref,query_compress,univdiagonal,querylength,pos5,pos3,
+				   /*query_unk_mismatch_p*/true,/*genome_unk_mismatch_p*/false);
+}
+
+static int
+count_mismatches_standard_qw_gm (T ref, Compress_T query_compress,
+				 Univcoord_T univdiagonal, int querylength, int pos5, int pos3) {
+  return count_mismatches_standard(ref,query_compress,univdiagonal,querylength,pos5,pos3,
+				   /*query_unk_mismatch_p*/false,/*genome_unk_mismatch_p*/true);
+}
+
+static int
+count_mismatches_standard_qw_gw (T ref, Compress_T query_compress,
+				 Univcoord_T univdiagonal, int querylength, int pos5, int pos3) {
+  return count_mismatches_standard(ref,query_compress,univdiagonal,querylength,pos5,pos3,
+				   /*query_unk_mismatch_p*/false,/*genome_unk_mismatch_p*/false);
+}
+
+typedef int (*Count_standard_proc_T) (T, Compress_T, Univcoord_T, int, int, int);
+
+/* Indexed by [query_unk_mismatch_p][genome_unk_mismatch_p] */
+static const Count_standard_proc_T count_standard_procs[2][2] =
+  {{count_mismatches_standard_qw_gw, count_mismatches_standard_qw_gm},
+   {count_mismatches_standard_qm_gw, count_mismatches_standard_qm_gm}};
+
+
 /* left is where the start of the query matches.  pos5 is where we
    want to start comparing in the query.  pos3 is just after where we
    want to stop comparing in the query, i.e., stop at (pos3-1)
@@ -328,26 +492,36 @@ int
 Genomebits_count_mismatches_substring (int *ref_mismatches, T ref, T alt, Compress_T query_compress,
 				       Univcoord_T univdiagonal, int querylength,
 				       int pos5, int pos3, bool plusp, int genestrand) {
+  Genomecomp_T alt_stack[GENOMEBITS_ALT_STACK_NWORDS], *alt_space;
+
   assert(pos5 <= pos3);
 
   if (alt == NULL) {
-    *ref_mismatches = count_mismatches_substring(ref,query_compress,univdiagonal,querylength,
-						 pos5,pos3,plusp,genestrand,
-						 query_unk_mismatch_p,genome_unk_mismatch_p);
+    if (standardp == true) {
+      assert(Compress_fwdp(query_compress) == plusp);
+      *ref_mismatches = (count_standard_procs[query_unk_mismatch_p][genome_unk_mismatch_p])
+	(ref,query_compress,univdiagonal,querylength,pos5,pos3);
+    } else {
+      *ref_mismatches = count_mismatches_substring(ref,query_compress,univdiagonal,querylength,
+						   pos5,pos3,plusp,genestrand,
+						   query_unk_mismatch_p,genome_unk_mismatch_p);
+    }
     return *ref_mismatches;
 
   } else if (maskedp == false) {
     /* Rely solely on SNP-tolerant alignment */
-    *ref_mismatches = count_mismatches_substring_snps(ref,alt,query_compress,
+    alt_space = Genomebits_alt_space(alt_stack,alt,querylength);
+    *ref_mismatches = count_mismatches_substring_snps(ref,alt,alt_space,query_compress,
 						      univdiagonal,querylength,
 						      pos5,pos3,plusp,genestrand,
 						      query_unk_mismatch_p,genome_unk_mismatch_p);
+    Genomebits_alt_space_free(&alt_space,alt_stack);
     return *ref_mismatches;
 
   } else {
     /* Mask genomic N's, and do not count as mismatches */
     /* Return only mismatches to exons */
-    *ref_mismatches = count_mismatches_substring_snps(ref,alt,query_compress,
+    *ref_mismatches = count_mismatches_substring_snps(ref,alt,/*alt_space*/NULL,query_compress,
 						      univdiagonal,querylength,
 						      pos5,pos3,plusp,genestrand,
 						      query_unk_mismatch_p,/*genome_unk_mismatch_p*/false);
@@ -596,7 +770,7 @@ mark_mismatches (char *genomic, T ref, Compress_T query_compress,
    block_diff_snp procedures.  Since genomic originally starts off as
    query, it needs to repl ace mismatches with ref sequence */
 static int
-mark_mismatches_snps (char *genomic, T ref, T alt, Compress_T query_compress,
+mark_mismatches_snps (char *genomic, T ref, T alt, Genomecomp_T *alt_space, Compress_T query_compress,
 		      Univcoord_T univdiagonal, int querylength,
 		      int pos5, int pos3, bool segment_plusp, bool query_plusp, int genestrand,
 		      bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
@@ -641,9 +815,13 @@ mark_mismatches_snps (char *genomic, T ref, T alt, Compress_T query_compress,
   ref_high_ptr = &(ref->high_blocks[startblocki]);
   ref_low_ptr = &(ref->low_blocks[startblocki]);
   ref_flags_ptr = &(ref->flags_blocks[startblocki]);
-  alt_high_ptr = &(alt->high_blocks[startblocki]);
-  alt_low_ptr = &(alt->low_blocks[startblocki]);
-  alt_flags_ptr = &(alt->flags_blocks[startblocki]);
+  if (alt_space == NULL) {
+    alt_high_ptr = &(alt->high_blocks[startblocki]);
+    alt_low_ptr = &(alt->low_blocks[startblocki]);
+    alt_flags_ptr = &(alt->flags_blocks[startblocki]);
+  } else {
+    Genomebits_alt_blocks(&alt_high_ptr,&alt_low_ptr,&alt_flags_ptr,alt_space,alt,startblocki,endblocki);
+  }
 
   startdiscard = (left+pos5) % 32U;
   enddiscard = (left+pos3) % 32U;
@@ -813,20 +991,278 @@ mark_mismatches_snps (char *genomic, T ref, T alt, Compress_T query_compress,
 }
 
 
+/* Marks the mismatches in diff_64, for the 64 genome positions at
+   ref_high_ptr, ref_low_ptr, and ref_flags_ptr */
+static inline ALWAYS_INLINE int
+mark_diff_64 (char *genomic, UINT8 diff_64, Genomecomp_T *ref_high_ptr,
+	      Genomecomp_T *ref_low_ptr, Genomecomp_T *ref_flags_ptr,
+	      int offset, int querylength, bool segment_plusp, bool query_plusp) {
+  int nmismatches = 0, mismatch_position, relpos;
+  int idx;
+
+  while (nonzero_p_64(diff_64)) {
+    mismatch_position = offset + (relpos = count_trailing_zeroes_64(diff_64));
+    diff_64 = clear_lowbit_64(diff_64,relpos);
+    idx = ((cast64(ref_flags_ptr) >> relpos) & 0x1) << 2 |
+      ((cast64(ref_high_ptr) >> relpos) & 0x1) << 1 |
+      ((cast64(ref_low_ptr) >> relpos) & 0x1);
+    if (segment_plusp != query_plusp) {
+      mismatch_position = (querylength - 1) - mismatch_position;
+      genomic[mismatch_position] = lowercase_revcomp_chartable[idx];
+    } else {
+      genomic[mismatch_position] = lowercase_chartable[idx];
+    }
+    nmismatches++;
+  }
+
+  return nmismatches;
+}
+
+static inline ALWAYS_INLINE int
+mark_diff_32 (char *genomic, UINT4 diff_32, Genomecomp_T *ref_high_ptr,
+	      Genomecomp_T *ref_low_ptr, Genomecomp_T *ref_flags_ptr,
+	      int offset, int querylength, bool segment_plusp, bool query_plusp) {
+  int nmismatches = 0, mismatch_position, relpos;
+  int idx;
+
+  while (nonzero_p_32(diff_32)) {
+    mismatch_position = offset + (relpos = count_trailing_zeroes_32(diff_32));
+    diff_32 = clear_lowbit_32(diff_32,relpos);
+    idx = ((*ref_flags_ptr >> relpos) & 0x1) << 2 |
+      ((*ref_high_ptr >> relpos) & 0x1) << 1 |
+      ((*ref_low_ptr >> relpos) & 0x1);
+    if (segment_plusp != query_plusp) {
+      mismatch_position = (querylength - 1) - mismatch_position;
+      genomic[mismatch_position] = lowercase_revcomp_chartable[idx];
+    } else {
+      genomic[mismatch_position] = lowercase_chartable[idx];
+    }
+    nmismatches++;
+  }
+
+  return nmismatches;
+}
+
+
+/* Versions of mark_mismatches for standard mode, analogous to
+   count_mismatches_standard.  Wide comparisons with no mismatches
+   are skipped, and the others are marked 64 bits at a time. */
+static inline ALWAYS_INLINE int
+mark_mismatches_standard (char *genomic, T ref, Compress_T query_compress,
+			  Univcoord_T univdiagonal, int querylength,
+			  int pos5, int pos3, bool segment_plusp, bool query_plusp,
+			  bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
+  int nmismatches = 0, offset, nshift;
+  int startdiscard, enddiscard;
+  Univcoord_T left, startblocki, endblocki;
+  Genomecomp_T *query_high_shifted, *query_low_shifted, *query_flags_shifted;
+  Genomecomp_T *ref_high_ptr, *ref_low_ptr, *ref_flags_ptr, *end_ptr;
+  UINT4 diff_32;
+  UINT8 diff_64;
+#ifdef HAVE_AVX2
+  UINT8 diff_lanes[8];
+  int lanei;
+  __m256i _diff_256;
+#endif
+#ifdef HAVE_AVX512
+  __m512i _diff_512;
+#endif
+
+  /* Check for alignments before genome start */
+  left = univdiagonal - querylength;
+  if (univdiagonal + pos5 < (Univcoord_T) querylength) {
+    pos5 = querylength - univdiagonal;
+  }
+
+  startblocki = (left+pos5)/32U;
+  endblocki = (left+pos3)/32U;
+
+  nshift = left % 32U;
+  Compress_shift(&query_high_shifted,&query_low_shifted,&query_flags_shifted,query_compress,
+		 nshift,/*initpos*/pos5);
+
+  ref_high_ptr = &(ref->high_blocks[startblocki]);
+  ref_low_ptr = &(ref->low_blocks[startblocki]);
+  ref_flags_ptr = &(ref->flags_blocks[startblocki]);
+
+  startdiscard = (left+pos5) % 32U;
+  enddiscard = (left+pos3) % 32U;
+  offset = -startdiscard + pos5; /* for mismatch_position from qpos 0 */
+
+  if (endblocki == startblocki) {
+    /* Single 32-bit */
+    diff_32 = block_diff_standard_32(query_high_shifted,query_low_shifted,
+				     query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				     /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+    diff_32 = clear_start_32(diff_32,startdiscard);
+    diff_32 = clear_end_32(diff_32,enddiscard);
+    return mark_diff_32(genomic,diff_32,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+			offset,querylength,segment_plusp,query_plusp);
+
+  } else if (endblocki == startblocki + 1) {
+    /* Single 64-bit */
+    diff_64 = block_diff_standard_64(query_high_shifted,query_low_shifted,
+				     query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				     /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+    diff_64 = clear_start_64(diff_64,startdiscard);
+    diff_64 = clear_end_64(diff_64,enddiscard + 32);
+    return mark_diff_64(genomic,diff_64,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+			offset,querylength,segment_plusp,query_plusp);
+
+  } else {
+    /* Multiple words */
+    end_ptr = &(ref->high_blocks[endblocki]);
+
+    /* Start word */
+    diff_64 = block_diff_standard_64(query_high_shifted,query_low_shifted,
+				     query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				     /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+    diff_64 = clear_start_64(diff_64,startdiscard);
+    nmismatches = mark_diff_64(genomic,diff_64,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+			       offset,querylength,segment_plusp,query_plusp);
+
+    query_high_shifted += 2; query_low_shifted += 2; query_flags_shifted += 2;
+    ref_high_ptr += 2; ref_low_ptr += 2; ref_flags_ptr += 2;
+    offset += 64;
+
+    /* Middle words */
+#ifdef HAVE_AVX512
+    while (ref_high_ptr + 16 <= end_ptr) {
+      _diff_512 = block_diff_standard_512(query_high_shifted,query_low_shifted,
+					  query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+					  query_unk_mismatch_p,genome_unk_mismatch_p);
+      if (_mm512_test_epi64_mask(_diff_512,_diff_512) != 0) {
+	_mm512_storeu_si512((void *) diff_lanes,_diff_512);
+	for (lanei = 0; lanei < 8; lanei++) {
+	  nmismatches += mark_diff_64(genomic,diff_lanes[lanei],&(ref_high_ptr[2*lanei]),
+				      &(ref_low_ptr[2*lanei]),&(ref_flags_ptr[2*lanei]),
+				      offset + 64*lanei,querylength,segment_plusp,query_plusp);
+	}
+      }
+      query_high_shifted += 16; query_low_shifted += 16; query_flags_shifted += 16;
+      ref_high_ptr += 16; ref_low_ptr += 16; ref_flags_ptr += 16;
+      offset += 512;
+    }
+#endif
+#ifdef HAVE_AVX2
+    while (ref_high_ptr + 8 <= end_ptr) {
+      _diff_256 = block_diff_standard_256(query_high_shifted,query_low_shifted,
+					  query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+					  query_unk_mismatch_p,genome_unk_mismatch_p);
+      if (!_mm256_testz_si256(_diff_256,_diff_256)) {
+	_mm256_storeu_si256((__m256i *) diff_lanes,_diff_256);
+	for (lanei = 0; lanei < 4; lanei++) {
+	  nmismatches += mark_diff_64(genomic,diff_lanes[lanei],&(ref_high_ptr[2*lanei]),
+				      &(ref_low_ptr[2*lanei]),&(ref_flags_ptr[2*lanei]),
+				      offset + 64*lanei,querylength,segment_plusp,query_plusp);
+	}
+      }
+      query_high_shifted += 8; query_low_shifted += 8; query_flags_shifted += 8;
+      ref_high_ptr += 8; ref_low_ptr += 8; ref_flags_ptr += 8;
+      offset += 256;
+    }
+#endif
+    while (ref_high_ptr + 2 <= end_ptr) {
+      diff_64 = block_diff_standard_64(query_high_shifted,query_low_shifted,
+				       query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				       /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+      nmismatches += mark_diff_64(genomic,diff_64,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				  offset,querylength,segment_plusp,query_plusp);
+
+      query_high_shifted += 2; query_low_shifted += 2; query_flags_shifted += 2;
+      ref_high_ptr += 2; ref_low_ptr += 2; ref_flags_ptr += 2;
+      offset += 64;
+    }
+
+    if (ref_high_ptr + 1 == end_ptr) {
+      /* End 64-bit */
+      diff_64 = block_diff_standard_64(query_high_shifted,query_low_shifted,
+				       query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				       /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+      diff_64 = clear_end_64(diff_64,enddiscard + 32);
+      return nmismatches + mark_diff_64(genomic,diff_64,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+					offset,querylength,segment_plusp,query_plusp);
+
+    } else {
+      /* End 32-bit */
+      diff_32 = block_diff_standard_32(query_high_shifted,query_low_shifted,
+				       query_flags_shifted,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+				       /*plusp*/true,/*genestrand*/0,query_unk_mismatch_p,genome_unk_mismatch_p);
+      diff_32 = clear_end_32(diff_32,enddiscard);
+      return nmismatches + mark_diff_32(genomic,diff_32,ref_high_ptr,ref_low_ptr,ref_flags_ptr,
+					offset,querylength,segment_plusp,query_plusp);
+    }
+  }
+}
+
+static int
+mark_mismatches_standard_qm_gm (char *genomic, T ref, Compress_T query_compress,
+				Univcoord_T univdiagonal, int querylength,
+				int pos5, int pos3, bool segment_plusp, bool query_plusp) {
+  return mark_mismatches_standard(genomic,ref,query_compress,univdiagonal,querylength,
+				  pos5,pos3,segment_plusp,query_plusp,
+				  /*query_unk_mismatch_p*/true,/*genome_unk_mismatch_p*/true);
+}
+
+static int
+mark_mismatches_standard_qm_gw (char *genomic, T ref, Compress_T query_compress,
+				Univcoord_T univdiagonal, int querylength,
+				int pos5, int pos3, bool segment_plusp, bool query_plusp) {
+  return mark_mismatches_standard(genomic,ref,query_compress,univdiagonal,querylength,
+				  pos5,pos3,segment_plusp,query_plusp,
+				  /*query_unk_mismatch_p*/true,/*genome_unk_mismatch_p*/false);
+}
+
+static int
+mark_mismatches_standard_qw_gm (char *genomic, T ref, Compress_T query_compress,
+				Univcoord_T univdiagonal, int querylength,
+				int pos5, int pos3, bool segment_plusp, bool query_plusp) {
+  return mark_mismatches_standard(genomic,ref,query_compress,univdiagonal,querylength,
+				  pos5,pos3,segment_plusp,query_plusp,
+				  /*query_unk_mismatch_p*/false,/*genome_unk_mismatch_p*/true);
+}
+
+static int
+mark_mismatches_standard_qw_gw (char *genomic, T ref, Compress_T query_compress,
+				Univcoord_T univdiagonal, int querylength,
+				int pos5, int pos3, bool segment_plusp, bool query_plusp) {
+  return mark_mismatches_standard(genomic,ref,query_compress,univdiagonal,querylength,
+				  pos5,pos3,segment_plusp,query_plusp,
+				  /*query_unk_mismatch_p*/false,/*genome_unk_mismatch_p*/false);
+}
+
+typedef int (*Mark_standard_proc_T) (char *, T, Compress_T, Univcoord_T, int, int, int, bool, bool);
+
+/* Indexed by [query_unk_mismatch_p][genome_unk_mismatch_p] */
+static const Mark_standard_proc_T mark_standard_procs[2][2] =
+  {{mark_mismatches_standard_qw_gw, mark_mismatches_standard_qw_gm},
+   {mark_mismatches_standard_qm_gw, mark_mismatches_standard_qm_gm}};
+
+
 int
 Genomebits_mark_mismatches (int *nmatches_exonic, char *genomic,
 			    Compress_T query_compress,
 			    Univcoord_T univdiagonal, int querylength,
 			    int pos5, int pos3, bool segment_plusp, bool query_plusp,
 			    int genestrand) {
+  Genomecomp_T alt_stack[GENOMEBITS_ALT_STACK_NWORDS], *alt_space;
+  int nmismatches;
+
   assert(pos5 < pos3);
 
   if (alt == NULL) {
     *nmatches_exonic = 0;
-    return mark_mismatches(&(*genomic),ref,query_compress,
-			   univdiagonal,querylength,pos5,pos3,
-			   segment_plusp,query_plusp,genestrand,
-			   /*query_unk_mismatch_p*/true,/*genome_unk_mismatch_p*/true);
+    if (standardp == true) {
+      assert(Compress_fwdp(query_compress) == segment_plusp);
+      return mark_mismatches_standard_qm_gm(&(*genomic),ref,query_compress,
+					    univdiagonal,querylength,pos5,pos3,
+					    segment_plusp,query_plusp);
+    } else {
+      return mark_mismatches(&(*genomic),ref,query_compress,
+			     univdiagonal,querylength,pos5,pos3,
+			     segment_plusp,query_plusp,genestrand,
+			     /*query_unk_mismatch_p*/true,/*genome_unk_mismatch_p*/true);
+    }
 
   } else if (maskedp == true) {
     *nmatches_exonic = (pos3 - pos5) -
@@ -845,19 +1281,28 @@ Genomebits_mark_mismatches (int *nmatches_exonic, char *genomic,
   } else if (md_report_snps_p == true) {
     /* Mark relative to ref, not using alt */
     *nmatches_exonic = 0;
-    return mark_mismatches(&(*genomic),ref,query_compress,
-			   univdiagonal,querylength,pos5,pos3,
-			   segment_plusp,query_plusp,genestrand,
-			   query_unk_mismatch_p,genome_unk_mismatch_p);
+    if (standardp == true) {
+      return (mark_standard_procs[query_unk_mismatch_p][genome_unk_mismatch_p])
+	(&(*genomic),ref,query_compress,univdiagonal,querylength,pos5,pos3,
+	 segment_plusp,query_plusp);
+    } else {
+      return mark_mismatches(&(*genomic),ref,query_compress,
+			     univdiagonal,querylength,pos5,pos3,
+			     segment_plusp,query_plusp,genestrand,
+			     query_unk_mismatch_p,genome_unk_mismatch_p);
+    }
 
 
   } else {
     /* Mark in with snp-tolerance (ignoring known SNPs) */
     *nmatches_exonic = 0;
-    return mark_mismatches_snps(&(*genomic),ref,alt,query_compress,
-				univdiagonal,querylength,pos5,pos3,
-				segment_plusp,query_plusp,genestrand,
-				query_unk_mismatch_p,genome_unk_mismatch_p);
+    alt_space = Genomebits_alt_space(alt_stack,alt,querylength);
+    nmismatches = mark_mismatches_snps(&(*genomic),ref,alt,alt_space,query_compress,
+				       univdiagonal,querylength,pos5,pos3,
+				       segment_plusp,query_plusp,genestrand,
+				       query_unk_mismatch_p,genome_unk_mismatch_p);
+    Genomebits_alt_space_free(&alt_space,alt_stack);
+    return nmismatches;
   }
 }
 
@@ -876,6 +1321,7 @@ Genomebits_count_setup (T ref_in, T alt_in,
   genome_unk_mismatch_p = genome_unk_mismatch_p_in;
   md_report_snps_p = md_report_snps_p_in;
   maskedp = maskedp_in;
+  standardp = (mode == STANDARD) ? true : false;
 
 
   switch (mode) {
@@ -0,0 +1,294 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+/* Throughput benchmark for Genomebits_count_mismatches_substring and
+   Genomebits_mark_mismatches in standard mode.  Built only on
+   request, by "make genomebits_count_bench", using the highest SIMD
+   level that the compiler supports.  Queries are taken from a random
+   genome, with substitutions and Ns, and the results are checked
+   against a position-by-position comparison before timing. */
+
+#include "genomebits_count.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mem.h"
+#include "stopwatch.h"
+
+
+#define GENOMELENGTH (1 << 22)
+#define NQUERIES 4096
+#define NROUNDS 64
+#define SUBST_PER_1000 20
+#define N_PER_1000 5
+#define MAXDISCARD 8		/* Trimmed from either end of the query */
+
+static int querylengths[] = {100, 150, 300, 1000};
+#define NLENGTHS (int) (sizeof(querylengths)/sizeof(int))
+
+static char nt_chars[] = "ACGT";
+
+
+typedef struct Query_T *Query_T;
+struct Query_T {
+  char *queryseq;
+  Compress_T query_compress;
+  Univcoord_T univdiagonal;
+  int pos5;
+  int pos3;
+};
+
+
+static Genomebits_T
+make_genome (char *genomeseq, Univcoord_T genomelength) {
+  Genomebits_T genomebits;
+  Univcoord_T pos;
+  int nblocks, blocki, c;
+
+  nblocks = genomelength/32 + 1;
+  genomebits = (Genomebits_T) MALLOC(sizeof(*genomebits));
+  memset(genomebits,0,sizeof(*genomebits));
+  genomebits->access = ALLOCATED_PRIVATE;
+  genomebits->high_blocks = (Genomecomp_T *) CALLOC_KEEP(nblocks,sizeof(Genomecomp_T));
+  genomebits->low_blocks = (Genomecomp_T *) CALLOC_KEEP(nblocks,sizeof(Genomecomp_T));
+  genomebits->flags_blocks = (Genomecomp_T *) CALLOC_KEEP(nblocks,sizeof(Genomecomp_T));
+  genomebits->snpoverlay = NULL;
+
+  for (pos = 0; pos < genomelength; pos++) {
+    blocki = pos/32;
+    if (rand() % 1000 < N_PER_1000) {
+      genomeseq[pos] = 'N';
+      genomebits->flags_blocks[blocki] |= (1U << (pos % 32));
+    } else {
+      c = rand() % 4;
+      genomeseq[pos] = nt_chars[c];
+      genomebits->high_blocks[blocki] |= (Genomecomp_T) (c >> 1) << (pos % 32);
+      genomebits->low_blocks[blocki] |= (Genomecomp_T) (c & 1) << (pos % 32);
+    }
+  }
+  genomeseq[genomelength] = '\0';
+
+  return genomebits;
+}
+
+static struct Query_T *
+make_queries (char *genomeseq, Univcoord_T genomelength, int querylength) {
+  struct Query_T *queries;
+  Univcoord_T left;
+  int queryi, i;
+
+  queries = (struct Query_T *) MALLOC(NQUERIES*sizeof(struct Query_T));
+  for (queryi = 0; queryi < NQUERIES; queryi++) {
+    left = (Univcoord_T) rand() % (genomelength - querylength);
+    queries[queryi].queryseq = (char *) MALLOC((querylength+1)*sizeof(char));
+    for (i = 0; i < querylength; i++) {
+      if (rand() % 1000 < N_PER_1000) {
+	queries[queryi].queryseq[i] = 'N';
+      } else if (rand() % 1000 < SUBST_PER_1000 || genomeseq[left+i] == 'N') {
+	queries[queryi].queryseq[i] = nt_chars[rand() % 4];
+      } else {
+	queries[queryi].queryseq[i] = genomeseq[left+i];
+      }
+    }
+    queries[queryi].queryseq[querylength] = '\0';
+    queries[queryi].query_compress = Compress_new_fwd(queries[queryi].queryseq,querylength);
+    queries[queryi].univdiagonal = left + querylength;
+    queries[queryi].pos5 = rand() % MAXDISCARD;
+    queries[queryi].pos3 = querylength - rand() % MAXDISCARD;
+  }
+
+  return queries;
+}
+
+static void
+free_queries (struct Query_T *queries) {
+  int queryi;
+
+  for (queryi = 0; queryi < NQUERIES; queryi++) {
+    Compress_free(&queries[queryi].query_compress);
+    FREE(queries[queryi].queryseq);
+  }
+  FREE(queries);
+  return;
+}
+
+
+/* Mirrors block_diff_standard: a genome N overrides a query N */
+static bool
+mismatchp (char querychar, char genomechar, bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
+  if (genomechar == 'N') {
+    return genome_unk_mismatch_p;
+  } else if (querychar == 'N') {
+    return query_unk_mismatch_p;
+  } else {
+    return (querychar != genomechar) ? true : false;
+  }
+}
+
+static void
+check_queries (Genomebits_T genomebits, char *genomeseq, struct Query_T *queries, int querylength,
+	       bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
+  char *genomic;
+  Univcoord_T left;
+  int nmismatches, expected, ref_mismatches, nmatches_exonic;
+  int queryi, i;
+
+  genomic = (char *) MALLOC((querylength+1)*sizeof(char));
+  for (queryi = 0; queryi < NQUERIES; queryi++) {
+    left = queries[queryi].univdiagonal - querylength;
+
+    expected = 0;
+    for (i = queries[queryi].pos5; i < queries[queryi].pos3; i++) {
+      if (mismatchp(queries[queryi].queryseq[i],genomeseq[left+i],
+		    query_unk_mismatch_p,genome_unk_mismatch_p) == true) {
+	expected++;
+      }
+    }
+    nmismatches = Genomebits_count_mismatches_substring(&ref_mismatches,genomebits,/*alt*/NULL,
+							queries[queryi].query_compress,
+							queries[queryi].univdiagonal,querylength,
+							queries[queryi].pos5,queries[queryi].pos3,
+							/*plusp*/true,/*genestrand*/0);
+    if (nmismatches != expected) {
+      fprintf(stderr,"Query %d of length %d: counted %d mismatches, expected %d\n",
+	      queryi,querylength,nmismatches,expected);
+      exit(9);
+    }
+
+    /* Genomebits_mark_mismatches treats Ns as mismatches */
+    strcpy(genomic,queries[queryi].queryseq);
+    nmismatches = Genomebits_mark_mismatches(&nmatches_exonic,genomic,queries[queryi].query_compress,
+					     queries[queryi].univdiagonal,querylength,
+					     queries[queryi].pos5,queries[queryi].pos3,
+					     /*segment_plusp*/true,/*query_plusp*/true,/*genestrand*/0);
+    expected = 0;
+    for (i = queries[queryi].pos5; i < queries[queryi].pos3; i++) {
+      if (mismatchp(queries[queryi].queryseq[i],genomeseq[left+i],true,true) == true) {
+	if (genomic[i] != (genomeseq[left+i] == 'N' ? 'x' : genomeseq[left+i] - 'A' + 'a')) {
+	  fprintf(stderr,"Query %d of length %d: position %d marked as %c, expected %c\n",
+		  queryi,querylength,i,genomic[i],genomeseq[left+i]);
+	  exit(9);
+	}
+	expected++;
+      } else if (genomic[i] != queries[queryi].queryseq[i]) {
+	fprintf(stderr,"Query %d of length %d: position %d marked but matches\n",
+		queryi,querylength,i);
+	exit(9);
+      }
+    }
+    if (nmismatches != expected) {
+      fprintf(stderr,"Query %d of length %d: marked %d mismatches, expected %d\n",
+	      queryi,querylength,nmismatches,expected);
+      exit(9);
+    }
+  }
+  FREE(genomic);
+
+  return;
+}
+
+
+static double
+time_count (Genomebits_T genomebits, struct Query_T *queries, int querylength) {
+  Stopwatch_T stopwatch;
+  double runtime;
+  int ref_mismatches, total = 0;
+  int round, queryi;
+
+  stopwatch = Stopwatch_new();
+  Stopwatch_start(stopwatch);
+  for (round = 0; round < NROUNDS; round++) {
+    for (queryi = 0; queryi < NQUERIES; queryi++) {
+      total += Genomebits_count_mismatches_substring(&ref_mismatches,genomebits,/*alt*/NULL,
+						     queries[queryi].query_compress,
+						     queries[queryi].univdiagonal,querylength,
+						     queries[queryi].pos5,queries[queryi].pos3,
+						     /*plusp*/true,/*genestrand*/0);
+    }
+  }
+  runtime = Stopwatch_stop(stopwatch);
+  Stopwatch_free(&stopwatch);
+
+  if (total < 0) {
+    /* Keeps the calls from being optimized away */
+    printf("%d\n",total);
+  }
+
+  return (double) NROUNDS * (double) NQUERIES / runtime / 1e6;
+}
+
+static double
+time_mark (struct Query_T *queries, int querylength) {
+  Stopwatch_T stopwatch;
+  double runtime;
+  char *genomic;
+  int nmatches_exonic, total = 0;
+  int round, queryi;
+
+  genomic = (char *) MALLOC((querylength+1)*sizeof(char));
+  strcpy(genomic,queries[0].queryseq);
+
+  stopwatch = Stopwatch_new();
+  Stopwatch_start(stopwatch);
+  for (round = 0; round < NROUNDS; round++) {
+    for (queryi = 0; queryi < NQUERIES; queryi++) {
+      /* Marks are idempotent, so genomic need not be reset */
+      total += Genomebits_mark_mismatches(&nmatches_exonic,genomic,queries[queryi].query_compress,
+					  queries[queryi].univdiagonal,querylength,
+					  queries[queryi].pos5,queries[queryi].pos3,
+					  /*segment_plusp*/true,/*query_plusp*/true,/*genestrand*/0);
+    }
+  }
+  runtime = Stopwatch_stop(stopwatch);
+  Stopwatch_free(&stopwatch);
+
+  FREE(genomic);
+  if (total < 0) {
+    printf("%d\n",total);
+  }
+
+  return (double) NROUNDS * (double) NQUERIES / runtime / 1e6;
+}
+
+
+int
+main (int argc, char *argv[]) {
+  Genomebits_T genomebits;
+  char *genomeseq;
+  struct Query_T *queries;
+  char label[32];
+  int query_unk, genome_unk;
+  int lengthi;
+
+  srand(42);
+  genomeseq = (char *) MALLOC((GENOMELENGTH+1)*sizeof(char));
+  genomebits = make_genome(genomeseq,GENOMELENGTH);
+
+  printf("%-6s %-24s %12s\n","length","procedure","Mqueries/s");
+  for (lengthi = 0; lengthi < NLENGTHS; lengthi++) {
+    queries = make_queries(genomeseq,GENOMELENGTH,querylengths[lengthi]);
+
+    for (query_unk = 0; query_unk <= 1; query_unk++) {
+      for (genome_unk = 0; genome_unk <= 1; genome_unk++) {
+	Genomebits_count_setup(genomebits,/*alt*/NULL,query_unk,genome_unk,STANDARD,
+			       /*md_report_snps_p*/false,/*maskedp*/false);
+	check_queries(genomebits,genomeseq,queries,querylengths[lengthi],query_unk,genome_unk);
+	sprintf(label,"count q_%s g_%s",query_unk ? "mismatch" : "wildcard",
+		genome_unk ? "mismatch" : "wildcard");
+	printf("%-6d %-24s %12.2f\n",querylengths[lengthi],label,
+	       time_count(genomebits,queries,querylengths[lengthi]));
+      }
+    }
+    printf("%-6d %-24s %12.2f\n",querylengths[lengthi],"mark",time_mark(queries,querylengths[lengthi]));
+
+    free_queries(queries);
+  }
+
+  Genomebits_free(&genomebits);
+  FREE(genomeseq);
+
+  return 0;
+}
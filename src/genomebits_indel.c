@@ -356,6 +356,11 @@ genomebits_shift (Genomecomp_T **genome_high_shifted, Genomecomp_T **genome_low_
     }
   }
 
+  if (genome->snpoverlay != NULL) {
+    Snpoverlay_patch_bits(genome->snpoverlay,*genome_high_shifted,*genome_low_shifted,*genome_flags_shifted,
+			  startpos,nwords);
+  }
+
   return nwords;
 }
 
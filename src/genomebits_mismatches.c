@@ -246,7 +246,7 @@ mismatches_fromleft (int *mismatch_positions, int max_mismatches, T ref, Compres
 
 /* Returns nmismatches_fromboth */
 static int
-mismatches_fromleft_alt (int *mismatch_positions, int max_mismatches, T ref, T alt,
+mismatches_fromleft_alt (int *mismatch_positions, int max_mismatches, T ref, T alt, Genomecomp_T *alt_space,
 			 Compress_T query_compress, Univcoord_T univdiagonal, int querylength,
 			 int pos5, int pos3, bool plusp, int genestrand,
 			 bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
@@ -292,9 +292,13 @@ mismatches_fromleft_alt (int *mismatch_positions, int max_mismatches, T ref, T a
   ref_high_ptr = &(ref->high_blocks[startblocki]);
   ref_low_ptr = &(ref->low_blocks[startblocki]);
   ref_flags_ptr = &(ref->flags_blocks[startblocki]);
-  alt_high_ptr = &(alt->high_blocks[startblocki]);
-  alt_low_ptr = &(alt->low_blocks[startblocki]);
-  alt_flags_ptr = &(alt->flags_blocks[startblocki]);
+  if (alt_space == NULL) {
+    alt_high_ptr = &(alt->high_blocks[startblocki]);
+    alt_low_ptr = &(alt->low_blocks[startblocki]);
+    alt_flags_ptr = &(alt->flags_blocks[startblocki]);
+  } else {
+    Genomebits_alt_blocks(&alt_high_ptr,&alt_low_ptr,&alt_flags_ptr,alt_space,alt,startblocki,endblocki);
+  }
 
   startdiscard = (left+pos5) % 32U;
   enddiscard = (left+pos3) % 32U;
@@ -453,6 +457,7 @@ Genomebits_mismatches_fromleft (int *mismatch_positions, int max_mismatches, T r
 				Compress_T query_compress,
 				Univcoord_T univdiagonal, int querylength,
 				int pos5, int pos3, bool plusp, int genestrand) {
+  Genomecomp_T alt_stack[GENOMEBITS_ALT_STACK_NWORDS], *alt_space;
   int nmismatches;
 #ifdef DEBUG0
   int i;
@@ -466,9 +471,11 @@ Genomebits_mismatches_fromleft (int *mismatch_positions, int max_mismatches, T r
 				      query_unk_mismatch_p,genome_unk_mismatch_p);
   } else {
 
-    nmismatches = mismatches_fromleft_alt(&(*mismatch_positions),max_mismatches,ref,alt,query_compress,
+    alt_space = Genomebits_alt_space(alt_stack,alt,querylength);
+    nmismatches = mismatches_fromleft_alt(&(*mismatch_positions),max_mismatches,ref,alt,alt_space,query_compress,
 					  univdiagonal,querylength,pos5,pos3,plusp,genestrand,
 					  query_unk_mismatch_p,genome_unk_mismatch_p);
+    Genomebits_alt_space_free(&alt_space,alt_stack);
   }
   mismatch_positions[nmismatches] = pos3;
   debug0(printf("Genomebits_mismatches_fromleft with left %u, pos5 %d, pos3 %d\n",left,pos5,pos3));
@@ -492,6 +499,7 @@ Genomebits_mismatches_fromleft_for_trim (int *mismatch_positions, int max_mismat
 					 Compress_T query_compress,
 					 Univcoord_T univdiagonal, int querylength,
 					 int pos5, int pos3, bool plusp, int genestrand) {
+  Genomecomp_T alt_stack[GENOMEBITS_ALT_STACK_NWORDS], *alt_space;
   int nmismatches;
 #ifdef DEBUG
   int i;
@@ -505,10 +513,12 @@ Genomebits_mismatches_fromleft_for_trim (int *mismatch_positions, int max_mismat
 				      plusp,genestrand,/*query_unk_mismatch_p*/false,
 				      /*genome_unk_mismatch_p*/true);
   } else {
-    nmismatches = mismatches_fromleft_alt(&(*mismatch_positions),max_mismatches,ref,alt,query_compress,
+    alt_space = Genomebits_alt_space(alt_stack,alt,querylength);
+    nmismatches = mismatches_fromleft_alt(&(*mismatch_positions),max_mismatches,ref,alt,alt_space,query_compress,
 					  univdiagonal,querylength,pos5,pos3,
 					  plusp,genestrand,/*query_unk_mismatch_p*/false,
 					  /*genome_unk_mismatch_p*/true);
+    Genomebits_alt_space_free(&alt_space,alt_stack);
   }
   mismatch_positions[nmismatches] = pos3;
   debug(
@@ -714,7 +724,7 @@ mismatches_fromright (int *mismatch_positions, int max_mismatches, T ref, Compre
 
 /* Returns nmismatches_fromboth */
 static int
-mismatches_fromright_alt (int *mismatch_positions, int max_mismatches, T ref, T alt,
+mismatches_fromright_alt (int *mismatch_positions, int max_mismatches, T ref, T alt, Genomecomp_T *alt_space,
 			  Compress_T query_compress, Univcoord_T univdiagonal, int querylength,
 			  int pos5, int pos3, bool plusp, int genestrand,
 			  bool query_unk_mismatch_p, bool genome_unk_mismatch_p) {
@@ -761,9 +771,16 @@ mismatches_fromright_alt (int *mismatch_positions, int max_mismatches, T ref, T
   ref_high_ptr = &(ref->high_blocks[endblocki]);
   ref_low_ptr = &(ref->low_blocks[endblocki]);
   ref_flags_ptr = &(ref->flags_blocks[endblocki]);
-  alt_high_ptr = &(alt->high_blocks[endblocki]);
-  alt_low_ptr = &(alt->low_blocks[endblocki]);
-  alt_flags_ptr = &(alt->flags_blocks[endblocki]);
+  if (alt_space == NULL) {
+    alt_high_ptr = &(alt->high_blocks[endblocki]);
+    alt_low_ptr = &(alt->low_blocks[endblocki]);
+    alt_flags_ptr = &(alt->flags_blocks[endblocki]);
+  } else {
+    Genomebits_alt_blocks(&alt_high_ptr,&alt_low_ptr,&alt_flags_ptr,alt_space,alt,startblocki,endblocki);
+    alt_high_ptr += endblocki - startblocki;
+    alt_low_ptr += endblocki - startblocki;
+    alt_flags_ptr += endblocki - startblocki;
+  }
 
   startdiscard = (left+pos5) % 32U;
   enddiscard = (left+pos3) % 32U;
@@ -919,6 +936,7 @@ Genomebits_mismatches_fromright (int *mismatch_positions, int max_mismatches, T
 				 Compress_T query_compress,
 				 Univcoord_T univdiagonal, int querylength,
 				 int pos5, int pos3, bool plusp, int genestrand) {
+  Genomecomp_T alt_stack[GENOMEBITS_ALT_STACK_NWORDS], *alt_space;
   int nmismatches;
 #ifdef DEBUG0
   int i;
@@ -931,9 +949,11 @@ Genomebits_mismatches_fromright (int *mismatch_positions, int max_mismatches, T
 				       univdiagonal,querylength,pos5,pos3,plusp,genestrand,
 				       query_unk_mismatch_p,genome_unk_mismatch_p);
   } else {
-    nmismatches = mismatches_fromright_alt(&(*mismatch_positions),max_mismatches,ref,alt,query_compress,
+    alt_space = Genomebits_alt_space(alt_stack,alt,querylength);
+    nmismatches = mismatches_fromright_alt(&(*mismatch_positions),max_mismatches,ref,alt,alt_space,query_compress,
 					   univdiagonal,querylength,pos5,pos3,plusp,genestrand,
 					   query_unk_mismatch_p,genome_unk_mismatch_p);
+    Genomebits_alt_space_free(&alt_space,alt_stack);
   }
   mismatch_positions[nmismatches] = pos5 - 1;
   debug0(printf("Genomebits_mismatches_fromleft with left %u, pos5 %d, pos3 %d\n",left,pos5,pos3));
@@ -957,6 +977,7 @@ Genomebits_mismatches_fromright_for_trim (int *mismatch_positions, int max_misma
 					  Compress_T query_compress,
 					  Univcoord_T univdiagonal, int querylength,
 					  int pos5, int pos3, bool plusp, int genestrand) {
+  Genomecomp_T alt_stack[GENOMEBITS_ALT_STACK_NWORDS], *alt_space;
   int nmismatches;
 #ifdef DEBUG
   int i;
@@ -970,10 +991,12 @@ Genomebits_mismatches_fromright_for_trim (int *mismatch_positions, int max_misma
 				       plusp,genestrand,/*query_unk_mismatch_p*/false,
 				       /*genome_unk_mismatch_p*/true);
   } else {
-    nmismatches = mismatches_fromright_alt(&(*mismatch_positions),max_mismatches,ref,alt,query_compress,
+    alt_space = Genomebits_alt_space(alt_stack,alt,querylength);
+    nmismatches = mismatches_fromright_alt(&(*mismatch_positions),max_mismatches,ref,alt,alt_space,query_compress,
 					   univdiagonal,querylength,pos5,pos3,
 					   plusp,genestrand,/*query_unk_mismatch_p*/false,
 					   /*genome_unk_mismatch_p*/true);
+    Genomebits_alt_space_free(&alt_space,alt_stack);
   }
   mismatch_positions[nmismatches] = pos5 - 1;
   debug(
@@ -0,0 +1,149 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+/* Lists, verifies, and removes the index snapshots made by gmap and
+   gsnap with --snapshot-dir.  See snapshot.h. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bool.h"
+#include "mem.h"
+#include "snapshot.h"
+#include "getopt.h"
+
+
+/* Program Options */
+static char *snapshot_dir = SNAPSHOT_DEFAULT_DIR;
+static bool stalep = false;
+static bool forcep = false;
+
+
+static struct option long_options[] = {
+  {"snapshot-dir", required_argument, 0, 'D'}, /* snapshot_dir */
+  {"stale", no_argument, 0, 0}, /* stalep */
+  {"force", no_argument, 0, 0}, /* forcep */
+
+  /* Help options */
+  {"version", no_argument, 0, '^'}, /* print_program_version */
+  {"help", no_argument, 0, '?'}, /* print_program_usage */
+  {0, 0, 0, 0}
+};
+
+
+static void
+print_program_version () {
+  fprintf(stdout,"\n");
+  fprintf(stdout,"gmap_snapshot: manages index snapshots from gmap and gsnap --snapshot-dir\n");
+  fprintf(stdout,"Part of GMAP package, version %s\n",PACKAGE_VERSION);
+  fprintf(stdout,"Thomas D. Wu, Genentech, Inc.\n");
+  fprintf(stdout,"Contact: twu@gene.com\n");
+  fprintf(stdout,"\n");
+  return;
+}
+
+static void
+print_program_usage () {
+  fprintf(stdout,"\
+Usage: gmap_snapshot [OPTIONS...] list\n\
+       gmap_snapshot [OPTIONS...] verify [snapshot...]\n\
+       gmap_snapshot [OPTIONS...] evict [snapshot...]\n\
+\n\
+list shows each snapshot with its state, size, number of processes\n\
+using it, creation time, and source file.  A snapshot is stale if its\n\
+source file has changed since, and orphaned if the source file no\n\
+longer exists.\n\
+\n\
+verify recomputes the checksum of the given snapshots, or of all\n\
+snapshots.\n\
+\n\
+evict removes the given snapshots, or all snapshots.  Snapshots in\n\
+use are kept, unless --force is given.\n\
+\n\
+Options\n\
+  -D, --snapshot-dir=STRING      Directory of snapshots (default %s)\n\
+  --stale                        With evict, remove only stale, orphaned, or invalid snapshots\n\
+  --force                        With evict, remove snapshots even if they are in use.\n\
+                                   Processes using them keep their copies until they exit\n\
+\n\
+  --version                      Show version\n\
+  --help                         Show this help message\n\
+",SNAPSHOT_DEFAULT_DIR);
+  return;
+}
+
+
+int
+main (int argc, char *argv[]) {
+  char *command;
+  int nfailures, nevicted;
+
+  int opt;
+  extern int optind;
+  extern char *optarg;
+  int long_option_index = 0;
+  const char *long_name;
+
+  while ((opt = getopt_long(argc,argv,"D:^?",
+			    long_options,&long_option_index)) != -1) {
+    switch (opt) {
+    case 0:
+      long_name = long_options[long_option_index].name;
+      if (!strcmp(long_name,"version")) {
+	print_program_version();
+	exit(0);
+      } else if (!strcmp(long_name,"help")) {
+	print_program_usage();
+	exit(0);
+      } else if (!strcmp(long_name,"stale")) {
+	stalep = true;
+      } else if (!strcmp(long_name,"force")) {
+	forcep = true;
+      } else {
+	/* Shouldn't reach here */
+	fprintf(stderr,"Don't recognize option %s.  For usage, run 'gmap_snapshot --help'",long_name);
+	exit(9);
+      }
+      break;
+
+    case 'D': snapshot_dir = optarg; break;
+    case '^': print_program_version(); exit(0);
+    case '?': print_program_usage(); exit(0);
+    default: exit(9);
+    }
+  }
+  argc -= optind;
+  argv += optind;
+
+  if (argc == 0) {
+    fprintf(stderr,"Need to specify list, verify, or evict.  For usage, run 'gmap_snapshot --help'\n");
+    exit(9);
+  } else {
+    command = argv[0];
+    argc--;
+    argv++;
+  }
+
+  if (!strcmp(command,"list")) {
+    Snapshot_list(snapshot_dir);
+
+  } else if (!strcmp(command,"verify")) {
+    if ((nfailures = Snapshot_verify(snapshot_dir,argv,argc)) > 0) {
+      fprintf(stderr,"%d snapshots failed verification\n",nfailures);
+      exit(9);
+    }
+
+  } else if (!strcmp(command,"evict")) {
+    nevicted = Snapshot_evict(snapshot_dir,argv,argc,stalep,forcep);
+    fprintf(stderr,"Removed %d snapshots\n",nevicted);
+
+  } else {
+    fprintf(stderr,"Don't recognize command %s.  For usage, run 'gmap_snapshot --help'\n",command);
+    exit(9);
+  }
+
+  return 0;
+}
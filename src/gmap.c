@@ -62,6 +62,7 @@ static char rcsid[] = "$Id: 50ceb981edd1a50960517cebc97adb53ac1e129d $";
 #include "diagpool.h"
 #include "cellpool.h"
 #include "stopwatch.h"
+#include "latency.h"
 #include "translation.h"	/* For Translation_setup */
 #include "genome.h"
 #include "genome-write.h"
@@ -213,6 +214,7 @@ static Width_T index1part;
 
 static Indexdb_T indexdb_fwd = NULL;
 static Indexdb_T indexdb_rev = NULL;
+static Minindex_T minindex = NULL;
 
 /* static Localdb_T localdb = NULL; */
 
@@ -319,6 +321,8 @@ bool multiple_sequences_p = false;
 static bool sharedp = false;
 static bool preload_shared_memory_p = false;
 static bool unload_shared_memory_p = false;
+static char *snapshot_dir = NULL;
+static int load_nthreads = ACCESS_DEFAULT_NREADERS;
 static bool expand_offsets_p = false;
 
 #ifdef HAVE_MMAP
@@ -342,6 +346,10 @@ static int max_deletionlength = 30;
 static int maxtotallen_bound = 2400000;
 
 static bool split_large_introns_p = false;
+static bool sparse_chaining_p = false;
+static bool minimizers_p = false;
+static int minimizer_window = 0; /* 0 means any window in the index */
+static int xdrop = 0;
 
 /* Need to set higher than 200,000 for many human genes, such as ALK */
 static int maxintronlen = 500000; /* Was used previously in stage 1.  Now used only in stage 2 and Stage3_mergeable. */
@@ -399,6 +407,14 @@ static bool diag_debug = false;
 static Stage3debug_T stage3debug = NO_STAGE3DEBUG;
 static bool timingp = false;
 static bool checkp = false;
+
+/* Per-query latencies.  Each worker thread records into its own
+   element of latencies, and these are merged at the end */
+static bool latency_report_p = false;
+static char *slow_reads_file = NULL;
+static double slow_read_threshold = 1.0; /* seconds */
+static Latency_T *latencies = NULL;
+
 static int maxpaths_report = 5;	/* 0 means 1 if nonchimeric, 2 if chimeric */
 static bool quiet_if_excessive_p = false;
 static double suboptimal_score_float = 0.50;
@@ -499,6 +515,7 @@ static Triecontent_T *triecontents_max = NULL;
 static char *split_output_root = NULL;
 static char *failedinput_root = NULL;
 static bool appendp = false;
+static Outwriter_method_T async_output = OUTWRITER_NONE;
 static Inbuffer_T inbuffer = NULL;
 static Outbuffer_T outbuffer = NULL;
 static unsigned int input_buffer_size = 1000; /* previously inbuffer_nspaces */
@@ -533,6 +550,8 @@ static struct option long_options[] = {
   {"use-shared-memory", required_argument, 0, 0}, /* sharedp */
   {"preload-shared-memory", no_argument, 0, 0},	  /* preload_shared_memory_p */
   {"unload-shared-memory", no_argument, 0, 0},	  /* unload_shared_memory_p */
+  {"snapshot-dir", required_argument, 0, 0},	  /* snapshot_dir, sharedp */
+  {"load-threads", required_argument, 0, 0},	  /* load_nthreads */
 #ifdef HAVE_MMAP
   {"batch", required_argument, 0, 'B'}, /* offsetsstrm_access, positions_access, genome_access */
 #endif
@@ -544,6 +563,9 @@ static struct option long_options[] = {
   {"max-intronlength-middle", required_argument, 0, 0}, /* maxintronlen */
   {"max-intronlength-ends", required_argument, 0, 0}, /* maxintronlen_ends */
   {"split-large-introns", no_argument, 0, 0},	      /* split_large_introns_p */
+  {"sparse-chaining", no_argument, 0, 0},	      /* sparse_chaining_p */
+  {"minimizers", optional_argument, 0, 0},	      /* minimizers_p, minimizer_window */
+  {"xdrop", required_argument, 0, 0},		      /* xdrop */
 
   {"end-trimming-score", required_argument, 0, 0},      /* end_trimming_score */
   {"trim-end-exons", required_argument, 0, 0}, /* minendexon */
@@ -600,6 +622,7 @@ static struct option long_options[] = {
   {"split-output", required_argument, 0, 0}, /* split_output_root */
   {"failed-input", required_argument, 0, 0}, /* failedinput_root */
   {"append-output", no_argument, 0, 0},	     /* appendp */
+  {"async-output", required_argument, 0, 0}, /* async_output */
   {"suboptimal-score", required_argument, 0, 0}, /* suboptimal_score_float */
   {"require-splicedir", no_argument, 0, 0}, /* require_splicedir_p */
 
@@ -665,6 +688,9 @@ static struct option long_options[] = {
 
   /* Diagnostic options */
   {"time", no_argument, 0, 0},	/* timingp */
+  {"latency-report", no_argument, 0, 0}, /* latency_report_p */
+  {"slow-reads", required_argument, 0, 0}, /* slow_reads_file */
+  {"slow-read-threshold", required_argument, 0, 0}, /* slow_read_threshold */
 
   /* Help options */
   {"check", no_argument, 0, 0}, /* check_compiler_assumptions */
@@ -4483,7 +4509,8 @@ stage3_with_stage1 (bool *mergedp, Chimera_T *chimera, List_T gregions, Sequence
 
 
 static Filestring_T
-process_request (Filestring_T *fp_failedinput, double *worker_runtime, Request_T request,
+process_request (Filestring_T *fp_failedinput, double *worker_runtime, double *stage1_runtime,
+		 Request_T request,
 		 Matchpool_T matchpool, Genome_T genome, Genome_T genomealt,
 		 Pairpool_T pairpool, Diagpool_T diagpool, Cellpool_T cellpool,
 		 Stage2_alloc_T stage2_alloc, Oligoindex_array_T oligoindices_major, Oligoindex_array_T oligoindices_minor,
@@ -4513,6 +4540,7 @@ process_request (Filestring_T *fp_failedinput, double *worker_runtime, Request_T
   Cellpool_reset(cellpool);
 
 
+  *stage1_runtime = 0.0;
   if (worker_stopwatch != NULL) {
     Stopwatch_start(worker_stopwatch);
   }
@@ -4588,11 +4616,19 @@ process_request (Filestring_T *fp_failedinput, double *worker_runtime, Request_T
 					      chromosome_iit,chrsubset_start,chrsubset_end,matchpool,
 					      stutterhits,diagnostic,worker_stopwatch,/*nbest*/10);
 
+#ifndef PMAP
+      } else if (minindex != NULL) {
+	gregions = Stage1_compute_minimizers(&lowidentityp,queryuc,minindex,
+					     chromosome_iit,chrsubset_start,chrsubset_end,
+					     diagnostic,worker_stopwatch,/*nbest*/10);
+#endif
+
       } else {
 	gregions = Stage1_compute(&lowidentityp,queryuc,indexdb_fwd,indexdb_rev,/*genestrand*/0,
 				  chromosome_iit,chrsubset_start,chrsubset_end,matchpool,
 				  stutterhits,diagnostic,worker_stopwatch,/*nbest*/10);
       }
+      *stage1_runtime = diagnostic->stage1_runtime;
       debug(printf("Got %d gregions\n",List_length(gregions)));
 
       if (stage1debug == true) {
@@ -4632,6 +4668,8 @@ process_request (Filestring_T *fp_failedinput, double *worker_runtime, Request_T
 
       Oligoindex_clear_inquery(Oligoindex_array_elt(oligoindices_major,0),/*queryuc_ptr*/Sequence_fullpointer(queryuc),
 			       /*querystart*/0,/*queryend*/Sequence_fulllength(queryuc));
+      Oligoindex_array_clear_tallies(oligoindices_major);
+      Oligoindex_array_clear_tallies(oligoindices_minor);
 
     } /* Matches not user segment and not maponly */
 
@@ -4722,13 +4760,14 @@ single_thread () {
   Pairpool_T pairpool;
   Diagpool_T diagpool;
   Cellpool_T cellpool;
-  Stopwatch_T worker_stopwatch;
+  Stopwatch_T worker_stopwatch, query_stopwatch;
+  Latency_T latency_thread = NULL;
   Request_T request;
   Genome_T genome, genomealt;
   Filestring_T fp, fp_failedinput;
   Sequence_T queryseq;
   int jobid = 0;
-  double worker_runtime;
+  double worker_runtime, stage1_runtime, query_runtime;
 
 #ifdef MEMUSAGE
   long int memusage, memusage_constant = 0;
@@ -4748,7 +4787,20 @@ single_thread () {
   pairpool = Pairpool_new();
   diagpool = Diagpool_new();
   cellpool = Cellpool_new();
-  worker_stopwatch = (timingp == true) ? Stopwatch_new() : (Stopwatch_T) NULL;
+  if (timingp == true || latency_report_p == true || slow_reads_file != NULL) {
+    worker_stopwatch = Stopwatch_new();
+  } else {
+    worker_stopwatch = (Stopwatch_T) NULL;
+  }
+  if (latency_report_p == true || slow_reads_file != NULL) {
+    /* worker_stopwatch is restarted within stages 1 and 2 */
+    query_stopwatch = Stopwatch_new();
+  } else {
+    query_stopwatch = (Stopwatch_T) NULL;
+  }
+  if (latencies != NULL) {
+    latencies[0] = latency_thread = Latency_new();
+  }
 
   /* Except_stack_create(); -- requires pthreads */
 
@@ -4770,14 +4822,22 @@ single_thread () {
 #endif
 
     TRY
-      fp = process_request(&fp_failedinput,&worker_runtime,request,
+      Stopwatch_start(query_stopwatch);
+      fp = process_request(&fp_failedinput,&worker_runtime,&stage1_runtime,request,
 			   matchpool,genome,genomealt,pairpool,diagpool,cellpool,
 			   stage2_alloc,oligoindices_major,oligoindices_minor,
 			   dynprogL,dynprogM,dynprogR,worker_stopwatch);
+      query_runtime = Stopwatch_stop(query_stopwatch);
       if (timingp == true) {
         queryseq = Request_queryseq(request);
         fprintf(stderr,"%s\t%.6f\n",Sequence_accession(queryseq),worker_runtime);
       }
+      if (latency_thread != NULL) {
+	Latency_record(latency_thread,query_runtime,stage1_runtime);
+      }
+      if (slow_reads_file != NULL) {
+	Latency_trap(Request_queryseq(request),query_runtime,stage1_runtime);
+      }
 
     ELSE
       queryseq = Request_queryseq(request);
@@ -4840,6 +4900,9 @@ single_thread () {
 
   /* Except_stack_destroy(); -- requires pthreads */
 
+  if (query_stopwatch != NULL) {
+    Stopwatch_free(&query_stopwatch);
+  }
   if (worker_stopwatch != NULL) {
     Stopwatch_free(&worker_stopwatch);
   }
@@ -4872,16 +4935,15 @@ worker_thread (void *data) {
   Pairpool_T pairpool;
   Diagpool_T diagpool;
   Cellpool_T cellpool;
-  Stopwatch_T worker_stopwatch;
+  Stopwatch_T worker_stopwatch, query_stopwatch;
+  Latency_T latency_thread = NULL;
   Request_T request;
   Genome_T genome, genomealt;
   Filestring_T fp, fp_failedinput;
   Sequence_T queryseq;
   int worker_jobid = 0;
-  double worker_runtime;
-#if defined(DEBUG) || defined(MEMUSAGE)
+  double worker_runtime, stage1_runtime, query_runtime;
   long int worker_id = (long int) data;
-#endif
 
 #ifdef MEMUSAGE
   long int memusage_constant = 0, memusage, max_memusage;
@@ -4905,7 +4967,20 @@ worker_thread (void *data) {
   pairpool = Pairpool_new();
   diagpool = Diagpool_new();
   cellpool = Cellpool_new();
-  worker_stopwatch = (timingp == true) ? Stopwatch_new() : (Stopwatch_T) NULL;
+  if (timingp == true || latency_report_p == true || slow_reads_file != NULL) {
+    worker_stopwatch = Stopwatch_new();
+  } else {
+    worker_stopwatch = (Stopwatch_T) NULL;
+  }
+  if (latency_report_p == true || slow_reads_file != NULL) {
+    /* worker_stopwatch is restarted within stages 1 and 2 */
+    query_stopwatch = Stopwatch_new();
+  } else {
+    query_stopwatch = (Stopwatch_T) NULL;
+  }
+  if (latencies != NULL) {
+    latencies[worker_id] = latency_thread = Latency_new();
+  }
 
   Except_stack_create();
 
@@ -4930,14 +5005,22 @@ worker_thread (void *data) {
 #endif
 
     TRY
-      fp = process_request(&fp_failedinput,&worker_runtime,request,
+      Stopwatch_start(query_stopwatch);
+      fp = process_request(&fp_failedinput,&worker_runtime,&stage1_runtime,request,
 			   matchpool,genome,genomealt,pairpool,diagpool,cellpool,
 			   stage2_alloc,oligoindices_major,oligoindices_minor,
 			   dynprogL,dynprogM,dynprogR,worker_stopwatch);
+      query_runtime = Stopwatch_stop(query_stopwatch);
       if (timingp == true) {
         queryseq = Request_queryseq(request);
         fprintf(stderr,"%s\t%.6f\n",Sequence_accession(queryseq),worker_runtime);
       }
+      if (latency_thread != NULL) {
+	Latency_record(latency_thread,query_runtime,stage1_runtime);
+      }
+      if (slow_reads_file != NULL) {
+	Latency_trap(Request_queryseq(request),query_runtime,stage1_runtime);
+      }
 
     ELSE
       queryseq = Request_queryseq(request);
@@ -5006,6 +5089,9 @@ worker_thread (void *data) {
 
   Except_stack_destroy();
 
+  if (query_stopwatch != NULL) {
+    Stopwatch_free(&query_stopwatch);
+  }
   if (worker_stopwatch != NULL) {
     Stopwatch_free(&worker_stopwatch);
   }
@@ -5304,6 +5390,15 @@ parse_command_line (int argc, char *argv[], int optind) {
       } else if (!strcmp(long_name,"time")) {
 	timingp = true;
 
+      } else if (!strcmp(long_name,"latency-report")) {
+	latency_report_p = true;
+
+      } else if (!strcmp(long_name,"slow-reads")) {
+	slow_reads_file = optarg;
+
+      } else if (!strcmp(long_name,"slow-read-threshold")) {
+	slow_read_threshold = atof(check_valid_float_or_int(optarg));
+
       } else if (!strcmp(long_name,"use-shared-memory")) {
 	if (!strcmp(optarg,"1")) {
 	  sharedp = true;
@@ -5320,6 +5415,13 @@ parse_command_line (int argc, char *argv[], int optind) {
       } else if (!strcmp(long_name,"unload-shared-memory")) {
 	unload_shared_memory_p = true;
 
+      } else if (!strcmp(long_name,"snapshot-dir")) {
+	snapshot_dir = optarg;
+	sharedp = true;
+
+      } else if (!strcmp(long_name,"load-threads")) {
+	load_nthreads = atoi(check_valid_int(optarg));
+
       } else if (!strcmp(long_name,"expand-offsets")) {
 	fprintf(stderr,"Note: --expand-offsets flag is no longer supported.  With the latest algorithms, it doesn't improve speed much.  Ignoring this flag");
 
@@ -5370,6 +5472,27 @@ parse_command_line (int argc, char *argv[], int optind) {
       } else if (!strcmp(long_name,"split-large-introns")) {
 	split_large_introns_p = true;
 
+      } else if (!strcmp(long_name,"sparse-chaining")) {
+	sparse_chaining_p = true;
+
+      } else if (!strcmp(long_name,"minimizers")) {
+	minimizers_p = true;
+	if (optarg != NULL) {
+	  minimizer_window = atoi(check_valid_int(optarg));
+	}
+
+      } else if (!strcmp(long_name,"xdrop")) {
+#ifdef PMAP
+	fprintf(stderr,"--xdrop is not supported by PMAP\n");
+	return 9;
+#else
+	xdrop = atoi(check_valid_int(optarg));
+	if (xdrop < 0) {
+	  fprintf(stderr,"xdrop should be 0 or positive\n");
+	  return 9;
+	}
+#endif
+
       } else if (!strcmp(long_name,"end-trimming-score")) {
 	end_trimming_score = atoi(check_valid_int(optarg));
 	if (end_trimming_score > 0) {
@@ -5535,6 +5658,16 @@ parse_command_line (int argc, char *argv[], int optind) {
       } else if (!strcmp(long_name,"append-output")) {
 	appendp = true;
 
+      } else if (!strcmp(long_name,"async-output")) {
+	if (!strcmp(optarg,"uring")) {
+	  async_output = OUTWRITER_URING;
+	} else if (!strcmp(optarg,"threads")) {
+	  async_output = OUTWRITER_THREADS;
+	} else {
+	  fprintf(stderr,"--async-output values allowed: uring, threads\n");
+	  return 9;
+	}
+
       } else if (!strcmp(long_name,"gff3-add-separators")) {
 	if (!strcmp(optarg,"1")) {
 	  gff3_separators_p = true;
@@ -6154,6 +6287,8 @@ main (int argc, char *argv[]) {
   }
 
   check_compiler_assumptions();
+  Access_set_nreaders(load_nthreads);
+  Access_set_snapshot_dir(snapshot_dir);
 
   if (exception_raise_p == false) {
     fprintf(stderr,"Allowing signals and exceptions to pass through.  If using shared memory, need to remove segments manually.\n");
@@ -6438,6 +6573,18 @@ main (int argc, char *argv[]) {
     }
 
 
+#ifndef PMAP
+    if (minimizers_p == true) {
+      if (mode != STANDARD) {
+	fprintf(stderr,"The --minimizers flag works only in standard mode\n");
+	exit(9);
+      } else if ((minindex = Minindex_new(genomesubdir,fileroot,required_index1part,minimizer_window)) == NULL) {
+	fprintf(stderr,"Cannot find minimizer index file with the requested k and w.  Need to run gmap_build with --minimizers\n");
+	exit(9);
+      }
+    }
+#endif
+
     if (user_chrsubsetname != NULL) {
       if ((divno = Univ_IIT_find_one(chromosome_iit,user_chrsubsetname)) < 0) {
 	fprintf(stderr,"Cannot find chrsubset %s in chromosome IIT file.  Ignoring.\n",user_chrsubsetname);
@@ -6543,14 +6690,14 @@ main (int argc, char *argv[]) {
 
   Stage2_setup(/*splicingp*/novelsplicingp == true || knownsplicingp == true,cross_species_p,
 	       suboptimal_score_start,suboptimal_score_end,sufflookback,nsufflookback,maxintronlen,mode,
-	       /*snps_p*/global_genomealt == global_genome ? false : true);
+	       /*snps_p*/global_genomealt == global_genome ? false : true,sparse_chaining_p);
   Dynprog_single_setup(user_open,user_extend,user_dynprog_p,homopolymerp);
   Dynprog_genome_setup(novelsplicingp,splicing_iit,splicing_divint_crosstable,
 		       donor_typeint,acceptor_typeint,
 		       user_open,user_extend,user_dynprog_p);
   Dynprog_end_setup(splicesites,splicetypes,splicedists,nsplicesites,
 		    trieoffsets_obs,triecontents_obs,trieoffsets_max,triecontents_max,
-		    user_open,user_extend,user_dynprog_p);
+		    user_open,user_extend,user_dynprog_p,xdrop);
   Pair_setup(novelsplicingp,splicing_iit,trim_indel_score,print_margin_p,
 	     gff3_separators_p,sam_insert_0M_p,force_xs_direction_p,
 	     md_lowercase_variant_p,/*snps_p*/global_genomealt == global_genome ? false : true,
@@ -6587,10 +6734,15 @@ main (int argc, char *argv[]) {
 		   sam_read_group_library,sam_read_group_platform);
   Outbuffer_setup(any_circular_p,quiet_if_excessive_p,
 		  /*paired_end_p*/false,appendp,/*output_file*/NULL,
-		  /*split_simple_p*/false,split_output_root,failedinput_root);
+		  /*split_simple_p*/false,split_output_root,failedinput_root,async_output);
   outbuffer = Outbuffer_new(output_buffer_size,nread);
   Inbuffer_set_outbuffer(inbuffer,outbuffer);
 
+  if (latency_report_p == true) {
+    latencies = (Latency_T *) CALLOC(nworkers > 0 ? nworkers : 1,sizeof(Latency_T));
+  }
+  Latency_setup(slow_reads_file,slow_read_threshold);
+
   fprintf(stderr,"Starting alignment\n");
   stopwatch = Stopwatch_new();
   Stopwatch_start(stopwatch);
@@ -6636,10 +6788,10 @@ main (int argc, char *argv[]) {
 
     for (i = 0; i < nworkers; i++) {
 #ifdef WORKER_DETACH
-      pthread_create(&(worker_thread_ids[i]),&thread_attr_detach,worker_thread,(void *) NULL);
+      pthread_create(&(worker_thread_ids[i]),&thread_attr_detach,worker_thread,(void *) (long int) i);
 #else
       /* Need to have worker threads finish before we call Inbuffer_free() */
-      pthread_create(&(worker_thread_ids[i]),&thread_attr_join,worker_thread,(void *) NULL);
+      pthread_create(&(worker_thread_ids[i]),&thread_attr_join,worker_thread,(void *) (long int) i);
 #endif
     }
     
@@ -6667,6 +6819,22 @@ main (int argc, char *argv[]) {
   fprintf(stderr,"Processed %u queries in %.2f seconds (%.2f queries/sec)\n",
 	  nread,runtime,(double) nread/runtime);
 
+  if (latencies != NULL) {
+#ifdef HAVE_PTHREAD
+    /* Only latencies[0] is used if the program ran in a single thread */
+    for (i = 1; i < nworkers; i++) {
+      if (latencies[i] != NULL) {
+	Latency_merge(latencies[0],latencies[i]);
+	Latency_free(&(latencies[i]));
+      }
+    }
+#endif
+    Latency_print(stderr,latencies[0]);
+    Latency_free(&(latencies[0]));
+    FREE(latencies);
+  }
+  Latency_cleanup();
+
   Outbuffer_free(&outbuffer);
   Inbuffer_free(&inbuffer);	/* Also closes inputs */
 
@@ -6717,6 +6885,9 @@ main (int argc, char *argv[]) {
     Indexdb_free(&indexdb_fwd);
   }
 #else
+  if (minindex != NULL) {
+    Minindex_free(&minindex);
+  }
   if (indexdb_rev != indexdb_fwd) {
     Indexdb_free(&indexdb_rev);
   }
@@ -6868,7 +7039,12 @@ Usage: gmap [OPTIONS...] <FASTA files...>, or\n\
   fprintf(stdout,"\
   --use-shared-memory=INT        If 1, then allocated memory is shared among all processes on this node\n\
                                    If 0 (default), then each process has private allocated memory\n\
-");
+  --snapshot-dir=STRING          Share allocated memory through snapshots in this directory, such as\n\
+                                   /dev/shm, instead of SysV shared memory.  The first process copies\n\
+                                   each file into a snapshot, and later ones map it.  Snapshots persist\n\
+                                   until removed by gmap_snapshot evict.  Implies --use-shared-memory=1\n\
+  --load-threads=INT             Number of threads reading each allocated index file (default %d)\n\
+",ACCESS_DEFAULT_NREADERS);
 
     fprintf(stdout,"\
   --nosplicing                   Turns off splicing (useful for aligning genomic sequences\n\
@@ -6903,6 +7079,17 @@ Usage: gmap [OPTIONS...] <FASTA files...>, or\n\
   --split-large-introns          Sometimes GMAP will exceed the value for --max-intronlength-middle,\n\
                                    if it finds a good single alignment.  However, you can force GMAP\n\
                                    to split such alignments by using this flag\n\
+  --sparse-chaining              In stage 2, find the best previous hit for each hit with range-maximum\n\
+                                   queries instead of scanning, when there are many hits.  Gives the same\n\
+                                   alignments, but is faster for long or repetitive queries\n\
+  --minimizers[=INT]             In stage 1, seed with the (w,k)-minimizer index built by gmap_build\n\
+                                   --minimizers and chain the anchors, instead of sampling fixed-interval\n\
+                                   k-mers.  Intended for long, noisy reads such as nanopore cDNA.  If\n\
+                                   several indexes were built, choose one by its window INT and by -k\n\
+  --xdrop=INT                    In stage 3, align 5' and 3' ends with a band that follows the best\n\
+                                   cell of each anti-diagonal, stopping once the score drops INT below\n\
+                                   the best so far, instead of a fixed band over a chopped end.  Suited\n\
+                                   to long, noisy reads; try 100 (default 0, meaning off)\n\
 ");
     fprintf(stdout,"\
   --end-trimming-score=INT       Trim ends if the alignment score is below this value\n\
@@ -7106,6 +7293,13 @@ Output options\n\
                                    is generated in addition to the output in the .nomapping file.\n\
   --append-output                When --split-output or --failedinput is given, this flag will append output\n\
                                    to the existing files.  Otherwise, the default is to create new files.\n\
+  --async-output=STRING          Write output files in the background, in 1 MB blocks, using uring (io_uring,\n\
+                                   or threads if not available) or threads.  Does not apply to stdout\n\
+  --latency-report               At the end, print percentiles of the time per query, overall, for stage 1\n\
+                                   and for stages 2 and 3 separately\n\
+  --slow-reads=STRING            Print queries that take longer than --slow-read-threshold to the given\n\
+                                   file, in FASTA format, with their times in the header\n\
+  --slow-read-threshold=FLOAT    Time in seconds for --slow-reads (default 1.0)\n\
 ");
   fprintf(stdout,"\
   --output-buffer-size=INT       Buffer size, in queries, for output thread (default %d).  When the number\n\
@@ -43,6 +43,7 @@ typedef Tableuint_T Table_chrpos_T;
 #include "genome-write.h"
 #include "indexdb-write.h"
 #include "localdb-write.h"
+#include "minindex.h"
 #include "compress-write.h"
 #include "intlist.h"
 #include "indexdb.h"		/* For Indexdb_filenames_T */
@@ -98,7 +99,7 @@ typedef Tableuint_T Table_chrpos_T;
 
 /* Program variables */
 typedef enum {NONE, AUXFILES, GENOME, COMPRESS_GENOMES, CONCATENATE_GENOMES, UNSHUFFLE, COUNT,
-	      OFFSETS, POSITIONS, LOCALDB,
+	      OFFSETS, POSITIONS, BITPACK_POSITIONS, LOCALDB, MINIMIZERS,
 #if 0
 	      REGIONDB_HASH, CONCATENATE_REGIONDBS,
 #endif
@@ -112,6 +113,7 @@ static int compression_type;
 
 static int index1part = 15;
 static int index1interval = 3;	/* Interval for storing 15-mers */
+static int minimizer_window = 10; /* Window for the minimizer index, using index1part as k */
 /* static int region1part = 6; */
 /* static int region1interval = 1; */
 /* static int required_region1part = 0; */
@@ -1395,7 +1397,7 @@ main (int argc, char *argv[]) {
   extern char *optarg;
   char *string;
 
-  while ((c = getopt(argc,argv,"D:d:x:z:k:q:A0rlGZCUNHOPQRSLWw:e:Ss:n:m9")) != -1) {
+  while ((c = getopt(argc,argv,"D:d:x:z:k:q:A0rlGZCUNHOPcQMy:RSLWw:e:Ss:n:m9")) != -1) {
     switch (c) {
     case 'D': destdir = optarg; break;
     case 'd': fileroot = optarg; break;
@@ -1440,8 +1442,11 @@ main (int argc, char *argv[]) {
 
     case 'O': action = OFFSETS; break;
     case 'P': action = POSITIONS; break;
+    case 'c': action = BITPACK_POSITIONS; break;
 
     case 'Q': action = LOCALDB; break;
+    case 'M': action = MINIMIZERS; break;
+    case 'y': minimizer_window = atoi(optarg); break;
 #if 0
     case 'R': action = CONCATENATE_REGIONDBS; break;
 #endif
@@ -1987,6 +1992,44 @@ main (int argc, char *argv[]) {
     FREE(positionsfile_low);
     Univ_IIT_free(&chromosome_iit);
 
+  } else if (action == BITPACK_POSITIONS) {
+    /* Usage: gmapindex [-D <destdir>] -d <dbname> -k <kmer> -q <interval> -c
+       Requires <destdir>/<dbname>.ref153offsets64meta, .ref153offsets64strm, and .ref153positions
+       Creates <destdir>/<dbname>.ref153positions64meta and .ref153positions64strm */
+
+    chromosomefile = (char *) CALLOC(strlen(destdir)+strlen("/")+
+				     strlen(fileroot)+strlen(".chromosome.iit")+1,sizeof(char));
+    sprintf(chromosomefile,"%s/%s.chromosome.iit",destdir,fileroot);
+    if ((chromosome_iit = Univ_IIT_read(chromosomefile,/*readonlyp*/true,/*add_iit_p*/false)) == NULL) {
+      fprintf(stderr,"IIT file %s is not valid\n",chromosomefile);
+      exit(9);
+    }
+    FREE(chromosomefile);
+
+    if (Univ_IIT_coord_values_8p(chromosome_iit) == true || huge_offsets_p == true) {
+      fprintf(stderr,"Bitpacked positions are available only for genomes with 4-byte positions\n");
+      exit(9);
+    }
+
+    ifilenames = Indexdb_get_filenames(&compression_type,&index1part,&index1interval,
+				       destdir,fileroot,IDX_FILESUFFIX,/*snps_root*/NULL,
+				       /*required_index1part*/index1part,
+				       /*required_interval*/index1interval,/*offsets_only_p*/true);
+
+    positionsfile_low = (char *) CALLOC(strlen(destdir)+strlen("/")+strlen(fileroot)+
+					strlen(".")+strlen(IDX_FILESUFFIX)+
+					/*for kmer*/2+/*for interval char*/1+
+					strlen(POSITIONS_FILESUFFIX)+1,sizeof(char));
+    sprintf(positionsfile_low,"%s/%s.%s%02d%c%s",
+	    destdir,fileroot,IDX_FILESUFFIX,index1part,interval_char,POSITIONS_FILESUFFIX);
+
+    Indexdb_write_positions_bitpack(positionsfile_low,ifilenames->pointers_filename,
+				    ifilenames->offsets_filename,index1part);
+
+    Indexdb_filenames_free(&ifilenames);
+    FREE(positionsfile_low);
+    Univ_IIT_free(&chromosome_iit);
+
   } else if (action == LOCALDB) {
     /* Usage: gmapindex [-D <destdir>] -d <dbname> -Q <genomefile>
        Creates <destdir>/<dbname>.sarray16 and .sarray8 */
@@ -2026,6 +2069,28 @@ main (int argc, char *argv[]) {
     FREE(sarray16file);
     FREE(saindex16file);
 
+  } else if (action == MINIMIZERS) {
+    /* Usage: gmapindex [-D <destdir>] -d <dbname> [-k <kmer>] [-y <window>] -M
+       Creates <destdir>/<dbname>.min<kmer>w<window>keys, offsets, and positions */
+
+    chromosomefile = (char *) CALLOC(strlen(destdir)+strlen("/")+
+				     strlen(fileroot)+strlen(".chromosome.iit")+1,sizeof(char));
+    sprintf(chromosomefile,"%s/%s.chromosome.iit",destdir,fileroot);
+    if ((chromosome_iit = Univ_IIT_read(chromosomefile,/*readonlyp*/true,/*add_iit_p*/false)) == NULL) {
+      fprintf(stderr,"IIT file %s is not valid\n",chromosomefile);
+      exit(9);
+    }
+    FREE(chromosomefile);
+
+    genomecomp = Genome_new(destdir,fileroot,/*alt_root*/NULL,
+			    chromosome_iit,/*access*/USE_MMAP_ONLY,/*sharedp*/false,/*revcompp*/false);
+
+    fprintf(stderr,"Writing minimizer index\n");
+    Minindex_write(destdir,fileroot,genomecomp,chromosome_iit,/*k*/index1part,/*w*/minimizer_window);
+
+    Genome_free(&genomecomp);
+    Univ_IIT_free(&chromosome_iit);
+
 #if 0
   } else if (action == REGIONDB_HASH) {
     /* Usage: gmapindex [-D <destdir>] -d <dbname> -Q <genomefile>
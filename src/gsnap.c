@@ -148,6 +148,9 @@ static char rcsid[] = "$Id: 34f1605e3ec4686f9485cb9805c0b5eb1459ee4a $";
 #include "path-print-m8.h"
 #include "path-print-sam.h"
 #include "path-learn.h"
+#include "pass1info.h"
+#include "livesplicing.h"
+#include "latency.h"
 
 #include "trpath-solve.h"
 #include "trpath-convert.h"
@@ -252,9 +255,13 @@ static Indexdb_T tr_indexdb = NULL;
 
 static bool two_pass_p = false;
 static Pass_T pass = PASS2;	/* Use pass 2, unless user specifies two-pass mode */
-#ifdef HAVE_PTHREAD
-pthread_mutex_t pass1_lock;
-#endif
+static char *pass1_dump_file = NULL;
+static char *pass1_read_files = NULL; /* Comma-separated list */
+static double pass1_sample_fraction = 1.0;
+static unsigned int pass1_max_reads = 0; /* 0 means no limit */
+static double pass1_saturation = 0.0; /* New introns per 1000 reads */
+#define PASS1_SATURATION_WINDOW 5000	/* Reads per thread */
+static unsigned int live_splicing_interval = 0; /* 0 means no --live-splicing */
 
 
 /* default_localdb_p applies if user did not specify whether to use
@@ -301,6 +308,7 @@ static char *genome_dbroot = NULL;
 
 static unsigned int part_modulus = 0;
 static unsigned int part_interval = 1;
+static char *part_index_file = NULL;
 static int barcode_length = 0;
 static int endtrim_length = 0;
 
@@ -347,6 +355,9 @@ static bool multiple_sequences_p;
 static bool sharedp = false;
 static bool preload_shared_memory_p = false;
 static bool unload_shared_memory_p = false;
+static char *snapshot_dir = NULL;
+static int load_nthreads = ACCESS_DEFAULT_NREADERS;
+static bool bitpack_positions_p = false;
 static bool expand_offsets_p = false;
 
 #ifdef HAVE_MMAP
@@ -454,28 +465,20 @@ static char *indels_file = NULL;
 static Knownindels_T knownindels = NULL;
 
 
-/* Need a mutex lock */
-static unsigned long long total_mismatches = 0;
-static unsigned long long total_querylength = 0;
+/* Learned during pass 1.  Each worker thread accumulates into its
+   own element of pass1infos, without locking, and these are merged
+   into pass1info at the end of pass 1 */
+static Pass1info_T *pass1infos = NULL;
+static Pass1info_T pass1info = NULL;
+
+/* For --live-splicing, introns learned during the single pass */
+static Livesplicing_T livesplicing = NULL;
 
 static Univcoordtableuint_T donor_table = NULL;
 static Univcoordtableuint_T acceptor_table = NULL;
 static Univcoordtableuint_T antidonor_table = NULL;
 static Univcoordtableuint_T antiacceptor_table = NULL;
 
-static Univcoordlist_T donor_startpoints = NULL;
-static Univcoordlist_T donor_partners = NULL;
-static Univcoordlist_T acceptor_startpoints = NULL;
-static Univcoordlist_T acceptor_partners = NULL;
-static Univcoordlist_T antidonor_startpoints = NULL;
-static Univcoordlist_T antidonor_partners = NULL;
-static Univcoordlist_T antiacceptor_startpoints = NULL;
-static Univcoordlist_T antiacceptor_partners = NULL;
-
-static Univcoordtable_T indel_table = NULL;
-
-static Uintlist_T insertlengths = NULL;
-
 
 /* Cmet and AtoI */
 static char *user_modedir = NULL;  /* user_cmetdir, user_atoidir */
@@ -489,6 +492,7 @@ static bool maskedp = false;
 /* SNPs IIT */
 static char *user_snpsdir = NULL;
 static char *snps_root = (char *) NULL;
+static bool sparse_snps_p = false;
 static IIT_T snps_iit = NULL;
 static int *snps_divint_crosstable = NULL;
 
@@ -567,12 +571,20 @@ static char *split_output_root = NULL;
 static char *output_file = NULL;
 static char *failedinput_root = NULL;
 static bool appendp = false;
+static Outwriter_method_T async_output = OUTWRITER_NONE;
 static Outbuffer_T outbuffer;
 static Inbuffer_T inbuffer;
 static unsigned int input_buffer_size = 10000; /* previously inbuffer_nspaces */
 static bool timingp = false;
 static bool unloadp = false;
 
+/* Per-read latencies.  Each worker thread records into its own
+   element of latencies, and these are merged at the end */
+static bool latency_report_p = false;
+static char *slow_reads_file = NULL;
+static double slow_read_threshold = 1.0; /* seconds */
+static Latency_T *latencies = NULL;
+
 
 /* getopt used alphabetically: AaBCcDdeGgiJjKklMmNnOoQqstVvwYyZz7 */
 
@@ -584,10 +596,17 @@ static struct option long_options[] = {
   {"dir", required_argument, 0, 'D'},	/* user_genomedir */
   {"db", required_argument, 0, 'd'}, /* genome_dbroot */
   {"two-pass", no_argument, 0, 0},   /* two_pass_p */
+  {"pass1-dump", required_argument, 0, 0}, /* pass1_dump_file, two_pass_p */
+  {"pass1-read", required_argument, 0, 0}, /* pass1_read_files, two_pass_p */
+  {"pass1-sample", required_argument, 0, 0}, /* pass1_sample_fraction, two_pass_p */
+  {"pass1-max-reads", required_argument, 0, 0}, /* pass1_max_reads, two_pass_p */
+  {"pass1-saturation", required_argument, 0, 0}, /* pass1_saturation, two_pass_p */
+  {"live-splicing", required_argument, 0, 0}, /* live_splicing_interval */
   {"use-localdb", required_argument, 0, 0}, /* user_localdb_p, use_localdb_p */
   {"kmer", required_argument, 0, 'k'}, /* required_index1part, index1part */
   {"sampling", required_argument, 0, 0}, /* required_index1interval, index1interval */
   {"part", required_argument, 0, 'q'}, /* part_modulus, part_interval */
+  {"part-index", required_argument, 0, 0}, /* part_index_file */
   {"orientation", required_argument, 0, 0}, /* single_cell_p, invert_first_p, invert_second_p */
   {"input-buffer-size", required_argument, 0, 0}, /* input_buffer_size */
   {"barcode-length", required_argument, 0, 0},	  /* barcode_length */
@@ -615,6 +634,9 @@ static struct option long_options[] = {
   {"use-shared-memory", required_argument, 0, 0}, /* sharedp */
   {"preload-shared-memory", no_argument, 0, 0},	  /* preload_shared_memory_p */
   {"unload-shared-memory", no_argument, 0, 0},	  /* unload_shared_memory_p */
+  {"snapshot-dir", required_argument, 0, 0},	  /* snapshot_dir, sharedp */
+  {"load-threads", required_argument, 0, 0},	  /* load_nthreads */
+  {"bitpack-positions", no_argument, 0, 0},	  /* bitpack_positions_p */
 #ifdef HAVE_MMAP
   {"batch", required_argument, 0, 'B'}, /* offsetsstrm_access, positions_access, genome_access */
 #endif
@@ -667,6 +689,7 @@ static struct option long_options[] = {
   {"use-mask", required_argument, 0, 'e'}, /* masked_suffix */
   {"snpsdir", required_argument, 0, 'V'},   /* user_snpsdir */
   {"use-snps", required_argument, 0, 'v'}, /* snps_root */
+  {"sparse-snps", no_argument, 0, 0},	   /* sparse_snps_p */
 
   {"tallydir", required_argument, 0, 0},   /* user_tallydir */
   {"use-tally", required_argument, 0, 0}, /* tally_root */
@@ -724,6 +747,7 @@ static struct option long_options[] = {
 
   {"failed-input", required_argument, 0, 0}, /* failed_input_root */
   {"append-output", no_argument, 0, 0},	     /* appendp */
+  {"async-output", required_argument, 0, 0}, /* async_output */
 
   {"order-among-best", required_argument, 0, 0}, /* want_random_p */
 
@@ -735,6 +759,9 @@ static struct option long_options[] = {
 
   /* Diagnostic options */
   {"time", no_argument, 0, 0},	/* timingp */
+  {"latency-report", no_argument, 0, 0}, /* latency_report_p */
+  {"slow-reads", required_argument, 0, 0}, /* slow_reads_file */
+  {"slow-read-threshold", required_argument, 0, 0}, /* slow_read_threshold */
   {"unload", no_argument, 0, 0},	/* unloadp */
 
   /* Obsolete, but included for backward compatibility */
@@ -964,9 +991,9 @@ check_compiler_assumptions () {
 
 /************************************************************************/
 
-/* Pass1 updates the global list of intron info */
+/* Pass1 updates the intron info of the calling thread */
 static void
-process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool, 
+process_request_pass1 (Pass1info_T pass1info_thread, Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool, 
 		       Auxinfopool_T auxinfopool, Intlistpool_T intlistpool, Uintlistpool_T uintlistpool,
 		       Univcoordlistpool_T univcoordlistpool, Listpool_T listpool, 
 		       Trpathpool_T trpathpool, Pathpool_T pathpool, Vectorpool_T vectorpool,
@@ -980,6 +1007,7 @@ process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_
   int npaths_primary, npaths_altloc, npaths5_primary, npaths5_altloc, npaths3_primary, npaths3_altloc, i;
   int first_absmq, second_absmq, first_absmq5, second_absmq5, first_absmq3, second_absmq3;
   Pairtype_T final_pairtype;
+  Method_T final_method;
 
   queryseq1 = Request_queryseq1(request);
   queryseq2 = Request_queryseq2(request);
@@ -987,26 +1015,14 @@ process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_
   if (single_cell_p == true) {
     Spliceendsgen_reset(spliceendsgen);
     patharray = Stage1_single_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,
-				   queryseq2,repetitive_ef64,knownsplicing,knownindels,localdb,
+				   &final_method,queryseq2,repetitive_ef64,knownsplicing,knownindels,localdb,
 				   trdiagpool,univdiagpool,auxinfopool,
 				   intlistpool,uintlistpool,univcoordlistpool,
 				   listpool,trpathpool,pathpool,transcriptpool,vectorpool,hitlistpool,
 				   spliceendsgen,/*single_cell_p*/true,/*first_read_p*/true,
 				   /*pass*/PASS1);
     if (npaths_primary + npaths_altloc == 1) {
-#ifdef HAVE_PTHREAD
-      pthread_mutex_lock(&pass1_lock);
-#endif
-      Path_learn_defect_rate(patharray[0],&total_mismatches,&total_querylength);
-      /* Path_learn_splicesites(patharray[0],donor_table,acceptor_table,antidonor_table,antiacceptor_table); */
-      Path_learn_introns(patharray[0],&donor_startpoints,&donor_partners,
-			 &acceptor_startpoints,&acceptor_partners,
-			 &antidonor_startpoints,&antidonor_partners,
-			 &antiacceptor_startpoints,&antiacceptor_partners);
-      Path_learn_indels(patharray[0],indel_table);
-#ifdef HAVE_PTHREAD
-      pthread_mutex_unlock(&pass1_lock);
-#endif
+      Pass1info_learn_path(pass1info_thread,patharray[0]);
     }
 
     for (i = 0; i < npaths_primary + npaths_altloc; i++) {
@@ -1019,26 +1035,14 @@ process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_
   } else if (queryseq2 == NULL) {
     Spliceendsgen_reset(spliceendsgen);
     patharray = Stage1_single_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,
-				   queryseq1,repetitive_ef64,knownsplicing,knownindels,localdb,
+				   &final_method,queryseq1,repetitive_ef64,knownsplicing,knownindels,localdb,
 				   trdiagpool,univdiagpool,auxinfopool,
 				   intlistpool,uintlistpool,univcoordlistpool,
 				   listpool,trpathpool,pathpool,transcriptpool,vectorpool,hitlistpool,
 				   spliceendsgen,/*single_cell_p*/false,/*first_read_p*/true,
 				   /*pass*/PASS1);
     if (npaths_primary + npaths_altloc == 1) {
-#ifdef HAVE_PTHREAD
-      pthread_mutex_lock(&pass1_lock);
-#endif
-      Path_learn_defect_rate(patharray[0],&total_mismatches,&total_querylength);
-      /* Path_learn_splicesites(patharray[0],donor_table,acceptor_table,antidonor_table,antiacceptor_table); */
-      Path_learn_introns(patharray[0],&donor_startpoints,&donor_partners,
-			 &acceptor_startpoints,&acceptor_partners,
-			 &antidonor_startpoints,&antidonor_partners,
-			 &antiacceptor_startpoints,&antiacceptor_partners);
-      Path_learn_indels(patharray[0],indel_table);
-#ifdef HAVE_PTHREAD
-      pthread_mutex_unlock(&pass1_lock);
-#endif
+      Pass1info_learn_path(pass1info_thread,patharray[0]);
     }
     for (i = 0; i < npaths_primary + npaths_altloc; i++) {
       Path_free(&(patharray[i]),intlistpool,univcoordlistpool,
@@ -1053,26 +1057,14 @@ process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_
   } else if (Shortread_fulllength(queryseq1) < min_querylength) {
     Spliceendsgen_reset(spliceendsgen);
     patharray = Stage1_single_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,
-				   queryseq2,repetitive_ef64,knownsplicing,knownindels,localdb,
+				   &final_method,queryseq2,repetitive_ef64,knownsplicing,knownindels,localdb,
 				   trdiagpool,univdiagpool,auxinfopool,
 				   intlistpool,uintlistpool,univcoordlistpool,
 				   listpool,trpathpool,pathpool,transcriptpool,vectorpool,hitlistpool,
 				   spliceendsgen,/*single_cell_p*/false,/*first_read_p*/false,
 				   /*pass*/PASS1);
     if (npaths_primary + npaths_altloc == 1) {
-#ifdef HAVE_PTHREAD
-      pthread_mutex_lock(&pass1_lock);
-#endif
-      Path_learn_defect_rate(patharray[0],&total_mismatches,&total_querylength);
-      /* Path_learn_splicesites(patharray[0],donor_table,acceptor_table,antidonor_table,antiacceptor_table); */
-      Path_learn_introns(patharray[0],&donor_startpoints,&donor_partners,
-			 &acceptor_startpoints,&acceptor_partners,
-			 &antidonor_startpoints,&antidonor_partners,
-			 &antiacceptor_startpoints,&antiacceptor_partners);
-      Path_learn_indels(patharray[0],indel_table);
-#ifdef HAVE_PTHREAD
-      pthread_mutex_unlock(&pass1_lock);
-#endif
+      Pass1info_learn_path(pass1info_thread,patharray[0]);
     }
     for (i = 0; i < npaths_primary + npaths_altloc; i++) {
       Path_free(&(patharray[i]),intlistpool,univcoordlistpool,
@@ -1083,26 +1075,14 @@ process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_
   } else if (Shortread_fulllength(queryseq2) < min_querylength) {
     Spliceendsgen_reset(spliceendsgen);
     patharray = Stage1_single_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,
-				   queryseq1,repetitive_ef64,knownsplicing,knownindels,localdb,
+				   &final_method,queryseq1,repetitive_ef64,knownsplicing,knownindels,localdb,
 				   trdiagpool,univdiagpool,auxinfopool,
 				   intlistpool,uintlistpool,univcoordlistpool,
 				   listpool,trpathpool,pathpool,transcriptpool,vectorpool,hitlistpool,
 				   spliceendsgen,/*single_cell_p*/false,/*first_read_p*/true,
 				   /*pass*/PASS1);
     if (npaths_primary + npaths_altloc == 1) {
-#ifdef HAVE_PTHREAD
-      pthread_mutex_lock(&pass1_lock);
-#endif
-      Path_learn_defect_rate(patharray[0],&total_mismatches,&total_querylength);
-      /* Path_learn_splicesites(patharray[0],donor_table,acceptor_table,antidonor_table,antiacceptor_table); */
-      Path_learn_introns(patharray[0],&donor_startpoints,&donor_partners,
-			 &acceptor_startpoints,&acceptor_partners,
-			 &antidonor_startpoints,&antidonor_partners,
-			 &antiacceptor_startpoints,&antiacceptor_partners);
-      Path_learn_indels(patharray[0],indel_table);
-#ifdef HAVE_PTHREAD
-      pthread_mutex_unlock(&pass1_lock);
-#endif
+      Pass1info_learn_path(pass1info_thread,patharray[0]);
     }
     for (i = 0; i < npaths_primary + npaths_altloc; i++) {
       Path_free(&(patharray[i]),intlistpool,univcoordlistpool,
@@ -1115,6 +1095,7 @@ process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_
     Spliceendsgen_reset(spliceendsgen3);
 
     if ((pathpairarray = Stage1_paired_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,&final_pairtype,
+					    &final_method,
 					    &patharray5,&npaths5_primary,&npaths5_altloc,&first_absmq5,&second_absmq5,
 					    &patharray3,&npaths3_primary,&npaths3_altloc,&first_absmq3,&second_absmq3,
 					    queryseq1,queryseq2,repetitive_ef64,
@@ -1130,28 +1111,9 @@ process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_
 	path5 = pathpair->path5;
 	path3 = pathpair->path3;
 
-#ifdef HAVE_PTHREAD
-	pthread_mutex_lock(&pass1_lock);
-#endif
-	Pathpair_learn_insertlengths(pathpairarray[0],&insertlengths);
-	Path_learn_defect_rate(path5,&total_mismatches,&total_querylength);
-	Path_learn_defect_rate(path3,&total_mismatches,&total_querylength);
-	/* Path_learn_splicesites(path5,donor_table,acceptor_table,antidonor_table,antiacceptor_table); */
-	Path_learn_introns(path5,&donor_startpoints,&donor_partners,
-				&acceptor_startpoints,&acceptor_partners,
-				&antidonor_startpoints,&antidonor_partners,
-				&antiacceptor_startpoints,&antiacceptor_partners);
-	Path_learn_indels(path5,indel_table);
-
-	/* Path_learn_splicesites(path3,donor_table,acceptor_table,antidonor_table,antiacceptor_table); */
-	Path_learn_introns(path3,&donor_startpoints,&donor_partners,
-				&acceptor_startpoints,&acceptor_partners,
-				&antidonor_startpoints,&antidonor_partners,
-				&antiacceptor_startpoints,&antiacceptor_partners);
-	Path_learn_indels(path3,indel_table);
-#ifdef HAVE_PTHREAD
-	pthread_mutex_unlock(&pass1_lock);
-#endif
+	Pass1info_learn_pathpair(pass1info_thread,pathpair);
+	Pass1info_learn_path(pass1info_thread,path5);
+	Pass1info_learn_path(pass1info_thread,path3);
       }
       for (i = 0; i < npaths_primary + npaths_altloc; i++) {
 	Pathpair_free(&(pathpairarray[i]),intlistpool,univcoordlistpool,
@@ -1162,34 +1124,10 @@ process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_
     } else {
       /* Process unpaired ends */
       if (npaths5_primary + npaths5_altloc == 1) {
-#ifdef HAVE_PTHREAD
-	pthread_mutex_lock(&pass1_lock);
-#endif
-	Path_learn_defect_rate(patharray5[0],&total_mismatches,&total_querylength);
-	/* Path_learn_splicesites(patharray5[0],donor_table,acceptor_table,antidonor_table,antiacceptor_table); */
-	Path_learn_introns(patharray5[0],&donor_startpoints,&donor_partners,
-				&acceptor_startpoints,&acceptor_partners,
-				&antidonor_startpoints,&antidonor_partners,
-				&antiacceptor_startpoints,&antiacceptor_partners);
-	Path_learn_indels(patharray5[0],indel_table);
-#ifdef HAVE_PTHREAD
-	pthread_mutex_unlock(&pass1_lock);
-#endif
+	Pass1info_learn_path(pass1info_thread,patharray5[0]);
       }
       if (npaths3_primary + npaths3_altloc == 1) {
-#ifdef HAVE_PTHREAD
-	pthread_mutex_lock(&pass1_lock);
-#endif
-	Path_learn_defect_rate(patharray3[0],&total_mismatches,&total_querylength);
-	/* Path_learn_splicesites(patharray3[0],donor_table,acceptor_table,antidonor_table,antiacceptor_table); */
-	Path_learn_introns(patharray3[0],&donor_startpoints,&donor_partners,
-				&acceptor_startpoints,&acceptor_partners,
-				&antidonor_startpoints,&antidonor_partners,
-				&antiacceptor_startpoints,&antiacceptor_partners);
-	Path_learn_indels(patharray3[0],indel_table);
-#ifdef HAVE_PTHREAD
-	pthread_mutex_unlock(&pass1_lock);
-#endif
+	Pass1info_learn_path(pass1info_thread,patharray3[0]);
       }
       for (i = 0; i < npaths5_primary + npaths5_altloc; i++) {
 	Path_free(&(patharray5[i]),intlistpool,univcoordlistpool,
@@ -1204,13 +1142,68 @@ process_request_pass1 (Request_T request, Trdiagpool_T trdiagpool, Univdiagpool_
     }
   }
 
+  if (pass1_saturation > 0.0 &&
+      Pass1info_saturatedp(pass1info_thread,PASS1_SATURATION_WINDOW,pass1_saturation) == true) {
+    Inbuffer_stop(inbuffer);
+  }
+
+  return;
+}
+
+
+/* For --live-splicing.  As in pass 1, learns only from reads (or
+   pairs) with a single alignment */
+static void
+learn_introns_from_result (Pass1info_T pass1info_thread, Result_T result) {
+  Resulttype_T resulttype;
+  void **array;
+  Pathpair_T pathpair;
+  int npaths_primary, npaths_altloc, first_absmq, second_absmq;
+
+  if (pass1info_thread == NULL) {
+    return;
+  }
+
+  resulttype = Result_resulttype(result);
+  if (resulttype == SINGLEEND_NOMAPPING || resulttype == PAIREDEND_NOMAPPING) {
+    /* Nothing to learn */
+
+  } else if (resulttype == SINGLEEND_UNIQ || resulttype == SINGLEEND_TRANSLOC || resulttype == SINGLEEND_MULT) {
+    array = Result_array(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,result);
+    if (npaths_primary + npaths_altloc == 1) {
+      Pass1info_learn_introns(pass1info_thread,(Path_T) array[0]);
+    }
+
+  } else if (resulttype == HALFMAPPING_UNIQ || resulttype == HALFMAPPING_TRANSLOC || resulttype == HALFMAPPING_MULT ||
+	     resulttype == UNPAIRED_UNIQ || resulttype == UNPAIRED_TRANSLOC || resulttype == UNPAIRED_MULT) {
+    array = Result_array(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,result);
+    if (npaths_primary + npaths_altloc == 1) {
+      Pass1info_learn_introns(pass1info_thread,(Path_T) array[0]);
+    }
+    array = Result_array2(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,result);
+    if (npaths_primary + npaths_altloc == 1) {
+      Pass1info_learn_introns(pass1info_thread,(Path_T) array[0]);
+    }
+
+  } else {
+    /* Paired or concordant */
+    array = Result_array(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,result);
+    if (npaths_primary + npaths_altloc == 1) {
+      pathpair = (Pathpair_T) array[0];
+      Pass1info_learn_introns(pass1info_thread,pathpair->path5);
+      Pass1info_learn_introns(pass1info_thread,pathpair->path3);
+    }
+  }
+
   return;
 }
 
 
 static Filestring_T
 process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinput_1, Filestring_T *fp_failedinput_2,
-		       double *worker_runtime, Request_T request,
+		       double *worker_runtime, double *stage1_runtime, Method_T *final_method,
+		       Request_T request,
+		       Knownsplicing_T knownsplicing_thread, Pass1info_T pass1info_thread,
 
 		       Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool, Auxinfopool_T auxinfopool,
 		       Intlistpool_T intlistpool, Uintlistpool_T uintlistpool,
@@ -1244,14 +1237,16 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
   if (single_cell_p == true) {
     Spliceendsgen_reset(spliceendsgen);
     patharray = Stage1_single_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,
-				   queryseq2,repetitive_ef64,knownsplicing,knownindels,localdb,
+				   &(*final_method),queryseq2,repetitive_ef64,knownsplicing_thread,knownindels,localdb,
 				   trdiagpool,univdiagpool,auxinfopool,
 				   intlistpool,uintlistpool,univcoordlistpool,
 				   listpool,trpathpool,pathpool,transcriptpool,vectorpool,hitlistpool,
 				   spliceendsgen,/*single_cell_p*/true,/*first_read_p*/true,
 				   /*pass*/PASS2);
+    *stage1_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
 
     result = Result_single_read_new(jobid,(void **) patharray,npaths_primary,npaths_altloc,first_absmq,second_absmq);
+    learn_introns_from_result(pass1info_thread,result);
     fp = Output_filestring_fromresult(&(*fp_failedinput),&(*fp_failedinput_1),&(*fp_failedinput_2),
 				      result,request,listpool);
     *worker_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
@@ -1262,14 +1257,16 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
   } else if (queryseq2 == NULL) {
     Spliceendsgen_reset(spliceendsgen);
     patharray = Stage1_single_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,
-				   queryseq1,repetitive_ef64,knownsplicing,knownindels,localdb,
+				   &(*final_method),queryseq1,repetitive_ef64,knownsplicing_thread,knownindels,localdb,
 				   trdiagpool,univdiagpool,auxinfopool,
 				   intlistpool,uintlistpool,univcoordlistpool,
 				   listpool,trpathpool,pathpool,transcriptpool,vectorpool,hitlistpool,
 				   spliceendsgen,/*single_cell_p*/false,/*first_read_p*/true,
 				   /*pass*/PASS2);
+    *stage1_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
 
     result = Result_single_read_new(jobid,(void **) patharray,npaths_primary,npaths_altloc,first_absmq,second_absmq);
+    learn_introns_from_result(pass1info_thread,result);
     fp = Output_filestring_fromresult(&(*fp_failedinput),&(*fp_failedinput_1),&(*fp_failedinput_2),
 				      result,request,listpool);
     *worker_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
@@ -1280,10 +1277,13 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
   } else if (Shortread_fulllength(queryseq1) < min_querylength &&
 	     Shortread_fulllength(queryseq2) < min_querylength) {
     patharray3 = patharray5 = (Path_T *) NULL;
+    *final_method = METHOD_INIT;
+    *stage1_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
     result = Result_paired_as_singles_new(jobid,(void **) patharray5,/*npaths5_primary*/0,/*npaths5_altloc*/0,
 					  /*first_absmq5*/0,/*second_absmq5*/0,
 					  (void **) patharray3,/*npaths3_primary*/0,/*npaths3_altloc*/0,
 					  /*first_absmq3*/0,/*second_absmq3*/0);
+    learn_introns_from_result(pass1info_thread,result);
     fp = Output_filestring_fromresult(&(*fp_failedinput),&(*fp_failedinput_1),&(*fp_failedinput_2),
 				      result,request,listpool);
     *worker_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
@@ -1296,16 +1296,18 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
     Spliceendsgen_reset(spliceendsgen);
     patharray5 = (Path_T *) NULL;
     patharray3 = Stage1_single_read(&npaths3_primary,&npaths3_altloc,&first_absmq3,&second_absmq3,
-				    queryseq2,repetitive_ef64,knownsplicing,knownindels,localdb,
+				    &(*final_method),queryseq2,repetitive_ef64,knownsplicing_thread,knownindels,localdb,
 				    trdiagpool,univdiagpool,auxinfopool,
 				    intlistpool,uintlistpool,univcoordlistpool,
 				    listpool,trpathpool,pathpool,transcriptpool,vectorpool,hitlistpool,
 				    spliceendsgen,/*single_cell_p*/false,/*first_read_p*/false,
 				    /*pass*/PASS2);
+    *stage1_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
     result = Result_paired_as_singles_new(jobid,(void **) patharray5,/*npaths5_primary*/0,/*npaths5_altloc*/0,
 					  /*first_absmq5*/0,/*second_absmq5*/0,
 					  (void **) patharray3,npaths3_primary,npaths3_altloc,
 					  first_absmq3,second_absmq3);
+    learn_introns_from_result(pass1info_thread,result);
     fp = Output_filestring_fromresult(&(*fp_failedinput),&(*fp_failedinput_1),&(*fp_failedinput_2),
 				      result,request,listpool);
     *worker_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
@@ -1318,16 +1320,18 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
     Spliceendsgen_reset(spliceendsgen);
     patharray3 = (Path_T *) NULL;
     patharray5 = Stage1_single_read(&npaths5_primary,&npaths5_altloc,&first_absmq5,&second_absmq5,
-				    queryseq1,repetitive_ef64,knownsplicing,knownindels,localdb,
+				    &(*final_method),queryseq1,repetitive_ef64,knownsplicing_thread,knownindels,localdb,
 				    trdiagpool,univdiagpool,auxinfopool,
 				    intlistpool,uintlistpool,univcoordlistpool,
 				    listpool,trpathpool,pathpool,transcriptpool,vectorpool,hitlistpool,
 				    spliceendsgen,/*single_cell_p*/false,/*first_read_p*/true,
 				    /*pass*/PASS2);
+    *stage1_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
     result = Result_paired_as_singles_new(jobid,(void **) patharray5,npaths5_primary,npaths5_altloc,
 					  first_absmq5,second_absmq5,
 					  (void **) patharray3,/*npaths3_primary*/0,/*npaths3_altloc*/0,
 					  /*first_absmq3*/0,/*second_absmq3*/0);
+    learn_introns_from_result(pass1info_thread,result);
     fp = Output_filestring_fromresult(&(*fp_failedinput),&(*fp_failedinput_1),&(*fp_failedinput_2),
 				      result,request,listpool);
     *worker_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
@@ -1339,20 +1343,24 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
     Spliceendsgen_reset(spliceendsgen5);
     Spliceendsgen_reset(spliceendsgen3);
 
-    if ((pathpairarray = Stage1_paired_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,&final_pairtype,
-					    &patharray5,&npaths5_primary,&npaths5_altloc,&first_absmq5,&second_absmq5,
-					    &patharray3,&npaths3_primary,&npaths3_altloc,&first_absmq3,&second_absmq3,
-					    queryseq1,queryseq2,repetitive_ef64,
-					    knownsplicing,knownindels,(Chrpos_T) pairmax_linear,
-					    trdiagpool,univdiagpool,auxinfopool,
-					    intlistpool,uintlistpool,univcoordlistpool,
-					    listpool,trpathpool,pathpool,vectorpool,hitlistpool,
-					    transcriptpool,spliceendsgen5,spliceendsgen3,
-					    /*pass*/PASS2)) != NULL) {
-
+    pathpairarray = Stage1_paired_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,&final_pairtype,
+				       &(*final_method),
+				       &patharray5,&npaths5_primary,&npaths5_altloc,&first_absmq5,&second_absmq5,
+				       &patharray3,&npaths3_primary,&npaths3_altloc,&first_absmq3,&second_absmq3,
+				       queryseq1,queryseq2,repetitive_ef64,
+				       knownsplicing_thread,knownindels,(Chrpos_T) pairmax_linear,
+				       trdiagpool,univdiagpool,auxinfopool,
+				       intlistpool,uintlistpool,univcoordlistpool,
+				       listpool,trpathpool,pathpool,vectorpool,hitlistpool,
+				       transcriptpool,spliceendsgen5,spliceendsgen3,
+				       /*pass*/PASS2);
+    *stage1_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
+
+    if (pathpairarray != NULL) {
       /* Paired or concordant hits found */
       result = Result_paired_read_new(jobid,(void **) pathpairarray,npaths_primary,npaths_altloc,first_absmq,second_absmq,
 				      final_pairtype);
+      learn_introns_from_result(pass1info_thread,result);
       fp = Output_filestring_fromresult(&(*fp_failedinput),&(*fp_failedinput_1),&(*fp_failedinput_2),
 					result,request,listpool);
       *worker_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
@@ -1368,6 +1376,8 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
       result = Result_paired_as_singles_new(jobid,(void **) patharray5,npaths5_primary,npaths5_altloc,first_absmq5,second_absmq5,
 					    (void **) patharray3,npaths3_primary,npaths3_altloc,first_absmq3,second_absmq3);
 
+      learn_introns_from_result(pass1info_thread,result);
+
       fp = Output_filestring_fromresult(&(*fp_failedinput),&(*fp_failedinput_1),&(*fp_failedinput_2),
 					result,request,listpool);
       *worker_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
@@ -1391,10 +1401,11 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
       FREE_OUT(patharray3);
       
       if ((pathpairarray = Stage1_paired_read(&npaths_primary,&npaths_altloc,&first_absmq,&second_absmq,&final_pairtype,
+					      &(*final_method),
 					      &patharray5,&npaths5_primary,&npaths5_altloc,&first_absmq5,&second_absmq5,
 					      &patharray3,&npaths3_primary,&npaths3_altloc,&first_absmq3,&second_absmq3,
 					      queryseq1,queryseq2,repetitive_ef64,
-					      knownsplicing,knownindels,(Chrpos_T) pairmax_linear,
+					      knownsplicing_thread,knownindels,(Chrpos_T) pairmax_linear,
 					      trdiagpool,univdiagpool,auxinfopool,
 					      intlistpool,uintlistpool,univcoordlistpool,
 					      listpool,trpathpool,pathpool,vectorpool,hitlistpool,
@@ -1410,6 +1421,8 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
 					      (void **) patharray3,npaths3_primary,npaths3_altloc,first_absmq3,second_absmq3);
       }
       
+      learn_introns_from_result(pass1info_thread,result);
+      
       fp = Output_filestring_fromresult(&(*fp_failedinput),&(*fp_failedinput_1),&(*fp_failedinput_2),
 					result,request,listpool);
       *worker_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
@@ -1420,6 +1433,7 @@ process_request_pass2 (Filestring_T *fp_failedinput, Filestring_T *fp_failedinpu
     } else {
       result = Result_paired_as_singles_new(jobid,(void **) patharray5,npaths5_primary,npaths5_altloc,first_absmq5,second_absmq5,
 					    (void **) patharray3,npaths3_primary,npaths3_altloc,first_absmq3,second_absmq3);
+      learn_introns_from_result(pass1info_thread,result);
       fp = Output_filestring_fromresult(&(*fp_failedinput),&(*fp_failedinput_1),&(*fp_failedinput_2),
 					result,request,listpool);
       *worker_runtime = worker_stopwatch == NULL ? 0.00 : Stopwatch_stop(worker_stopwatch);
@@ -1529,11 +1543,16 @@ single_thread () {
   Transcriptpool_T transcriptpool;
   Vectorpool_T vectorpool;
   Spliceendsgen_T spliceendsgen, spliceendsgen5, spliceendsgen3;
+  Pass1info_T pass1info_thread = NULL;
+  Knownsplicing_T knownsplicing_thread;
+  unsigned int nlearned = 0, handoff_interval = 0;
+  Latency_T latency_thread = NULL;
+  Method_T final_method;
   int jobid = 0;
-  double worker_runtime;
+  double worker_runtime, stage1_runtime;
 
 #ifdef MEMUSAGE
-  long int overall_max = 0, memusage_constant = 0, memusage;
+  long int overall_max = 0, memusage_constant = 0, memusage, stage1_nbuilt, stage1_nreused;
   char acc[100+1], comma0[20], comma1[20], comma2[20], comma3[20], comma4[20], comma5[20], comma9[20];
 #endif
 
@@ -1553,7 +1572,24 @@ single_thread () {
   spliceendsgen = Spliceendsgen_new();
   spliceendsgen5 = Spliceendsgen_new();
   spliceendsgen3 = Spliceendsgen_new();
-  worker_stopwatch = (timingp == true) ? Stopwatch_new() : (Stopwatch_T) NULL;
+  if (timingp == true || latency_report_p == true || slow_reads_file != NULL) {
+    worker_stopwatch = Stopwatch_new();
+  } else {
+    worker_stopwatch = (Stopwatch_T) NULL;
+  }
+
+  if (pass == PASS1) {
+    pass1infos[0] = pass1info_thread = Pass1info_new();
+    if (pass1_saturation > 0.0) {
+      Pass1info_track_novelty(pass1info_thread);
+    }
+  } else if (livesplicing != NULL) {
+    pass1info_thread = Pass1info_new();
+    handoff_interval = Livesplicing_handoff_interval(livesplicing);
+  }
+  if (pass == PASS2 && latencies != NULL) {
+    latencies[0] = latency_thread = Latency_new();
+  }
 
   /* Except_stack_create(); -- requires pthreads */
 
@@ -1572,21 +1608,43 @@ single_thread () {
     /* fprintf(stderr,"Single thread starting %s\n",Shortread_accession(queryseq1)); */
     Mem_usage_reset_stack_max();
     Mem_usage_reset_heap_max();
+    Mem_usage_reset_nallocs();
 #endif
 
     TRY
       if (pass == PASS1) {
-	process_request_pass1(request,trdiagpool,univdiagpool,auxinfopool,
+	process_request_pass1(pass1info_thread,request,trdiagpool,univdiagpool,auxinfopool,
 			      intlistpool,uintlistpool,univcoordlistpool,
 			      listpool,trpathpool,pathpool,vectorpool,hitlistpool,
 			      transcriptpool,spliceendsgen,spliceendsgen5,spliceendsgen3);
       } else if (pass == PASS2) {
-	fp = process_request_pass2(&fp_failedinput,&fp_failedinput_1,&fp_failedinput_2,&worker_runtime,
-				   request,trdiagpool,univdiagpool,auxinfopool,
+	if (livesplicing == NULL) {
+	  knownsplicing_thread = knownsplicing;
+	} else if ((knownsplicing_thread = Livesplicing_acquire(livesplicing,0)) == NULL) {
+	  knownsplicing_thread = knownsplicing; /* No introns learned yet */
+	}
+	fp = process_request_pass2(&fp_failedinput,&fp_failedinput_1,&fp_failedinput_2,
+				   &worker_runtime,&stage1_runtime,&final_method,request,knownsplicing_thread,pass1info_thread,
+				   trdiagpool,univdiagpool,auxinfopool,
 				   intlistpool,uintlistpool,univcoordlistpool,
 				   listpool,trpathpool,pathpool,vectorpool,hitlistpool,
 				   transcriptpool,spliceendsgen,spliceendsgen5,spliceendsgen3,
 				   worker_stopwatch);
+	if (livesplicing != NULL) {
+	  Livesplicing_release(livesplicing,0);
+	  if (++nlearned == handoff_interval) {
+	    Livesplicing_contribute(livesplicing,pass1info_thread,nlearned);
+	    pass1info_thread = Pass1info_new();
+	    nlearned = 0;
+	  }
+	}
+	if (latency_thread != NULL) {
+	  Latency_record(latency_thread,worker_runtime,stage1_runtime,final_method);
+	}
+	if (slow_reads_file != NULL) {
+	  Latency_trap(Request_queryseq1(request),Request_queryseq2(request),
+		       worker_runtime,stage1_runtime,final_method);
+	}
       } else {
 	fprintf(stderr,"Unknown pass %d\n",pass);
 	abort();
@@ -1627,6 +1685,7 @@ single_thread () {
     if (pass == PASS1) {
       /* Nothing to do */
     } else if (pass == PASS2) {
+      Filestring_set_id(fp,Request_inputid(request));
       Filestring_stringify(fp);
       if (fp_failedinput != NULL) {
 	Filestring_stringify(fp_failedinput);
@@ -1682,6 +1741,9 @@ single_thread () {
 #if 1
     fprintf(stdout,"Acc %s: constant %s  overall_max %s  query_max %s  std %s  keep %s  in %s  out %s\n",
 	    acc,comma0,comma9,comma1,comma2,comma3,comma4,comma5);
+    Stage1_report_reuse(&stage1_nbuilt,&stage1_nreused);
+    fprintf(stdout,"Acc %s: allocations %ld  stage1 built %ld  reused %ld\n",
+	    acc,Mem_usage_report_nallocs(),stage1_nbuilt,stage1_nreused);
 #endif
 
     if ((memusage = Mem_usage_report_std_heap()) > memusage_constant) {
@@ -1710,6 +1772,11 @@ single_thread () {
   Spliceendsgen_free(&spliceendsgen5);
   Spliceendsgen_free(&spliceendsgen);
 
+  if (pass == PASS2 && pass1info_thread != NULL) {
+    /* For --live-splicing.  Evidence from the last reads comes too late to be used */
+    Pass1info_free(&pass1info_thread);
+  }
+
   Trpathpool_free(&trpathpool);
   Pathpool_free(&pathpool);
   Hitlistpool_free(&hitlistpool);
@@ -1753,14 +1820,18 @@ worker_thread (void *data) {
   Vectorpool_T vectorpool;
   Spliceendsgen_T spliceendsgen, spliceendsgen5, spliceendsgen3;
 
+  Pass1info_T pass1info_thread = NULL;
+  Knownsplicing_T knownsplicing_thread;
+  unsigned int nlearned = 0, handoff_interval = 0;
+  Latency_T latency_thread = NULL;
+  Method_T final_method;
+
   int worker_jobid = 0;
-  double worker_runtime;
-#if defined(DEBUG) || defined(MEMUSAGE)
+  double worker_runtime, stage1_runtime;
   long int worker_id = (long int) data;
-#endif
 
 #ifdef MEMUSAGE
-  long int overall_max = 0, memusage_constant = 0, memusage;
+  long int overall_max = 0, memusage_constant = 0, memusage, stage1_nbuilt, stage1_nreused;
   char threadname[12];
   char acc[100+1], comma0[20], comma1[20], comma2[20], comma3[20], comma4[20], comma5[20], comma9[20];
   sprintf(threadname,"thread-%ld",worker_id);
@@ -1786,7 +1857,24 @@ worker_thread (void *data) {
   spliceendsgen = Spliceendsgen_new();
   spliceendsgen5 = Spliceendsgen_new();
   spliceendsgen3 = Spliceendsgen_new();
-  worker_stopwatch = (timingp == true) ? Stopwatch_new() : (Stopwatch_T) NULL;
+  if (timingp == true || latency_report_p == true || slow_reads_file != NULL) {
+    worker_stopwatch = Stopwatch_new();
+  } else {
+    worker_stopwatch = (Stopwatch_T) NULL;
+  }
+
+  if (pass == PASS1) {
+    pass1infos[worker_id] = pass1info_thread = Pass1info_new();
+    if (pass1_saturation > 0.0) {
+      Pass1info_track_novelty(pass1info_thread);
+    }
+  } else if (livesplicing != NULL) {
+    pass1info_thread = Pass1info_new();
+    handoff_interval = Livesplicing_handoff_interval(livesplicing);
+  }
+  if (pass == PASS2 && latencies != NULL) {
+    latencies[worker_id] = latency_thread = Latency_new();
+  }
 
   Except_stack_create();
 
@@ -1806,21 +1894,43 @@ worker_thread (void *data) {
     /* fprintf(stderr,"Thread %d starting %s\n",worker_id,Shortread_accession(queryseq1)); */
     Mem_usage_reset_stack_max();
     Mem_usage_reset_heap_max();
+    Mem_usage_reset_nallocs();
 #endif
 
     TRY
       if (pass == PASS1) {
-	process_request_pass1(request,trdiagpool,univdiagpool,auxinfopool,
+	process_request_pass1(pass1info_thread,request,trdiagpool,univdiagpool,auxinfopool,
 			      intlistpool,uintlistpool,univcoordlistpool,
 			      listpool,trpathpool,pathpool,vectorpool,hitlistpool,
 			      transcriptpool,spliceendsgen,spliceendsgen5,spliceendsgen3);
       } else if (pass == PASS2) {
-	fp = process_request_pass2(&fp_failedinput,&fp_failedinput_1,&fp_failedinput_2,&worker_runtime,
-				   request,trdiagpool,univdiagpool,auxinfopool,
+	if (livesplicing == NULL) {
+	  knownsplicing_thread = knownsplicing;
+	} else if ((knownsplicing_thread = Livesplicing_acquire(livesplicing,worker_id)) == NULL) {
+	  knownsplicing_thread = knownsplicing; /* No introns learned yet */
+	}
+	fp = process_request_pass2(&fp_failedinput,&fp_failedinput_1,&fp_failedinput_2,
+				   &worker_runtime,&stage1_runtime,&final_method,request,knownsplicing_thread,pass1info_thread,
+				   trdiagpool,univdiagpool,auxinfopool,
 				   intlistpool,uintlistpool,univcoordlistpool,
 				   listpool,trpathpool,pathpool,vectorpool,hitlistpool,
 				   transcriptpool,spliceendsgen,spliceendsgen5,spliceendsgen3,
 				   worker_stopwatch);
+	if (livesplicing != NULL) {
+	  Livesplicing_release(livesplicing,worker_id);
+	  if (++nlearned == handoff_interval) {
+	    Livesplicing_contribute(livesplicing,pass1info_thread,nlearned);
+	    pass1info_thread = Pass1info_new();
+	    nlearned = 0;
+	  }
+	}
+	if (latency_thread != NULL) {
+	  Latency_record(latency_thread,worker_runtime,stage1_runtime,final_method);
+	}
+	if (slow_reads_file != NULL) {
+	  Latency_trap(Request_queryseq1(request),Request_queryseq2(request),
+		       worker_runtime,stage1_runtime,final_method);
+	}
       } else {
 	fprintf(stderr,"Unknown pass %d\n",pass);
 	abort();
@@ -1865,6 +1975,7 @@ worker_thread (void *data) {
 
     } else if (pass == PASS2) {
       /* Parallelize the stringify operation by performing by worker thread and not the output thread */
+      Filestring_set_id(fp,Request_inputid(request));
       Filestring_stringify(fp);
       if (fp_failedinput != NULL) {
 	Filestring_stringify(fp_failedinput);
@@ -1922,6 +2033,9 @@ worker_thread (void *data) {
 #if 1
     fprintf(stdout,"Acc %s, thread %d: constant %s  overall_max %s  query_max %s  std %s  keep %s  in %s  out %s\n",
 	    acc,worker_id,comma0,comma9,comma1,comma2,comma3,comma4,comma5);
+    Stage1_report_reuse(&stage1_nbuilt,&stage1_nreused);
+    fprintf(stdout,"Acc %s, thread %d: allocations %ld  stage1 built %ld  reused %ld\n",
+	    acc,worker_id,Mem_usage_report_nallocs(),stage1_nbuilt,stage1_nreused);
 #endif
 
     if ((memusage = Mem_usage_report_std_heap()) > memusage_constant) {
@@ -1948,6 +2062,11 @@ worker_thread (void *data) {
   Spliceendsgen_free(&spliceendsgen3);
   Spliceendsgen_free(&spliceendsgen5);
   Spliceendsgen_free(&spliceendsgen);
+
+  if (pass == PASS2 && pass1info_thread != NULL) {
+    /* For --live-splicing.  Evidence from the last reads comes too late to be used */
+    Pass1info_free(&pass1info_thread);
+  }
   Vectorpool_free(&vectorpool);
   Transcriptpool_free(&transcriptpool);
   Hitlistpool_free(&hitlistpool);
@@ -2229,6 +2348,36 @@ parse_command_line (int argc, char *argv[], int optind) {
       } else if (!strcmp(long_name,"two-pass")) {
 	two_pass_p = true;
 
+      } else if (!strcmp(long_name,"pass1-dump")) {
+	pass1_dump_file = optarg;
+	two_pass_p = true;
+
+      } else if (!strcmp(long_name,"pass1-read")) {
+	pass1_read_files = optarg;
+	two_pass_p = true;
+
+      } else if (!strcmp(long_name,"pass1-sample")) {
+	pass1_sample_fraction = check_valid_float(optarg,long_name);
+	if (pass1_sample_fraction <= 0.0 || pass1_sample_fraction > 1.0) {
+	  fprintf(stderr,"Value for --pass1-sample should be greater than 0.0 and at most 1.0\n");
+	  return 9;
+	}
+	two_pass_p = true;
+
+      } else if (!strcmp(long_name,"pass1-max-reads")) {
+	pass1_max_reads = (unsigned int) strtoul(check_valid_int(optarg),NULL,10);
+	two_pass_p = true;
+
+      } else if (!strcmp(long_name,"pass1-saturation")) {
+	pass1_saturation = atof(check_valid_float_or_int(optarg));
+	two_pass_p = true;
+
+      } else if (!strcmp(long_name,"live-splicing")) {
+	live_splicing_interval = (unsigned int) strtoul(check_valid_int(optarg),NULL,10);
+
+      } else if (!strcmp(long_name,"part-index")) {
+	part_index_file = optarg;
+
       } else if (!strcmp(long_name,"use-localdb")) {
 	if (!strcmp(optarg,"1")) {
 	  user_localdb_p = true;
@@ -2272,6 +2421,16 @@ parse_command_line (int argc, char *argv[], int optind) {
       } else if (!strcmp(long_name,"unload-shared-memory")) {
 	unload_shared_memory_p = true;
 
+      } else if (!strcmp(long_name,"snapshot-dir")) {
+	snapshot_dir = optarg;
+	sharedp = true;
+
+      } else if (!strcmp(long_name,"load-threads")) {
+	load_nthreads = atoi(check_valid_int(optarg));
+
+      } else if (!strcmp(long_name,"bitpack-positions")) {
+	bitpack_positions_p = true;
+
       } else if (!strcmp(long_name,"expand-offsets")) {
 	fprintf(stderr,"Note: --expand-offsets flag is no longer supported.  With the latest algorithms, it doesn't improve speed much.  Ignoring this flag");
 
@@ -2281,6 +2440,15 @@ parse_command_line (int argc, char *argv[], int optind) {
       } else if (!strcmp(long_name,"time")) {
 	timingp = true;
 
+      } else if (!strcmp(long_name,"latency-report")) {
+	latency_report_p = true;
+
+      } else if (!strcmp(long_name,"slow-reads")) {
+	slow_reads_file = optarg;
+
+      } else if (!strcmp(long_name,"slow-read-threshold")) {
+	slow_read_threshold = atof(check_valid_float_or_int(optarg));
+
       } else if (!strcmp(long_name,"unload")) {
 	unloadp = true;
 
@@ -2346,6 +2514,9 @@ parse_command_line (int argc, char *argv[], int optind) {
 	  exit(9);
 	}
 
+      } else if (!strcmp(long_name,"sparse-snps")) {
+	sparse_snps_p = true;
+
       } else if (!strcmp(long_name,"tallydir")) {
 	user_tallydir = optarg;
 
@@ -2462,6 +2633,16 @@ parse_command_line (int argc, char *argv[], int optind) {
       } else if (!strcmp(long_name,"append-output")) {
 	appendp = true;
 
+      } else if (!strcmp(long_name,"async-output")) {
+	if (!strcmp(optarg,"uring")) {
+	  async_output = OUTWRITER_URING;
+	} else if (!strcmp(optarg,"threads")) {
+	  async_output = OUTWRITER_THREADS;
+	} else {
+	  fprintf(stderr,"--async-output values allowed: uring, threads\n");
+	  return 9;
+	}
+
       } else if (!strcmp(long_name,"order-among-best")) {
 	if (!strcmp(optarg,"genomic")) {
 	  want_random_p = false;
@@ -3059,6 +3240,31 @@ parse_command_line (int argc, char *argv[], int optind) {
     return 9;
   }
 
+  if (pass1_dump_file != NULL && pass1_read_files != NULL) {
+    fprintf(stderr,"Cannot specify both --pass1-dump and --pass1-read\n");
+    return 9;
+  }
+
+  if (live_splicing_interval > 0 && two_pass_p == true) {
+    fprintf(stderr,"Cannot specify --live-splicing with --two-pass or its related options\n");
+    return 9;
+  }
+
+  if (pass1_read_files != NULL &&
+      (pass1_sample_fraction < 1.0 || pass1_max_reads > 0 || pass1_saturation > 0.0)) {
+    fprintf(stderr,"Cannot specify --pass1-sample, --pass1-max-reads, or --pass1-saturation with --pass1-read\n");
+    return 9;
+  }
+
+  if (part_index_file != NULL) {
+    if (split_output_root != NULL) {
+      fprintf(stderr,"Cannot specify --part-index with --split-output\n");
+      return 9;
+    }
+    /* merge_parts relies on each part being in input order */
+    orderedp = true;
+  }
+
   if (sam_headers_batch >= 0) {
     if ((int) part_modulus == sam_headers_batch) {
       sam_headers_p = true;
@@ -3344,6 +3550,7 @@ worker_setup (char *transcriptomesubdir, char *transcriptome_fileroot,
   char *snpsdir = NULL, *modedir = NULL, *mapdir = NULL, *iitfile = NULL;
   /* Univcoord_T genome_totallength; */
   char *idx_filesuffix1, *idx_filesuffix2;
+  Genomebits_T snpbits;
   FILE *dump_fp;
 
 
@@ -3388,10 +3595,20 @@ worker_setup (char *transcriptomesubdir, char *transcriptome_fileroot,
 			chromosome_iit,genome_access,sharedp,/*revcompp*/false);
     genomebits = Genomebits_new(genomesubdir,genome_fileroot,/*alt_root*/NULL,
 				genome_access,sharedp,/*revcompp*/false);
-    genomealt = Genome_new(snpsdir,genome_fileroot,snps_root,
-			   chromosome_iit,genome_access,sharedp,/*revcompp*/false);
-    genomebits_alt = Genomebits_new(snpsdir,genome_fileroot,snps_root,
-				    genome_access,sharedp,/*revcompp*/false);
+    if (sparse_snps_p == false) {
+      genomealt = Genome_new(snpsdir,genome_fileroot,snps_root,
+			     chromosome_iit,genome_access,sharedp,/*revcompp*/false);
+      genomebits_alt = Genomebits_new(snpsdir,genome_fileroot,snps_root,
+				      genome_access,sharedp,/*revcompp*/false);
+    } else {
+      /* Read the SNP genome only to find where it differs from the reference */
+      genomealt = genome;
+      snpbits = Genomebits_new(snpsdir,genome_fileroot,snps_root,
+			       /*access*/USE_MMAP_ONLY,/*sharedp*/false,/*revcompp*/false);
+      genomebits_alt = Genomebits_new_snpoverlay(genomebits,snpbits);
+      Genomebits_free(&snpbits);
+      Genome_setup_snpoverlay(genomebits_alt->snpoverlay);
+    }
   }
 
   /* Must be done before Knownsplicing_retrieve_via_splicesites */
@@ -3418,7 +3635,35 @@ worker_setup (char *transcriptomesubdir, char *transcriptome_fileroot,
     idx_filesuffix2 = (char *) NULL;
   }
 
-  if ((indexdb = Indexdb_new_genome(&index1part,&index1interval,
+#ifndef LARGE_GENOMES
+  /* A combined index from cmetindex or atoiindex --combined holds
+     metct and metga, or a2iag and a2itc, in that order */
+  if (idx_filesuffix2 != NULL && snps_root == NULL) {
+    if (mode == CMET_STRANDED || mode == CMET_NONSTRANDED) {
+      indexdb = Indexdb_new_combined(&indexdb_nonstd,&index1part,&index1interval,
+				     /*genomesubdir*/modedir,genome_fileroot,CMET_COMBINED_FILESUFFIX,
+				     required_index1part,required_index1interval,
+				     offsetsstrm_access,positions_access,sharedp,
+				     multiple_sequences_p,preload_shared_memory_p,unload_shared_memory_p);
+    } else if (mode == ATOI_STRANDED || mode == ATOI_NONSTRANDED) {
+      indexdb = Indexdb_new_combined(&indexdb_nonstd,&index1part,&index1interval,
+				     /*genomesubdir*/modedir,genome_fileroot,ATOI_COMBINED_FILESUFFIX,
+				     required_index1part,required_index1interval,
+				     offsetsstrm_access,positions_access,sharedp,
+				     multiple_sequences_p,preload_shared_memory_p,unload_shared_memory_p);
+    } else {
+      indexdb_nonstd = Indexdb_new_combined(&indexdb,&index1part,&index1interval,
+					    /*genomesubdir*/modedir,genome_fileroot,ATOI_COMBINED_FILESUFFIX,
+					    required_index1part,required_index1interval,
+					    offsetsstrm_access,positions_access,sharedp,
+					    multiple_sequences_p,preload_shared_memory_p,unload_shared_memory_p);
+    }
+  }
+#endif
+
+  if (indexdb != NULL) {
+    /* Loaded from combined index */
+  } else if ((indexdb = Indexdb_new_genome(&index1part,&index1interval,
 				    /*genomesubdir*/modedir,snpsdir,
 				    genome_fileroot,idx_filesuffix1,snps_root,
 				    required_index1part,required_index1interval,
@@ -3438,6 +3683,8 @@ worker_setup (char *transcriptomesubdir, char *transcriptome_fileroot,
 
   if (idx_filesuffix2 == NULL) {
     indexdb_nonstd = indexdb;
+  } else if (indexdb_nonstd != NULL) {
+    /* Loaded from combined index */
   } else if ((indexdb_nonstd = Indexdb_new_genome(&index1part,&index1interval,
 						  /*genomesubdir*/modedir,snpsdir,
 						  genome_fileroot,idx_filesuffix2,snps_root,
@@ -3916,6 +4163,9 @@ worker_cleanup () {
   if (genomealt != NULL && genomealt != genome) {
     Genome_free(&genomealt);
     Genomebits_free(&genomebits_alt);
+  } else if (genomebits_alt != NULL) {
+    /* SNP overlay */
+    Genomebits_free(&genomebits_alt);
   }
   if (genomebits != NULL) {
     Genomebits_free(&genomebits);
@@ -4001,6 +4251,84 @@ worker_cleanup () {
 }
 
 
+/* For --pass1-sample, --pass1-max-reads, and --pass1-saturation.
+   The number of distinct introns that a full pass would find is
+   estimated from the introns seen once (f1) and twice (f2) in the
+   sample, by extrapolating the species accumulation curve (Shen,
+   Chao, and Lin, 2003) to the number of reads in the input.  If the
+   input was not read to the end, its size is unknown, so the
+   asymptotic Chao1 estimate is given instead. */
+static void
+report_pass1_sample (unsigned int nsampled, unsigned int ninput, bool stoppedp) {
+  int ndistinct, f1, f2;
+  double f0, nestimated;
+
+  ndistinct = Pass1info_count_introns(&f1,&f2,pass1info);
+  f0 = (double) f1*(double) (f1 - 1)/(2.0*(double) (f2 + 1)); /* Bias-corrected Chao1 */
+  if (stoppedp == true) {
+    nestimated = (double) ndistinct + f0;
+  } else if (f0 == 0.0 || nsampled == 0) {
+    nestimated = (double) ndistinct;
+  } else {
+    nestimated = (double) ndistinct +
+      f0*(1.0 - pow(1.0 - (double) f1/((double) nsampled*f0 + (double) f1),(double) (ninput - nsampled)));
+  }
+
+  if (stoppedp == true) {
+    fprintf(stderr,"Pass 1 sample: %u reads, stopped after %u input reads\n",nsampled,ninput);
+  } else {
+    fprintf(stderr,"Pass 1 sample: %u of %u input reads\n",nsampled,ninput);
+  }
+  fprintf(stderr,"Pass 1 sample: %d distinct introns (%d seen once, %d seen twice), out of an estimated %.0f %s",
+	  ndistinct,f1,f2,nestimated,(stoppedp == true) ? "in total" : "in a full pass");
+  if (nestimated > 0.0) {
+    fprintf(stderr," (%.1f%%)",100.0*(double) ndistinct/nestimated);
+  }
+  fprintf(stderr,"\n");
+
+  return;
+}
+
+/* For --pass1-dump */
+static void
+write_pass1_file (char *filename) {
+  FILE *fp;
+
+  if ((fp = fopen(filename,"w")) == NULL) {
+    fprintf(stderr,"Cannot write to --pass1-dump file %s\n",filename);
+    exit(9);
+  }
+  Pass1info_dump(pass1info,fp);
+  fclose(fp);
+
+  fprintf(stderr,"Wrote pass 1 evidence to %s\n",filename);
+  return;
+}
+
+/* For --pass1-read.  Sums the evidence from each file, before any filtering */
+static void
+read_pass1_files (char *filenames) {
+  FILE *fp;
+  char *copy, *filename;
+
+  copy = (char *) MALLOC((strlen(filenames)+1)*sizeof(char));
+  strcpy(copy,filenames);
+
+  for (filename = strtok(copy,","); filename != NULL; filename = strtok(NULL,",")) {
+    if ((fp = fopen(filename,"r")) == NULL) {
+      fprintf(stderr,"Cannot open --pass1-read file %s\n",filename);
+      exit(9);
+    }
+    fprintf(stderr,"Reading pass 1 evidence from %s\n",filename);
+    Pass1info_read(pass1info,fp,filename);
+    fclose(fp);
+  }
+
+  FREE(copy);
+  return;
+}
+
+
 int
 main (int argc, char *argv[]) {
   int nchars1 = 0, nchars2 = 0;
@@ -4030,6 +4358,10 @@ main (int argc, char *argv[]) {
   int nextchar = '\0';
   double runtime;
 
+  Univcoordlist_T donor_startpoints, donor_partners, acceptor_startpoints, acceptor_partners,
+    antidonor_startpoints, antidonor_partners, antiacceptor_startpoints, antiacceptor_partners;
+  Univcoordtable_T indel_table;
+
 #ifdef HAVE_PTHREAD
   int ret;
   pthread_attr_t thread_attr_join;
@@ -4060,6 +4392,9 @@ main (int argc, char *argv[]) {
   }
 
   check_compiler_assumptions();
+  Access_set_nreaders(load_nthreads);
+  Access_set_snapshot_dir(snapshot_dir);
+  Indexdb_use_bitpack_positions(bitpack_positions_p);
 
   if (exception_raise_p == false) {
     fprintf(stderr,"Allowing signals and exceptions to pass through.  If using shared memory, need to remove segments manually.\n");
@@ -4127,6 +4462,10 @@ main (int argc, char *argv[]) {
 #endif
 			  interleavedp,read_files_command,files,nfiles,input_buffer_size,
 			  part_modulus,part_interval);
+  if (two_pass_p == true && pass1_read_files == NULL) {
+    /* Applies only to pass 1, since pass 2 gets a new inbuffer */
+    Inbuffer_set_sample(inbuffer,pass1_sample_fraction,pass1_max_reads);
+  }
 
   if ((nread = Inbuffer_fill_init(inbuffer)) > 1) {
     multiple_sequences_p = true;
@@ -4256,24 +4595,30 @@ main (int argc, char *argv[]) {
 
   stopwatch = Stopwatch_new();
 
-  if (two_pass_p == true) {
+  if (two_pass_p == true && pass1_read_files != NULL) {
+    /* Pass 1 was run previously, possibly in several parts */
+    donor_table = Univcoordtableuint_new(/*hint*/500000);
+    acceptor_table = Univcoordtableuint_new(/*hint*/500000);
+    antidonor_table = Univcoordtableuint_new(/*hint*/500000);
+    antiacceptor_table = Univcoordtableuint_new(/*hint*/500000);
+
+    pass1info = Pass1info_new();
+    read_pass1_files(pass1_read_files);
+
+  } else if (two_pass_p == true) {
     /* Pass 1 */
 
     Stopwatch_start(stopwatch);
     outbuffer = Outbuffer_new(output_buffer_size,nread);
     Inbuffer_set_outbuffer(inbuffer,outbuffer);
 
-#ifdef HAVE_PTHREAD
-    pthread_mutex_init(&pass1_lock,NULL);
-#endif
-
     pass = PASS1;		/* Causes worker or single thread to run process_request_pass1 */
     fprintf(stderr,"Starting pass 1.  Learning defect rate, splice sites, introns, and insert lengths (alignments are being analyzed internally, without any output)\n");
     donor_table = Univcoordtableuint_new(/*hint*/500000);
     acceptor_table = Univcoordtableuint_new(/*hint*/500000);
     antidonor_table = Univcoordtableuint_new(/*hint*/500000);
     antiacceptor_table = Univcoordtableuint_new(/*hint*/500000);
-    indel_table = Univcoordtable_new(/*hint*/500000);
+    pass1infos = (Pass1info_T *) CALLOC(nthreads > 0 ? nthreads : 1,sizeof(Pass1info_T));
     
 #if !defined(HAVE_PTHREAD)
     /* Serial version */
@@ -4327,54 +4672,27 @@ main (int argc, char *argv[]) {
     fprintf(stderr,"Pass 1: Processed %u queries in %.2f seconds (%.2f queries/sec)\n",
 	  nread,runtime,(double) nread/runtime);
 
-#ifdef HAVE_PTHREAD
-    pthread_mutex_destroy(&pass1_lock);
-#endif
-
-    defect_rate = (double) total_mismatches/(double) total_querylength;
-    fprintf(stderr,"%llu mismatches/%llu aligned bp => %f defect rate\n",
-	    total_mismatches,total_querylength,defect_rate);
-    if (knownsplicing != NULL) {
-      Knownsplicing_free(&knownsplicing);
-    }
-    knownsplicing = Knownsplicing_new(donor_startpoints,donor_partners,
-				      acceptor_startpoints,acceptor_partners,
-				      antidonor_startpoints,antidonor_partners,
-				      antiacceptor_startpoints,antiacceptor_partners,
-				      donor_table,acceptor_table,antidonor_table,antiacceptor_table,
-				      genomelength,dump_splices_fp,chromosome_iit,chromosome_ef64,
-				      /*intron_level_p*/true);
-    if (dump_splices_fp != NULL) {
-      fclose(dump_splices_fp);
-    }
+    /* Combine the evidence from each thread */
+    pass1info = Pass1info_merge(pass1infos,nthreads > 0 ? nthreads : 1,nthreads);
+    FREE(pass1infos);
 
-    knownindels = Knownindels_new(indel_table,genomelength,dump_indels_fp,
-				  chromosome_iit,chromosome_ef64);
-    if (dump_indels_fp != NULL) {
-      fclose(dump_indels_fp);
+    if (pass1_sample_fraction < 1.0 || pass1_max_reads > 0 || pass1_saturation > 0.0) {
+      report_pass1_sample(nread,Inbuffer_ninput(inbuffer),Inbuffer_stoppedp(inbuffer));
     }
 
-    Pathpair_analyze_insertlengths(&expected_pairlength,&pairlength_deviation,insertlengths);
-    max_insertlength = (int) (expected_pairlength + 5*pairlength_deviation);
-
-    /* Stage3hr_pass2_setup(expected_pairlength,pairlength_deviation); */
-    /* Pathpair_pass2_setup(expected_pairlength,pairlength_deviation); */
-    Altsplice_setup(max_insertlength);
-    Stage1hr_paired_pass2_setup(max_insertlength,shortsplicedist);
-    Uintlist_free(&insertlengths);
-
-    Univcoordtable_free(&indel_table);
-
-    Univcoordtableuint_free(&antiacceptor_table);
-    Univcoordtableuint_free(&antidonor_table);
-    Univcoordtableuint_free(&acceptor_table);
-    Univcoordtableuint_free(&donor_table);
-
     Outbuffer_free(&outbuffer);
     Inbuffer_free(&inbuffer);
-    pass = PASS2;
 
-    /* Reset inbuffer and outbuffer for pass 2 */
+    if (pass1_dump_file != NULL) {
+      /* Evidence is merged and filtered by a later run with --pass1-read */
+      write_pass1_file(pass1_dump_file);
+
+      Stopwatch_free(&stopwatch);
+      worker_cleanup();
+      return 0;
+    }
+
+    /* Reset inbuffer for pass 2 */
     fastq_format_p = open_input_streams_parser(&nextchar,&nchars1,&nchars2,&paired_end_p,
 					       &files,&nfiles,&input,&input2,
 #ifdef HAVE_ZLIB
@@ -4402,6 +4720,51 @@ main (int argc, char *argv[]) {
       multiple_sequences_p = false;
     }
   }
+
+  if (two_pass_p == true) {
+    defect_rate = (double) Pass1info_total_mismatches(pass1info)/(double) Pass1info_total_querylength(pass1info);
+    fprintf(stderr,"%llu mismatches/%llu aligned bp => %f defect rate\n",
+	    Pass1info_total_mismatches(pass1info),Pass1info_total_querylength(pass1info),defect_rate);
+    if (knownsplicing != NULL) {
+      Knownsplicing_free(&knownsplicing);
+    }
+    /* Knownsplicing_new frees the lists */
+    Pass1info_transfer_introns(&donor_startpoints,&donor_partners,&acceptor_startpoints,&acceptor_partners,
+			       &antidonor_startpoints,&antidonor_partners,&antiacceptor_startpoints,&antiacceptor_partners,
+			       pass1info);
+    knownsplicing = Knownsplicing_new(donor_startpoints,donor_partners,acceptor_startpoints,acceptor_partners,
+				      antidonor_startpoints,antidonor_partners,antiacceptor_startpoints,antiacceptor_partners,
+				      donor_table,acceptor_table,antidonor_table,antiacceptor_table,
+				      genomelength,dump_splices_fp,chromosome_iit,chromosome_ef64,
+				      /*intron_level_p*/true);
+    if (dump_splices_fp != NULL) {
+      fclose(dump_splices_fp);
+    }
+
+    indel_table = Pass1info_transfer_indel_table(pass1info);
+    knownindels = Knownindels_new(indel_table,genomelength,dump_indels_fp,
+				  chromosome_iit,chromosome_ef64);
+    if (dump_indels_fp != NULL) {
+      fclose(dump_indels_fp);
+    }
+
+    Pathpair_analyze_insertlengths(&expected_pairlength,&pairlength_deviation,Pass1info_insertlengths(pass1info));
+    max_insertlength = (int) (expected_pairlength + 5*pairlength_deviation);
+
+    /* Stage3hr_pass2_setup(expected_pairlength,pairlength_deviation); */
+    /* Pathpair_pass2_setup(expected_pairlength,pairlength_deviation); */
+    Altsplice_setup(max_insertlength);
+    Stage1hr_paired_pass2_setup(max_insertlength,shortsplicedist);
+    Univcoordtable_free(&indel_table); /* Knownindels_new frees the values */
+    Pass1info_free(&pass1info);
+
+    Univcoordtableuint_free(&antiacceptor_table);
+    Univcoordtableuint_free(&antidonor_table);
+    Univcoordtableuint_free(&acceptor_table);
+    Univcoordtableuint_free(&donor_table);
+
+    pass = PASS2;
+  }
     
 
   /* Pass 2 */
@@ -4411,7 +4774,20 @@ main (int argc, char *argv[]) {
 		   sam_read_group_library,sam_read_group_platform);
   Outbuffer_setup(any_circular_p,quiet_if_excessive_p,
 		  paired_end_p,appendp,output_file,
-		  split_simple_p,split_output_root,failedinput_root);
+		  split_simple_p,split_output_root,failedinput_root,async_output);
+  if (part_index_file != NULL) {
+    Outbuffer_part_index_open(part_index_file);
+  }
+
+  if (live_splicing_interval > 0) {
+    livesplicing = Livesplicing_new(/*nworkers*/nthreads > 0 ? nthreads : 1,live_splicing_interval,
+				    genomelength,chromosome_iit,chromosome_ef64);
+  }
+
+  if (latency_report_p == true) {
+    latencies = (Latency_T *) CALLOC(nthreads > 0 ? nthreads : 1,sizeof(Latency_T));
+  }
+  Latency_setup(slow_reads_file,slow_read_threshold,invert_first_p,invert_second_p);
 
   Stopwatch_start(stopwatch);
   outbuffer = Outbuffer_new(output_buffer_size,nread);
@@ -4491,6 +4867,24 @@ main (int argc, char *argv[]) {
   
   Stopwatch_free(&stopwatch);
 
+  if (livesplicing != NULL) {
+    Livesplicing_free(&livesplicing);
+  }
+
+  if (latencies != NULL) {
+    /* Only latencies[0] is used if the program ran in a single thread */
+    for (worker_id = 1; worker_id < nthreads; worker_id++) {
+      if (latencies[worker_id] != NULL) {
+	Latency_merge(latencies[0],latencies[worker_id]);
+	Latency_free(&(latencies[worker_id]));
+      }
+    }
+    Latency_print(stderr,latencies[0]);
+    Latency_free(&(latencies[0]));
+    FREE(latencies);
+  }
+  Latency_cleanup();
+
   Outbuffer_free(&outbuffer);
   Inbuffer_free(&inbuffer);
 
@@ -4521,10 +4915,25 @@ Usage: gsnap [OPTIONS...] <FASTA file>, or\n\
   -d, --db=STRING                Genome database\n\
   --two-pass                     Two-pass mode, in which the sequences are processed first to identify splice sites\n\
                                    and introns, and then aligned using this splicing information\n\
+  --pass1-dump=FILE              Run only pass 1 of --two-pass mode, and write the unfiltered splicing, indel,\n\
+                                   and insert length evidence to the given file.  Useful with --part, so that\n\
+                                   the evidence from all parts can be combined with --pass1-read\n\
+  --pass1-read=FILE[,FILE...]    Skip pass 1 of --two-pass mode, and instead sum the evidence in the given\n\
+                                   files from --pass1-dump before aligning\n\
+  --pass1-sample=FLOAT           Run pass 1 of --two-pass mode on only this fraction of the reads, taken at\n\
+                                   evenly spaced intervals through the input (default 1.0)\n\
+  --pass1-max-reads=INT          Stop pass 1 of --two-pass mode after this many reads (default 0, no limit)\n\
+  --pass1-saturation=FLOAT       Stop pass 1 of --two-pass mode when fewer than this many new introns are found\n\
+                                   per 1000 reads (default 0.0, never).  Checked by each thread over windows of\n\
+                                   %d reads.  With any of these sampling options, a report compares the introns\n\
+                                   found with an estimate of those a full pass would find\n\
+  --live-splicing=INT            Single-pass alternative to --two-pass.  Introns found in the alignments are used\n\
+                                   for later reads, first after this many reads, and then after doubling numbers\n\
+                                   of further reads (default 0, not used)\n\
   --use-localdb=INT              Whether to use the local suffix arrays, which help with finding extensions to the ends\n\
                                    of alignments in the presence of splicing or indels (0=no, 1=yes if available (default))\n\
 \n\
-");
+",PASS1_SATURATION_WINDOW);
 
   /* Transcriptome-guided options */
   fprintf(stdout,"Transcriptome-guided options (optional)\n");
@@ -4553,6 +4962,9 @@ Usage: gsnap [OPTIONS...] <FASTA file>, or\n\
   -q, --part=INT/INT             Process only the i-th out of every n sequences\n\
                                    e.g., 0/100 or 99/100 (useful for distributing jobs\n\
                                    to a computer farm).\n\
+  --part-index=FILE              Write the input index and byte length of each output record to the given file,\n\
+                                   so that the outputs from several --part runs can be combined in input\n\
+                                   order by merge_parts.  Implies --ordered.  Not allowed with --split-output\n\
 ");
   fprintf(stdout,"\
   --input-buffer-size=INT        Size of input buffer (program reads this many sequences\n\
@@ -4654,7 +5066,15 @@ is still designed to be fast.\n\
   --unload-shared-memory         Unload files indicated by --batch mode into shared memory, or allow them\n\
                                    to be unloaded when existing GMAP/GSNAP processes on this node are finished\n\
                                    with them.  Ignore any input files.\n\
-");
+  --snapshot-dir=STRING          Share allocated memory through snapshots in this directory, such as\n\
+                                   /dev/shm, instead of SysV shared memory.  The first process copies\n\
+                                   each file into a snapshot, and later ones map it.  Snapshots persist\n\
+                                   until removed by gmap_snapshot evict.  Implies --use-shared-memory=1\n\
+  --load-threads=INT             Number of threads reading each allocated index file (default %d)\n\
+  --bitpack-positions            Use bitpacked genomic positions, made by gmapindex -c, which take\n\
+                                   less memory but are decoded for each lookup.  Not used with\n\
+                                   --use-shared-memory=1\n\
+",ACCESS_DEFAULT_NREADERS);
 
   fprintf(stdout,"\
   -m, --max-mismatches=FLOAT     Maximum number of mismatches allowed (if not specified, then\n\
@@ -4703,6 +5123,9 @@ is still designed to be fast.\n\
                                    location of genome index files specified using -D and -d)\n \
   -v, --use-snps=STRING          Use database containing known SNPs (in <STRING>.iit, built\n\
                                    previously using snpindex) for tolerance to SNPs\n\
+  --sparse-snps                  With --use-snps, keep only the SNP positions and alleles in memory,\n\
+                                   instead of a second copy of the genome.  SNPs then do not create\n\
+                                   new splice sites\n\
   --cmetdir=STRING               Directory for methylcytosine index files (created using cmetindex)\n\
                                    (default is location of genome index files specified using -D, -V, and -d)\n\
   --atoidir=STRING               Directory for A-to-I RNA editing index files (created using atoiindex)\n\
@@ -4886,6 +5309,13 @@ is still designed to be fast.\n\
                                     in addition to the output in the .nomapping file.\n\
   --append-output                When --split-output or --failed-input is given, this flag will append output\n\
                                     to the existing files.  Otherwise, the default is to create new files.\n\
+  --async-output=STRING          Write output files in the background, in 1 MB blocks, using uring (io_uring,\n\
+                                    or threads if not available) or threads.  Does not apply to stdout\n\
+  --latency-report               At the end, print percentiles of the time per read, overall, for stage 1\n\
+                                    and output separately, and by the last stage 1 method needed\n\
+  --slow-reads=STRING            Print reads that take longer than --slow-read-threshold to the given\n\
+                                    file, in FASTA format, with their times and last method in the header\n\
+  --slow-read-threshold=FLOAT    Time in seconds for --slow-reads (default 1.0)\n\
   --order-among-best=STRING      Among alignments tied with the best score, order those alignments in this order.\n\
                                     Allowed values: genomic, random (default)\n\
 ");
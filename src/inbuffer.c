@@ -95,6 +95,15 @@ struct T {
 
   unsigned int part_modulus;
   unsigned int part_interval;
+
+#if defined(GSNAP) || defined(GFILTER)
+  /* Sampling, for pass 1 of --two-pass */
+  double sample_fraction;
+  unsigned int sample_maxreads;	/* 0 means no limit */
+  unsigned int nconsidered;	/* Reads in this part, before sampling */
+  unsigned int nsampled;
+  bool stopp;			/* No more reads are to be read */
+#endif
 };
 
 
@@ -225,9 +234,116 @@ Inbuffer_new (int nextchar, FILE *input,
   new->part_modulus = part_modulus;
   new->part_interval = part_interval;
 
+#if defined(GSNAP) || defined(GFILTER)
+  new->sample_fraction = 1.0;
+  new->sample_maxreads = 0;
+  new->nconsidered = 0;
+  new->nsampled = 0;
+  new->stopp = false;
+#endif
+
   return new;
 }
 
+#if defined(GSNAP) || defined(GFILTER)
+/* Needs to be called before Inbuffer_fill_init.  Reads are taken at
+   evenly spaced intervals through the input (or through this part,
+   with --part), so the sample is stratified by position in the input.
+   Reading stops after maxreads reads are taken, if maxreads > 0. */
+void
+Inbuffer_set_sample (T this, double fraction, unsigned int maxreads) {
+  this->sample_fraction = fraction;
+  this->sample_maxreads = maxreads;
+  return;
+}
+
+/* May be called by a worker thread.  Requests already in the buffer
+   are still given out */
+void
+Inbuffer_stop (T this) {
+#if defined(HAVE_PTHREAD)
+  pthread_mutex_lock(&this->lock);
+#endif
+  this->stopp = true;
+#if defined(HAVE_PTHREAD)
+  pthread_mutex_unlock(&this->lock);
+#endif
+  return;
+}
+
+bool
+Inbuffer_stoppedp (T this) {
+  return this->stopp;
+}
+
+/* Number of reads in the input (or this part), or as far as the
+   input was read */
+unsigned int
+Inbuffer_ninput (T this) {
+  return this->nconsidered;
+}
+
+/* When reading stops early, the Shortread procedures never reach the
+   end of the input, which is where they close it */
+static void
+close_input (T this) {
+  if (this->input != NULL) {
+    if (this->read_files_command != NULL) {
+      pclose(this->input);
+    } else {
+      fclose(this->input);
+    }
+    this->input = (FILE *) NULL;
+  }
+  if (this->input2 != NULL) {
+    if (this->read_files_command != NULL) {
+      pclose(this->input2);
+    } else {
+      fclose(this->input2);
+    }
+    this->input2 = (FILE *) NULL;
+  }
+
+#ifdef HAVE_ZLIB
+  if (this->gzipped != NULL) {
+    gzclose(this->gzipped);
+    this->gzipped = (gzFile) NULL;
+  }
+  if (this->gzipped2 != NULL) {
+    gzclose(this->gzipped2);
+    this->gzipped2 = (gzFile) NULL;
+  }
+#endif
+
+#ifdef HAVE_BZLIB
+  if (this->bzipped != NULL) {
+    Bzip2_free(&this->bzipped);
+  }
+  if (this->bzipped2 != NULL) {
+    Bzip2_free(&this->bzipped2);
+  }
+#endif
+
+  return;
+}
+
+static bool
+skip_input_p (T this) {
+  unsigned int n;
+
+  if (this->inputid % this->part_interval != this->part_modulus) {
+    return true;
+  } else if (this->sample_fraction >= 1.0) {
+    return false;
+  } else {
+    /* Take the read if the running total of the fraction crosses an integer */
+    n = this->nconsidered;
+    return ((unsigned long long) ((double) (n + 1)*this->sample_fraction) ==
+	    (unsigned long long) ((double) n*this->sample_fraction)) ? true : false;
+  }
+}
+#endif
+
 void
 Inbuffer_set_outbuffer (T this, Outbuffer_T outbuffer) {
   this->outbuffer = outbuffer;
@@ -312,7 +428,7 @@ fill_buffer (T this) {
   int nchars1 = 0, nchars2 = 0;		/* Returned only because MPI master needs it.  Doesn't need to be saved as a field in Inbuffer_T. */
 
   /* fprintf(stderr,"Entered fill_buffer\n"); */
-  while (nread < this->nspaces &&
+  while (nread < this->nspaces && this->stopp == false &&
 	 (queryseq1 = Shortread_read(&this->nextchar,&nchars1,&nchars2,&queryseq2,
 				     &this->input,&this->input2,
 #ifdef HAVE_ZLIB
@@ -323,7 +439,7 @@ fill_buffer (T this) {
 #endif
 				     this->interleavedp,
 				     this->read_files_command,&this->files,&this->nfiles,single_cell_p,
-				     skipp = (this->inputid % this->part_interval != this->part_modulus))) != NULL) {
+				     skipp = skip_input_p(this))) != NULL) {
     if (skipp) {
 #if 0
       /* Shortread procedures won't allocate in this situation */
@@ -348,12 +464,22 @@ fill_buffer (T this) {
       }
       
     } else {
-      this->buffer[nread++] = Request_new(this->requestid++,queryseq1,queryseq2);
+      this->buffer[nread++] = Request_new(this->requestid++,this->inputid,queryseq1,queryseq2);
+      if (++this->nsampled == this->sample_maxreads) {
+	this->stopp = true;
+      }
+    }
+    if (this->inputid % this->part_interval == this->part_modulus) {
+      this->nconsidered++;
     }
     this->inputid++;
   }
   /* fprintf(stderr,"Read %d reads\n",nread); */
 
+  if (this->stopp == true) {
+    close_input(this);
+  }
+
   this->nleft = nread;
   this->ptr = 0;
 
@@ -68,6 +68,17 @@ Inbuffer_new (int nextchar, FILE *input,
 extern void
 Inbuffer_set_outbuffer (T this, Outbuffer_T outbuffer);
 
+#if defined(GSNAP) || defined(GFILTER)
+extern void
+Inbuffer_set_sample (T this, double fraction, unsigned int maxreads);
+extern void
+Inbuffer_stop (T this);
+extern bool
+Inbuffer_stoppedp (T this);
+extern unsigned int
+Inbuffer_ninput (T this);
+#endif
+
 extern void
 Inbuffer_free (T *old);
 
@@ -68,6 +68,7 @@ static char rcsid[] = "$Id: indexdb-write.c 226315 2023-02-28 18:22:20Z twu $";
 #include "bitpack64-write.h"
 #include "bitpack64-access.h"
 #include "bitpack64-incr.h"
+#include "bitpack64-positions.h"
 
 
 #define MAX_BITPACK_BLOCKSIZE 64
@@ -2762,6 +2763,330 @@ Indexdb_write_positions (char *positionsfile_high, char *positionsfile_low, char
 
 
 
+#ifndef PMAP
+/* Writes the bitpacked format from an existing positions file with
+   4-byte entries.  The positions file is kept, since utilities such
+   as cmetindex and atoiindex read it directly. */
+void
+Indexdb_write_positions_bitpack (char *positionsfile, char *offsetsmetafile, char *offsetsstrmfile,
+				 int index1part) {
+  FILE *fp;
+  char *metafile, *strmfile, *comma1, *comma2;
+  int offsetsmeta_fd, offsetsstrm_fd, positions_fd;
+  size_t offsetsmeta_len, offsetsstrm_len, positions_len;
+  UINT4 *offsetsmeta, *offsetsstrm, *positions, *strm;
+  UINT8 *startbits, *meta;
+  size_t nmeta, nwords;
+  Oligospace_T oligospace, oligo;
+  Positionsptr_T totalcounts, ptr0, end0;
+#ifndef HAVE_MMAP
+  Access_T offsetsmeta_access, offsetsstrm_access, positions_access;
+#endif
+  double seconds;
+
+#ifdef HAVE_MMAP
+  offsetsmeta = (UINT4 *) Access_mmap(&offsetsmeta_fd,&offsetsmeta_len,&seconds,offsetsmetafile,/*randomp*/false);
+  offsetsstrm = (UINT4 *) Access_mmap(&offsetsstrm_fd,&offsetsstrm_len,&seconds,offsetsstrmfile,/*randomp*/false);
+  positions = (UINT4 *) Access_mmap(&positions_fd,&positions_len,&seconds,positionsfile,/*randomp*/false);
+#else
+  offsetsmeta = (UINT4 *) Access_allocate_private(&offsetsmeta_access,&offsetsmeta_len,&seconds,offsetsmetafile,sizeof(UINT4));
+  offsetsstrm = (UINT4 *) Access_allocate_private(&offsetsstrm_access,&offsetsstrm_len,&seconds,offsetsstrmfile,sizeof(UINT4));
+  positions = (UINT4 *) Access_allocate_private(&positions_access,&positions_len,&seconds,positionsfile,sizeof(UINT4));
+#endif
+
+  oligospace = power(4,index1part);
+  totalcounts = Bitpack64_read_one(oligospace,offsetsmeta,offsetsstrm);
+  if (positions_len != (size_t) totalcounts*sizeof(UINT4)) {
+    fprintf(stderr,"Expected %zu bytes in %s, but found %zu\n",
+	    (size_t) totalcounts*sizeof(UINT4),positionsfile,positions_len);
+    exit(9);
+  }
+
+  fprintf(stderr,"Bitpacking %u positions from %s...",totalcounts,positionsfile);
+  startbits = (UINT8 *) CALLOC(totalcounts/64 + 1,sizeof(UINT8));
+  ptr0 = 0;
+  for (oligo = 0; oligo < oligospace; oligo++) {
+    if ((end0 = Bitpack64_read_one(oligo+1,offsetsmeta,offsetsstrm)) > ptr0) {
+      startbits[ptr0/64] |= ((UINT8) 1 << (ptr0 % 64));
+    }
+    ptr0 = end0;
+  }
+
+  strm = Bitpack64_positions_encode(&meta,&nmeta,&nwords,positions,startbits,totalcounts);
+  FREE(startbits);
+
+  metafile = (char *) CALLOC(strlen(positionsfile)+strlen(POSITIONS_BITPACK_META_SUFFIX)+1,sizeof(char));
+  sprintf(metafile,"%s%s",positionsfile,POSITIONS_BITPACK_META_SUFFIX);
+  strmfile = (char *) CALLOC(strlen(positionsfile)+strlen(POSITIONS_BITPACK_STRM_SUFFIX)+1,sizeof(char));
+  sprintf(strmfile,"%s%s",positionsfile,POSITIONS_BITPACK_STRM_SUFFIX);
+
+  if ((fp = FOPEN_WRITE_BINARY(metafile)) == NULL) {
+    fprintf(stderr,"Can't open file %s\n",metafile);
+    exit(9);
+  }
+  FWRITE_UINT8S(meta,nmeta,fp);
+  fclose(fp);
+
+  if ((fp = FOPEN_WRITE_BINARY(strmfile)) == NULL) {
+    fprintf(stderr,"Can't open file %s\n",strmfile);
+    exit(9);
+  }
+  FWRITE_UINTS(strm,nwords,fp);
+  fclose(fp);
+
+  comma1 = Genomicpos_commafmt(nmeta*sizeof(UINT8) + nwords*sizeof(UINT4));
+  comma2 = Genomicpos_commafmt(positions_len);
+  fprintf(stderr,"done (%s bytes, vs %s bytes)\n",comma1,comma2);
+  FREE(comma2);
+  FREE(comma1);
+
+  FREE(strmfile);
+  FREE(metafile);
+  FREE(strm);
+  FREE(meta);
+
+#ifdef HAVE_MMAP
+  munmap((void *) positions,positions_len);
+  close(positions_fd);
+  munmap((void *) offsetsstrm,offsetsstrm_len);
+  close(offsetsstrm_fd);
+  munmap((void *) offsetsmeta,offsetsmeta_len);
+  close(offsetsmeta_fd);
+#else
+  FREE_KEEP(positions);
+  FREE_KEEP(offsetsstrm);
+  FREE_KEEP(offsetsmeta);
+#endif
+
+  return;
+}
+#endif
+
+
+#ifndef PMAP
+static char *
+combined_filename (char *destdir, char *fileroot, char *idx_filesuffix, char *index1info_ptr) {
+  char *filename;
+
+  filename = (char *) CALLOC(strlen(destdir)+strlen("/")+strlen(fileroot)+strlen(".")+
+			     strlen(idx_filesuffix)+strlen(index1info_ptr)+1,sizeof(char));
+  sprintf(filename,"%s/%s.%s%s",destdir,fileroot,idx_filesuffix,index1info_ptr);
+  return filename;
+}
+
+/* Writes a single index for both conversions of cmetindex (metct and
+   metga) or atoiindex (a2iag and a2itc), from the separate indexes
+   already in destdir.  A k-mer can be in both only if its bases are
+   unchanged by both conversions (see Indexdb_combined_group).  Its
+   positions are stored as those only in the first conversion, those
+   in both, and those only in the second, each sorted, and the first
+   two counts go in the splits file.  The offsets are then shared,
+   and positions in both are stored once.  Requires 4-byte
+   positions. */
+void
+Indexdb_write_combined (char *destdir, char *fileroot, Indexdb_filenames_T ifilenames,
+			char *idx_filesuffix1, char *idx_filesuffix2, char *combined_filesuffix,
+			int index1part, int shared_xor) {
+  FILE *positions_fp, *fp;
+  char *offsetsmetafile1, *offsetsstrmfile1, *positionsfile1,
+    *offsetsmetafile2, *offsetsstrmfile2, *positionsfile2,
+    *offsetsmetafile, *offsetsstrmfile, *positionsfile, *splitsfile, *comma1, *comma2;
+  int offsetsmeta1_fd, offsetsstrm1_fd, positions1_fd, offsetsmeta2_fd, offsetsstrm2_fd, positions2_fd;
+  size_t offsetsmeta1_len, offsetsstrm1_len, positions1_len, offsetsmeta2_len, offsetsstrm2_len, positions2_len;
+  UINT4 *offsetsmeta1, *offsetsstrm1, *positions1, *offsetsmeta2, *offsetsstrm2, *positions2;
+  UINT4 offsets1[MAX_BITPACK_BLOCKSIZE+1], offsets2[MAX_BITPACK_BLOCKSIZE+1];
+  UINT4 *splits, *first, *both, *second, *p1, *end1, *p2, *end2;
+  UINT4 n1, n2, nfirst, nboth, nsecond, increment;
+  Oligospace_T oligospace, bmerspace, oligoi, oligo, bmer, rank;
+  char *packsizes;
+  UINT4 **bitpacks;
+  int new_packsize, group, ii;
+  size_t total, nshared;
+#ifndef HAVE_MMAP
+  Access_T offsetsmeta1_access, offsetsstrm1_access, positions1_access,
+    offsetsmeta2_access, offsetsstrm2_access, positions2_access;
+#endif
+  double seconds;
+
+  offsetsmetafile1 = combined_filename(destdir,fileroot,idx_filesuffix1,ifilenames->pointers_index1info_ptr);
+  offsetsstrmfile1 = combined_filename(destdir,fileroot,idx_filesuffix1,ifilenames->offsets_index1info_ptr);
+  positionsfile1 = combined_filename(destdir,fileroot,idx_filesuffix1,ifilenames->positions_index1info_ptr);
+  offsetsmetafile2 = combined_filename(destdir,fileroot,idx_filesuffix2,ifilenames->pointers_index1info_ptr);
+  offsetsstrmfile2 = combined_filename(destdir,fileroot,idx_filesuffix2,ifilenames->offsets_index1info_ptr);
+  positionsfile2 = combined_filename(destdir,fileroot,idx_filesuffix2,ifilenames->positions_index1info_ptr);
+  offsetsmetafile = combined_filename(destdir,fileroot,combined_filesuffix,ifilenames->pointers_index1info_ptr);
+  offsetsstrmfile = combined_filename(destdir,fileroot,combined_filesuffix,ifilenames->offsets_index1info_ptr);
+  positionsfile = combined_filename(destdir,fileroot,combined_filesuffix,ifilenames->positions_index1info_ptr);
+  splitsfile = (char *) CALLOC(strlen(positionsfile)+strlen(COMBINED_SPLITS_SUFFIX)+1,sizeof(char));
+  sprintf(splitsfile,"%s%s",positionsfile,COMBINED_SPLITS_SUFFIX);
+
+#ifdef HAVE_MMAP
+  offsetsmeta1 = (UINT4 *) Access_mmap(&offsetsmeta1_fd,&offsetsmeta1_len,&seconds,offsetsmetafile1,/*randomp*/false);
+  offsetsstrm1 = (UINT4 *) Access_mmap(&offsetsstrm1_fd,&offsetsstrm1_len,&seconds,offsetsstrmfile1,/*randomp*/false);
+  positions1 = (UINT4 *) Access_mmap(&positions1_fd,&positions1_len,&seconds,positionsfile1,/*randomp*/false);
+  offsetsmeta2 = (UINT4 *) Access_mmap(&offsetsmeta2_fd,&offsetsmeta2_len,&seconds,offsetsmetafile2,/*randomp*/false);
+  offsetsstrm2 = (UINT4 *) Access_mmap(&offsetsstrm2_fd,&offsetsstrm2_len,&seconds,offsetsstrmfile2,/*randomp*/false);
+  positions2 = (UINT4 *) Access_mmap(&positions2_fd,&positions2_len,&seconds,positionsfile2,/*randomp*/false);
+#else
+  offsetsmeta1 = (UINT4 *) Access_allocate_private(&offsetsmeta1_access,&offsetsmeta1_len,&seconds,offsetsmetafile1,sizeof(UINT4));
+  offsetsstrm1 = (UINT4 *) Access_allocate_private(&offsetsstrm1_access,&offsetsstrm1_len,&seconds,offsetsstrmfile1,sizeof(UINT4));
+  positions1 = (UINT4 *) Access_allocate_private(&positions1_access,&positions1_len,&seconds,positionsfile1,sizeof(UINT4));
+  offsetsmeta2 = (UINT4 *) Access_allocate_private(&offsetsmeta2_access,&offsetsmeta2_len,&seconds,offsetsmetafile2,sizeof(UINT4));
+  offsetsstrm2 = (UINT4 *) Access_allocate_private(&offsetsstrm2_access,&offsetsstrm2_len,&seconds,offsetsstrmfile2,sizeof(UINT4));
+  positions2 = (UINT4 *) Access_allocate_private(&positions2_access,&positions2_len,&seconds,positionsfile2,sizeof(UINT4));
+#endif
+
+  fprintf(stderr,"Combining %s and %s into %s...",idx_filesuffix1,idx_filesuffix2,positionsfile);
+  if ((positions_fp = FOPEN_WRITE_BINARY(positionsfile)) == NULL) {
+    fprintf(stderr,"Can't open file %s\n",positionsfile);
+    exit(9);
+  }
+
+  oligospace = power(4,index1part);
+  nshared = (size_t) 1 << index1part;
+  splits = (UINT4 *) CALLOC(COMBINED_SPLITS_HEADER + 2*nshared,sizeof(UINT4));
+  splits[0] = (UINT4) shared_xor;
+  splits[1] = (UINT4) index1part;
+  splits[2] = Bitpack64_read_one(oligospace,offsetsmeta1,offsetsstrm1);
+  splits[3] = Bitpack64_read_one(oligospace,offsetsmeta2,offsetsstrm2);
+
+  bmerspace = oligospace/MAX_BITPACK_BLOCKSIZE;
+  packsizes = (char *) CALLOC(bmerspace,sizeof(char));
+  bitpacks = (UINT4 **) CALLOC(bmerspace,sizeof(UINT4 *));
+
+  total = 0;
+  for (oligoi = 0; oligoi < oligospace; oligoi += MAX_BITPACK_BLOCKSIZE) {
+    Bitpack64_block_offsets(offsets1,oligoi,offsetsmeta1,offsetsstrm1);
+    Bitpack64_block_offsets(offsets2,oligoi,offsetsmeta2,offsetsstrm2);
+    for (ii = 0; ii < MAX_BITPACK_BLOCKSIZE; ii++) {
+      oligo = oligoi + ii;
+      n1 = offsets1[ii+1] - offsets1[ii];
+      n2 = offsets2[ii+1] - offsets2[ii];
+      if (n1 == 0 && n2 == 0) {
+	continue;
+      }
+
+      group = Indexdb_combined_group(&rank,oligo,index1part,shared_xor);
+      if ((n1 > 0 && group == COMBINED_SECOND) || (n2 > 0 && group == COMBINED_FIRST)) {
+	fprintf(stderr,"\nk-mer %llu has positions in %s, which is not expected for this conversion\n",
+		(unsigned long long) oligo,n1 > 0 ? idx_filesuffix1 : idx_filesuffix2);
+	exit(9);
+      }
+
+      if (group != COMBINED_SHARED) {
+	increment = n1 + n2;
+	FWRITE_UINTS(n1 > 0 ? &(positions1[offsets1[ii]]) : &(positions2[offsets2[ii]]),increment,positions_fp);
+
+      } else {
+	first = (UINT4 *) MALLOC((2*n1 + n2)*sizeof(UINT4));
+	both = &(first[n1]);
+	second = &(first[2*n1]);
+	nfirst = nboth = nsecond = 0;
+	p1 = &(positions1[offsets1[ii]]);
+	end1 = &(positions1[offsets1[ii+1]]);
+	p2 = &(positions2[offsets2[ii]]);
+	end2 = &(positions2[offsets2[ii+1]]);
+	while (p1 < end1 && p2 < end2) {
+	  if (*p1 < *p2) {
+	    first[nfirst++] = *p1++;
+	  } else if (*p2 < *p1) {
+	    second[nsecond++] = *p2++;
+	  } else {
+	    both[nboth++] = *p1++;
+	    p2++;
+	  }
+	}
+	while (p1 < end1) {
+	  first[nfirst++] = *p1++;
+	}
+	while (p2 < end2) {
+	  second[nsecond++] = *p2++;
+	}
+
+	FWRITE_UINTS(first,nfirst,positions_fp);
+	FWRITE_UINTS(both,nboth,positions_fp);
+	FWRITE_UINTS(second,nsecond,positions_fp);
+	splits[COMBINED_SPLITS_HEADER + 2*rank] = nfirst;
+	splits[COMBINED_SPLITS_HEADER + 2*rank + 1] = nboth;
+	increment = nfirst + nboth + nsecond;
+
+	FREE(first);
+      }
+
+      bmer = oligo/MAX_BITPACK_BLOCKSIZE;
+      if ((new_packsize = Bitpack64_access_new_packsize(oligo,/*old_packsize*/(int) packsizes[bmer],
+							bitpacks[bmer],increment)) != (int) packsizes[bmer]) {
+	bitpacks[bmer] = Bitpack64_realloc_multiple((int) packsizes[bmer],new_packsize,bitpacks[bmer]);
+	packsizes[bmer] = (char) new_packsize;
+      }
+      Bitpack64_add_bitpack(oligo,(int) packsizes[bmer],bitpacks[bmer],increment);
+      total += increment;
+    }
+  }
+  fclose(positions_fp);
+
+  Bitpack64_write_differential_bitpacks(offsetsmetafile,offsetsstrmfile,packsizes,bitpacks,oligospace);
+  for (bmer = 0; bmer < bmerspace; bmer++) {
+    FREE(bitpacks[bmer]);
+  }
+  FREE(bitpacks);
+  FREE(packsizes);
+
+  if ((fp = FOPEN_WRITE_BINARY(splitsfile)) == NULL) {
+    fprintf(stderr,"Can't open file %s\n",splitsfile);
+    exit(9);
+  }
+  FWRITE_UINTS(splits,COMBINED_SPLITS_HEADER + 2*nshared,fp);
+  fclose(fp);
+
+  comma1 = Genomicpos_commafmt(total*sizeof(UINT4) + Access_filesize(offsetsmetafile) +
+			       Access_filesize(offsetsstrmfile) + Access_filesize(splitsfile));
+  comma2 = Genomicpos_commafmt(positions1_len + positions2_len +
+			       offsetsmeta1_len + offsetsstrm1_len + offsetsmeta2_len + offsetsstrm2_len);
+  fprintf(stderr,"done (%s bytes, vs %s bytes)\n",comma1,comma2);
+  FREE(comma2);
+  FREE(comma1);
+
+  FREE(splits);
+
+#ifdef HAVE_MMAP
+  munmap((void *) positions2,positions2_len);
+  close(positions2_fd);
+  munmap((void *) offsetsstrm2,offsetsstrm2_len);
+  close(offsetsstrm2_fd);
+  munmap((void *) offsetsmeta2,offsetsmeta2_len);
+  close(offsetsmeta2_fd);
+  munmap((void *) positions1,positions1_len);
+  close(positions1_fd);
+  munmap((void *) offsetsstrm1,offsetsstrm1_len);
+  close(offsetsstrm1_fd);
+  munmap((void *) offsetsmeta1,offsetsmeta1_len);
+  close(offsetsmeta1_fd);
+#else
+  FREE_KEEP(positions2);
+  FREE_KEEP(offsetsstrm2);
+  FREE_KEEP(offsetsmeta2);
+  FREE_KEEP(positions1);
+  FREE_KEEP(offsetsstrm1);
+  FREE_KEEP(offsetsmeta1);
+#endif
+
+  FREE(splitsfile);
+  FREE(positionsfile);
+  FREE(offsetsstrmfile);
+  FREE(offsetsmetafile);
+  FREE(positionsfile2);
+  FREE(offsetsstrmfile2);
+  FREE(offsetsmetafile2);
+  FREE(positionsfile1);
+  FREE(offsetsstrmfile1);
+  FREE(offsetsmetafile1);
+
+  return;
+}
+#endif
+
+
 #ifdef HAVE_64_BIT
 void
 Indexdb_write_positions_huge_offsets (char *positionsfile_high, char *positionsfile_low,
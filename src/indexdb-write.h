@@ -9,6 +9,7 @@
 #include "types.h"		/* For Oligospace_T */
 #include "genomicpos.h"
 #include "iit-read-univ.h"
+#include "indexdb.h"
 
 #ifdef PMAP
 #include "alphabet.h"
@@ -78,6 +79,16 @@ Indexdb_write_positions (char *positionsfile_high, char *positionsfile_low, char
 			 int index1interval, Univcoord_T genomelength, bool genome_lc_p, bool writefilep,
 			 char *fileroot, bool mask_lowercase_p, bool coord_values_8p);
 
+#ifndef PMAP
+extern void
+Indexdb_write_positions_bitpack (char *positionsfile, char *offsetsmetafile, char *offsetsstrmfile,
+				 int index1part);
+extern void
+Indexdb_write_combined (char *destdir, char *fileroot, Indexdb_filenames_T ifilenames,
+			char *idx_filesuffix1, char *idx_filesuffix2, char *combined_filesuffix,
+			int index1part, int shared_xor);
+#endif
+
 #ifdef HAVE_64_BIT
 extern void
 Indexdb_write_positions_huge_offsets (char *positionsfile_high, char *positionsfile_low, char *pagesfile, char *pointersfile, char *offsetsfile,
@@ -56,10 +56,12 @@ static char rcsid[] = "$Id: 55d496a7258d2f55161a3b5c3da984a1712c69e8 $";
 #include "filesuffix.h"
 
 #include "compress.h"
+#include "list.h"
 #include "interval.h"
 #include "complement.h"
 #include "bitpack64-read.h"	/* For Bitpack64_block_offsets */
 #include "bitpack64-readtwo.h"
+#include "bitpack64-positions.h"
 
 #ifdef HAVE_PTHREAD
 #include <pthread.h>		/* sys/types.h already included above */
@@ -150,6 +152,26 @@ Indexdb_setup (Width_T index1part_in) {
 #endif
 
 
+static bool bitpack_positions_p = false;
+#if defined(GSNAP) || defined(GFILTER)
+static bool combined_p = false;	/* Set by Indexdb_new_combined */
+#endif
+
+/* Needs to be called before Indexdb_new_genome */
+void
+Indexdb_use_bitpack_positions (bool bitpack_positions_p_in) {
+#ifdef LARGE_GENOMES
+  if (bitpack_positions_p_in == true) {
+    fprintf(stderr,"Bitpacked positions are not available for large genomes, so ignoring that option\n");
+  }
+  bitpack_positions_p = false;
+#else
+  bitpack_positions_p = bitpack_positions_p_in;
+#endif
+  return;
+}
+
+
 #define T Indexdb_T
 
 
@@ -246,6 +268,35 @@ void
 Indexdb_free (T *old) {
   if (*old) {
 
+    if ((*old)->combined_view != 0) {
+      if ((*old)->combined_owner_p == false) {
+	/* Storage belongs to the other view */
+	FREE(*old);
+	return;
+      }
+      FREE_KEEP((*old)->combined_splits);
+    }
+
+    if ((*old)->positions_bitpack_p == true) {
+      if ((*old)->positionsstrm_access == ALLOCATED_PRIVATE) {
+	FREE_KEEP((*old)->positionsstrm);
+#ifdef HAVE_MMAP
+      } else if ((*old)->positionsstrm_access == MMAPPED) {
+	munmap((void *) (*old)->positionsstrm,(*old)->positionsstrm_len);
+	close((*old)->positionsstrm_fd);
+#endif
+      }
+
+      if ((*old)->positionsmeta_access == ALLOCATED_PRIVATE) {
+	FREE_KEEP((*old)->positionsmeta);
+#ifdef HAVE_MMAP
+      } else if ((*old)->positionsmeta_access == MMAPPED) {
+	munmap((void *) (*old)->positionsmeta,(*old)->positionsmeta_len);
+	close((*old)->positionsmeta_fd);
+#endif
+      }
+    }
+
     if ((*old)->positions_access == ALLOCATED_PRIVATE) {
       FREE_KEEP((*old)->positions);
 
@@ -386,6 +437,43 @@ Indexdb_mean_size (T this, Mode_T mode, Width_T index1part) {
 }
 
 
+/* For combined indexes.  A k-mer is in both conversions only if all
+   of its bases are unchanged by both, A and T for cmet (shared_xor
+   0) or C and G for atoi (shared_xor 1).  Otherwise, it belongs to
+   the first conversion if it has the base that only the first can
+   contain (G for cmet, T for atoi), and to the second if not.  For
+   shared k-mers, *rank is the low bit of each base packed together.
+   Assumes index1part of at most 16. */
+int
+Indexdb_combined_group (Oligospace_T *rank, Oligospace_T oligo, Width_T index1part, int shared_xor) {
+  UINT4 lowbits, high, nonshared, x;
+
+  lowbits = 0x55555555U;
+  if (index1part < 16) {
+    lowbits &= ~(~0U << 2*index1part);
+  }
+  high = ((UINT4) oligo >> 1) & lowbits;
+  nonshared = ((UINT4) oligo ^ high) & lowbits;
+  if (shared_xor != 0) {
+    nonshared ^= lowbits;
+  }
+
+  if (nonshared == 0) {
+    x = (UINT4) oligo & lowbits;
+    x = (x | (x >> 1)) & 0x33333333U;
+    x = (x | (x >> 2)) & 0x0F0F0F0FU;
+    x = (x | (x >> 4)) & 0x00FF00FFU;
+    x = (x | (x >> 8)) & 0x0000FFFFU;
+    *rank = (Oligospace_T) x;
+    return COMBINED_SHARED;
+  } else if ((nonshared & high) != 0) {
+    return COMBINED_FIRST;
+  } else {
+    return COMBINED_SECOND;
+  }
+}
+
+
 
 
 static Indexdb_filenames_T
@@ -1288,7 +1376,8 @@ load_offsets (T new, Indexdb_filenames_T filenames, char *idx_filesuffix, char *
     exit(9);
   } else {
     comma = Genomicpos_commafmt(new->offsetsmeta_len);
-    fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+    fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	    Access_mbps(new->offsetsmeta_len,seconds));
     FREE(comma);
     /* new->offsetsmeta_access set by Access_allocate */
   }
@@ -1318,7 +1407,8 @@ load_offsets (T new, Indexdb_filenames_T filenames, char *idx_filesuffix, char *
       exit(9);
     } else {
       comma = Genomicpos_commafmt(new->offsetsstrm_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	      Access_mbps(new->offsetsstrm_len,seconds));
       FREE(comma);
     }
     
@@ -1362,7 +1452,8 @@ load_offsets (T new, Indexdb_filenames_T filenames, char *idx_filesuffix, char *
       exit(9);
     } else {
       comma = Genomicpos_commafmt(new->offsetsstrm_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	      Access_mbps(new->offsetsstrm_len,seconds));
       FREE(comma);
       new->offsetsstrm_access = MMAPPED;
     }
@@ -1467,7 +1558,8 @@ load_positions_high (T new, Indexdb_filenames_T filenames, char *idx_filesuffix,
       exit(9);
     } else {
       comma = Genomicpos_commafmt(new->positions_high_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	      Access_mbps(new->positions_high_len,seconds));
       FREE(comma);
       /* new->positions_high_access set by Access_allocate */
     }
@@ -1496,7 +1588,8 @@ load_positions_high (T new, Indexdb_filenames_T filenames, char *idx_filesuffix,
       exit(9);
     } else {
       comma = Genomicpos_commafmt(new->positions_high_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	      Access_mbps(new->positions_high_len,seconds));
       FREE(comma);
       new->positions_high_access = MMAPPED;
     }
@@ -1527,7 +1620,8 @@ load_positions_high (T new, Indexdb_filenames_T filenames, char *idx_filesuffix,
       exit(9);
     } else {
       comma = Genomicpos_commafmt(new->positions_high_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	      Access_mbps(new->positions_high_len,seconds));
       FREE(comma);
       new->positions_high_access = MMAPPED;
     }
@@ -1595,7 +1689,8 @@ load_positions (T new, Indexdb_filenames_T filenames, char *idx_filesuffix,
       exit(9);
     } else {
       comma = Genomicpos_commafmt(new->positions_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	      Access_mbps(new->positions_len,seconds));
       FREE(comma);
       /* new->positions_access set by Access_allocate */
     }
@@ -1618,7 +1713,8 @@ load_positions (T new, Indexdb_filenames_T filenames, char *idx_filesuffix,
       exit(9);
     } else {
       comma = Genomicpos_commafmt(new->positions_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	      Access_mbps(new->positions_len,seconds));
       FREE(comma);
       new->positions_access = MMAPPED;
     }
@@ -1643,7 +1739,8 @@ load_positions (T new, Indexdb_filenames_T filenames, char *idx_filesuffix,
       exit(9);
     } else {
       comma = Genomicpos_commafmt(new->positions_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	      Access_mbps(new->positions_len,seconds));
       FREE(comma);
       new->positions_access = MMAPPED;
     }
@@ -1675,6 +1772,92 @@ load_positions (T new, Indexdb_filenames_T filenames, char *idx_filesuffix,
 }
 
 
+#if !defined(LARGE_GENOMES) && !defined(UTILITYP)
+/* Loads the bitpacked positions written by gmapindex -c in place of
+   the positions file.  Returns false if they are not available. */
+static bool
+load_positions_bitpack (T new, Indexdb_filenames_T filenames, char *idx_filesuffix,
+			char *snps_root, Access_mode_T positions_access) {
+  char *metafile, *strmfile, *comma;
+  double seconds0, seconds1;
+  size_t len;
+
+  metafile = (char *) CALLOC(strlen(filenames->positions_filename)+strlen(POSITIONS_BITPACK_META_SUFFIX)+1,
+			     sizeof(char));
+  sprintf(metafile,"%s%s",filenames->positions_filename,POSITIONS_BITPACK_META_SUFFIX);
+  strmfile = (char *) CALLOC(strlen(filenames->positions_filename)+strlen(POSITIONS_BITPACK_STRM_SUFFIX)+1,
+			     sizeof(char));
+  sprintf(strmfile,"%s%s",filenames->positions_filename,POSITIONS_BITPACK_STRM_SUFFIX);
+
+#ifdef WORDS_BIGENDIAN
+  fprintf(stderr,"Bitpacked positions are not supported on bigendian machines, so using %s\n",
+	  filenames->positions_filename);
+  FREE(strmfile);
+  FREE(metafile);
+  return false;
+#endif
+
+  if (Access_file_exists_p(metafile) == false || Access_file_exists_p(strmfile) == false) {
+    fprintf(stderr,"Cannot find bitpacked positions files %s and %s (made by gmapindex -c), so using %s\n",
+	    metafile,strmfile,filenames->positions_filename);
+    FREE(strmfile);
+    FREE(metafile);
+    return false;
+  }
+
+  if (positions_access == USE_ALLOCATE) {
+    if (snps_root) {
+      fprintf(stderr,"Allocating memory for %s (%s) bitpacked positions, kmer %d, interval %d...",
+	      idx_filesuffix,snps_root,new->index1part,new->index1interval);
+    } else {
+      fprintf(stderr,"Allocating memory for %s bitpacked positions, kmer %d, interval %d...",
+	      idx_filesuffix,new->index1part,new->index1interval);
+    }
+    new->positionsmeta = (UINT8 *) Access_allocate_private(&new->positionsmeta_access,&new->positionsmeta_len,
+							   &seconds0,metafile,sizeof(UINT8));
+    new->positionsstrm = (UINT4 *) Access_allocate_private(&new->positionsstrm_access,&new->positionsstrm_len,
+							   &seconds1,strmfile,sizeof(UINT4));
+#ifdef HAVE_MMAP
+  } else {
+    if (snps_root) {
+      fprintf(stderr,"Memory mapping %s (%s) bitpacked positions, kmer %d, interval %d...",
+	      idx_filesuffix,snps_root,new->index1part,new->index1interval);
+    } else {
+      fprintf(stderr,"Memory mapping %s bitpacked positions, kmer %d, interval %d...",
+	      idx_filesuffix,new->index1part,new->index1interval);
+    }
+    new->positionsmeta = (UINT8 *) Access_mmap(&new->positionsmeta_fd,&new->positionsmeta_len,&seconds0,
+					       metafile,/*randomp*/true);
+    new->positionsmeta_access = MMAPPED;
+    new->positionsstrm = (UINT4 *) Access_mmap(&new->positionsstrm_fd,&new->positionsstrm_len,&seconds1,
+					       strmfile,/*randomp*/true);
+    new->positionsstrm_access = MMAPPED;
+#endif
+  }
+
+  if (new->positionsmeta == NULL || new->positionsstrm == NULL) {
+    fprintf(stderr,"insufficient memory for bitpacked positions\n");
+    exit(9);
+  } else {
+    len = new->positionsmeta_len + new->positionsstrm_len;
+    comma = Genomicpos_commafmt(len);
+    fprintf(stderr,"done (%s bytes, %.0f%% of positions file, %.2f sec, %.0f MB/s)\n",comma,
+	    100.0*(double) len/(double) (new->total_npositions*sizeof(UINT4)),seconds0 + seconds1,
+	    Access_mbps(len,seconds0 + seconds1));
+    FREE(comma);
+  }
+
+  new->positions_bitpack_p = true;
+  new->positions = (UINT4 *) NULL;
+  new->positions_access = NOT_USED;
+
+  FREE(strmfile);
+  FREE(metafile);
+  return true;
+}
+#endif
+
+
 T
 Indexdb_new_genome (Width_T *index1part, Width_T *index1interval,
 		    char *genomesubdir, char *snpsdir,
@@ -1690,6 +1873,8 @@ Indexdb_new_genome (Width_T *index1part, Width_T *index1interval,
   /* Positionsptr_T ptr0; -- UINT8 or UINT4 */
   /* Positionsptr_T end0; -- UINT8 or UINT4 */
 
+  new->positions_bitpack_p = false;
+  new->combined_view = 0;
   
   if (snpsdir == NULL || !strcmp(snpsdir,genomesubdir)) {
     indexdb_dir = genomesubdir;
@@ -1723,6 +1908,12 @@ Indexdb_new_genome (Width_T *index1part, Width_T *index1interval,
 #if defined(LARGE_GENOMES) || defined(UTILITYP)
   load_positions_high(new,filenames,idx_filesuffix,snps_root,positions_access,sharedp,
 		      multiple_sequences_p,preload_shared_memory_p,unload_shared_memory_p);
+#endif
+#if !defined(LARGE_GENOMES) && !defined(UTILITYP)
+  if (bitpack_positions_p == true && sharedp == false &&
+      load_positions_bitpack(new,filenames,idx_filesuffix,snps_root,positions_access) == true) {
+    /* Loaded in place of positions */
+  } else
 #endif
   load_positions(new,filenames,idx_filesuffix,snps_root,positions_access,sharedp,
 		 multiple_sequences_p,preload_shared_memory_p,unload_shared_memory_p);
@@ -1733,6 +1924,96 @@ Indexdb_new_genome (Width_T *index1part, Width_T *index1interval,
 }
 
 
+#if (defined(GSNAP) || defined(GFILTER)) && !defined(LARGE_GENOMES)
+/* Loads a combined index written by cmetindex or atoiindex
+   --combined, and returns views for the first and second
+   conversions, which share the offsets and positions.  Returns NULL
+   if the combined index is not available. */
+T
+Indexdb_new_combined (T *second, Width_T *index1part, Width_T *index1interval,
+		      char *genomesubdir, char *fileroot, char *idx_filesuffix,
+		      Width_T required_index1part, Width_T required_interval,
+		      Access_mode_T offsetsstrm_access, Access_mode_T positions_access, bool sharedp,
+		      bool multiple_sequences_p, bool preload_shared_memory_p, bool unload_shared_memory_p) {
+  T new;
+  Indexdb_filenames_T filenames;
+  Width_T combined_index1part, combined_index1interval;
+  char *splitsfile, *comma;
+  UINT4 *header;
+  size_t nshared;
+  double seconds;
+
+  if ((filenames = Indexdb_get_filenames_bitpack(&combined_index1part,&combined_index1interval,
+						 genomesubdir,fileroot,idx_filesuffix,/*snps_root*/NULL,
+						 required_index1part,required_interval,
+						 /*blocksize*/64,/*offsets_only_p*/false)) == NULL) {
+    return (T) NULL;
+  }
+
+  splitsfile = (char *) CALLOC(strlen(filenames->positions_filename)+strlen(COMBINED_SPLITS_SUFFIX)+1,
+			       sizeof(char));
+  sprintf(splitsfile,"%s%s",filenames->positions_filename,COMBINED_SPLITS_SUFFIX);
+  if (Access_file_exists_p(splitsfile) == false) {
+    fprintf(stderr,"Cannot find %s, so not using the combined %s index\n",splitsfile,idx_filesuffix);
+    FREE(splitsfile);
+    Indexdb_filenames_free(&filenames);
+    return (T) NULL;
+  }
+
+  new = (T) MALLOC(sizeof(*new));
+  new->index1part = combined_index1part;
+  new->index1interval = combined_index1interval;
+  new->positions_bitpack_p = false;
+
+  new->combined_splits = (UINT4 *) Access_allocate_private(&new->combined_splits_access,&new->combined_splits_len,
+							   &seconds,splitsfile,sizeof(UINT4));
+  header = new->combined_splits;
+  nshared = (size_t) 1 << new->index1part;
+  if (new->combined_splits_len != (COMBINED_SPLITS_HEADER + 2*nshared)*sizeof(UINT4) ||
+      header[1] != (UINT4) new->index1part) {
+    fprintf(stderr,"File %s does not match kmer %d\n",splitsfile,new->index1part);
+    exit(9);
+  }
+  new->combined_view = COMBINED_FIRST;
+  new->combined_owner_p = true;
+  new->combined_shared_xor = (int) header[0];
+  FREE(splitsfile);
+
+  *index1part = new->index1part;
+  *index1interval = new->index1interval;
+  load_offsets(new,filenames,idx_filesuffix,/*snps_root*/NULL,offsetsstrm_access,sharedp,
+	       multiple_sequences_p,preload_shared_memory_p,unload_shared_memory_p);
+
+  if (bitpack_positions_p == true && sharedp == false &&
+      load_positions_bitpack(new,filenames,idx_filesuffix,/*snps_root*/NULL,positions_access) == true) {
+    /* Loaded in place of positions */
+  } else {
+    load_positions(new,filenames,idx_filesuffix,/*snps_root*/NULL,positions_access,sharedp,
+		   multiple_sequences_p,preload_shared_memory_p,unload_shared_memory_p);
+  }
+
+  /* Each view reports its own total, so Indexdb_mean_size is
+     unchanged from separate indexes */
+  new->total_npositions = header[2];
+  *second = (T) MALLOC(sizeof(*new));
+  memcpy(*second,new,sizeof(*new));
+  (*second)->combined_view = COMBINED_SECOND;
+  (*second)->combined_owner_p = false;
+  (*second)->total_npositions = header[3];
+
+  comma = Genomicpos_commafmt((size_t) header[2] + (size_t) header[3] -
+			      Access_filesize(filenames->positions_filename)/sizeof(UINT4));
+  fprintf(stderr,"Combined %s index stores %s shared positions once\n",idx_filesuffix,comma);
+  FREE(comma);
+
+  Indexdb_filenames_free(&filenames);
+  combined_p = true;
+
+  return new;
+}
+#endif
+
+
 /* Assume that transcriptome is less than 4 billion bp, even for GSNAPL */
 T
 Indexdb_new_transcriptome (Width_T *index1part, Width_T *index1interval,
@@ -1750,6 +2031,8 @@ Indexdb_new_transcriptome (Width_T *index1part, Width_T *index1interval,
   /* Positionsptr_T ptr0; -- UINT8 or UINT4 */
   /* Positionsptr_T end0; -- UINT8 or UINT4 */
 
+  new->positions_bitpack_p = false;
+  new->combined_view = 0;
   if ((filenames = Indexdb_get_filenames_bitpack(
 #ifdef PMAP
 						 &(*alphabet),required_alphabet,
@@ -2571,6 +2854,177 @@ Indexdb_largeptr (unsigned char **positions_high, UINT4 **positions,
 
 
 #if defined(GSNAP) || defined(GFILTER)
+/* Bitpacked positions are decoded into a buffer owned by the calling
+   thread.  Callers hold the resulting pointers for a whole query, so
+   the buffer grows during a query and is emptied only by
+   Indexdb_reset_decoded at the start of the next one. */
+
+#define DECODED_CHUNK 1048576	/* entries */
+#define DECODED_PAD 16		/* for SIMD consumers that read past the end */
+
+typedef struct Decoded_T *Decoded_T;
+struct Decoded_T {
+  UINT4 *space;
+  size_t used;
+  List_T overflow;		/* Separate allocations for lists that do not fit */
+};
+
+#ifdef HAVE_PTHREAD
+static pthread_key_t decoded_key;
+static pthread_once_t decoded_once = PTHREAD_ONCE_INIT;
+#else
+static Decoded_T decoded_global = NULL;
+#endif
+
+static void
+decoded_free (void *data) {
+  Decoded_T decoded = (Decoded_T) data;
+  List_T p;
+  UINT4 *space;
+
+  for (p = decoded->overflow; p != NULL; p = List_next(p)) {
+    space = (UINT4 *) List_head(p);
+    FREE_KEEP(space);
+  }
+  List_free_keep(&decoded->overflow);
+  FREE_KEEP(decoded->space);
+  FREE_KEEP(decoded);
+  return;
+}
+
+#ifdef HAVE_PTHREAD
+static void
+decoded_key_create (void) {
+  pthread_key_create(&decoded_key,decoded_free);
+  return;
+}
+#endif
+
+static Decoded_T
+decoded_get (void) {
+  Decoded_T decoded;
+
+#ifdef HAVE_PTHREAD
+  pthread_once(&decoded_once,decoded_key_create);
+  if ((decoded = (Decoded_T) pthread_getspecific(decoded_key)) == NULL) {
+#else
+  if ((decoded = decoded_global) == NULL) {
+#endif
+    decoded = (Decoded_T) MALLOC_KEEP(sizeof(*decoded));
+    decoded->space = (UINT4 *) MALLOC_KEEP(DECODED_CHUNK*sizeof(UINT4));
+    decoded->used = 0;
+    decoded->overflow = (List_T) NULL;
+#ifdef HAVE_PTHREAD
+    pthread_setspecific(decoded_key,(void *) decoded);
+#else
+    decoded_global = decoded;
+#endif
+  }
+
+  return decoded;
+}
+
+static UINT4 *
+decoded_alloc (int nentries) {
+  Decoded_T decoded = decoded_get();
+  UINT4 *space;
+
+  if (decoded->used + nentries + DECODED_PAD <= DECODED_CHUNK) {
+    space = &(decoded->space[decoded->used]);
+    decoded->used += nentries + DECODED_PAD;
+  } else {
+    space = (UINT4 *) MALLOC_KEEP((nentries + DECODED_PAD)*sizeof(UINT4));
+    decoded->overflow = List_push_keep(decoded->overflow,(void *) space);
+  }
+  return space;
+}
+
+/* To be called by each thread before processing a query */
+void
+Indexdb_reset_decoded (void) {
+  Decoded_T decoded;
+  List_T p;
+  UINT4 *space;
+
+  if (bitpack_positions_p == true || combined_p == true) {
+    decoded = decoded_get();
+    for (p = decoded->overflow; p != NULL; p = List_next(p)) {
+      space = (UINT4 *) List_head(p);
+      FREE_KEEP(space);
+    }
+    List_free_keep(&decoded->overflow);
+    decoded->used = 0;
+  }
+  return;
+}
+
+
+/* For a view of a combined index.  The positions of a shared k-mer
+   hold the first conversion only, both, and the second conversion
+   only, so each view sees two sorted runs, which are merged unless
+   one is empty. */
+static int
+combined_ptr (UINT4 **positions, T this, Oligospace_T oligo, UINT4 ptr0, UINT4 end0) {
+  int nentries;
+  UINT4 *all, *splits, *a, *aend, *b, *bend, *out;
+  UINT4 start, mid, end;
+  Oligospace_T rank;
+  int group;
+
+  if ((group = Indexdb_combined_group(&rank,oligo,this->index1part,this->combined_shared_xor)) == COMBINED_SHARED) {
+    splits = &(this->combined_splits[COMBINED_SPLITS_HEADER + 2*rank]);
+    if (this->combined_view == COMBINED_FIRST) {
+      start = 0;
+      mid = splits[0];
+      end = splits[0] + splits[1];
+    } else {
+      start = splits[0];
+      mid = splits[0] + splits[1];
+      end = end0 - ptr0;
+    }
+  } else if (group == this->combined_view) {
+    start = 0;
+    mid = end = end0 - ptr0;
+  } else {
+    *positions = (UINT4 *) NULL;
+    return 0;
+  }
+
+  if ((nentries = end - start) == 0) {
+    *positions = (UINT4 *) NULL;
+    return 0;
+  }
+
+  if (this->positions_bitpack_p == true) {
+    all = decoded_alloc(end0 - ptr0);
+    Bitpack64_positions_read(all,this->positionsmeta,this->positionsstrm,ptr0,end0);
+  } else {
+    all = &(this->positions[ptr0]);
+  }
+
+  if (mid == start || mid == end) {
+    *positions = &(all[start]);
+  } else {
+    *positions = out = decoded_alloc(nentries);
+    a = &(all[start]);
+    aend = b = &(all[mid]);
+    bend = &(all[end]);
+    while (a < aend && b < bend) {
+      if (*a < *b) {
+	*out++ = *a++;
+      } else {
+	*out++ = *b++;
+      }
+    }
+    memcpy(out,a,(aend - a)*sizeof(UINT4));
+    out += aend - a;
+    memcpy(out,b,(bend - b)*sizeof(UINT4));
+  }
+
+  return nentries;
+}
+
+
 int
 Indexdb_ptr (UINT4 **positions, T this, Oligospace_T oligo) {
   int nentries;
@@ -2588,6 +3042,14 @@ Indexdb_ptr (UINT4 **positions, T this, Oligospace_T oligo) {
     *positions = (UINT4 *) NULL;
     return 0;
 
+  } else if (this->combined_view != 0) {
+    return combined_ptr(&(*positions),this,oligo,ptr0,end0);
+
+  } else if (this->positions_bitpack_p == true) {
+    *positions = decoded_alloc(nentries);
+    Bitpack64_positions_read(*positions,this->positionsmeta,this->positionsstrm,ptr0,end0);
+    return nentries;
+
   } else {
     *positions = &(this->positions[ptr0]);
 
@@ -2790,6 +3252,8 @@ Indexdb_new_segment (char *genomicseg,
   int between_counter, in_counter;
 #endif
 
+  new->positions_bitpack_p = false;
+  new->combined_view = 0;
   uppercaseCode = UPPERCASE_U2T;
 
 #ifdef PMAP
@@ -37,8 +37,22 @@ extern void
 Indexdb_setup (Width_T index1part_in);
 #endif
 
+extern void
+Indexdb_use_bitpack_positions (bool bitpack_positions_p_in);
+
 extern void
 Indexdb_free (T *old);
+
+/* Groups of k-mers in a combined index */
+#define COMBINED_SHARED 0
+#define COMBINED_FIRST 1
+#define COMBINED_SECOND 2
+
+/* shared_xor, index1part, and the total positions of each conversion */
+#define COMBINED_SPLITS_HEADER 4
+
+extern int
+Indexdb_combined_group (Oligospace_T *rank, Oligospace_T oligo, Width_T index1part, int shared_xor);
 #ifndef PMAP
 extern Width_T
 Indexdb_interval (T this);
@@ -140,6 +154,15 @@ Indexdb_new_transcriptome (Width_T *index1part, Width_T *index1interval,
 			   Access_mode_T offsetsstrm_access, Access_mode_T positions_access, bool sharedp,
 			   bool multiple_sequences_p, bool preload_shared_memory_p, bool unload_shared_memory_p);
 
+#if (defined(GSNAP) || defined(GFILTER)) && !defined(LARGE_GENOMES)
+extern T
+Indexdb_new_combined (T *second, Width_T *index1part, Width_T *index1interval,
+		      char *genomesubdir, char *fileroot, char *idx_filesuffix,
+		      Width_T required_index1part, Width_T required_interval,
+		      Access_mode_T offsetsstrm_access, Access_mode_T positions_access, bool sharedp,
+		      bool multiple_sequences_p, bool preload_shared_memory_p, bool unload_shared_memory_p);
+#endif
+
 #ifndef UTILITYP
 extern T
 Indexdb_new_segment (char *genomicseg,
@@ -171,6 +194,11 @@ Indexdb_largeptr (unsigned char **positions_high, UINT4 **positions_low,
 		  T this, Oligospace_T oligo);
 #endif
 
+#if defined(GSNAP) || defined(GFILTER)
+extern void
+Indexdb_reset_decoded (void);
+#endif
+
 extern int
 Indexdb_ptr (UINT4 **positions, T this, Oligospace_T oligo);
 
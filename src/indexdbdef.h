@@ -78,8 +78,35 @@ struct T {
 				   UINT4 to allow this to work with
 				   large genomes */
 
+  /* Bitpacked alternative to positions, from bitpack64-positions.c.
+     When positions_bitpack_p is true, positions is NULL. */
+  bool positions_bitpack_p;
+
+  Access_T positionsmeta_access;
+  int positionsmeta_fd;
+  size_t positionsmeta_len;
+  UINT8 *positionsmeta;
+
+  Access_T positionsstrm_access;
+  int positionsstrm_fd;
+  size_t positionsstrm_len;
+  UINT4 *positionsstrm;
+
   size_t total_npositions;	/* Needed to compute mean size */
 
+  /* View of a combined index for two conversions, from cmetindex or
+     atoiindex --combined.  The two views share the offsets and
+     positions, which are freed only by the owner.  combined_splits
+     has COMBINED_SPLITS_HEADER words, then for each shared k-mer, the
+     number of positions only in the first conversion and the number
+     in both.  See Indexdb_write_combined. */
+  int combined_view;		/* 0 if not combined, else COMBINED_FIRST or COMBINED_SECOND */
+  bool combined_owner_p;
+  int combined_shared_xor;
+  Access_T combined_splits_access;
+  size_t combined_splits_len;
+  UINT4 *combined_splits;
+
 #ifdef HAVE_PTHREAD
   pthread_mutex_t positions_read_mutex;
 #endif
@@ -163,7 +163,7 @@ galloping_intersection_anchorA (int *indices, const int smallset_index, const in
         break;
       }
     } else {
-      *indices++ = largeset_index + k1;
+      /* *indices++ = largeset_index + k1; -- want only indices2 */
       *indices++ = smallset_index + k2;
       ++k2;
       if (k2 == smalllength) {
@@ -248,7 +248,7 @@ galloping_intersection_anchorB (int *indices, const int smallset_index, const in
         break;
       }
     } else {
-      *indices++ = smallset_index + k2;
+      /* *indices++ = smallset_index + k2; -- want only indices2 */
       *indices++ = largeset_index + k1;
       ++k2;
       if (k2 == smalllength) {
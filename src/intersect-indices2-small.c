@@ -166,11 +166,11 @@ galloping_intersection (int *indices, const int smallset_index, const int larges
       }
     } else {
       if (smallset_first_p == true) {
-	*indices++ = smallset_index + k2;
+	/* *indices++ = smallset_index + k2; -- want only indices2 */
 	*indices++ = largeset_index + k1;
       } else {
-	*indices++ = largeset_index + k1;
 	*indices++ = smallset_index + k2;
+	/* *indices++ = largeset_index + k1; -- want only indices2 */
       }
       ++k2;
       if (k2 == smalllength) {
@@ -0,0 +1,411 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "latency.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>		/* For ceil */
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "mem.h"
+#include "filestring.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+
+/* Times are recorded in microseconds.  Values below 2*SUBCOUNT have
+   their own buckets.  Above that, each power of two is divided into
+   SUBCOUNT buckets, so a bucket is never wider than 1/SUBCOUNT of its
+   values.  Times beyond 2^MAX_BITS microseconds (about 19 hours) go
+   into the last bucket. */
+#define SUB_BITS 5
+#define SUBCOUNT (1 << SUB_BITS)
+#define MAX_BITS 36
+#define NBUCKETS ((MAX_BITS - SUB_BITS + 2) * SUBCOUNT)
+
+
+typedef struct Histogram_T *Histogram_T;
+struct Histogram_T {
+  unsigned long long counts[NBUCKETS];
+  unsigned long long n;
+  double total;			/* In seconds */
+  double max;
+};
+
+
+#define T Latency_T
+struct T {
+  struct Histogram_T all;
+  struct Histogram_T stage1;	/* Stage1_single_read or Stage1_paired_read in GSNAP, Stage1_compute in GMAP */
+  struct Histogram_T output;	/* Everything after stage 1: result and output formatting in GSNAP,
+				   stages 2 and 3 and output formatting in GMAP */
+
+#ifdef GSNAP
+  /* Total time by the last method that Stage 1 needed.  Allocated
+     when first used */
+  Histogram_T bymethod[NMETHODS];
+#endif
+};
+
+#ifdef GSNAP
+#define OUTPUT_LABEL "output"
+#else
+#define OUTPUT_LABEL "stage2-3"
+#endif
+
+
+static FILE *slow_reads_fp = NULL;
+static double slow_read_threshold;
+#ifdef GSNAP
+static bool invert_first_p;
+static bool invert_second_p;
+#endif
+static unsigned long long nslow;
+#ifdef HAVE_PTHREAD
+static pthread_mutex_t slow_reads_lock;
+#endif
+
+
+#ifdef GSNAP
+void
+Latency_setup (char *slow_reads_filename, double slow_read_threshold_in,
+	       bool invert_first_p_in, bool invert_second_p_in) {
+#else
+void
+Latency_setup (char *slow_reads_filename, double slow_read_threshold_in) {
+#endif
+
+  if (slow_reads_filename != NULL) {
+    if ((slow_reads_fp = fopen(slow_reads_filename,"w")) == NULL) {
+      fprintf(stderr,"Cannot open file %s for writing\n",slow_reads_filename);
+      exit(9);
+    }
+#ifdef HAVE_PTHREAD
+    pthread_mutex_init(&slow_reads_lock,NULL);
+#endif
+  }
+
+  slow_read_threshold = slow_read_threshold_in;
+#ifdef GSNAP
+  invert_first_p = invert_first_p_in;
+  invert_second_p = invert_second_p_in;
+#endif
+  nslow = 0;
+
+  return;
+}
+
+
+void
+Latency_cleanup () {
+  if (slow_reads_fp != NULL) {
+    fprintf(stderr,"%llu reads took longer than %.3f seconds, and were written to the slow reads file\n",
+	    nslow,slow_read_threshold);
+    fclose(slow_reads_fp);
+    slow_reads_fp = (FILE *) NULL;
+#ifdef HAVE_PTHREAD
+    pthread_mutex_destroy(&slow_reads_lock);
+#endif
+  }
+
+  return;
+}
+
+
+T
+Latency_new () {
+  T new = (T) CALLOC(1,sizeof(*new));
+
+  /* bymethod entries are NULL from CALLOC */
+  return new;
+}
+
+void
+Latency_free (T *old) {
+#ifdef GSNAP
+  Method_T method;
+#endif
+
+  if (*old) {
+#ifdef GSNAP
+    for (method = METHOD_INIT; method < NMETHODS; method++) {
+      if ((*old)->bymethod[method] != NULL) {
+	FREE((*old)->bymethod[method]);
+      }
+    }
+#endif
+    FREE(*old);
+  }
+
+  return;
+}
+
+
+static int
+bucket_index (unsigned long long usec) {
+  int msb, shift;
+
+  if (usec < 2*SUBCOUNT) {
+    return (int) usec;
+  } else {
+    msb = 0;
+    while ((usec >> msb) > 1) {
+      msb++;
+    }
+    if ((shift = msb - SUB_BITS) > MAX_BITS - SUB_BITS) {
+      return NBUCKETS - 1;
+    } else {
+      return (shift + 1) * SUBCOUNT + (int) ((usec >> shift) - SUBCOUNT);
+    }
+  }
+}
+
+/* Returns the highest value, in microseconds, that falls into the bucket */
+static unsigned long long
+bucket_highest (int index) {
+  int shift;
+  unsigned long long sub;
+
+  if (index < 2*SUBCOUNT) {
+    return (unsigned long long) index;
+  } else {
+    shift = index/SUBCOUNT - 1;
+    sub = (unsigned long long) (index % SUBCOUNT + SUBCOUNT);
+    return ((sub + 1) << shift) - 1;
+  }
+}
+
+
+static void
+histogram_record (Histogram_T histogram, double seconds) {
+  histogram->counts[bucket_index((unsigned long long) (seconds * 1e6))] += 1;
+  histogram->n += 1;
+  histogram->total += seconds;
+  if (seconds > histogram->max) {
+    histogram->max = seconds;
+  }
+  return;
+}
+
+static void
+histogram_merge (Histogram_T dest, Histogram_T source) {
+  int i;
+
+  for (i = 0; i < NBUCKETS; i++) {
+    dest->counts[i] += source->counts[i];
+  }
+  dest->n += source->n;
+  dest->total += source->total;
+  if (source->max > dest->max) {
+    dest->max = source->max;
+  }
+  return;
+}
+
+/* Returns the percentile in microseconds */
+static double
+histogram_percentile (Histogram_T histogram, double percentile) {
+  unsigned long long target, cum = 0;
+  double usec;
+  int i;
+
+  if ((target = (unsigned long long) ceil(percentile / 100.0 * (double) histogram->n)) == 0) {
+    target = 1;
+  }
+  for (i = 0; i < NBUCKETS; i++) {
+    if ((cum += histogram->counts[i]) >= target) {
+      if ((usec = (double) bucket_highest(i)) > histogram->max * 1e6) {
+	return histogram->max * 1e6;
+      } else {
+	return usec;
+      }
+    }
+  }
+
+  return histogram->max * 1e6;
+}
+
+
+#ifdef GSNAP
+void
+Latency_record (T this, double runtime, double stage1_runtime, Method_T final_method) {
+#else
+void
+Latency_record (T this, double runtime, double stage1_runtime) {
+#endif
+  histogram_record(&this->all,runtime);
+  histogram_record(&this->stage1,stage1_runtime);
+  histogram_record(&this->output,runtime - stage1_runtime);
+
+#ifdef GSNAP
+  if (this->bymethod[final_method] == NULL) {
+    this->bymethod[final_method] = (Histogram_T) CALLOC(1,sizeof(struct Histogram_T));
+  }
+  histogram_record(this->bymethod[final_method],runtime);
+#endif
+
+  return;
+}
+
+
+static void
+print_slow_read (Filestring_T fp) {
+  Filestring_stringify(fp);
+
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&slow_reads_lock);
+#endif
+  Filestring_print(slow_reads_fp,fp);
+  fflush(slow_reads_fp);	/* So reads are kept if a later read crashes */
+  nslow += 1;
+#ifdef HAVE_PTHREAD
+  pthread_mutex_unlock(&slow_reads_lock);
+#endif
+
+  return;
+}
+
+
+#ifdef GSNAP
+/* Writes the read in FASTA format, so the file can be given back to
+   GSNAP, with the times and method in the header */
+void
+Latency_trap (Shortread_T queryseq1, Shortread_T queryseq2,
+	      double runtime, double stage1_runtime, Method_T final_method) {
+  Filestring_T fp;
+
+  if (slow_reads_fp == NULL || runtime < slow_read_threshold) {
+    return;
+  }
+
+  fp = Filestring_new();
+  FPRINTF(fp,">%s usec=%.0f stage1_usec=%.0f method=%s\n",
+	  Shortread_accession(queryseq1),runtime * 1e6,stage1_runtime * 1e6,
+	  Method_string(final_method));
+  if (queryseq2 == NULL) {
+    Shortread_print_oneline(fp,queryseq1);
+    FPRINTF(fp,"\n");
+  } else {
+    if (invert_first_p == true) {
+      Shortread_print_oneline_revcomp(fp,queryseq1);
+    } else {
+      Shortread_print_oneline(fp,queryseq1);
+    }
+    FPRINTF(fp,"\n");
+    if (invert_second_p == true) {
+      Shortread_print_oneline_revcomp(fp,queryseq2);
+    } else {
+      Shortread_print_oneline(fp,queryseq2);
+    }
+    FPRINTF(fp,"\n");
+  }
+  print_slow_read(fp);
+
+  Filestring_free(&fp,/*free_string_p*/true);
+  return;
+}
+
+#else
+/* Writes the query in FASTA format, so the file can be given back to
+   GMAP, with the times in the header */
+void
+Latency_trap (Sequence_T queryseq, double runtime, double stage1_runtime) {
+  Filestring_T fp;
+
+  if (slow_reads_fp == NULL || runtime < slow_read_threshold) {
+    return;
+  }
+
+  fp = Filestring_new();
+  FPRINTF(fp,">%s usec=%.0f stage1_usec=%.0f\n",
+	  Sequence_accession(queryseq) == NULL ? "NO_HEADER" : Sequence_accession(queryseq),
+	  runtime * 1e6,stage1_runtime * 1e6);
+  Sequence_print(fp,queryseq,/*uppercasep*/false,/*wraplength*/60,/*trimmedp*/false);
+  print_slow_read(fp);
+
+  Filestring_free(&fp,/*free_string_p*/true);
+  return;
+}
+#endif
+
+
+void
+Latency_merge (T dest, T source) {
+#ifdef GSNAP
+  Method_T method;
+#endif
+
+  histogram_merge(&dest->all,&source->all);
+  histogram_merge(&dest->stage1,&source->stage1);
+  histogram_merge(&dest->output,&source->output);
+
+#ifdef GSNAP
+  for (method = METHOD_INIT; method < NMETHODS; method++) {
+    if (source->bymethod[method] != NULL) {
+      if (dest->bymethod[method] == NULL) {
+	dest->bymethod[method] = (Histogram_T) CALLOC(1,sizeof(struct Histogram_T));
+      }
+      histogram_merge(dest->bymethod[method],source->bymethod[method]);
+    }
+  }
+#endif
+
+  return;
+}
+
+
+static void
+histogram_print (FILE *fp, Histogram_T histogram, char *label, double overall_total) {
+  if (histogram->n == 0) {
+    fprintf(fp,"%-14s %10d\n",label,0);
+  } else {
+    fprintf(fp,"%-14s %10llu %10.0f %10.0f %10.0f %10.0f %10.0f %10.0f %6.1f%%\n",
+	    label,histogram->n,histogram->total / (double) histogram->n * 1e6,
+	    histogram_percentile(histogram,50.0),histogram_percentile(histogram,90.0),
+	    histogram_percentile(histogram,99.0),histogram_percentile(histogram,99.9),
+	    histogram->max * 1e6,
+	    overall_total > 0.0 ? 100.0 * histogram->total / overall_total : 0.0);
+  }
+  return;
+}
+
+void
+Latency_print (FILE *fp, T this) {
+#ifdef GSNAP
+  Method_T method;
+#endif
+
+#ifdef GSNAP
+  fprintf(fp,"Latency per read, in microseconds\n");
+#else
+  fprintf(fp,"Latency per query, in microseconds\n");
+#endif
+  fprintf(fp,"%-14s %10s %10s %10s %10s %10s %10s %10s %7s\n",
+	  "Stage","Reads","Mean","p50","p90","p99","p99.9","Max","Time");
+  histogram_print(fp,&this->all,"all",this->all.total);
+  histogram_print(fp,&this->stage1,"stage1",this->all.total);
+  histogram_print(fp,&this->output,OUTPUT_LABEL,this->all.total);
+
+#ifdef GSNAP
+  fprintf(fp,"By last method needed in stage 1\n");
+  for (method = METHOD_INIT; method < NMETHODS; method++) {
+    if (this->bymethod[method] != NULL) {
+      histogram_print(fp,this->bymethod[method],Method_string(method),this->all.total);
+    }
+  }
+#endif
+
+  return;
+}
+
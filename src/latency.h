@@ -0,0 +1,66 @@
+/* $Id$ */
+#ifndef LATENCY_INCLUDED
+#define LATENCY_INCLUDED
+
+#include <stdio.h>
+#include "bool.h"
+#ifdef GSNAP
+#include "method.h"
+#include "shortread.h"
+#else
+#include "sequence.h"
+#endif
+
+
+/* Per-read latency histograms.  Each worker thread records into its
+   own Latency_T, and the results are combined by Latency_merge at the
+   end of the run.  Histograms are log-linear, in the manner of HDR
+   histograms, so percentiles are accurate to about 3% over any range
+   of times.  GSNAP also breaks times down by the last stage 1 method
+   needed. */
+
+#define T Latency_T
+typedef struct T *T;
+
+#ifdef GSNAP
+extern void
+Latency_setup (char *slow_reads_filename, double slow_read_threshold,
+	       bool invert_first_p, bool invert_second_p);
+#else
+extern void
+Latency_setup (char *slow_reads_filename, double slow_read_threshold);
+#endif
+
+extern void
+Latency_cleanup ();
+
+extern T
+Latency_new ();
+
+extern void
+Latency_free (T *old);
+
+#ifdef GSNAP
+extern void
+Latency_record (T this, double runtime, double stage1_runtime, Method_T final_method);
+
+extern void
+Latency_trap (Shortread_T queryseq1, Shortread_T queryseq2,
+	      double runtime, double stage1_runtime, Method_T final_method);
+#else
+extern void
+Latency_record (T this, double runtime, double stage1_runtime);
+
+extern void
+Latency_trap (Sequence_T queryseq, double runtime, double stage1_runtime);
+#endif
+
+extern void
+Latency_merge (T dest, T source);
+
+extern void
+Latency_print (FILE *fp, T this);
+
+#undef T
+#endif
+
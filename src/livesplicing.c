@@ -0,0 +1,349 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "livesplicing.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>		/* For UINT_MAX */
+#include <time.h>		/* For nanosleep */
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "mem.h"
+#include "list.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+
+/* Each worker publishes the epoch at which it took the current
+   Knownsplicing_T, or QUIESCENT when it holds none.  The slots are
+   padded so that workers do not share cache lines. */
+#define QUIESCENT 0
+#define CACHELINE_SIZE 64
+
+typedef struct Slot_T *Slot_T;
+struct Slot_T {
+  volatile unsigned long epoch;
+  char padding[CACHELINE_SIZE - sizeof(unsigned long)];
+};
+
+/* How long the learner waits between checks for a grace period */
+#define GRACE_POLL_NSEC 100000
+
+
+#define T Livesplicing_T
+struct T {
+  Knownsplicing_T volatile current;
+  volatile unsigned long epoch;
+
+  int nworkers;
+  struct Slot_T *slots;
+
+  /* Reads before the next rebuild.  Each rebuild processes all the
+     evidence so far, so the interval doubles after each one to keep
+     the total cost proportional to the evidence */
+  unsigned int interval;
+  int nsnapshots;
+
+  /* Evidence handed off by workers, not yet in a snapshot */
+#ifdef HAVE_PTHREAD
+  pthread_mutex_t lock;
+  pthread_cond_t pending_avail_p;
+  pthread_t learner_thread_id;
+#endif
+  List_T pending;
+  unsigned int npending_reads;
+  bool donep;
+
+  /* All evidence so far.  Used only by the learner */
+  Pass1info_T cumulative;
+  unsigned int ncumulative_reads;
+
+  Univcoord_T genomelength;
+  Univ_IIT_T chromosome_iit;
+  EF64_T chromosome_ef64;
+};
+
+
+/* Called by a worker before it aligns a read.  The returned
+   Knownsplicing_T remains valid until Livesplicing_release */
+Knownsplicing_T
+Livesplicing_acquire (T this, int worker_id) {
+  this->slots[worker_id].epoch = this->epoch;
+#ifdef HAVE_PTHREAD
+  __sync_synchronize();		/* Announce the epoch before reading current */
+#endif
+  return this->current;
+}
+
+void
+Livesplicing_release (T this, int worker_id) {
+#ifdef HAVE_PTHREAD
+  __sync_synchronize();		/* Finish with current before announcing quiescence */
+#endif
+  this->slots[worker_id].epoch = QUIESCENT;
+  return;
+}
+
+
+/* Waits until every worker is either quiescent or has taken the
+   Knownsplicing_T published at new_epoch, so that none can still
+   hold the previous one */
+static void
+wait_for_readers (T this, unsigned long new_epoch) {
+  unsigned long epoch;
+  int worker_id;
+#ifdef HAVE_PTHREAD
+  struct timespec delay;
+
+  delay.tv_sec = 0;
+  delay.tv_nsec = GRACE_POLL_NSEC;
+#endif
+
+  for (worker_id = 0; worker_id < this->nworkers; worker_id++) {
+    while ((epoch = this->slots[worker_id].epoch) != QUIESCENT && epoch < new_epoch) {
+#ifdef HAVE_PTHREAD
+      nanosleep(&delay,NULL);
+#endif
+    }
+  }
+
+  return;
+}
+
+
+/* Builds a new Knownsplicing_T from the cumulative evidence, publishes
+   it, and frees the one it replaces */
+static void
+rebuild (T this, List_T pending) {
+  Pass1info_T *pass1infos, info;
+  Univcoordlist_T donor_startpoints, donor_partners, acceptor_startpoints, acceptor_partners,
+    antidonor_startpoints, antidonor_partners, antiacceptor_startpoints, antiacceptor_partners;
+  Knownsplicing_T new_knownsplicing, old_knownsplicing;
+  unsigned long new_epoch;
+  int n, i;
+
+  n = List_length(pending) + 1;
+  pass1infos = (Pass1info_T *) MALLOC(n*sizeof(Pass1info_T));
+  pass1infos[0] = this->cumulative;
+  for (i = 1; i < n; i++) {
+    pending = List_pop(pending,(void **) &info);
+    pass1infos[i] = info;
+  }
+  this->cumulative = Pass1info_merge(pass1infos,n,/*nthreads*/1);
+  FREE(pass1infos);
+
+  Pass1info_introns(&donor_startpoints,&donor_partners,&acceptor_startpoints,&acceptor_partners,
+		    &antidonor_startpoints,&antidonor_partners,&antiacceptor_startpoints,&antiacceptor_partners,
+		    this->cumulative);
+
+  /* Knownsplicing_new frees its lists, so give it copies.  The splice
+     site tables are not learned, so none are given. */
+  new_knownsplicing =
+    Knownsplicing_new(Univcoordlist_copy(donor_startpoints),Univcoordlist_copy(donor_partners),
+		      Univcoordlist_copy(acceptor_startpoints),Univcoordlist_copy(acceptor_partners),
+		      Univcoordlist_copy(antidonor_startpoints),Univcoordlist_copy(antidonor_partners),
+		      Univcoordlist_copy(antiacceptor_startpoints),Univcoordlist_copy(antiacceptor_partners),
+		      /*donor_table*/NULL,/*acceptor_table*/NULL,/*antidonor_table*/NULL,/*antiacceptor_table*/NULL,
+		      this->genomelength,/*dump_splices_fp*/NULL,this->chromosome_iit,this->chromosome_ef64,
+		      /*intron_level_p*/true);
+
+  old_knownsplicing = this->current;
+  this->current = new_knownsplicing;
+  new_epoch = this->epoch + 1;
+#ifdef HAVE_PTHREAD
+  __sync_synchronize();		/* Publish current before the epoch that announces it */
+#endif
+  this->epoch = new_epoch;
+#ifdef HAVE_PTHREAD
+  __sync_synchronize();
+#endif
+
+  this->nsnapshots += 1;
+  fprintf(stderr,"Live splicing: snapshot %d built from introns in %u reads\n",
+	  this->nsnapshots,this->ncumulative_reads);
+
+  if (old_knownsplicing != NULL) {
+    wait_for_readers(this,new_epoch);
+    Knownsplicing_free(&old_knownsplicing);
+  }
+
+  return;
+}
+
+
+#ifdef HAVE_PTHREAD
+static void *
+learner_thread (void *data) {
+  T this = (T) data;
+  List_T pending;
+
+  pthread_mutex_lock(&this->lock);
+  while (this->donep == false) {
+    while (this->donep == false && this->npending_reads < this->interval) {
+      pthread_cond_wait(&this->pending_avail_p,&this->lock);
+    }
+
+    if (this->donep == false) {
+      pending = this->pending;
+      this->ncumulative_reads += this->npending_reads;
+      this->pending = (List_T) NULL;
+      this->npending_reads = 0;
+      if (this->interval <= UINT_MAX/2) {
+	this->interval *= 2;
+      }
+      pthread_mutex_unlock(&this->lock);
+
+      /* Workers keep aligning and handing off evidence meanwhile */
+      rebuild(this,pending);
+
+      pthread_mutex_lock(&this->lock);
+    }
+  }
+  pthread_mutex_unlock(&this->lock);
+
+  return (void *) NULL;
+}
+#endif
+
+
+/* Called by a worker with evidence from its last nreads reads.  Takes
+   ownership of pass1info */
+void
+Livesplicing_contribute (T this, Pass1info_T pass1info, unsigned int nreads) {
+#ifdef HAVE_PTHREAD
+  pthread_mutex_lock(&this->lock);
+  this->pending = List_push(this->pending,(void *) pass1info);
+  this->npending_reads += nreads;
+  if (this->npending_reads >= this->interval) {
+    pthread_cond_signal(&this->pending_avail_p);
+  }
+  pthread_mutex_unlock(&this->lock);
+
+#else
+  /* The only worker is the caller, which holds no Knownsplicing_T here */
+  List_T pending;
+
+  this->pending = List_push(this->pending,(void *) pass1info);
+  this->npending_reads += nreads;
+  if (this->npending_reads >= this->interval) {
+    pending = this->pending;
+    this->ncumulative_reads += this->npending_reads;
+    this->pending = (List_T) NULL;
+    this->npending_reads = 0;
+    if (this->interval <= UINT_MAX/2) {
+      this->interval *= 2;
+    }
+    rebuild(this,pending);
+  }
+#endif
+
+  return;
+}
+
+
+/* Number of reads after which each worker should hand off its
+   evidence, so that the learner receives about interval reads at a
+   time */
+unsigned int
+Livesplicing_handoff_interval (T this) {
+  unsigned int handoff;
+
+  if ((handoff = this->interval/this->nworkers) == 0) {
+    return 1;
+  } else {
+    return handoff;
+  }
+}
+
+
+T
+Livesplicing_new (int nworkers, unsigned int interval,
+		  Univcoord_T genomelength, Univ_IIT_T chromosome_iit, EF64_T chromosome_ef64) {
+  T new = (T) MALLOC(sizeof(*new));
+  int worker_id;
+#ifdef HAVE_PTHREAD
+  pthread_attr_t thread_attr_join;
+#endif
+
+  new->current = (Knownsplicing_T) NULL;
+  new->epoch = QUIESCENT + 1;
+
+  new->nworkers = nworkers;
+  new->slots = (struct Slot_T *) MALLOC(nworkers*sizeof(struct Slot_T));
+  for (worker_id = 0; worker_id < nworkers; worker_id++) {
+    new->slots[worker_id].epoch = QUIESCENT;
+  }
+
+  new->interval = interval;
+  new->nsnapshots = 0;
+
+  new->pending = (List_T) NULL;
+  new->npending_reads = 0;
+  new->donep = false;
+
+  new->cumulative = Pass1info_new();
+  new->ncumulative_reads = 0;
+
+  new->genomelength = genomelength;
+  new->chromosome_iit = chromosome_iit;
+  new->chromosome_ef64 = chromosome_ef64;
+
+#ifdef HAVE_PTHREAD
+  pthread_mutex_init(&new->lock,NULL);
+  pthread_cond_init(&new->pending_avail_p,NULL);
+
+  pthread_attr_init(&thread_attr_join);
+  pthread_attr_setdetachstate(&thread_attr_join,PTHREAD_CREATE_JOINABLE);
+  pthread_create(&new->learner_thread_id,&thread_attr_join,learner_thread,(void *) new);
+  pthread_attr_destroy(&thread_attr_join);
+#endif
+
+  return new;
+}
+
+
+/* Needs to be called after the workers have finished */
+void
+Livesplicing_free (T *old) {
+  Pass1info_T info;
+  Knownsplicing_T knownsplicing;
+
+  if (*old) {
+#ifdef HAVE_PTHREAD
+    pthread_mutex_lock(&(*old)->lock);
+    (*old)->donep = true;
+    pthread_cond_signal(&(*old)->pending_avail_p);
+    pthread_mutex_unlock(&(*old)->lock);
+    pthread_join((*old)->learner_thread_id,NULL);
+
+    pthread_cond_destroy(&(*old)->pending_avail_p);
+    pthread_mutex_destroy(&(*old)->lock);
+#endif
+
+    while ((*old)->pending != NULL) {
+      (*old)->pending = List_pop((*old)->pending,(void **) &info);
+      Pass1info_free(&info);
+    }
+    Pass1info_free(&(*old)->cumulative);
+
+    if ((knownsplicing = (*old)->current) != NULL) {
+      Knownsplicing_free(&knownsplicing);
+    }
+    FREE((*old)->slots);
+    FREE(*old);
+  }
+
+  return;
+}
+
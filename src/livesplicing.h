@@ -0,0 +1,44 @@
+/* $Id$ */
+#ifndef LIVESPLICING_INCLUDED
+#define LIVESPLICING_INCLUDED
+
+#include "bool.h"
+#include "univcoord.h"
+#include "iit-read-univ.h"
+#include "ef64.h"
+#include "knownsplicing.h"
+#include "pass1info.h"
+
+
+/* Single-pass alternative to --two-pass.  Introns learned by the
+   worker threads are periodically combined into a new
+   Knownsplicing_T, which is then used for later reads.  Workers read
+   the current Knownsplicing_T without locking, in the manner of
+   read-copy-update, and a replaced Knownsplicing_T is freed once no
+   worker can still be using it. */
+
+#define T Livesplicing_T
+typedef struct T *T;
+
+extern T
+Livesplicing_new (int nworkers, unsigned int interval,
+		  Univcoord_T genomelength, Univ_IIT_T chromosome_iit, EF64_T chromosome_ef64);
+
+extern void
+Livesplicing_free (T *old);
+
+extern Knownsplicing_T
+Livesplicing_acquire (T this, int worker_id);
+
+extern void
+Livesplicing_release (T this, int worker_id);
+
+extern void
+Livesplicing_contribute (T this, Pass1info_T pass1info, unsigned int nreads);
+
+extern unsigned int
+Livesplicing_handoff_interval (T this);
+
+#undef T
+#endif
+
@@ -2448,7 +2448,8 @@ Localdb_new (char *genomesubdir, char *fileroot,
       new->localdb_access = FILEIO;
     } else {
       comma = Genomicpos_commafmt(new->saindex16_len + new->sarray16_len + new->sarray8_len + new->sasort16_len);
-      fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds0 + seconds1 + seconds2);
+      fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds0 + seconds1 + seconds2,
+	      Access_mbps(new->saindex16_len + new->sarray16_len + new->sarray8_len + new->sasort16_len,seconds0 + seconds1 + seconds2));
       FREE(comma);
       new->localdb_access = MMAPPED;
     }
@@ -80,6 +80,7 @@ static pthread_key_t key_memusage_std_stack_max;
 static pthread_key_t key_memusage_std_heap;
 static pthread_key_t key_memusage_std_heap_max;
 static pthread_key_t key_memusage_keep; /* Keep pool: Memory that is kept by a thread between queries  */
+static pthread_key_t key_memusage_nallocs; /* Allocations in the standard and keep pools */
 static pthread_key_t key_threadname;
 #else
 static char *threadname = "program";
@@ -89,6 +90,7 @@ static long int memusage_std_stack_max = 0;
 static long int memusage_std_heap = 0;
 static long int memusage_std_heap_max = 0;
 static long int memusage_keep = 0;
+static long int memusage_nallocs = 0;
 #endif
 
 static long int memusage_in = 0; /* Input pool: Memory from inbuffer to threads */
@@ -103,12 +105,14 @@ Mem_usage_init () {
   pthread_key_create(&key_memusage_std_heap,NULL);
   pthread_key_create(&key_memusage_std_heap_max,NULL);
   pthread_key_create(&key_memusage_keep,NULL);
+  pthread_key_create(&key_memusage_nallocs,NULL);
   pthread_key_create(&key_threadname,NULL);
 
   pthread_setspecific(key_memusage_std_stack,(void *) 0);
   pthread_setspecific(key_memusage_std_stack_max,(void *) 0);
   pthread_setspecific(key_memusage_std_heap,(void *) 0);
   pthread_setspecific(key_memusage_std_heap_max,(void *) 0);
+  pthread_setspecific(key_memusage_nallocs,(void *) 0);
 #else
   memusage_std_stack = 0;
   memusage_std_sizelist = NULL;
@@ -116,6 +120,7 @@ Mem_usage_init () {
   memusage_std_heap = 0;
   memusage_std_heap_max = 0;
   memusage_keep = 0;
+  memusage_nallocs = 0;
 #endif
 
   memusage_in = 0;
@@ -178,6 +183,29 @@ Mem_usage_reset_heap_max () {
 }
 
 
+void
+Mem_usage_reset_nallocs () {
+#if defined(HAVE_PTHREAD)
+  pthread_setspecific(key_memusage_nallocs,(void *) 0);
+#else
+  memusage_nallocs = 0;
+#endif
+}
+
+/* Called with memusage_mutex held */
+static void
+nallocs_add () {
+#if defined(HAVE_PTHREAD)
+  long int memusage_nallocs;
+
+  memusage_nallocs = (long int) pthread_getspecific(key_memusage_nallocs);
+  pthread_setspecific(key_memusage_nallocs,(void *) (memusage_nallocs + 1));
+#else
+  memusage_nallocs += 1;
+#endif
+}
+
+
 void
 Mem_usage_std_stack_add (long int x, const char *file, int line) {
   struct sizelist *new;
@@ -318,6 +346,15 @@ Mem_usage_report_keep () {
 #endif
 }
 
+long int
+Mem_usage_report_nallocs () {
+#if defined(HAVE_PTHREAD)
+  return (long int) pthread_getspecific(key_memusage_nallocs);
+#else
+  return memusage_nallocs;
+#endif
+}
+
 long int
 Mem_usage_report_std_stack_max () {
 #if defined(HAVE_PTHREAD)
@@ -416,6 +453,7 @@ Mem_alloc (size_t nbytes, const char *file, int line) {
   }
 #endif
 
+  nallocs_add();
   h = hash(ptr,htab);
   bp = malloc(sizeof(*bp));
   bp->link = htab[h];
@@ -490,6 +528,7 @@ Mem_alloc_keep (size_t nbytes, const char *file, int line) {
 #else
   memusage_keep += nbytes;
 #endif
+  nallocs_add();
   h = hash(ptr,htab);
   bp = malloc(sizeof(*bp));
   bp->link = htab[h];
@@ -731,6 +770,7 @@ Mem_calloc (size_t count, size_t nbytes, const char *file, int line) {
     memusage_std_heap_max = memusage_std_heap;
   }
 #endif
+  nallocs_add();
   h = hash(ptr,htab);
   bp = malloc(sizeof(*bp));
   bp->link = htab[h];
@@ -814,6 +854,7 @@ Mem_calloc_keep (size_t count, size_t nbytes, const char *file, int line) {
 #else
   memusage_keep += count*nbytes;
 #endif
+  nallocs_add();
   h = hash(ptr,htab);
   bp = malloc(sizeof(*bp));
   bp->link = htab[h];
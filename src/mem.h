@@ -46,6 +46,8 @@ Mem_usage_reset_stack_max ();
 extern void
 Mem_usage_reset_heap_max ();
 extern void
+Mem_usage_reset_nallocs ();
+extern void
 Mem_usage_std_stack_add (long int x, const char *file, int line);
 extern void
 Mem_usage_std_stack_subtract (const char *file, int line);
@@ -62,6 +64,8 @@ Mem_usage_report_std_heap_max ();
 extern long int
 Mem_usage_report_keep ();
 extern long int
+Mem_usage_report_nallocs ();
+extern long int
 Mem_usage_report_in ();
 extern long int
 Mem_usage_report_out ();
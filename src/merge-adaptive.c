@@ -0,0 +1,509 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "merge-adaptive.h"
+#include "assert.h"
+#include "mem.h"
+#include "merge-diagonals-simd-uint4.h"
+#ifdef LARGE_GENOMES
+#include "merge-diagonals-heap.h"
+#include "merge-diagonals-simd-uint8.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>		/* For memset */
+
+#include "simd.h"
+
+
+/* Thresholds were measured on streams recorded from GSNAP runs,
+   including reads from a genome with high-copy interspersed repeats.
+   Below MIN_TOTAL, the pyramid merge is as fast as anything else.
+   With few streams, the pyramid merge falls back on Sedgesort, and
+   pairwise merging by galloping is 1.5 to 4 times faster.  With one
+   stream at least GALLOP_RATIO times the others combined, galloping
+   is 1.5 to 7 times faster.  Radix sort wins by 1.3 to 3 times over
+   RADIX_MIN_NSTREAMS streams totaling RADIX_MIN_TOTAL, but loses
+   when one stream dominates, since it has to touch every element. */
+#define MIN_TOTAL 64
+#define GALLOP_MAX_NSTREAMS 4
+#define GALLOP_RATIO 2		/* largest stream vs the sum of the others */
+#define RADIX_MIN_NSTREAMS 8
+#define RADIX_MIN_TOTAL 1024
+
+#define RADIX_BITS 11
+#define RADIX_NBUCKETS (1 << RADIX_BITS)
+#define RADIX_MASK (RADIX_NBUCKETS - 1)
+#define RADIX_MAXDIGITS_UINT4 3	/* ceil(32/11) */
+#define RADIX_MAXDIGITS_UINT8 6	/* ceil(64/11) */
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+
+#ifdef MERGE_ADAPTIVE_BENCH
+/* Set by merge_adaptive_bench, to time each strategy on the same
+   streams.  Only the next decision is forced.  The decisions after
+   it, for merging the rest of the streams, pick the pyramid merge. */
+static int forced_strategy = -1;
+static int forced_rest = -1;
+
+void
+Merge_adaptive_force (int strategy) {
+  forced_strategy = strategy;
+  forced_rest = (strategy < 0) ? -1 : (int) MERGE_PYRAMID;
+  return;
+}
+#endif
+
+
+Merge_strategy_T
+Merge_adaptive_strategy (int *largesti, int *streamsize_array, int nstreams) {
+  int total = 0, max = 0, i;
+#ifdef MERGE_ADAPTIVE_BENCH
+  int forced;
+#endif
+
+  *largesti = 0;
+  for (i = 0; i < nstreams; i++) {
+    total += streamsize_array[i];
+    if (streamsize_array[i] > max) {
+      max = streamsize_array[i];
+      *largesti = i;
+    }
+  }
+
+  debug(printf("Merge_adaptive_strategy: nstreams %d, total %d, largest %d\n",nstreams,total,max));
+#ifdef MERGE_ADAPTIVE_BENCH
+  if ((forced = forced_strategy) >= 0) {
+    forced_strategy = forced_rest;
+    return (forced == MERGE_GALLOP && nstreams < 2) ? MERGE_PYRAMID : (Merge_strategy_T) forced;
+  }
+#endif
+
+  if (total < MIN_TOTAL) {
+    return MERGE_PYRAMID;
+  } else if (nstreams <= GALLOP_MAX_NSTREAMS || max >= GALLOP_RATIO * (total - max)) {
+    return MERGE_GALLOP;
+  } else if (nstreams >= RADIX_MIN_NSTREAMS && total >= RADIX_MIN_TOTAL) {
+    return MERGE_RADIX;
+  } else {
+    return MERGE_PYRAMID;
+  }
+}
+
+
+/* Merges small, which is sorted, into large + diagterm.  Each element
+   of small is placed by an exponential search from the previous
+   insertion point, and the run of large before it is copied. */
+static UINT4 *
+gallop_uint4 (UINT4 *large, int nlarge, UINT4 diagterm, UINT4 *small, int nsmall) {
+  UINT4 *_result, *out, value;
+  int i = 0, lo, hi, mid, step, j, k;
+
+  MALLOC_ALIGN(_result,(nlarge + nsmall)*sizeof(UINT4));
+  out = _result;
+
+  for (k = 0; k < nsmall; k++) {
+    value = small[k];
+
+    /* Find first j >= i with large[j] + diagterm > value */
+    step = 1;
+    lo = i;
+    while (lo + step <= nlarge && large[lo + step - 1] + diagterm <= value) {
+      lo += step;
+      step <<= 1;
+    }
+    hi = (lo + step <= nlarge) ? lo + step - 1 : nlarge;
+    while (lo < hi) {
+      mid = lo + (hi - lo)/2;
+      if (large[mid] + diagterm <= value) {
+	lo = mid + 1;
+      } else {
+	hi = mid;
+      }
+    }
+
+    for (j = i; j < lo; j++) {
+      *out++ = large[j] + diagterm;
+    }
+    *out++ = value;
+    i = lo;
+  }
+
+  for (j = i; j < nlarge; j++) {
+    *out++ = large[j] + diagterm;
+  }
+
+  return _result;
+}
+
+
+/* LSD radix sort.  Takes ownership of _array, which must be aligned,
+   and returns the sorted result, freeing whichever buffer is not
+   returned.  Digits that are the same for every element are
+   skipped. */
+static UINT4 *
+radix_uint4 (UINT4 *_array, int n) {
+  UINT4 *_temp, *src, *dest, *swap;
+  int counts[RADIX_MAXDIGITS_UINT4][RADIX_NBUCKETS], *count;
+  int digit, shift, bucket, sum, c, i;
+
+  memset(counts,0,RADIX_MAXDIGITS_UINT4*RADIX_NBUCKETS*sizeof(int));
+  for (i = 0; i < n; i++) {
+    counts[0][_array[i] & RADIX_MASK] += 1;
+    counts[1][(_array[i] >> RADIX_BITS) & RADIX_MASK] += 1;
+    counts[2][_array[i] >> (2*RADIX_BITS)] += 1;
+  }
+
+  MALLOC_ALIGN(_temp,n*sizeof(UINT4));
+  src = _array;
+  dest = _temp;
+
+  for (digit = 0, shift = 0; digit < RADIX_MAXDIGITS_UINT4; digit++, shift += RADIX_BITS) {
+    count = counts[digit];
+    if (count[(src[0] >> shift) & RADIX_MASK] == n) {
+      debug(printf("Skipping digit %d\n",digit));
+    } else {
+      sum = 0;
+      for (bucket = 0; bucket < RADIX_NBUCKETS; bucket++) {
+	c = count[bucket];
+	count[bucket] = sum;
+	sum += c;
+      }
+      for (i = 0; i < n; i++) {
+	dest[count[(src[i] >> shift) & RADIX_MASK]++] = src[i];
+      }
+      swap = src; src = dest; dest = swap;
+    }
+  }
+
+  FREE_ALIGN(dest);
+  return src;
+}
+
+UINT4 *
+Merge_adaptive_uint4 (int *nelts1, Merge_strategy_T strategy, int largesti,
+		      UINT4 **stream_array, int *streamsize_array, int *diagterm_array,
+		      int nstreams, Mergeinfo_uint4_T mergeinfo) {
+  UINT4 *_result, *_small, *out, **rest_stream_array, diagterm;
+  int *rest_streamsize_array, *rest_diagterm_array;
+  int nsmall, total, i, k, l;
+
+  if (strategy == MERGE_RADIX) {
+    total = 0;
+    for (i = 0; i < nstreams; i++) {
+      total += streamsize_array[i];
+    }
+
+    MALLOC_ALIGN(_result,total*sizeof(UINT4));
+    out = _result;
+    for (i = 0; i < nstreams; i++) {
+      if (diagterm_array == NULL) {
+	memcpy(out,stream_array[i],streamsize_array[i]*sizeof(UINT4));
+	out += streamsize_array[i];
+      } else {
+	diagterm = (UINT4) diagterm_array[i];
+	for (l = 0; l < streamsize_array[i]; l++) {
+	  *out++ = stream_array[i][l] + diagterm;
+	}
+      }
+    }
+
+    *nelts1 = total;
+    return radix_uint4(_result,total);
+
+  } else {
+    /* MERGE_GALLOP: Merge the other streams, then insert them into the largest */
+    rest_stream_array = (UINT4 **) MALLOC((nstreams - 1)*sizeof(UINT4 *));
+    rest_streamsize_array = (int *) MALLOC((nstreams - 1)*sizeof(int));
+    rest_diagterm_array = (int *) MALLOC((nstreams - 1)*sizeof(int));
+    for (i = 0, k = 0; i < nstreams; i++) {
+      if (i != largesti) {
+	rest_stream_array[k] = stream_array[i];
+	rest_streamsize_array[k] = streamsize_array[i];
+	rest_diagterm_array[k] = (diagterm_array == NULL) ? 0 : diagterm_array[i];
+	k++;
+      }
+    }
+
+    if (diagterm_array == NULL) {
+      _small = Merge_diagonals_uint4(&nsmall,rest_stream_array,rest_streamsize_array,
+				     nstreams - 1,mergeinfo);
+      diagterm = 0;
+    } else {
+      _small = Merge_diagonals(&nsmall,rest_stream_array,rest_streamsize_array,
+			       rest_diagterm_array,nstreams - 1,mergeinfo);
+      diagterm = (UINT4) diagterm_array[largesti];
+    }
+
+    _result = gallop_uint4(stream_array[largesti],streamsize_array[largesti],diagterm,
+			   _small,nsmall);
+    *nelts1 = streamsize_array[largesti] + nsmall;
+
+    if (_small != NULL) {
+      FREE_ALIGN(_small);
+    }
+    FREE(rest_diagterm_array);
+    FREE(rest_streamsize_array);
+    FREE(rest_stream_array);
+
+    return _result;
+  }
+}
+
+
+#ifdef LARGE_GENOMES
+#define GETPOS(high,low) (((UINT8) high << 32) + low)
+
+static UINT8 *
+gallop_large (unsigned char *large_high, UINT4 *large_low, int nlarge,
+	      UINT8 diagterm, UINT8 *small, int nsmall) {
+  UINT8 *_result, *out, value;
+  int i = 0, lo, hi, mid, step, j, k;
+
+  MALLOC_ALIGN(_result,(nlarge + nsmall)*sizeof(UINT8));
+  out = _result;
+
+  for (k = 0; k < nsmall; k++) {
+    value = small[k];
+
+    step = 1;
+    lo = i;
+    while (lo + step <= nlarge && GETPOS(large_high[lo + step - 1],large_low[lo + step - 1]) + diagterm <= value) {
+      lo += step;
+      step <<= 1;
+    }
+    hi = (lo + step <= nlarge) ? lo + step - 1 : nlarge;
+    while (lo < hi) {
+      mid = lo + (hi - lo)/2;
+      if (GETPOS(large_high[mid],large_low[mid]) + diagterm <= value) {
+	lo = mid + 1;
+      } else {
+	hi = mid;
+      }
+    }
+
+    for (j = i; j < lo; j++) {
+      *out++ = GETPOS(large_high[j],large_low[j]) + diagterm;
+    }
+    *out++ = value;
+    i = lo;
+  }
+
+  for (j = i; j < nlarge; j++) {
+    *out++ = GETPOS(large_high[j],large_low[j]) + diagterm;
+  }
+
+  return _result;
+}
+
+static UINT8 *
+gallop_uint8 (UINT8 *large, int nlarge, UINT8 *small, int nsmall) {
+  UINT8 *_result, *out, value;
+  int i = 0, lo, hi, mid, step, k;
+
+  MALLOC_ALIGN(_result,(nlarge + nsmall)*sizeof(UINT8));
+  out = _result;
+
+  for (k = 0; k < nsmall; k++) {
+    value = small[k];
+
+    step = 1;
+    lo = i;
+    while (lo + step <= nlarge && large[lo + step - 1] <= value) {
+      lo += step;
+      step <<= 1;
+    }
+    hi = (lo + step <= nlarge) ? lo + step - 1 : nlarge;
+    while (lo < hi) {
+      mid = lo + (hi - lo)/2;
+      if (large[mid] <= value) {
+	lo = mid + 1;
+      } else {
+	hi = mid;
+      }
+    }
+
+    memcpy(out,&(large[i]),(lo - i)*sizeof(UINT8));
+    out += lo - i;
+    *out++ = value;
+    i = lo;
+  }
+
+  memcpy(out,&(large[i]),(nlarge - i)*sizeof(UINT8));
+
+  return _result;
+}
+
+static UINT8 *
+radix_uint8 (UINT8 *_array, int n) {
+  UINT8 *_temp, *src, *dest, *swap, all_or = 0;
+  int counts[RADIX_MAXDIGITS_UINT8][RADIX_NBUCKETS], *count;
+  int ndigits, digit, shift, bucket, sum, c, i;
+
+  /* Genomic coordinates use only the low 40 bits or so */
+  for (i = 0; i < n; i++) {
+    all_or |= _array[i];
+  }
+  ndigits = 1;
+  while (ndigits < RADIX_MAXDIGITS_UINT8 && (all_or >> (ndigits*RADIX_BITS)) != 0) {
+    ndigits++;
+  }
+
+  memset(counts,0,ndigits*RADIX_NBUCKETS*sizeof(int));
+  for (i = 0; i < n; i++) {
+    for (digit = 0, shift = 0; digit < ndigits; digit++, shift += RADIX_BITS) {
+      counts[digit][(_array[i] >> shift) & RADIX_MASK] += 1;
+    }
+  }
+
+  MALLOC_ALIGN(_temp,n*sizeof(UINT8));
+  src = _array;
+  dest = _temp;
+
+  for (digit = 0, shift = 0; digit < ndigits; digit++, shift += RADIX_BITS) {
+    count = counts[digit];
+    if (count[(src[0] >> shift) & RADIX_MASK] == n) {
+      debug(printf("Skipping digit %d\n",digit));
+    } else {
+      sum = 0;
+      for (bucket = 0; bucket < RADIX_NBUCKETS; bucket++) {
+	c = count[bucket];
+	count[bucket] = sum;
+	sum += c;
+      }
+      for (i = 0; i < n; i++) {
+	dest[count[(src[i] >> shift) & RADIX_MASK]++] = src[i];
+      }
+      swap = src; src = dest; dest = swap;
+    }
+  }
+
+  FREE_ALIGN(dest);
+  return src;
+}
+
+
+Univcoord_T *
+Merge_adaptive_large (int *nelts1, Merge_strategy_T strategy, int largesti,
+		      unsigned char **stream_high_array, UINT4 **stream_low_array,
+		      int *streamsize_array, int *diagterm_array, int nstreams,
+		      Mergeinfo_uint8_T mergeinfo) {
+  UINT8 *_result, *_small, *out, diagterm;
+  unsigned char **rest_stream_high_array;
+  UINT4 **rest_stream_low_array;
+  int *rest_streamsize_array, *rest_diagterm_array;
+  int nsmall, total, i, k, l;
+
+  if (strategy == MERGE_RADIX) {
+    total = 0;
+    for (i = 0; i < nstreams; i++) {
+      total += streamsize_array[i];
+    }
+
+    MALLOC_ALIGN(_result,total*sizeof(UINT8));
+    out = _result;
+    for (i = 0; i < nstreams; i++) {
+      diagterm = diagterm_array[i];
+      for (l = 0; l < streamsize_array[i]; l++) {
+	*out++ = GETPOS(stream_high_array[i][l],stream_low_array[i][l]) + diagterm;
+      }
+    }
+
+    *nelts1 = total;
+    return radix_uint8(_result,total);
+
+  } else {
+    rest_stream_high_array = (unsigned char **) MALLOC((nstreams - 1)*sizeof(unsigned char *));
+    rest_stream_low_array = (UINT4 **) MALLOC((nstreams - 1)*sizeof(UINT4 *));
+    rest_streamsize_array = (int *) MALLOC((nstreams - 1)*sizeof(int));
+    rest_diagterm_array = (int *) MALLOC((nstreams - 1)*sizeof(int));
+    for (i = 0, k = 0; i < nstreams; i++) {
+      if (i != largesti) {
+	rest_stream_high_array[k] = stream_high_array[i];
+	rest_stream_low_array[k] = stream_low_array[i];
+	rest_streamsize_array[k] = streamsize_array[i];
+	rest_diagterm_array[k] = diagterm_array[i];
+	k++;
+      }
+    }
+
+    _small = Merge_diagonals_large(&nsmall,rest_stream_high_array,rest_stream_low_array,
+				   rest_streamsize_array,rest_diagterm_array,nstreams - 1,mergeinfo);
+    diagterm = diagterm_array[largesti];
+    _result = gallop_large(stream_high_array[largesti],stream_low_array[largesti],
+			   streamsize_array[largesti],diagterm,_small,nsmall);
+    *nelts1 = streamsize_array[largesti] + nsmall;
+
+    if (_small != NULL) {
+      FREE_ALIGN(_small);
+    }
+    FREE(rest_diagterm_array);
+    FREE(rest_streamsize_array);
+    FREE(rest_stream_low_array);
+    FREE(rest_stream_high_array);
+
+    return _result;
+  }
+}
+
+
+Univcoord_T *
+Merge_adaptive_uint8 (int *nelts1, Merge_strategy_T strategy, int largesti,
+		      Univcoord_T **stream_array, int *streamsize_array,
+		      int nstreams, Mergeinfo_uint8_T mergeinfo) {
+  UINT8 *_result, *_small, *out, **rest_stream_array;
+  int *rest_streamsize_array;
+  int nsmall, total, i, k;
+
+  if (strategy == MERGE_RADIX) {
+    total = 0;
+    for (i = 0; i < nstreams; i++) {
+      total += streamsize_array[i];
+    }
+
+    MALLOC_ALIGN(_result,total*sizeof(UINT8));
+    out = _result;
+    for (i = 0; i < nstreams; i++) {
+      memcpy(out,stream_array[i],streamsize_array[i]*sizeof(UINT8));
+      out += streamsize_array[i];
+    }
+
+    *nelts1 = total;
+    return radix_uint8(_result,total);
+
+  } else {
+    rest_stream_array = (UINT8 **) MALLOC((nstreams - 1)*sizeof(UINT8 *));
+    rest_streamsize_array = (int *) MALLOC((nstreams - 1)*sizeof(int));
+    for (i = 0, k = 0; i < nstreams; i++) {
+      if (i != largesti) {
+	rest_stream_array[k] = stream_array[i];
+	rest_streamsize_array[k] = streamsize_array[i];
+	k++;
+      }
+    }
+
+    _small = Merge_diagonals_uint8(&nsmall,rest_stream_array,rest_streamsize_array,
+				   nstreams - 1,mergeinfo);
+    _result = gallop_uint8(stream_array[largesti],streamsize_array[largesti],_small,nsmall);
+    *nelts1 = streamsize_array[largesti] + nsmall;
+
+    if (_small != NULL) {
+      FREE_ALIGN(_small);
+    }
+    FREE(rest_streamsize_array);
+    FREE(rest_stream_array);
+
+    return _result;
+  }
+}
+#endif
+
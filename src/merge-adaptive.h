@@ -0,0 +1,52 @@
+/* $Id$ */
+#ifndef MERGE_ADAPTIVE_INCLUDED
+#define MERGE_ADAPTIVE_INCLUDED
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "types.h"
+#include "univcoord.h"
+#include "mergeinfo.h"
+
+
+/* Choice of algorithm for merging the position streams of a read,
+   based on the distribution of stream sizes.  MERGE_PYRAMID is the
+   existing merge in merge-diagonals-*.c.  MERGE_GALLOP is used for
+   a few streams or when one stream dominates: the others are merged
+   among themselves and then inserted into the largest one by
+   galloping search.  MERGE_RADIX is used for many streams of
+   comparable size, which are concatenated and radix sorted. */
+
+typedef enum {MERGE_PYRAMID, MERGE_GALLOP, MERGE_RADIX} Merge_strategy_T;
+
+extern Merge_strategy_T
+Merge_adaptive_strategy (int *largesti, int *streamsize_array, int nstreams);
+
+#ifdef MERGE_ADAPTIVE_BENCH
+/* Forces the next choice, or restores the adaptive choice if strategy is -1 */
+extern void
+Merge_adaptive_force (int strategy);
+#endif
+
+/* For MERGE_GALLOP and MERGE_RADIX.  diagterm_array may be NULL.
+   Input streams are not modified, and output is aligned. */
+extern UINT4 *
+Merge_adaptive_uint4 (int *nelts1, Merge_strategy_T strategy, int largesti,
+		      UINT4 **stream_array, int *streamsize_array, int *diagterm_array,
+		      int nstreams, Mergeinfo_uint4_T mergeinfo);
+
+#ifdef LARGE_GENOMES
+extern Univcoord_T *
+Merge_adaptive_large (int *nelts1, Merge_strategy_T strategy, int largesti,
+		      unsigned char **stream_high_array, UINT4 **stream_low_array,
+		      int *streamsize_array, int *diagterm_array, int nstreams,
+		      Mergeinfo_uint8_T mergeinfo);
+extern Univcoord_T *
+Merge_adaptive_uint8 (int *nelts1, Merge_strategy_T strategy, int largesti,
+		      Univcoord_T **stream_array, int *streamsize_array,
+		      int nstreams, Mergeinfo_uint8_T mergeinfo);
+#endif
+
+#endif
+
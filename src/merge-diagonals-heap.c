@@ -7,6 +7,7 @@ static char rcsid[] = "$Id: merge-diagonals-heap.c 224755 2021-12-13 00:42:15Z t
 #include "assert.h"
 #include "mem.h"
 #include "list.h"
+#include "merge-adaptive.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -183,6 +184,8 @@ Merge_diagonals_large (int *nelts, unsigned char **stream_high_array, UINT4 **st
   int streami;
   List_T free_list, p;
   int l;
+  Merge_strategy_T strategy;
+  int largesti;
 
   if (nstreams == 0) {
     *nelts = 0;
@@ -201,6 +204,10 @@ Merge_diagonals_large (int *nelts, unsigned char **stream_high_array, UINT4 **st
 
     return result;
 
+  } else if ((strategy = Merge_adaptive_strategy(&largesti,streamsize_array,nstreams)) != MERGE_PYRAMID) {
+    return Merge_adaptive_large(&(*nelts),strategy,largesti,stream_high_array,stream_low_array,
+				streamsize_array,diagterm_array,nstreams,mergeinfo);
+
   } else {
     *nelts = 0;
     for (streami = 0; streami < nstreams; streami++) {
@@ -297,6 +304,8 @@ Merge_diagonals_uint8 (int *nelts, Univcoord_T **stream_array, int *streamsize_a
   Univcoord_T *_result, *out, *diagonals, diagonal;
   List_T free_list, p;
   int streami;
+  Merge_strategy_T strategy;
+  int largesti;
 
   if (nstreams == 0) {
     *nelts = 0;
@@ -310,6 +319,10 @@ Merge_diagonals_uint8 (int *nelts, Univcoord_T **stream_array, int *streamsize_a
     memcpy(_result,stream,(*nelts)*sizeof(Univcoord_T));
     return _result;
 
+  } else if ((strategy = Merge_adaptive_strategy(&largesti,streamsize_array,nstreams)) != MERGE_PYRAMID) {
+    return Merge_adaptive_uint8(&(*nelts),strategy,largesti,stream_array,streamsize_array,
+				nstreams,mergeinfo);
+
   } else {
     *nelts = 0;
     for (streami = 0; streami < nstreams; streami++) {
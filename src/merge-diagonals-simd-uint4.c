@@ -9,6 +9,7 @@ static char rcsid[] = "$Id: merge-diagonals-simd-uint4.c 226315 2023-02-28 18:22
 #include "popcount.h"		/* For clz_table */
 #include "sedgesort.h"
 #include "merge-uint4.h"
+#include "merge-adaptive.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -49,6 +50,42 @@ static char rcsid[] = "$Id: merge-diagonals-simd-uint4.c 226315 2023-02-28 18:22
 #endif
 
 
+#ifdef MERGE_RECORD
+/* Compile with -DMERGE_RECORD and set the environment variable
+   MERGE_RECORD to a filename to record every merge of two or more
+   streams, for timing with merge_adaptive_bench.  Each record is
+   nstreams, a flag for whether diagterms follow, the stream sizes,
+   the diagterms if present, and the streams, all in native byte
+   order.  Not thread-safe, so run with -t 1. */
+static void
+record_streams (UINT4 **stream_array, int *streamsize_array, int *diagterm_array, int nstreams) {
+  static FILE *fp = NULL;
+  char *filename;
+  int diagtermsp = (diagterm_array != NULL), i;
+
+  if (fp == NULL) {
+    if ((filename = getenv("MERGE_RECORD")) == NULL) {
+      return;
+    } else if ((fp = fopen(filename,"wb")) == NULL) {
+      fprintf(stderr,"Cannot open %s for writing\n",filename);
+      exit(9);
+    }
+  }
+
+  fwrite(&nstreams,sizeof(int),1,fp);
+  fwrite(&diagtermsp,sizeof(int),1,fp);
+  fwrite(streamsize_array,sizeof(int),nstreams,fp);
+  if (diagtermsp) {
+    fwrite(diagterm_array,sizeof(int),nstreams,fp);
+  }
+  for (i = 0; i < nstreams; i++) {
+    fwrite(stream_array[i],sizeof(UINT4),streamsize_array[i],fp);
+  }
+  return;
+}
+#endif
+
+
 #ifdef CHECK_INPUTS
 static void
 check_ascending (unsigned int *diagonals, int ndiagonals) {
@@ -250,11 +287,19 @@ Merge_diagonals (int *nelts1, UINT4 **stream_array, int *streamsize_array,
   int l;
   int ncopied, heapi, heapsize, base, ancestori, pyramid_start, pyramid_end;
   int bits;
+  Merge_strategy_T strategy;
+  int largesti;
 #ifdef DEBUG
   int i;
 #endif
 
 
+#ifdef MERGE_RECORD
+  if (nstreams >= 2) {
+    record_streams(stream_array,streamsize_array,diagterm_array,nstreams);
+  }
+#endif
+
   if (nstreams == 0) {
     *nelts1 = 0;
     return (UINT4 *) NULL;
@@ -283,6 +328,10 @@ Merge_diagonals (int *nelts1, UINT4 **stream_array, int *streamsize_array,
 
     return _result;
 
+  } else if ((strategy = Merge_adaptive_strategy(&largesti,streamsize_array,nstreams)) != MERGE_PYRAMID) {
+    return Merge_adaptive_uint4(&(*nelts1),strategy,largesti,stream_array,streamsize_array,diagterm_array,
+				nstreams,mergeinfo);
+
   } else {
     ncopied = make_diagonals_heap(mergeinfo,stream_array,streamsize_array,diagterm_array,nstreams);
     if (ncopied == 1) {
@@ -457,11 +506,19 @@ Merge_diagonals_uint4 (int *nelts1, UINT4 **stream_array, int *streamsize_array,
   UINT4 *_result, *stream;
   int ncopied, heapi, heapsize, base, ancestori, pyramid_start, pyramid_end;
   int bits;
+  Merge_strategy_T strategy;
+  int largesti;
 #ifdef DEBUG
   int i;
 #endif
 
 
+#ifdef MERGE_RECORD
+  if (nstreams >= 2) {
+    record_streams(stream_array,streamsize_array,/*diagterm_array*/NULL,nstreams);
+  }
+#endif
+
   if (nstreams == 0) {
     *nelts1 = 0;
     return (UINT4 *) NULL;
@@ -483,6 +540,10 @@ Merge_diagonals_uint4 (int *nelts1, UINT4 **stream_array, int *streamsize_array,
       return _result;
     }
 
+  } else if ((strategy = Merge_adaptive_strategy(&largesti,streamsize_array,nstreams)) != MERGE_PYRAMID) {
+    return Merge_adaptive_uint4(&(*nelts1),strategy,largesti,stream_array,streamsize_array,/*diagterm_array*/NULL,
+				nstreams,mergeinfo);
+
   } else {
     ncopied = make_univdiagonals_heap(mergeinfo,stream_array,streamsize_array,nstreams);
     if (ncopied == 1) {
@@ -9,6 +9,7 @@ static char rcsid[] = "$Id: merge-diagonals-simd-uint8.c 226315 2023-02-28 18:22
 #include "popcount.h"		/* For clz_table */
 #include "sedgesort.h"
 #include "merge-uint8.h"
+#include "merge-adaptive.h"
 
 #include <stdio.h>
 #include <stdlib.h>
@@ -241,6 +242,8 @@ Merge_diagonals_large (int *nelts1, unsigned char **stream_high_array, UINT4 **s
   int l;
   int ncopied, heapi, heapsize, base, ancestori, pyramid_start, pyramid_end;
   int bits;
+  Merge_strategy_T strategy;
+  int largesti;
 #ifdef DEBUG
   int i;
 #endif
@@ -264,6 +267,10 @@ Merge_diagonals_large (int *nelts1, unsigned char **stream_high_array, UINT4 **s
 
     return result;
 
+  } else if ((strategy = Merge_adaptive_strategy(&largesti,streamsize_array,nstreams)) != MERGE_PYRAMID) {
+    return Merge_adaptive_large(&(*nelts1),strategy,largesti,stream_high_array,stream_low_array,
+				streamsize_array,diagterm_array,nstreams,mergeinfo);
+
   } else {
     ncopied = make_diagonals_heap(mergeinfo,stream_high_array,stream_low_array,
 				  streamsize_array,diagterm_array,nstreams);
@@ -444,6 +451,8 @@ Merge_diagonals_uint8 (int *nelts1, Univcoord_T **stream_array, int *streamsize_
   Univcoord_T *_result, *stream;
   int ncopied, heapi, heapsize, base, ancestori, pyramid_start, pyramid_end;
   int bits;
+  Merge_strategy_T strategy;
+  int largesti;
 #ifdef DEBUG
   int i;
 #endif
@@ -469,6 +478,10 @@ Merge_diagonals_uint8 (int *nelts1, Univcoord_T **stream_array, int *streamsize_
 
     return _result;
 
+  } else if ((strategy = Merge_adaptive_strategy(&largesti,streamsize_array,nstreams)) != MERGE_PYRAMID) {
+    return Merge_adaptive_uint8(&(*nelts1),strategy,largesti,stream_array,streamsize_array,
+				nstreams,mergeinfo);
+
   } else {
     ncopied = make_univdiagonals_heap(mergeinfo,stream_array,streamsize_array,nstreams);
     if (ncopied == 1) {
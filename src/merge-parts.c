@@ -0,0 +1,330 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+/* Combines the outputs of several GSNAP runs with --part=i/n into a
+   single output in input order.  Each run must also have been given
+   --part-index, which records the input index and byte length of
+   every output record.  The records are copied through with a k-way
+   merge on the input index, so memory usage does not depend on the
+   size of the outputs. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "bool.h"
+#include "mem.h"
+#include "getopt.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+#define COPY_BUFFER_SIZE 65536
+#define LINELENGTH 1024
+
+
+/* Program Options */
+static char *output_file = NULL;
+static char *index_suffix = ".index";
+
+
+static struct option long_options[] = {
+  {"output-file", required_argument, 0, 'o'}, /* output_file */
+  {"index-suffix", required_argument, 0, 0}, /* index_suffix */
+
+  /* Help options */
+  {"version", no_argument, 0, '^'}, /* print_program_version */
+  {"help", no_argument, 0, '?'}, /* print_program_usage */
+  {0, 0, 0, 0}
+};
+
+
+static void
+print_program_version () {
+  fprintf(stdout,"\n");
+  fprintf(stdout,"merge_parts: combines outputs from gsnap --part runs in input order\n");
+  fprintf(stdout,"Part of GMAP package, version %s\n",PACKAGE_VERSION);
+  fprintf(stdout,"Thomas D. Wu, Genentech, Inc.\n");
+  fprintf(stdout,"Contact: twu@gene.com\n");
+  fprintf(stdout,"\n");
+  return;
+}
+
+static void
+print_program_usage () {
+  fprintf(stdout,"\
+Usage: merge_parts [OPTIONS...] <part output> <part output>...\n\
+\n\
+Each part output must have been written by gsnap with --part=i/n,\n\
+-o <part output>, and --part-index=<part output><index suffix>.\n\
+SAM header lines are taken from the first part and skipped in the\n\
+others.\n\
+\n\
+Options\n\
+  -o, --output-file=STRING       Write the merged output to the given file (default is stdout)\n\
+  --index-suffix=STRING          Suffix of the index files (default .index)\n\
+\n\
+  --version                      Show version\n\
+  --help                         Show this help message\n\
+");
+  return;
+}
+
+
+typedef struct Part_T *Part_T;
+struct Part_T {
+  char *filename;
+  FILE *fp;
+  FILE *index_fp;
+  int lineno;
+
+  unsigned int inputid;		/* Of the next record */
+  unsigned long nbytes;		/* Of the next record */
+  bool validp;
+};
+
+
+/* Returns true if another record is available */
+static bool
+Part_advance (Part_T this) {
+  char line[LINELENGTH];
+  unsigned int inputid;
+
+  if (fgets(line,LINELENGTH,this->index_fp) == NULL) {
+    this->validp = false;
+    return false;
+  }
+  this->lineno++;
+
+  if (sscanf(line,"%u %lu",&inputid,&this->nbytes) != 2) {
+    fprintf(stderr,"Cannot parse line %d of the index for %s: %s",this->lineno,this->filename,line);
+    exit(9);
+  } else if (this->validp == true && inputid <= this->inputid) {
+    fprintf(stderr,"Index for %s is not in input order at line %d (%u after %u).  Was gsnap run with --ordered?\n",
+	    this->filename,this->lineno,inputid,this->inputid);
+    exit(9);
+  }
+
+  this->inputid = inputid;
+  this->validp = true;
+  return true;
+}
+
+
+static Part_T
+Part_new (char *filename) {
+  Part_T new = (Part_T) MALLOC(sizeof(*new));
+  char *index_filename;
+
+  new->filename = filename;
+  if ((new->fp = fopen(filename,"r")) == NULL) {
+    fprintf(stderr,"Cannot open part output %s\n",filename);
+    exit(9);
+  }
+
+  index_filename = (char *) MALLOC((strlen(filename)+strlen(index_suffix)+1)*sizeof(char));
+  sprintf(index_filename,"%s%s",filename,index_suffix);
+  if ((new->index_fp = fopen(index_filename,"r")) == NULL) {
+    fprintf(stderr,"Cannot open part index %s.  Was gsnap run with --part-index?\n",index_filename);
+    exit(9);
+  }
+  FREE(index_filename);
+
+  new->lineno = 0;
+  new->inputid = 0;
+  new->validp = false;
+  Part_advance(new);
+
+  return new;
+}
+
+
+static void
+Part_free (Part_T *old) {
+  if (getc((*old)->fp) != EOF) {
+    fprintf(stderr,"Part output %s has more bytes than listed in its index\n",(*old)->filename);
+    exit(9);
+  }
+  fclose((*old)->index_fp);
+  fclose((*old)->fp);
+  FREE(*old);
+  return;
+}
+
+
+/* Handles the SAM header lines at the start of a part output.  Copies
+   them if output is non-NULL, and skips them otherwise */
+static void
+Part_header (Part_T this, FILE *output) {
+  char buffer[COPY_BUFFER_SIZE];
+  int c;
+
+  while ((c = getc(this->fp)) == '@') {
+    ungetc(c,this->fp);
+    do {
+      if (fgets(buffer,COPY_BUFFER_SIZE,this->fp) == NULL) {
+	return;
+      } else if (output != NULL) {
+	fputs(buffer,output);
+      }
+    } while (buffer[strlen(buffer)-1] != '\n');
+  }
+
+  if (c != EOF) {
+    ungetc(c,this->fp);
+  }
+  return;
+}
+
+
+static void
+Part_copy_record (Part_T this, FILE *output) {
+  char buffer[COPY_BUFFER_SIZE];
+  unsigned long nleft = this->nbytes;
+  size_t nread, nwant;
+
+  while (nleft > 0) {
+    nwant = (nleft < COPY_BUFFER_SIZE) ? (size_t) nleft : COPY_BUFFER_SIZE;
+    if ((nread = fread(buffer,sizeof(char),nwant,this->fp)) != nwant) {
+      fprintf(stderr,"Part output %s is shorter than listed in its index (record %u)\n",
+	      this->filename,this->inputid);
+      exit(9);
+    }
+    fwrite(buffer,sizeof(char),nread,output);
+    nleft -= nread;
+  }
+
+  return;
+}
+
+
+/* Min-heap of parts, keyed on the input index of the next record */
+
+static void
+heap_sift_down (Part_T *heap, int n, int i) {
+  Part_T tmp;
+  int child;
+
+  while ((child = 2*i + 1) < n) {
+    if (child + 1 < n && heap[child+1]->inputid < heap[child]->inputid) {
+      child++;
+    }
+    if (heap[i]->inputid <= heap[child]->inputid) {
+      return;
+    } else {
+      tmp = heap[i];
+      heap[i] = heap[child];
+      heap[child] = tmp;
+      i = child;
+    }
+  }
+
+  return;
+}
+
+
+int
+main (int argc, char *argv[]) {
+  Part_T *parts, *heap;
+  FILE *output;
+  int nparts, nheap, i;
+  unsigned int last_inputid = 0;
+  bool firstp = true;
+
+  int opt;
+  extern int optind;
+  extern char *optarg;
+  int long_option_index = 0;
+  const char *long_name;
+
+  while ((opt = getopt_long(argc,argv,"o:^?",
+			    long_options,&long_option_index)) != -1) {
+    switch (opt) {
+    case 0:
+      long_name = long_options[long_option_index].name;
+      if (!strcmp(long_name,"version")) {
+	print_program_version();
+	exit(0);
+      } else if (!strcmp(long_name,"help")) {
+	print_program_usage();
+	exit(0);
+      } else if (!strcmp(long_name,"index-suffix")) {
+	index_suffix = optarg;
+      } else {
+	/* Shouldn't reach here */
+	fprintf(stderr,"Don't recognize option %s.  For usage, run 'merge_parts --help'",long_name);
+	exit(9);
+      }
+      break;
+
+    case 'o': output_file = optarg; break;
+    case '^': print_program_version(); exit(0);
+    case '?': print_program_usage(); exit(0);
+    default: exit(9);
+    }
+  }
+  argc -= optind;
+  argv += optind;
+
+  if ((nparts = argc) == 0) {
+    fprintf(stderr,"Need to specify at least one part output.  For usage, run 'merge_parts --help'\n");
+    exit(9);
+  }
+
+  if (output_file == NULL) {
+    output = stdout;
+  } else if ((output = fopen(output_file,"w")) == NULL) {
+    fprintf(stderr,"Cannot open file %s for writing\n",output_file);
+    exit(9);
+  }
+
+  parts = (Part_T *) MALLOC(nparts*sizeof(Part_T));
+  heap = (Part_T *) MALLOC(nparts*sizeof(Part_T));
+  nheap = 0;
+  for (i = 0; i < nparts; i++) {
+    parts[i] = Part_new(argv[i]);
+    Part_header(parts[i],(i == 0) ? output : (FILE *) NULL);
+    if (parts[i]->validp == true) {
+      heap[nheap++] = parts[i];
+    }
+  }
+
+  for (i = nheap/2 - 1; i >= 0; i--) {
+    heap_sift_down(heap,nheap,i);
+  }
+
+  while (nheap > 0) {
+    if (firstp == false && heap[0]->inputid == last_inputid) {
+      fprintf(stderr,"Input index %u appears in more than one part.  Were the parts run with the same --part denominator?\n",
+	      last_inputid);
+      exit(9);
+    }
+    debug(fprintf(stderr,"Copying record %u from %s\n",heap[0]->inputid,heap[0]->filename));
+    Part_copy_record(heap[0],output);
+    last_inputid = heap[0]->inputid;
+    firstp = false;
+
+    if (Part_advance(heap[0]) == false) {
+      heap[0] = heap[--nheap];
+    }
+    heap_sift_down(heap,nheap,0);
+  }
+
+  for (i = 0; i < nparts; i++) {
+    Part_free(&(parts[i]));
+  }
+  FREE(heap);
+  FREE(parts);
+
+  if (output != stdout) {
+    fclose(output);
+  }
+
+  return 0;
+}
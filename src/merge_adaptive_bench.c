@@ -0,0 +1,380 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+/* Timing benchmark for the strategies chosen by
+   Merge_adaptive_strategy.  Built only on request, by "make
+   merge_adaptive_bench", using the highest SIMD level that the
+   compiler supports.  Replays merges recorded from real runs (see
+   MERGE_RECORD in merge-diagonals-simd-uint4.c), such as the
+   tests/merge-streams.*.gz files, and times the pyramid, gallop, and
+   radix merges and the adaptive choice on each one, after checking
+   that they give the same result.  These are the measurements behind
+   MIN_TOTAL, GALLOP_RATIO, and RADIX_MIN_* in merge-adaptive.c.
+
+   Usage: merge_adaptive_bench [-v] [-m MINTOTAL] FILE
+            Sums the times over recorded merges of at least MINTOTAL
+            elements, printing each one with -v.
+          merge_adaptive_bench -s [-d] FILE
+            Times subsets of the largest recorded merge, with 2 to 86
+            streams truncated to 8 to 512 elements each.  With -d, the
+            first stream is replaced by the union of all of them, to
+            see where one dominant stream favors galloping. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+
+#include "bool.h"
+#include "types.h"
+#include "mem.h"
+#include "stopwatch.h"
+#include "mergeinfo.h"
+#include "merge-adaptive.h"
+#include "merge-diagonals-simd-uint4.h"
+
+
+#define NREPS 5			/* Best of, for recorded merges */
+#define SWEEP_NREPS 7
+#define ADAPTIVE -1
+
+static int sweep_nstreams[] = {2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 86};
+#define SWEEP_NNSTREAMS (int) (sizeof(sweep_nstreams)/sizeof(int))
+static int sweep_maxsizes[] = {8, 16, 32, 64, 128, 256, 512, 100000};
+#define SWEEP_NMAXSIZES (int) (sizeof(sweep_maxsizes)/sizeof(int))
+
+
+typedef struct Record_T *Record_T;
+struct Record_T {
+  int nstreams;
+  bool diagtermsp;
+  int *streamsizes;
+  int *diagterms;		/* All zero if !diagtermsp */
+  UINT4 **streams;
+  int total;
+  int max;
+};
+
+
+#ifdef HAVE_ZLIB
+typedef gzFile Input_T;
+#define input_open(filename) gzopen(filename,"rb")
+#define input_close(input) gzclose(input)
+static bool
+input_read (void *buffer, size_t size, int n, Input_T input) {
+  return gzread(input,buffer,size*n) == (int) (size*n);
+}
+#else
+typedef FILE *Input_T;
+#define input_open(filename) fopen(filename,"rb")
+#define input_close(input) fclose(input)
+static bool
+input_read (void *buffer, size_t size, int n, Input_T input) {
+  return fread(buffer,size,n,input) == (size_t) n;
+}
+#endif
+
+
+static struct Record_T *
+read_records (int *nrecords, char *filename) {
+  struct Record_T *records = NULL, *record;
+  Input_T input;
+  int nalloc = 0, nstreams, diagtermsp, i;
+
+  if ((input = input_open(filename)) == NULL) {
+    fprintf(stderr,"Cannot open file %s\n",filename);
+    exit(9);
+  }
+
+  *nrecords = 0;
+  while (input_read(&nstreams,sizeof(int),1,input) == true) {
+    if (*nrecords == nalloc) {
+      if (nalloc == 0) {
+	nalloc = 1024;
+	records = (struct Record_T *) MALLOC(nalloc*sizeof(struct Record_T));
+      } else {
+	nalloc *= 2;
+	RESIZE(records,nalloc*sizeof(struct Record_T));
+      }
+    }
+    record = &(records[(*nrecords)++]);
+    record->nstreams = nstreams;
+    record->streamsizes = (int *) MALLOC(nstreams*sizeof(int));
+    record->diagterms = (int *) CALLOC(nstreams,sizeof(int));
+    record->streams = (UINT4 **) MALLOC(nstreams*sizeof(UINT4 *));
+
+    if (input_read(&diagtermsp,sizeof(int),1,input) == false ||
+	input_read(record->streamsizes,sizeof(int),nstreams,input) == false ||
+	(diagtermsp && input_read(record->diagterms,sizeof(int),nstreams,input) == false)) {
+      fprintf(stderr,"File %s is truncated\n",filename);
+      exit(9);
+    }
+    record->diagtermsp = (diagtermsp != 0);
+
+    record->total = record->max = 0;
+    for (i = 0; i < nstreams; i++) {
+      record->streams[i] = (UINT4 *) MALLOC((record->streamsizes[i] + 1)*sizeof(UINT4));
+      if (input_read(record->streams[i],sizeof(UINT4),record->streamsizes[i],input) == false) {
+	fprintf(stderr,"File %s is truncated\n",filename);
+	exit(9);
+      }
+      record->total += record->streamsizes[i];
+      if (record->streamsizes[i] > record->max) {
+	record->max = record->streamsizes[i];
+      }
+    }
+  }
+  input_close(input);
+
+  return records;
+}
+
+static void
+free_records (struct Record_T *records, int nrecords) {
+  int recordi, i;
+
+  for (recordi = 0; recordi < nrecords; recordi++) {
+    for (i = 0; i < records[recordi].nstreams; i++) {
+      FREE(records[recordi].streams[i]);
+    }
+    FREE(records[recordi].streams);
+    FREE(records[recordi].diagterms);
+    FREE(records[recordi].streamsizes);
+  }
+  FREE(records);
+  return;
+}
+
+
+/* Returns the best time over nreps, in microseconds, and a checksum
+   of the merged result from the first rep */
+static double
+time_merge (unsigned long long *checksum, Record_T record, int strategy, int nreps,
+	    Mergeinfo_uint4_T mergeinfo) {
+  Stopwatch_T stopwatch;
+  UINT4 *result;
+  double runtime, best = 0.0;
+  int nelts, rep, i;
+
+  stopwatch = Stopwatch_new();
+  for (rep = 0; rep < nreps; rep++) {
+    Merge_adaptive_force(strategy);
+    Stopwatch_start(stopwatch);
+    if (record->diagtermsp == true) {
+      result = Merge_diagonals(&nelts,record->streams,record->streamsizes,record->diagterms,
+			       record->nstreams,mergeinfo);
+    } else {
+      result = Merge_diagonals_uint4(&nelts,record->streams,record->streamsizes,
+				     record->nstreams,mergeinfo);
+    }
+    runtime = Stopwatch_stop(stopwatch);
+    if (rep == 0 || runtime < best) {
+      best = runtime;
+    }
+
+    if (rep == 0) {
+      *checksum = (unsigned long long) nelts;
+      for (i = 0; i < nelts; i++) {
+	if (i > 0 && result[i] < result[i-1]) {
+	  fprintf(stderr,"Strategy %d gave an unsorted result\n",strategy);
+	  exit(9);
+	}
+	*checksum = (*checksum)*31 + result[i];
+      }
+    }
+    FREE_ALIGN(result);
+  }
+  Stopwatch_free(&stopwatch);
+  Merge_adaptive_force(ADAPTIVE);
+
+  return best * 1e6;
+}
+
+/* Times all strategies on record, in the order pyramid, gallop,
+   radix, adaptive, and checks that their results agree */
+static void
+time_strategies (double *times, Record_T record, int nreps, Mergeinfo_uint4_T mergeinfo) {
+  static int strategies[] = {MERGE_PYRAMID, MERGE_GALLOP, MERGE_RADIX, ADAPTIVE};
+  unsigned long long checksum, checksum0 = 0;
+  int k;
+
+  for (k = 0; k < 4; k++) {
+    times[k] = time_merge(&checksum,record,strategies[k],nreps,mergeinfo);
+    if (k == 0) {
+      checksum0 = checksum;
+    } else if (checksum != checksum0) {
+      fprintf(stderr,"Strategy %d disagrees with the pyramid merge on %d streams of %d elements\n",
+	      strategies[k],record->nstreams,record->total);
+      exit(9);
+    }
+  }
+  return;
+}
+
+
+static void
+replay (struct Record_T *records, int nrecords, int mintotal, bool verbosep,
+	Mergeinfo_uint4_T mergeinfo) {
+  double times[4], sums[4] = {0.0, 0.0, 0.0, 0.0};
+  int nmerges = 0, recordi, k;
+
+  for (recordi = 0; recordi < nrecords; recordi++) {
+    if (records[recordi].total >= mintotal) {
+      time_strategies(times,&(records[recordi]),NREPS,mergeinfo);
+      for (k = 0; k < 4; k++) {
+	sums[k] += times[k];
+      }
+      nmerges++;
+      if (verbosep == true) {
+	printf("nstreams %d total %d max %d  pyramid %.1f gallop %.1f radix %.1f adaptive %.1f us\n",
+	       records[recordi].nstreams,records[recordi].total,records[recordi].max,
+	       times[0],times[1],times[2],times[3]);
+      }
+    }
+  }
+
+  printf("%d merges: pyramid %.1f gallop %.1f radix %.1f adaptive %.1f us\n",
+	 nmerges,sums[0],sums[1],sums[2],sums[3]);
+  return;
+}
+
+
+static int
+uint4_cmp (const void *x, const void *y) {
+  UINT4 a = * (UINT4 *) x;
+  UINT4 b = * (UINT4 *) y;
+
+  if (a < b) {
+    return -1;
+  } else if (a > b) {
+    return +1;
+  } else {
+    return 0;
+  }
+}
+
+static void
+sweep (struct Record_T *records, int nrecords, bool dominantp, Mergeinfo_uint4_T mergeinfo) {
+  Record_T largest = &(records[0]);
+  struct Record_T subset;
+  UINT4 *all;
+  double times[4];
+  int nall = 0, nstreams, maxsize, recordi, ni, si, i, j;
+
+  for (recordi = 1; recordi < nrecords; recordi++) {
+    if (records[recordi].total > largest->total) {
+      largest = &(records[recordi]);
+    }
+  }
+
+  /* The union of the largest merge, for the dominant stream */
+  all = (UINT4 *) MALLOC((largest->total + 1)*sizeof(UINT4));
+  for (i = 0; i < largest->nstreams; i++) {
+    for (j = 0; j < largest->streamsizes[i]; j++) {
+      all[nall++] = largest->streams[i][j] + largest->diagterms[i];
+    }
+  }
+  qsort(all,nall,sizeof(UINT4),uint4_cmp);
+
+  subset.diagtermsp = true;
+  subset.streamsizes = (int *) MALLOC(largest->nstreams*sizeof(int));
+  subset.diagterms = (int *) MALLOC(largest->nstreams*sizeof(int));
+  subset.streams = (UINT4 **) MALLOC(largest->nstreams*sizeof(UINT4 *));
+
+  for (ni = 0; ni < SWEEP_NNSTREAMS; ni++) {
+    if ((nstreams = sweep_nstreams[ni]) <= largest->nstreams) {
+      for (si = 0; si < SWEEP_NMAXSIZES; si++) {
+	maxsize = sweep_maxsizes[si];
+	subset.nstreams = nstreams;
+	for (i = 0; i < nstreams; i++) {
+	  subset.streams[i] = largest->streams[i];
+	  subset.diagterms[i] = largest->diagterms[i];
+	  subset.streamsizes[i] = (largest->streamsizes[i] < maxsize) ? largest->streamsizes[i] : maxsize;
+	}
+	if (dominantp == true) {
+	  subset.streams[0] = all;
+	  subset.diagterms[0] = 0;
+	  subset.streamsizes[0] = nall;
+	}
+
+	subset.total = subset.max = 0;
+	for (i = 0; i < nstreams; i++) {
+	  subset.total += subset.streamsizes[i];
+	  if (subset.streamsizes[i] > subset.max) {
+	    subset.max = subset.streamsizes[i];
+	  }
+	}
+
+	time_strategies(times,&subset,SWEEP_NREPS,mergeinfo);
+	printf("nstreams %d total %d max %d ratio %.1f  pyramid %.1f gallop %.1f radix %.1f adaptive %.1f us\n",
+	       nstreams,subset.total,subset.max,
+	       (subset.total > subset.max) ? (double) subset.max/(double) (subset.total - subset.max) : 0.0,
+	       times[0],times[1],times[2],times[3]);
+      }
+    }
+  }
+
+  FREE(subset.streams);
+  FREE(subset.diagterms);
+  FREE(subset.streamsizes);
+  FREE(all);
+  return;
+}
+
+
+static void
+usage () {
+  fprintf(stderr,"Usage: merge_adaptive_bench [-v] [-m MINTOTAL] FILE\n");
+  fprintf(stderr,"       merge_adaptive_bench -s [-d] FILE\n");
+  exit(9);
+}
+
+int
+main (int argc, char *argv[]) {
+  struct Record_T *records;
+  Mergeinfo_uint4_T mergeinfo;
+  char *filename = NULL;
+  bool verbosep = false, sweepp = false, dominantp = false;
+  int nrecords, mintotal = 0, argi;
+
+  for (argi = 1; argi < argc; argi++) {
+    if (!strcmp(argv[argi],"-v")) {
+      verbosep = true;
+    } else if (!strcmp(argv[argi],"-s")) {
+      sweepp = true;
+    } else if (!strcmp(argv[argi],"-d")) {
+      dominantp = true;
+    } else if (!strcmp(argv[argi],"-m") && argi + 1 < argc) {
+      mintotal = atoi(argv[++argi]);
+    } else if (argv[argi][0] == '-' || filename != NULL) {
+      usage();
+    } else {
+      filename = argv[argi];
+    }
+  }
+  if (filename == NULL) {
+    usage();
+  }
+
+  records = read_records(&nrecords,filename);
+  if (nrecords == 0) {
+    fprintf(stderr,"No merges in %s\n",filename);
+    exit(9);
+  }
+
+  /* Enough for any recorded merge */
+  mergeinfo = Mergeinfo_uint4_new(/*querylength*/300,/*max_localdb_distance*/200000);
+  if (sweepp == true) {
+    sweep(records,nrecords,dominantp,mergeinfo);
+  } else {
+    replay(records,nrecords,mintotal,verbosep,mergeinfo);
+  }
+  Mergeinfo_uint4_free(&mergeinfo);
+
+  free_records(records,nrecords);
+  return 0;
+}
@@ -0,0 +1,490 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "minindex.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>		/* For opendir */
+#include <dirent.h>		/* For opendir and readdir */
+#include "mem.h"
+#include "access.h"
+#include "fopen.h"
+#ifdef WORDS_BIGENDIAN
+#include "bigendian.h"
+#else
+#include "littleendian.h"
+#endif
+#include "genomicpos.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+
+/* Chunk of genome uncompressed at a time by Minindex_write */
+#define WRITE_CHUNKSIZE 1000000
+
+/* Capacity of the window deque.  Must be a power of 2 greater than
+   MININDEX_MAXWINDOW */
+#define DEQUE_SIZE 128
+#define DEQUE_MASK (DEQUE_SIZE - 1)
+
+
+#define T Minindex_T
+struct T {
+  int k;
+  int w;
+
+  int nkeys;
+  UINT4 *keys;
+  Access_T keys_access;
+  size_t keys_len;
+
+  UINT4 *offsets;
+  Access_T offsets_access;
+  size_t offsets_len;
+
+  UINT4 *positions;
+  Access_T positions_access;
+  size_t positions_len;
+};
+
+
+/* Invertible hash on 2k bits, so that runs of low-complexity kmers do
+   not dominate the minimizers */
+static UINT4
+hash_kmer (UINT8 key, UINT8 mask) {
+  key = (~key + (key << 21)) & mask;
+  key = key ^ key >> 24;
+  key = ((key + (key << 3)) + (key << 8)) & mask;
+  key = key ^ key >> 14;
+  key = ((key + (key << 2)) + (key << 4)) & mask;
+  key = key ^ key >> 28;
+  key = (key + (key << 31)) & mask;
+  return (UINT4) key;
+}
+
+
+/* State of a scan, so that a long sequence can be given in chunks */
+typedef struct Scan_T *Scan_T;
+struct Scan_T {
+  int k;
+  int w;
+  UINT8 mask;
+
+  UINT8 kmer;
+  int nvalid;			/* Consecutive ACGT characters */
+
+  UINT4 deque_keys[DEQUE_SIZE];
+  Univcoord_T deque_positions[DEQUE_SIZE];
+  int head;
+  int tail;
+
+  bool emittedp;
+  Univcoord_T last_emitted;
+};
+
+
+static void
+scan_init (Scan_T scan, int k, int w) {
+  scan->k = k;
+  scan->w = w;
+  scan->mask = (1ULL << (2*k)) - 1;
+  scan->kmer = 0;
+  scan->nvalid = 0;
+  scan->head = scan->tail = 0;
+  scan->emittedp = false;
+  return;
+}
+
+
+/* Emits the leftmost smallest hash in each window of w consecutive
+   kmers, once per distinct position.  keys and positions may be NULL
+   for counting. */
+static int
+scan_chunk (UINT4 *keys, Univcoord_T *positions, Scan_T scan, char *sequence, int seqlength,
+	    Univcoord_T offset) {
+  int nminimizers = 0, i;
+  UINT8 code;
+  UINT4 key;
+  Univcoord_T pos;
+
+  for (i = 0; i < seqlength; i++) {
+    switch (sequence[i]) {
+    case 'A': case 'a': code = 0; break;
+    case 'C': case 'c': code = 1; break;
+    case 'G': case 'g': code = 2; break;
+    case 'T': case 't': code = 3; break;
+    default: code = 4;
+    }
+
+    if (code == 4) {
+      scan->nvalid = 0;
+      scan->head = scan->tail = 0;
+
+    } else {
+      scan->kmer = ((scan->kmer << 2) | code) & scan->mask;
+      if (++scan->nvalid >= scan->k) {
+	pos = offset + i - (scan->k - 1);
+	key = hash_kmer(scan->kmer,scan->mask);
+
+	while (scan->tail != scan->head && scan->deque_keys[(scan->tail - 1) & DEQUE_MASK] > key) {
+	  scan->tail--;
+	}
+	scan->deque_keys[scan->tail & DEQUE_MASK] = key;
+	scan->deque_positions[scan->tail & DEQUE_MASK] = pos;
+	scan->tail++;
+
+	while (scan->deque_positions[scan->head & DEQUE_MASK] + scan->w <= pos) {
+	  scan->head++;
+	}
+
+	if (scan->nvalid >= scan->k + scan->w - 1 &&
+	    (scan->emittedp == false || scan->deque_positions[scan->head & DEQUE_MASK] != scan->last_emitted)) {
+	  scan->last_emitted = scan->deque_positions[scan->head & DEQUE_MASK];
+	  scan->emittedp = true;
+	  if (keys != NULL) {
+	    keys[nminimizers] = scan->deque_keys[scan->head & DEQUE_MASK];
+	    positions[nminimizers] = scan->last_emitted;
+	  }
+	  nminimizers++;
+	}
+      }
+    }
+  }
+
+  return nminimizers;
+}
+
+
+/* keys and positions need room for seqlength entries.  Returns the
+   number of minimizers, in order of position. */
+int
+Minindex_scan (UINT4 *keys, int *positions, char *sequence, int seqlength, int k, int w) {
+  struct Scan_T scan;
+  Univcoord_T *positions_univ;
+  int nminimizers, i;
+
+  if (seqlength < k + w - 1) {
+    return 0;
+  }
+
+  positions_univ = (Univcoord_T *) MALLOC(seqlength*sizeof(Univcoord_T));
+  scan_init(&scan,k,w);
+  nminimizers = scan_chunk(keys,positions_univ,&scan,sequence,seqlength,/*offset*/0);
+  for (i = 0; i < nminimizers; i++) {
+    positions[i] = (int) positions_univ[i];
+  }
+  FREE(positions_univ);
+
+  return nminimizers;
+}
+
+
+#ifdef UTILITYP
+
+static int
+pair_compare (const void *a, const void *b) {
+  UINT8 x = * (UINT8 *) a;
+  UINT8 y = * (UINT8 *) b;
+
+  if (x < y) {
+    return -1;
+  } else if (y < x) {
+    return +1;
+  } else {
+    return 0;
+  }
+}
+
+
+/* Scans every chromosome (without its circular alias), first to count
+   and then to fill.  Pairs are packed as key:position in a UINT8, so
+   sorting them groups positions by key in ascending order. */
+static UINT8
+scan_genome (UINT8 *pairs, Genome_T genomecomp, Univ_IIT_T chromosome_iit, int k, int w) {
+  UINT8 npairs = 0;
+  struct Scan_T scan;
+  UINT4 *keys;
+  Univcoord_T *positions, chroffset, chrhigh, start;
+  Chrpos_T chrlength, chunklength;
+  char *chunk;
+  int nchromosomes, chrnum, nminimizers, i;
+
+  keys = (UINT4 *) MALLOC(WRITE_CHUNKSIZE*sizeof(UINT4));
+  positions = (Univcoord_T *) MALLOC(WRITE_CHUNKSIZE*sizeof(Univcoord_T));
+  chunk = (char *) MALLOC((WRITE_CHUNKSIZE+1)*sizeof(char));
+
+  nchromosomes = Univ_IIT_total_nintervals(chromosome_iit);
+  for (chrnum = 1; chrnum <= nchromosomes; chrnum++) {
+    Univ_IIT_interval_bounds(&chroffset,&chrhigh,&chrlength,chromosome_iit,chrnum,/*circular_typeint*/-1);
+    scan_init(&scan,k,w);
+    for (start = chroffset; start < chroffset + chrlength; start += chunklength) {
+      if ((chunklength = chroffset + chrlength - start) > WRITE_CHUNKSIZE) {
+	chunklength = WRITE_CHUNKSIZE;
+      }
+      Genome_fill_buffer_simple(genomecomp,start,chunklength,chunk);
+      nminimizers = scan_chunk(keys,positions,&scan,chunk,chunklength,/*offset*/start);
+      if (pairs != NULL) {
+	for (i = 0; i < nminimizers; i++) {
+	  pairs[npairs + i] = ((UINT8) keys[i] << 32) | (UINT8) positions[i];
+	}
+      }
+      npairs += nminimizers;
+    }
+  }
+
+  FREE(chunk);
+  FREE(positions);
+  FREE(keys);
+
+  return npairs;
+}
+
+
+static FILE *
+open_output (char *destdir, char *fileroot, int k, int w, char *suffix) {
+  FILE *fp;
+  char *filename;
+
+  filename = (char *) CALLOC(strlen(destdir)+strlen("/")+strlen(fileroot)+strlen(".")+
+			     strlen(MININDEX_FILESUFFIX)+/*k*/2+strlen("w")+/*w*/2+strlen(suffix)+1,
+			     sizeof(char));
+  sprintf(filename,"%s/%s.%s%02dw%02d%s",destdir,fileroot,MININDEX_FILESUFFIX,k,w,suffix);
+  if ((fp = FOPEN_WRITE_BINARY(filename)) == NULL) {
+    fprintf(stderr,"Can't write to file %s\n",filename);
+    exit(9);
+  }
+  FREE(filename);
+
+  return fp;
+}
+
+
+void
+Minindex_write (char *destdir, char *fileroot, Genome_T genomecomp, Univ_IIT_T chromosome_iit,
+		int k, int w) {
+  FILE *keys_fp, *offsets_fp, *positions_fp;
+  UINT8 *pairs, npairs, i;
+  UINT4 key, offset, position;
+  Univcoord_T genomelength;
+  int nkeys = 0;
+
+  if (k < 1 || k > MININDEX_MAXK) {
+    fprintf(stderr,"Minimizer kmer size %d is not allowed.  Must be between 1 and %d\n",k,MININDEX_MAXK);
+    exit(9);
+  } else if (w < 1 || w > MININDEX_MAXWINDOW) {
+    fprintf(stderr,"Minimizer window %d is not allowed.  Must be between 1 and %d\n",w,MININDEX_MAXWINDOW);
+    exit(9);
+  }
+
+  genomelength = Univ_IIT_genomelength(chromosome_iit,/*with_circular_alias_p*/true);
+  if (genomelength > 4294967295U) {
+    fprintf(stderr,"Minimizer index is not supported for large genomes\n");
+    exit(9);
+  }
+
+  fprintf(stderr,"Counting (%d,%d)-minimizers...",w,k);
+  npairs = scan_genome(/*pairs*/NULL,genomecomp,chromosome_iit,k,w);
+  fprintf(stderr,"%llu\n",(unsigned long long) npairs);
+  if (npairs > 4294967295U) {
+    fprintf(stderr,"Too many minimizers for a 4-byte offset.  Try a larger window.\n");
+    exit(9);
+  }
+
+  pairs = (UINT8 *) MALLOC((npairs + 1)*sizeof(UINT8));
+  scan_genome(pairs,genomecomp,chromosome_iit,k,w);
+  fprintf(stderr,"Sorting minimizers\n");
+  qsort(pairs,npairs,sizeof(UINT8),pair_compare);
+
+  keys_fp = open_output(destdir,fileroot,k,w,MININDEX_KEYS_FILESUFFIX);
+  offsets_fp = open_output(destdir,fileroot,k,w,MININDEX_OFFSETS_FILESUFFIX);
+  positions_fp = open_output(destdir,fileroot,k,w,MININDEX_POSITIONS_FILESUFFIX);
+
+  for (i = 0; i < npairs; i++) {
+    key = (UINT4) (pairs[i] >> 32);
+    position = (UINT4) (pairs[i] & 0xFFFFFFFF);
+    if (i == 0 || key != (UINT4) (pairs[i-1] >> 32)) {
+      offset = (UINT4) i;
+      FWRITE_UINT(key,keys_fp);
+      FWRITE_UINT(offset,offsets_fp);
+      nkeys++;
+    }
+    FWRITE_UINT(position,positions_fp);
+  }
+  offset = (UINT4) npairs;
+  FWRITE_UINT(offset,offsets_fp);
+
+  fclose(positions_fp);
+  fclose(offsets_fp);
+  fclose(keys_fp);
+  FREE(pairs);
+
+  fprintf(stderr,"Wrote %d distinct minimizers with %llu positions\n",nkeys,(unsigned long long) npairs);
+  return;
+}
+
+#endif
+
+
+void
+Minindex_free (T *old) {
+  if (*old) {
+    if ((*old)->positions_access == ALLOCATED_PRIVATE) {
+      FREE_KEEP((*old)->positions);
+    }
+    if ((*old)->offsets_access == ALLOCATED_PRIVATE) {
+      FREE_KEEP((*old)->offsets);
+    }
+    if ((*old)->keys_access == ALLOCATED_PRIVATE) {
+      FREE_KEEP((*old)->keys);
+    }
+    FREE_KEEP(*old);
+  }
+  return;
+}
+
+
+static void *
+read_file (Access_T *access, size_t *len, char *genomesubdir, char *fileroot, int k, int w, char *suffix) {
+  void *array;
+  char *filename, *comma;
+  double seconds;
+
+  filename = (char *) CALLOC(strlen(genomesubdir)+strlen("/")+strlen(fileroot)+strlen(".")+
+			     strlen(MININDEX_FILESUFFIX)+/*k*/2+strlen("w")+/*w*/2+strlen(suffix)+1,
+			     sizeof(char));
+  sprintf(filename,"%s/%s.%s%02dw%02d%s",genomesubdir,fileroot,MININDEX_FILESUFFIX,k,w,suffix);
+  if (Access_file_exists_p(filename) == false) {
+    fprintf(stderr,"Minimizer index file %s does not exist\n",filename);
+    exit(9);
+  }
+
+  fprintf(stderr,"Allocating memory for minimizer %s...",suffix);
+  if ((array = Access_allocate_private(&(*access),&(*len),&seconds,filename,sizeof(UINT4))) == NULL) {
+    fprintf(stderr,"insufficient memory for allocating %s\n",filename);
+    exit(9);
+  }
+  comma = Genomicpos_commafmt(*len);
+  fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	  Access_mbps(*len,seconds));
+  FREE(comma);
+  FREE(filename);
+
+  return array;
+}
+
+
+/* Uses the <fileroot>.minKKwWWkeys file in genomesubdir with the
+   given k and w, where 0 matches any value.  Returns NULL if there
+   is none, and exits if more than one matches. */
+T
+Minindex_new (char *genomesubdir, char *fileroot, int required_k, int required_w) {
+  T new;
+  DIR *dp;
+  struct dirent *entry;
+  char *pattern, *filename;
+  int patternlength, k = 0, w = 0, file_k, file_w, nfound = 0;
+
+  if ((dp = opendir(genomesubdir)) == NULL) {
+    fprintf(stderr,"Unable to open directory %s\n",genomesubdir);
+    return (T) NULL;
+  }
+
+  pattern = (char *) CALLOC(strlen(fileroot)+strlen(".")+strlen(MININDEX_FILESUFFIX)+1,sizeof(char));
+  sprintf(pattern,"%s.%s",fileroot,MININDEX_FILESUFFIX);
+  patternlength = strlen(pattern);
+
+  while ((entry = readdir(dp)) != NULL) {
+    filename = entry->d_name;
+    if (!strncmp(filename,pattern,patternlength) &&
+	sscanf(&(filename[patternlength]),"%2dw%2d",&file_k,&file_w) == 2 &&
+	!strcmp(&(filename[patternlength+5]),MININDEX_KEYS_FILESUFFIX) &&
+	(required_k == 0 || file_k == required_k) &&
+	(required_w == 0 || file_w == required_w)) {
+      if (nfound++ == 0) {
+	k = file_k;
+	w = file_w;
+      } else {
+	if (nfound == 2) {
+	  fprintf(stderr,"Found more than one minimizer index for %s: k = %d, w = %d",fileroot,k,w);
+	}
+	fprintf(stderr,"; k = %d, w = %d",file_k,file_w);
+      }
+    }
+  }
+  closedir(dp);
+  FREE(pattern);
+
+  if (nfound > 1) {
+    fprintf(stderr,".  Specify one with -k and --minimizers=INT\n");
+    exit(9);
+  } else if (nfound == 0) {
+    return (T) NULL;
+  }
+
+  new = (T) MALLOC_KEEP(sizeof(*new));
+  new->k = k;
+  new->w = w;
+  fprintf(stderr,"Looking for minimizer index with k = %d, w = %d\n",k,w);
+
+  new->keys = (UINT4 *) read_file(&new->keys_access,&new->keys_len,genomesubdir,fileroot,k,w,
+				  MININDEX_KEYS_FILESUFFIX);
+  new->offsets = (UINT4 *) read_file(&new->offsets_access,&new->offsets_len,genomesubdir,fileroot,k,w,
+				     MININDEX_OFFSETS_FILESUFFIX);
+  new->positions = (UINT4 *) read_file(&new->positions_access,&new->positions_len,genomesubdir,fileroot,k,w,
+				       MININDEX_POSITIONS_FILESUFFIX);
+  new->nkeys = new->keys_len/sizeof(UINT4);
+
+  if (new->offsets_len != (new->nkeys + 1)*sizeof(UINT4)) {
+    fprintf(stderr,"Minimizer keys and offsets files have inconsistent lengths\n");
+    exit(9);
+  }
+
+  return new;
+}
+
+
+int
+Minindex_k (T this) {
+  return this->k;
+}
+
+int
+Minindex_w (T this) {
+  return this->w;
+}
+
+
+/* Returns the number of genomic positions for key, and points
+   positions at them, in ascending order */
+int
+Minindex_read (UINT4 **positions, T this, UINT4 key) {
+  int lowi = 0, highi = this->nkeys, middlei;
+
+  while (lowi < highi) {
+    middlei = lowi + (highi - lowi)/2;
+    if (this->keys[middlei] < key) {
+      lowi = middlei + 1;
+    } else {
+      highi = middlei;
+    }
+  }
+
+  if (lowi >= this->nkeys || this->keys[lowi] != key) {
+    *positions = (UINT4 *) NULL;
+    return 0;
+  } else {
+    *positions = &(this->positions[this->offsets[lowi]]);
+    debug(printf("Key %08X has %u positions\n",key,this->offsets[lowi+1] - this->offsets[lowi]));
+    return (int) (this->offsets[lowi+1] - this->offsets[lowi]);
+  }
+}
+
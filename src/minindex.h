@@ -0,0 +1,59 @@
+/* $Id$ */
+#ifndef MININDEX_INCLUDED
+#define MININDEX_INCLUDED
+
+#include "bool.h"
+#include "types.h"
+#include "genomicpos.h"
+#include "iit-read-univ.h"
+#ifdef UTILITYP
+#include "genome.h"
+#endif
+
+
+/* (w,k)-minimizer index of the plus strand of the genome, built by
+   gmapindex -M alongside the offsets and positions, and used by the
+   minimizer path of Stage 1.  Files are
+   <fileroot>.min<k>w<w>keys (sorted minimizer hashes),
+   <fileroot>.min<k>w<w>offsets (nkeys+1 starts into positions), and
+   <fileroot>.min<k>w<w>positions (UINT4 genomic positions).  Kmers
+   are not canonical, so queries are scanned on both strands. */
+
+#define MININDEX_FILESUFFIX "min"
+#define MININDEX_KEYS_FILESUFFIX "keys"
+#define MININDEX_OFFSETS_FILESUFFIX "offsets"
+#define MININDEX_POSITIONS_FILESUFFIX "positions"
+
+#define MININDEX_MAXK 16
+#define MININDEX_MAXWINDOW 64
+
+#define T Minindex_T
+typedef struct T *T;
+
+extern int
+Minindex_scan (UINT4 *keys, int *positions, char *sequence, int seqlength, int k, int w);
+
+#ifdef UTILITYP
+extern void
+Minindex_write (char *destdir, char *fileroot, Genome_T genomecomp, Univ_IIT_T chromosome_iit,
+		int k, int w);
+#endif
+
+extern void
+Minindex_free (T *old);
+
+extern T
+Minindex_new (char *genomesubdir, char *fileroot, int required_k, int required_w);
+
+extern int
+Minindex_k (T this);
+
+extern int
+Minindex_w (T this);
+
+extern int
+Minindex_read (UINT4 **positions, T this, UINT4 key);
+
+#undef T
+#endif
+
@@ -130,6 +130,34 @@ struct Oligoindex_array_T {
 };
 
 
+/* Successive gregions for one query, and the 5' and 3' margin
+   re-searches, often ask for the same genomic window again.  Each
+   oligoindex keeps the last few tallies of the current query, keyed
+   by window, strand, and query range.  After allocate_positions,
+   counts are non-zero only for oligos in the query, so an entry needs
+   just those counts and positions, plus the table itself. */
+#define NTALLYCACHE 4
+
+struct Tallycache_T {
+  unsigned int lastuse;		/* 0 if empty */
+
+  Univcoord_T mappingstart;
+  Univcoord_T mappingend;
+  bool plusp;
+  Chrpos_T chrpos;
+  Genome_T genome;
+  int genestrand;
+  char *query;
+  int querylength;
+
+  Chrpos_T *table;
+  int noligos;
+  Shortoligomer_T *oligos;
+  Count_T *counts;
+  UINT4 *positions;
+};
+
+
 #ifdef DEBUG
 #define debug(x) x
 #else
@@ -8789,6 +8817,10 @@ Oligoindex_new (int indexsize, int diag_lookback, int suffnconsecutive, Shortoli
   new->positions = (UINT4 *) MALLOC_KEEP(new->oligospace * sizeof(UINT4));
   new->table = (Chrpos_T *) NULL;
 
+  new->tallycache = (struct Tallycache_T *) CALLOC_KEEP(NTALLYCACHE,sizeof(struct Tallycache_T));
+  new->tallyclock = 0;
+  new->table_cachedp = false;
+
   return new;
 }
 
@@ -33837,6 +33869,141 @@ store_positions (Chrpos_T **pointers, bool *overabundant,
 
 
 
+static void
+tallycache_clear (struct Tallycache_T *entry) {
+  if (entry->lastuse > 0) {
+    FREE(entry->query);
+    if (entry->table != NULL) {
+      FREE(entry->table);
+    }
+    FREE(entry->positions);
+    FREE(entry->counts);
+    FREE(entry->oligos);
+    entry->lastuse = 0;
+  }
+  return;
+}
+
+static struct Tallycache_T *
+tallycache_find (T this, Univcoord_T mappingstart, Univcoord_T mappingend, bool plusp,
+		 char *queryuc_ptr, int querystart, int queryend, Chrpos_T chrpos,
+		 Genome_T genome, int genestrand) {
+  struct Tallycache_T *entry;
+  int i;
+
+  for (i = 0; i < NTALLYCACHE; i++) {
+    entry = &(this->tallycache[i]);
+    if (entry->lastuse > 0 && entry->mappingstart == mappingstart && entry->mappingend == mappingend &&
+	entry->plusp == plusp && entry->chrpos == chrpos && entry->genome == genome &&
+	entry->genestrand == genestrand && entry->querylength == queryend - querystart &&
+	memcmp(entry->query,&(queryuc_ptr[querystart]),entry->querylength*sizeof(char)) == 0) {
+      return entry;
+    }
+  }
+
+  return (struct Tallycache_T *) NULL;
+}
+
+static void
+tallycache_restore (T this, struct Tallycache_T *entry) {
+  int k;
+
+  memset((void *) this->counts,0,this->oligospace*sizeof(Count_T));
+  for (k = 0; k < entry->noligos; k++) {
+    this->counts[entry->oligos[k]] = entry->counts[k];
+    this->positions[entry->oligos[k]] = entry->positions[k];
+  }
+
+  this->table = entry->table;
+  this->table_cachedp = true;
+  entry->lastuse = ++this->tallyclock;
+
+  return;
+}
+
+/* Takes ownership of this->table */
+static void
+tallycache_save (T this, Univcoord_T mappingstart, Univcoord_T mappingend, bool plusp,
+		 char *queryuc_ptr, int querystart, int queryend, Chrpos_T chrpos,
+		 Genome_T genome, int genestrand) {
+  struct Tallycache_T *entry;
+  int querylength = queryend - querystart;
+  int in_counter = 0, i, k;
+  Shortoligomer_T oligo = 0U, masked;
+  char *p;
+
+  entry = &(this->tallycache[0]);
+  for (k = 1; k < NTALLYCACHE; k++) {
+    if (this->tallycache[k].lastuse < entry->lastuse) {
+      entry = &(this->tallycache[k]);
+    }
+  }
+  tallycache_clear(entry);
+
+  entry->mappingstart = mappingstart;
+  entry->mappingend = mappingend;
+  entry->plusp = plusp;
+  entry->chrpos = chrpos;
+  entry->genome = genome;
+  entry->genestrand = genestrand;
+  entry->query = (char *) MALLOC(querylength*sizeof(char));
+  memcpy(entry->query,&(queryuc_ptr[querystart]),querylength*sizeof(char));
+  entry->querylength = querylength;
+
+  /* Same oligos as Oligoindex_set_inquery.  Repeated oligos are saved
+     more than once, which is harmless. */
+  entry->oligos = (Shortoligomer_T *) MALLOC(querylength*sizeof(Shortoligomer_T));
+  entry->counts = (Count_T *) MALLOC(querylength*sizeof(Count_T));
+  entry->positions = (UINT4 *) MALLOC(querylength*sizeof(UINT4));
+  k = 0;
+  for (i = querystart, p = &(queryuc_ptr[querystart]); i < queryend; i++, p++) {
+    in_counter++;
+
+    switch (*p) {
+    case 'A': oligo = (oligo << 2); break;
+    case 'C': oligo = (oligo << 2) | 1; break;
+    case 'G': oligo = (oligo << 2) | 2; break;
+    case 'T': oligo = (oligo << 2) | 3; break;
+    default: oligo = 0U; in_counter = 0; break;
+    }
+
+    if (in_counter == this->indexsize) {
+      masked = oligo & this->mask;
+      if (this->counts[masked] > 0) {
+	entry->oligos[k] = masked;
+	entry->counts[k] = this->counts[masked];
+	entry->positions[k] = this->positions[masked];
+	k++;
+      }
+      in_counter--;
+    }
+  }
+  entry->noligos = k;
+
+  entry->table = this->table;
+  this->table_cachedp = true;
+  entry->lastuse = ++this->tallyclock;
+
+  return;
+}
+
+void
+Oligoindex_array_clear_tallies (Oligoindex_array_T oligoindices) {
+  T this;
+  int source, i;
+
+  for (source = 0; source < oligoindices->length; source++) {
+    this = oligoindices->array[source];
+    for (i = 0; i < NTALLYCACHE; i++) {
+      tallycache_clear(&(this->tallycache[i]));
+    }
+    this->tallyclock = 0;
+  }
+
+  return;
+}
+
+
 /* Notes: genomicstart and genomicend define the region for alignment.
    Within that interval, mappingstart and mappingend define the region
    for allowable mappings.  This allows GSNAP to define a larger
@@ -33853,11 +34020,33 @@ Oligoindex_hr_tally (T this, Univcoord_T mappingstart, Univcoord_T mappingend, b
   Count_T *working_counts;
   Oligospace_T i;
   /* Oligospace_T oligo; */
+#ifndef GSNAP
+  struct Tallycache_T *entry;
+#endif
 
 
   /* Sets counts for trimming when trimp is true */
   Oligoindex_set_inquery(&badoligos,&repoligos,&trimoligos,&trim_start,&trim_end,this,
 			 queryuc_ptr,querystart,queryend,/*trimp*/false);
+
+#ifndef GSNAP
+  if (this->table_cachedp == true) {
+    /* Not untallied, but the cache still owns the table */
+    this->table = (Chrpos_T *) NULL;
+    this->table_cachedp = false;
+  }
+
+  /* For short queries, set_inquery leaves inquery unchanged, so the
+     query range alone does not determine the tally */
+  if (queryend - querystart > this->indexsize &&
+      (entry = tallycache_find(this,mappingstart,mappingend,plusp,queryuc_ptr,querystart,queryend,
+			       chrpos,genome,genestrand)) != NULL) {
+    debug0(printf("restoring tally for mapping %u..%u\n",mappingstart,mappingend));
+    tallycache_restore(this,entry);
+    return;
+  }
+#endif
+
   memset((void *) this->counts,0,this->oligospace*sizeof(Count_T));
 
   debug0(printf("called with mapping %u..%u\n",mappingstart,mappingend));
@@ -33943,6 +34132,13 @@ Oligoindex_hr_tally (T this, Univcoord_T mappingstart, Univcoord_T mappingend, b
   }
 #endif
 
+#ifndef GSNAP
+  if (queryend - querystart > this->indexsize) {
+    tallycache_save(this,mappingstart,mappingend,plusp,queryuc_ptr,querystart,queryend,
+		    chrpos,genome,genestrand);
+  }
+#endif
+
   return;
 }
 
@@ -34014,7 +34210,10 @@ Oligoindex_untally (T this) {
   }
 #endif
 
-  if (this->table != NULL) {
+  if (this->table_cachedp == true) {
+    this->table = (Chrpos_T *) NULL;
+    this->table_cachedp = false;
+  } else if (this->table != NULL) {
     FREE(this->table);
   }
 
@@ -34025,7 +34224,17 @@ Oligoindex_untally (T this) {
 
 static void
 Oligoindex_free (T *old) {
+  int i;
+
   if (*old) {
+    if ((*old)->table_cachedp == true) {
+      (*old)->table = (Chrpos_T *) NULL;
+    }
+    for (i = 0; i < NTALLYCACHE; i++) {
+      tallycache_clear(&((*old)->tallycache[i]));
+    }
+    FREE_KEEP((*old)->tallycache);
+
     /* FREE_KEEP((*old)->pointers_allocated); */
     FREE_KEEP((*old)->positions);
     FREE_KEEP((*old)->table);
@@ -71,6 +71,13 @@ struct T {
   UINT4 *positions;
   /* UINT4 *pointers; */
   /* UINT4 *pointers_allocated; */
+
+  /* Tallies from earlier gregions of the current query, so that a
+     window seen again is restored instead of re-tallied.  When
+     table_cachedp is true, table belongs to the cache. */
+  struct Tallycache_T *tallycache;
+  unsigned int tallyclock;
+  bool table_cachedp;
 };
 
 
@@ -111,6 +118,8 @@ Oligoindex_untally (T this);
 extern void
 Oligoindex_clear_inquery (T this, char *queryuc_ptr, int querystart, int queryend);
 extern void
+Oligoindex_array_clear_tallies (Oligoindex_array_T oligoindices);
+extern void
 Oligoindex_array_free(Oligoindex_array_T *old);
 
 extern List_T
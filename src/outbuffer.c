@@ -20,6 +20,7 @@ static char rcsid[] = "$Id: 3529459b95fcdd128017e80db0e0ff6b525111b9 $";
 #include "mem.h"
 #include "samheader.h"
 #include "printbuffer.h"
+#include "outwriter.h"
 
 
 #ifdef DEBUG
@@ -64,6 +65,10 @@ static char *split_output_root;
 static char *failedinput_root;
 #endif
 
+#if defined(GSNAP)
+static FILE *part_index_fp = NULL;
+#endif
+
 static char *write_mode;
 
 #if defined(GFILTER)
@@ -229,7 +234,8 @@ Outbuffer_setup (bool paired_end_p_in, bool appendp_in, char *output_root_in) {
 void
 Outbuffer_setup (bool any_circular_p_in, bool quiet_if_excessive_p_in,
 		 bool paired_end_p_in, bool appendp_in, char *output_file_in,
-		 bool split_simple_p_in, char *split_output_root_in, char *failedinput_root_in) {
+		 bool split_simple_p_in, char *split_output_root_in, char *failedinput_root_in,
+		 Outwriter_method_T async_output) {
 
   any_circular_p = any_circular_p_in;
   quiet_if_excessive_p = quiet_if_excessive_p_in;
@@ -256,6 +262,10 @@ Outbuffer_setup (bool any_circular_p_in, bool quiet_if_excessive_p_in,
   buffer_outputs = (char **) CALLOC_KEEP(1+N_SPLIT_OUTPUTS,sizeof(char *));
 #endif
 
+  if (async_output != OUTWRITER_NONE) {
+    Outwriter_setup(async_output,OUTWRITER_DEFAULT_NBUFFERS);
+  }
+
 
   /************************************************************************/
   /* Failed input files */
@@ -277,6 +287,32 @@ Outbuffer_setup (bool any_circular_p_in, bool quiet_if_excessive_p_in,
 #endif
 
 
+#if defined(GSNAP)
+/* For --part-index.  Records the input id and byte length of each
+   output record, in the order written, so that the outputs of
+   several --part runs can be interleaved back into input order by
+   merge_parts */
+void
+Outbuffer_part_index_open (char *part_index_file) {
+  if ((part_index_fp = fopen(part_index_file,write_mode)) == NULL) {
+    fprintf(stderr,"Cannot open file %s for writing\n",part_index_file);
+    exit(9);
+  }
+  return;
+}
+
+static void
+part_index_put (unsigned int inputid, char *string) {
+  size_t nbytes;
+
+  if (part_index_fp != NULL && string != NULL && (nbytes = strlen(string)) > 0) {
+    fprintf(part_index_fp,"%u\t%lu\n",inputid,(unsigned long) nbytes);
+  }
+  return;
+}
+#endif
+
+
 #if defined(GFILTER)
 
 void
@@ -326,6 +362,7 @@ struct RRlist_T {
   char *string1;
   char *string2;
 #elif defined(GSNAP)
+  unsigned int inputid;
   SAM_split_output_type split_output;
   char *string;
   char *string_failedinput;
@@ -437,6 +474,7 @@ RRlist_unshift (RRlist_T *head, RRlist_T tail, int request_id,
 
   new = (RRlist_T) MALLOC_OUT(sizeof(*new)); /* Called by worker thread */
   new->id = request_id;
+  new->inputid = Filestring_id(fp);
   new->split_output = Filestring_split_output(fp);
   new->string = Filestring_string(fp);
   if (fp_failedinput == NULL) {
@@ -483,11 +521,13 @@ RRlist_pop_pass1 (RRlist_T head, unsigned int *id) {
 
 /* Returns new head */
 static RRlist_T
-RRlist_pop (RRlist_T head, unsigned int *id, SAM_split_output_type *split_output, char **string,
+RRlist_pop (RRlist_T head, unsigned int *id, unsigned int *inputid,
+	    SAM_split_output_type *split_output, char **string,
 	    char **string_failedinput, char **string_failedinput_1, char **string_failedinput_2) {
   RRlist_T newhead;
 
   *id = head->id;
+  *inputid = head->inputid;
   *split_output = head->split_output;
   *string = head->string;
   *string_failedinput = head->string_failedinput;
@@ -830,13 +870,17 @@ Outbuffer_close_files () {
 
 #elif defined(GSNAP)
   if (failedinput_root != NULL) {
-    fclose(output_failedinput);
-    fclose(output_failedinput_1);
-    fclose(output_failedinput_2);
+    Outwriter_fclose(output_failedinput);
+    Outwriter_fclose(output_failedinput_1);
+    Outwriter_fclose(output_failedinput_2);
+  }
+  if (part_index_fp != NULL) {
+    fclose(part_index_fp);
+    part_index_fp = NULL;
   }
 #else  /* GEXACT or GMAP */
   if (failedinput_root != NULL) {
-    fclose(output_failedinput);
+    Outwriter_fclose(output_failedinput);
   }
 #endif
 
@@ -858,16 +902,17 @@ Outbuffer_close_files () {
 
     for (split_output = 1; split_output <= N_SPLIT_OUTPUTS; split_output++) {
       if (outputs[split_output] != NULL) {
-	fclose(outputs[split_output]);
+	Outwriter_fclose(outputs[split_output]);
       }
     }
   } else if (output_file != NULL && outputs[OUTPUT_FILE] != NULL) {
-    fclose(outputs[OUTPUT_FILE]);
+    Outwriter_fclose(outputs[OUTPUT_FILE]);
   } else {
     /* Wrote to stdout */
   }
 
   FREE_KEEP(outputs);
+  Outwriter_finish();
 #endif
 
   return;
@@ -1038,6 +1083,20 @@ Outbuffer_put_filestrings (T this, int request_id, Filestring_T fp, Filestring_T
 
 
 
+#if !defined(GFILTER)
+/* Like Filestring_print, but through Outwriter_fwrite */
+static void
+print_filestring (FILE *output, Filestring_T fp) {
+  char *string;
+  int strlength;
+
+  if (output != NULL && (string = Filestring_get(&strlength,fp)) != NULL) {
+    Outwriter_fwrite(string,sizeof(char),strlength,output);
+  }
+  return;
+}
+#endif
+
 /* Outbuffer_print_filestrings is used in single-thread mode.  The
    outbuffer object is not used, except to increment npassed for
    gfilter. */
@@ -1134,20 +1193,23 @@ Outbuffer_print_filestrings (Filestring_T fp, Filestring_T fp_failedinput, Files
     }
   }
 
-  Filestring_print(output,fp);
+  if (Filestring_split_output(fp) != OUTPUT_NONE) {
+    part_index_put(Filestring_id(fp),Filestring_string(fp));
+  }
+  print_filestring(output,fp);
   Filestring_free(&fp,/*free_string_p*/true);
 
   if (failedinput_root != NULL) {
     if (fp_failedinput != NULL) {
-      Filestring_print(output_failedinput,fp_failedinput);
+      print_filestring(output_failedinput,fp_failedinput);
       Filestring_free(&fp_failedinput,/*free_string_p*/true);
     }
     if (fp_failedinput_1 != NULL) {
-      Filestring_print(output_failedinput_1,fp_failedinput_1);
+      print_filestring(output_failedinput_1,fp_failedinput_1);
       Filestring_free(&fp_failedinput_1,/*free_string_p*/true);
     }
     if (fp_failedinput_2 != NULL) {
-      Filestring_print(output_failedinput_2,fp_failedinput_2);
+      print_filestring(output_failedinput_2,fp_failedinput_2);
       Filestring_free(&fp_failedinput_2,/*free_string_p*/true);
     }
   }
@@ -1201,12 +1263,12 @@ Outbuffer_print_filestrings (Filestring_T fp, Filestring_T fp_failedinput) {
     }
   }
 
-  Filestring_print(output,fp);
+  print_filestring(output,fp);
   Filestring_free(&fp,/*free_string_p*/true);
 
   if (failedinput_root != NULL) {
     if (fp_failedinput != NULL) {
-      Filestring_print(output_failedinput,fp_failedinput);
+      print_filestring(output_failedinput,fp_failedinput);
       Filestring_free(&fp_failedinput,/*free_string_p*/true);
     }
   }
@@ -1274,6 +1336,7 @@ Outbuffer_thread_anyorder (void *data) {
 #if defined(GFILTER)
   char *string1, *string2;
 #elif defined(GSNAP)
+  unsigned int inputid;
   SAM_split_output_type split_output;
   char *string, *string_failedinput;
   char *string_failedinput_1, *string_failedinput_2;
@@ -1315,8 +1378,11 @@ Outbuffer_thread_anyorder (void *data) {
 	Printbuffer_store(printbuffer,string1,string2);
       }
 #elif defined(GSNAP)
-      this->head = RRlist_pop(this->head,&id,&split_output,&string,&string_failedinput,
+      this->head = RRlist_pop(this->head,&id,&inputid,&split_output,&string,&string_failedinput,
 			      &string_failedinput_1,&string_failedinput_2);
+      if (split_output != OUTPUT_NONE) {
+	part_index_put(inputid,string);
+      }
       Printbuffer_store(printbuffer,split_output,string,string_failedinput,
 			string_failedinput_1,string_failedinput_2);
 #else  /* GEXACT or GMAP */
@@ -1393,6 +1459,7 @@ Outbuffer_thread_ordered (void *data) {
 #if defined(GFILTER)
   char *string1, *string2;
 #elif defined(GSNAP)
+  unsigned int inputid;
   SAM_split_output_type split_output;
   char *string, *string_failedinput;
   char *string_failedinput_1, *string_failedinput_2;
@@ -1456,8 +1523,11 @@ Outbuffer_thread_ordered (void *data) {
 	  Printbuffer_store(printbuffer,string1,string2);
 	}
 #elif defined(GSNAP)
-	queue = RRlist_pop(queue,&id,&split_output,&string,&string_failedinput,
+	queue = RRlist_pop(queue,&id,&inputid,&split_output,&string,&string_failedinput,
 			   &string_failedinput_1,&string_failedinput_2);
+	if (split_output != OUTPUT_NONE) {
+	  part_index_put(inputid,string);
+	}
 	Printbuffer_store(printbuffer,split_output,string,string_failedinput,
 			  string_failedinput_1,string_failedinput_2);
 #else  /* GEXACT or GMAP */
@@ -6,6 +6,7 @@
 #include "bool.h"
 #include "genomicpos.h"
 #include "filestring.h"
+#include "outwriter.h"
 
 #define T Outbuffer_T
 typedef struct T *T;
@@ -18,10 +19,15 @@ extern void
 Outbuffer_setup (bool any_circular_p_in, bool quiet_if_excessive_p_in,
 		 bool paired_end_p_in, bool appendp_in,
 		 char *output_file_in, bool split_simple_p_in, char *split_output_root_in,
-		 char *failedinput_root_in);
+		 char *failedinput_root_in, Outwriter_method_T async_output);
 #endif
 
 
+#if defined(GSNAP)
+extern void
+Outbuffer_part_index_open (char *part_index_file);
+#endif
+
 extern void
 Outbuffer_cleanup ();
 
@@ -0,0 +1,779 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "outwriter.h"
+
+#include <stdlib.h>
+#include <string.h>		/* For memcpy, memset, strerror */
+#include <errno.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>		/* For write, lseek */
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>		/* For fcntl and O_APPEND */
+#endif
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#if defined(HAVE_LINUX_IO_URING_H) && defined(HAVE_SYS_SYSCALL_H)
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define USE_URING 1
+#endif
+#endif
+
+#include "mem.h"
+#include "assert.h"
+#include "stopwatch.h"
+#include "list.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+
+#define NTHREADS 4		/* Writer threads, when io_uring is not available */
+
+typedef enum {BACKEND_SYNC, BACKEND_URING, BACKEND_THREADS} Backend_T;
+
+#define T Outwriter_T
+typedef struct T *T;
+
+typedef struct Buffer_T *Buffer_T;
+struct Buffer_T {
+  char *space;
+  size_t length;
+  size_t done;			/* Written so far */
+  off_t offset;
+  T writer;
+#ifdef USE_URING
+  struct iovec iov;
+#endif
+  Buffer_T next;
+};
+
+struct T {
+  FILE *fp;
+  int fd;
+  bool syncp;			/* Not a regular file, so written directly */
+  bool serialp;			/* Opened for append, so one buffer in flight */
+  off_t offset;			/* For the next buffer */
+
+  Buffer_T current;		/* Being filled */
+  Buffer_T pending_head;	/* Full, but not yet submitted */
+  Buffer_T pending_tail;
+  int ninflight;
+
+  T next;			/* Among all writers, for the writer threads */
+};
+
+
+static bool activep = false;
+static Backend_T backend = BACKEND_SYNC;
+static int nbuffers;
+static List_T open_writers = NULL;
+static Buffer_T free_buffers = NULL;
+
+/* Statistics */
+static Stopwatch_T stopwatch = NULL;
+static Stopwatch_T stall_stopwatch = NULL;
+static double stall_seconds;
+static size_t nbytes_written;
+static unsigned long nwrites;
+static int depth;		/* Buffers queued or being written */
+static int max_depth;
+static double sum_depth;
+
+#ifdef HAVE_PTHREAD
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t work_avail_p = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t buffer_free_p = PTHREAD_COND_INITIALIZER;
+static pthread_t threads[NTHREADS];
+static T writers = NULL;
+static bool shutdownp;
+#endif
+
+
+static Buffer_T
+buffer_new (void) {
+  Buffer_T new = (Buffer_T) MALLOC_KEEP(sizeof(*new));
+
+  new->space = (char *) MALLOC_KEEP(OUTWRITER_BUFSIZE*sizeof(char));
+  new->length = 0;
+  new->next = (Buffer_T) NULL;
+  return new;
+}
+
+static void
+buffer_free (Buffer_T *old) {
+  FREE_KEEP((*old)->space);
+  FREE_KEEP(*old);
+  return;
+}
+
+
+/* Writes the rest of buffer directly */
+static void
+write_buffer (Buffer_T buffer) {
+  ssize_t nwritten;
+
+  while (buffer->done < buffer->length) {
+    if ((nwritten = write(buffer->writer->fd,&(buffer->space[buffer->done]),buffer->length - buffer->done)) < 0) {
+      if (errno != EINTR) {
+	fprintf(stderr,"Error writing output: %s\n",strerror(errno));
+	exit(9);
+      }
+    } else {
+      buffer->done += nwritten;
+    }
+  }
+  return;
+}
+
+
+/************************************************************************
+ *   io_uring
+ ************************************************************************/
+
+#ifdef USE_URING
+static int ring_fd = -1;
+static void *sq_ring;
+static void *cq_ring;
+static size_t sq_ring_len;
+static size_t cq_ring_len;
+static struct io_uring_sqe *sqes;
+static size_t sqes_len;
+
+static unsigned int *sq_tail;
+static unsigned int *sq_mask;
+static unsigned int *sq_array;
+static unsigned int *cq_head;
+static unsigned int *cq_tail;
+static unsigned int *cq_mask;
+static struct io_uring_cqe *cqes;
+
+static bool
+uring_init (unsigned int entries) {
+  struct io_uring_params p;
+
+  memset(&p,0,sizeof(p));
+  if ((ring_fd = (int) syscall(__NR_io_uring_setup,entries,&p)) < 0) {
+    debug(printf("io_uring_setup failed: %s\n",strerror(errno)));
+    return false;
+  }
+
+  sq_ring_len = p.sq_off.array + p.sq_entries*sizeof(unsigned int);
+  cq_ring_len = p.cq_off.cqes + p.cq_entries*sizeof(struct io_uring_cqe);
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    if (cq_ring_len > sq_ring_len) {
+      sq_ring_len = cq_ring_len;
+    }
+    cq_ring_len = sq_ring_len;
+  }
+
+  if ((sq_ring = mmap(NULL,sq_ring_len,PROT_READ | PROT_WRITE,MAP_SHARED | MAP_POPULATE,
+		      ring_fd,IORING_OFF_SQ_RING)) == MAP_FAILED) {
+    close(ring_fd);
+    return false;
+  }
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    cq_ring = sq_ring;
+  } else if ((cq_ring = mmap(NULL,cq_ring_len,PROT_READ | PROT_WRITE,MAP_SHARED | MAP_POPULATE,
+			     ring_fd,IORING_OFF_CQ_RING)) == MAP_FAILED) {
+    munmap(sq_ring,sq_ring_len);
+    close(ring_fd);
+    return false;
+  }
+  sqes_len = p.sq_entries*sizeof(struct io_uring_sqe);
+  if ((sqes = (struct io_uring_sqe *) mmap(NULL,sqes_len,PROT_READ | PROT_WRITE,MAP_SHARED | MAP_POPULATE,
+					   ring_fd,IORING_OFF_SQES)) == MAP_FAILED) {
+    if (cq_ring != sq_ring) {
+      munmap(cq_ring,cq_ring_len);
+    }
+    munmap(sq_ring,sq_ring_len);
+    close(ring_fd);
+    return false;
+  }
+
+  sq_tail = (unsigned int *) ((char *) sq_ring + p.sq_off.tail);
+  sq_mask = (unsigned int *) ((char *) sq_ring + p.sq_off.ring_mask);
+  sq_array = (unsigned int *) ((char *) sq_ring + p.sq_off.array);
+  cq_head = (unsigned int *) ((char *) cq_ring + p.cq_off.head);
+  cq_tail = (unsigned int *) ((char *) cq_ring + p.cq_off.tail);
+  cq_mask = (unsigned int *) ((char *) cq_ring + p.cq_off.ring_mask);
+  cqes = (struct io_uring_cqe *) ((char *) cq_ring + p.cq_off.cqes);
+
+  return true;
+}
+
+static void
+uring_free (void) {
+  munmap((void *) sqes,sqes_len);
+  if (cq_ring != sq_ring) {
+    munmap(cq_ring,cq_ring_len);
+  }
+  munmap(sq_ring,sq_ring_len);
+  close(ring_fd);
+  ring_fd = -1;
+  return;
+}
+
+static void
+uring_enter (unsigned int to_submit, unsigned int min_complete) {
+  while (syscall(__NR_io_uring_enter,ring_fd,to_submit,min_complete,
+		 (min_complete > 0) ? IORING_ENTER_GETEVENTS : 0,NULL,0) < 0) {
+    if (errno != EINTR) {
+      fprintf(stderr,"Error submitting output to io_uring: %s\n",strerror(errno));
+      exit(9);
+    }
+  }
+  return;
+}
+
+/* The ring has as many entries as there are buffers, so it cannot be full */
+static void
+uring_submit (Buffer_T buffer) {
+  struct io_uring_sqe *sqe;
+  unsigned int tail, index;
+
+  tail = *sq_tail;
+  index = tail & *sq_mask;
+  sqe = &(sqes[index]);
+  memset((void *) sqe,0,sizeof(*sqe));
+
+  buffer->iov.iov_base = &(buffer->space[buffer->done]);
+  buffer->iov.iov_len = buffer->length - buffer->done;
+  sqe->opcode = IORING_OP_WRITEV;
+  sqe->fd = buffer->writer->fd;
+  sqe->addr = (unsigned long) &(buffer->iov);
+  sqe->len = 1;
+  sqe->off = buffer->offset + buffer->done;
+  sqe->user_data = (unsigned long) buffer;
+
+  sq_array[index] = index;
+  __atomic_store_n(sq_tail,tail + 1,__ATOMIC_RELEASE);
+  uring_enter(/*to_submit*/1,/*min_complete*/0);
+  return;
+}
+
+static void
+writer_release (T writer, Buffer_T buffer);
+
+/* Waits for at least min_complete writes, and handles all completions */
+static void
+uring_reap (unsigned int min_complete) {
+  struct io_uring_cqe *cqe;
+  Buffer_T buffer;
+  unsigned int head;
+
+  if (min_complete > 0) {
+    uring_enter(/*to_submit*/0,min_complete);
+  }
+
+  head = *cq_head;
+  while (head != __atomic_load_n(cq_tail,__ATOMIC_ACQUIRE)) {
+    cqe = &(cqes[head & *cq_mask]);
+    buffer = (Buffer_T) (unsigned long) cqe->user_data;
+    if (cqe->res <= 0) {
+      fprintf(stderr,"Error writing output: %s\n",
+	      (cqe->res == 0) ? "no bytes written" : strerror(-cqe->res));
+      exit(9);
+    }
+    head++;
+    __atomic_store_n(cq_head,head,__ATOMIC_RELEASE);
+
+    if ((buffer->done += cqe->res) < buffer->length) {
+      /* Short write */
+      uring_submit(buffer);
+    } else {
+      writer_release(buffer->writer,buffer);
+    }
+  }
+  return;
+}
+#endif
+
+
+/************************************************************************
+ *   Writer threads
+ ************************************************************************/
+
+#ifdef HAVE_PTHREAD
+/* Each writer has at most one buffer being written at a time */
+static void *
+writer_thread (void *data) {
+  T writer;
+  Buffer_T buffer;
+
+  pthread_mutex_lock(&lock);
+  while (1) {
+    writer = writers;
+    while (writer != NULL && (writer->pending_head == NULL || writer->ninflight > 0)) {
+      writer = writer->next;
+    }
+
+    if (writer != NULL) {
+      buffer = writer->pending_head;
+      if ((writer->pending_head = buffer->next) == NULL) {
+	writer->pending_tail = (Buffer_T) NULL;
+      }
+      writer->ninflight = 1;
+      pthread_mutex_unlock(&lock);
+
+      write_buffer(buffer);
+
+      pthread_mutex_lock(&lock);
+      writer->ninflight = 0;
+      buffer->next = free_buffers;
+      free_buffers = buffer;
+      depth--;
+      pthread_cond_broadcast(&buffer_free_p);
+
+    } else if (shutdownp == true) {
+      pthread_mutex_unlock(&lock);
+      return (void *) NULL;
+
+    } else {
+      pthread_cond_wait(&work_avail_p,&lock);
+    }
+  }
+}
+#endif
+
+
+/************************************************************************
+ *   Buffers
+ ************************************************************************/
+
+/* For io_uring or synchronous writes, called by the output thread */
+static void
+writer_release (T writer, Buffer_T buffer) {
+  writer->ninflight--;
+  buffer->next = free_buffers;
+  free_buffers = buffer;
+  depth--;
+
+#ifdef USE_URING
+  if (backend == BACKEND_URING && (buffer = writer->pending_head) != NULL) {
+    if ((writer->pending_head = buffer->next) == NULL) {
+      writer->pending_tail = (Buffer_T) NULL;
+    }
+    writer->ninflight++;
+    uring_submit(buffer);
+  }
+#endif
+  return;
+}
+
+static Buffer_T
+get_free_buffer (void) {
+  Buffer_T buffer;
+
+#ifdef USE_URING
+  if (backend == BACKEND_URING) {
+    if (free_buffers == NULL) {
+      Stopwatch_start(stall_stopwatch);
+      while (free_buffers == NULL) {
+	uring_reap(/*min_complete*/1);
+      }
+      stall_seconds += Stopwatch_stop(stall_stopwatch);
+    }
+    buffer = free_buffers;
+    free_buffers = buffer->next;
+    return buffer;
+  }
+#endif
+
+#ifdef HAVE_PTHREAD
+  if (backend == BACKEND_THREADS) {
+    pthread_mutex_lock(&lock);
+    if (free_buffers == NULL) {
+      Stopwatch_start(stall_stopwatch);
+      while (free_buffers == NULL) {
+	pthread_cond_wait(&buffer_free_p,&lock);
+      }
+      stall_seconds += Stopwatch_stop(stall_stopwatch);
+    }
+    buffer = free_buffers;
+    free_buffers = buffer->next;
+    pthread_mutex_unlock(&lock);
+    return buffer;
+  }
+#endif
+
+  buffer = free_buffers;
+  free_buffers = buffer->next;
+  return buffer;
+}
+
+static void
+record_depth (void) {
+  depth++;
+  if (depth > max_depth) {
+    max_depth = depth;
+  }
+  sum_depth += (double) depth;
+  return;
+}
+
+static void
+writer_submit (T writer, Buffer_T buffer) {
+  buffer->writer = writer;
+  buffer->offset = writer->offset;
+  buffer->done = 0;
+  buffer->next = (Buffer_T) NULL;
+  writer->offset += buffer->length;
+  nbytes_written += buffer->length;
+  nwrites++;
+
+#ifdef HAVE_PTHREAD
+  if (backend == BACKEND_THREADS) {
+    pthread_mutex_lock(&lock);
+    record_depth();
+    if (writer->pending_tail == NULL) {
+      writer->pending_head = buffer;
+    } else {
+      writer->pending_tail->next = buffer;
+    }
+    writer->pending_tail = buffer;
+    pthread_cond_signal(&work_avail_p);
+    pthread_mutex_unlock(&lock);
+    return;
+  }
+#endif
+
+  record_depth();
+#ifdef USE_URING
+  if (backend == BACKEND_URING) {
+    if (writer->serialp == true && writer->ninflight > 0) {
+      if (writer->pending_tail == NULL) {
+	writer->pending_head = buffer;
+      } else {
+	writer->pending_tail->next = buffer;
+      }
+      writer->pending_tail = buffer;
+    } else {
+      writer->ninflight++;
+      uring_submit(buffer);
+    }
+    uring_reap(/*min_complete*/0);
+    return;
+  }
+#endif
+
+  writer->ninflight++;
+  write_buffer(buffer);
+  writer_release(writer,buffer);
+  return;
+}
+
+
+/************************************************************************
+ *   Writers
+ ************************************************************************/
+
+/* Takes over fp, which should not be written again except through
+   this writer.  Files other than regular files, like pipes, are
+   written directly. */
+static T
+writer_new (FILE *fp) {
+  T new = (T) MALLOC_KEEP(sizeof(*new));
+  struct stat sb;
+  int flags;
+
+  fflush(fp);
+  new->fp = fp;
+  new->fd = fileno(fp);
+  if (fstat(new->fd,&sb) < 0 || !S_ISREG(sb.st_mode) || (new->offset = lseek(new->fd,0,SEEK_CUR)) < 0) {
+    new->syncp = true;
+    new->serialp = true;
+    new->offset = 0;
+  } else {
+    new->syncp = false;
+    flags = fcntl(new->fd,F_GETFL);
+    new->serialp = (flags >= 0 && (flags & O_APPEND) != 0) ? true : false;
+  }
+
+  /* Staging buffer, in addition to the nbuffers shared ones */
+  new->current = buffer_new();
+  new->pending_head = new->pending_tail = (Buffer_T) NULL;
+  new->ninflight = 0;
+
+#ifdef HAVE_PTHREAD
+  if (backend == BACKEND_THREADS) {
+    pthread_mutex_lock(&lock);
+    new->next = writers;
+    writers = new;
+    pthread_mutex_unlock(&lock);
+  }
+#endif
+
+  return new;
+}
+
+
+static void
+writer_write (T this, const char *string, size_t length) {
+  Buffer_T current;
+  size_t n;
+
+  if (this->syncp == true) {
+    fwrite(string,sizeof(char),length,this->fp);
+    return;
+  }
+
+  while (length > 0) {
+    current = this->current;
+    if ((n = OUTWRITER_BUFSIZE - current->length) > length) {
+      n = length;
+    }
+    memcpy(&(current->space[current->length]),string,n);
+    current->length += n;
+    string += n;
+    length -= n;
+
+    if (current->length == OUTWRITER_BUFSIZE) {
+      writer_submit(this,current);
+      this->current = get_free_buffer();
+      this->current->length = 0;
+    }
+  }
+
+  return;
+}
+
+
+/* Writes any remaining output and waits for it */
+static void
+writer_free (T *old) {
+  T this = *old;
+  Buffer_T buffer;
+  bool submittedp;
+#ifdef HAVE_PTHREAD
+  T *p;
+#endif
+
+  if (this == NULL) {
+    return;
+  }
+
+  if (this->current->length == 0) {
+    buffer_free(&this->current);
+    submittedp = false;
+  } else {
+    writer_submit(this,this->current);
+    submittedp = true;
+  }
+
+#ifdef USE_URING
+  if (backend == BACKEND_URING) {
+    while (this->ninflight > 0) {
+      uring_reap(/*min_complete*/1);
+    }
+    assert(this->pending_head == NULL);
+
+    /* Writes were at explicit offsets, so the file position is unchanged */
+    if (this->serialp == false) {
+      lseek(this->fd,this->offset,SEEK_SET);
+    }
+  }
+#endif
+
+#ifdef HAVE_PTHREAD
+  if (backend == BACKEND_THREADS) {
+    pthread_mutex_lock(&lock);
+    while (this->pending_head != NULL || this->ninflight > 0) {
+      pthread_cond_wait(&buffer_free_p,&lock);
+    }
+    for (p = &writers; *p != this; p = &((*p)->next)) ;
+    *p = this->next;
+    pthread_mutex_unlock(&lock);
+  }
+#endif
+
+  if (submittedp == true) {
+    /* Keep nbuffers shared buffers, now that the staging buffer has been returned */
+    buffer = get_free_buffer();
+    buffer_free(&buffer);
+  }
+
+  FREE_KEEP(*old);
+  return;
+}
+
+
+/************************************************************************
+ *   Interface
+ ************************************************************************/
+
+void
+Outwriter_setup (Outwriter_method_T method, int nbuffers_in) {
+  Buffer_T buffer;
+  int i;
+
+  activep = true;
+  nbuffers = (nbuffers_in > 0) ? nbuffers_in : OUTWRITER_DEFAULT_NBUFFERS;
+  for (i = 0; i < nbuffers; i++) {
+    buffer = buffer_new();
+    buffer->next = free_buffers;
+    free_buffers = buffer;
+  }
+
+  backend = BACKEND_SYNC;
+#ifdef USE_URING
+  if (method == OUTWRITER_URING) {
+    if (uring_init((unsigned int) nbuffers) == true) {
+      backend = BACKEND_URING;
+    } else {
+      fprintf(stderr,"io_uring is not available, so using writer threads for output\n");
+    }
+  }
+#endif
+
+#ifdef HAVE_PTHREAD
+  if (backend == BACKEND_SYNC && method != OUTWRITER_NONE) {
+    shutdownp = false;
+    writers = (T) NULL;
+    for (i = 0; i < NTHREADS; i++) {
+      pthread_create(&(threads[i]),NULL,writer_thread,(void *) NULL);
+    }
+    backend = BACKEND_THREADS;
+  }
+#endif
+
+  stopwatch = Stopwatch_new();
+  stall_stopwatch = Stopwatch_new();
+  Stopwatch_start(stopwatch);
+  stall_seconds = 0.0;
+  nbytes_written = 0;
+  nwrites = 0;
+  depth = max_depth = 0;
+  sum_depth = 0.0;
+
+  return;
+}
+
+
+/* Expects all files to have been closed by Outwriter_fclose.  Prints
+   statistics. */
+void
+Outwriter_finish (void) {
+  Buffer_T buffer;
+  double seconds, megabytes;
+#ifdef HAVE_PTHREAD
+  int i;
+#endif
+
+  if (activep == false) {
+    return;
+  }
+  assert(open_writers == NULL);
+
+#ifdef USE_URING
+  if (backend == BACKEND_URING) {
+    uring_free();
+  }
+#endif
+
+#ifdef HAVE_PTHREAD
+  if (backend == BACKEND_THREADS) {
+    pthread_mutex_lock(&lock);
+    shutdownp = true;
+    pthread_cond_broadcast(&work_avail_p);
+    pthread_mutex_unlock(&lock);
+    for (i = 0; i < NTHREADS; i++) {
+      pthread_join(threads[i],NULL);
+    }
+  }
+#endif
+
+  seconds = Stopwatch_stop(stopwatch);
+  megabytes = (double) nbytes_written/1048576.0;
+  fprintf(stderr,"Output written %s: %.1f MB in %lu writes, %.2f sec, %.0f MB/s, queue depth %.1f average and %d maximum, waited %.2f sec for buffers\n",
+	  (backend == BACKEND_URING) ? "with io_uring" : (backend == BACKEND_THREADS) ? "by writer threads" : "directly",
+	  megabytes,nwrites,seconds,(seconds > 0.0) ? megabytes/seconds : 0.0,
+	  (nwrites == 0) ? 0.0 : sum_depth/(double) nwrites,max_depth,stall_seconds);
+
+  while ((buffer = free_buffers) != NULL) {
+    free_buffers = buffer->next;
+    buffer_free(&buffer);
+  }
+  Stopwatch_free(&stall_stopwatch);
+  Stopwatch_free(&stopwatch);
+  backend = BACKEND_SYNC;
+  activep = false;
+
+  return;
+}
+
+
+
+static T
+find_writer (FILE *fp) {
+  List_T p;
+  T writer;
+
+  for (p = open_writers; p != NULL; p = List_next(p)) {
+    if ((writer = (T) List_head(p))->fp == fp) {
+      return writer;
+    }
+  }
+  return (T) NULL;
+}
+
+
+/* Same arguments as fwrite.  Standard output is always written
+   directly, since other code may also print to it. */
+void
+Outwriter_fwrite (const void *ptr, size_t size, size_t nmemb, FILE *fp) {
+  T writer;
+
+  if (activep == false || fp == stdout) {
+    fwrite(ptr,size,nmemb,fp);
+  } else {
+    if ((writer = find_writer(fp)) == NULL) {
+      writer = writer_new(fp);
+      open_writers = List_push_keep(open_writers,(void *) writer);
+    }
+    writer_write(writer,(const char *) ptr,size*nmemb);
+  }
+  return;
+}
+
+
+/* Waits for the writes to fp, and then closes it */
+void
+Outwriter_fclose (FILE *fp) {
+  T writer;
+  List_T p, prev = NULL;
+
+  for (p = open_writers; p != NULL; prev = p, p = List_next(p)) {
+    if ((writer = (T) List_head(p))->fp == fp) {
+      if (prev == NULL) {
+	open_writers = List_next(p);
+      } else {
+	prev->rest = List_next(p);
+      }
+      p->rest = (List_T) NULL;
+      List_free_keep(&p);
+      writer_free(&writer);
+      break;
+    }
+  }
+
+  fclose(fp);
+  return;
+}
+
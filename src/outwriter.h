@@ -0,0 +1,40 @@
+/* $Id$ */
+#ifndef OUTWRITER_INCLUDED
+#define OUTWRITER_INCLUDED
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stddef.h>
+#include "bool.h"
+
+
+/* Asynchronous writer for output files.  Records are copied into a
+   staging buffer for each file, and each full buffer is written in
+   the background, by io_uring if the kernel allows it and otherwise
+   by a small pool of writer threads.  The buffers of a given file are
+   written in order.  At most nbuffers are queued or being written
+   across all files, after which the output thread waits.  Until
+   Outwriter_setup is called, Outwriter_fwrite is just fwrite.  All
+   calls must come from a single thread, and a file given to
+   Outwriter_fwrite must not be written otherwise until
+   Outwriter_fclose. */
+
+#define OUTWRITER_BUFSIZE 1048576
+#define OUTWRITER_DEFAULT_NBUFFERS 16
+
+typedef enum {OUTWRITER_NONE, OUTWRITER_URING, OUTWRITER_THREADS} Outwriter_method_T;
+
+extern void
+Outwriter_setup (Outwriter_method_T method, int nbuffers);
+extern void
+Outwriter_finish (void);
+
+extern void
+Outwriter_fwrite (const void *ptr, size_t size, size_t nmemb, FILE *fp);
+extern void
+Outwriter_fclose (FILE *fp);
+
+#endif
+
@@ -2222,20 +2222,43 @@ Pair_print_exonsummary (Filestring_T fp, struct T *pairs, int npairs, Chrnum_T c
 	  intron_start = exon_genomeend - 1;
 	}
 	if (genomefirstp == true) {
-	  FPRINTF(fp,"    ");
+	  Filestring_put_string(fp,"    ");
 	  if (chrnum == 0) {
-	    FPRINTF(fp,"%u-%u",chroffset+exon_genomestart,chroffset+exon_genomeend);
+	    Filestring_put_uint(fp,chroffset+exon_genomestart);
+	    PUTC('-',fp);
+	    Filestring_put_uint(fp,chroffset+exon_genomeend);
 	  } else {
-	    FPRINTF(fp,"%s:%d-%d",chrstring,exon_genomestart,exon_genomeend);
+	    Filestring_put_string(fp,chrstring);
+	    PUTC(':',fp);
+	    Filestring_put_int(fp,exon_genomestart);
+	    PUTC('-',fp);
+	    Filestring_put_int(fp,exon_genomeend);
 	  }
-	  FPRINTF(fp,"  (%d-%d)",exon_querystart,exon_queryend);
+	  Filestring_put_string(fp,"  (");
+	  Filestring_put_int(fp,exon_querystart);
+	  PUTC('-',fp);
+	  Filestring_put_int(fp,exon_queryend);
+	  PUTC(')',fp);
 	} else {
-	  FPRINTF(fp,"    %d-%d",exon_querystart,exon_queryend);
-	  FPRINTF(fp,"  ");
+	  Filestring_put_string(fp,"    ");
+	  Filestring_put_int(fp,exon_querystart);
+	  PUTC('-',fp);
+	  Filestring_put_int(fp,exon_queryend);
+	  Filestring_put_string(fp,"  ");
 	  if (chrnum == 0) {
-	    FPRINTF(fp,"(%u-%u)",chroffset+exon_genomestart,chroffset+exon_genomeend);
+	    PUTC('(',fp);
+	    Filestring_put_uint(fp,chroffset+exon_genomestart);
+	    PUTC('-',fp);
+	    Filestring_put_uint(fp,chroffset+exon_genomeend);
+	    PUTC(')',fp);
 	  } else {
-	    FPRINTF(fp,"(%s:%d-%d)",chrstring,exon_genomestart,exon_genomeend);
+	    PUTC('(',fp);
+	    Filestring_put_string(fp,chrstring);
+	    PUTC(':',fp);
+	    Filestring_put_int(fp,exon_genomestart);
+	    PUTC('-',fp);
+	    Filestring_put_int(fp,exon_genomeend);
+	    PUTC(')',fp);
 	  }
 	}
 	if (den == 0) {
@@ -2244,28 +2267,28 @@ Pair_print_exonsummary (Filestring_T fp, struct T *pairs, int npairs, Chrnum_T c
 	  FPRINTF(fp,"   %d%%",(int) floor(100.0*(double) num/(double) den));
 	}
 	if (this->comp == FWD_CANONICAL_INTRON_COMP) {
-	  FPRINTF(fp," ->");
+	  Filestring_put_string(fp," ->");
 	  /* sensep = true; */
 	} else if (this->comp == REV_CANONICAL_INTRON_COMP) {
-	  FPRINTF(fp," <-");
+	  Filestring_put_string(fp," <-");
 	  /* sensep = false; */
 	} else if (this->comp == FWD_GCAG_INTRON_COMP) {
-	  FPRINTF(fp," -)");
+	  Filestring_put_string(fp," -)");
 	  /* sensep = true; */
 	} else if (this->comp == REV_GCAG_INTRON_COMP) {
-	  FPRINTF(fp," (-");
+	  Filestring_put_string(fp," (-");
 	  /* sensep = false; */
 	} else if (this->comp == FWD_ATAC_INTRON_COMP) {
-	  FPRINTF(fp," -]");
+	  Filestring_put_string(fp," -]");
 	  /* sensep = true; */
 	} else if (this->comp == REV_ATAC_INTRON_COMP) {
-	  FPRINTF(fp," [-");
+	  Filestring_put_string(fp," [-");
 	  /* sensep = false; */
 	} else if (this->comp == NONINTRON_COMP) {
-	  FPRINTF(fp," ==");
+	  Filestring_put_string(fp," ==");
 	  /* sensep = true; */
 	} else {
-	  FPRINTF(fp," ##");
+	  Filestring_put_string(fp," ##");
 	  /* sensep = true; */
 	}
 	in_exon = false;
@@ -2285,13 +2308,19 @@ Pair_print_exonsummary (Filestring_T fp, struct T *pairs, int npairs, Chrnum_T c
 	}
 	if (i > 0) {
 	  if (intron_end > intron_start) {
-	    FPRINTF(fp,"   ...%d...",intron_end - intron_start + 1);
+	    Filestring_put_string(fp,"   ...");
+	    Filestring_put_int(fp,intron_end - intron_start + 1);
+	    Filestring_put_string(fp,"...");
 	  } else {
-	    FPRINTF(fp,"   ...%d...",intron_start - intron_end + 1);
+	    Filestring_put_string(fp,"   ...");
+	    Filestring_put_int(fp,intron_start - intron_end + 1);
+	    Filestring_put_string(fp,"...");
 	  }
 
 	  if (exon_querystart > exon_queryend + 1) {
-	    FPRINTF(fp,"   ***query_skip:%d***",exon_querystart-(exon_queryend+1));
+	    Filestring_put_string(fp,"   ***query_skip:");
+	    Filestring_put_int(fp,exon_querystart-(exon_queryend+1));
+	    Filestring_put_string(fp,"***");
 	  }
 
 	  if (genome != NULL) {
@@ -2345,20 +2374,43 @@ Pair_print_exonsummary (Filestring_T fp, struct T *pairs, int npairs, Chrnum_T c
   exon_queryend = last_querypos + ONEBASEDP;
   exon_genomeend = last_genomepos + ONEBASEDP;
   if (genomefirstp == true) {
-    FPRINTF(fp,"    ");
+    Filestring_put_string(fp,"    ");
     if (chrnum == 0) {
-      FPRINTF(fp,"%u-%u",chroffset+exon_genomestart,chroffset+exon_genomeend);
+      Filestring_put_uint(fp,chroffset+exon_genomestart);
+      PUTC('-',fp);
+      Filestring_put_uint(fp,chroffset+exon_genomeend);
     } else {
-      FPRINTF(fp,"%s:%d-%d",chrstring,exon_genomestart,exon_genomeend);
-    }
-    FPRINTF(fp,"  (%d-%d)",exon_querystart,exon_queryend);
-  } else {
-    FPRINTF(fp,"    %d-%d",exon_querystart,exon_queryend);
-    FPRINTF(fp,"  ");
+      Filestring_put_string(fp,chrstring);
+      PUTC(':',fp);
+      Filestring_put_int(fp,exon_genomestart);
+      PUTC('-',fp);
+      Filestring_put_int(fp,exon_genomeend);
+    }
+    Filestring_put_string(fp,"  (");
+    Filestring_put_int(fp,exon_querystart);
+    PUTC('-',fp);
+    Filestring_put_int(fp,exon_queryend);
+    PUTC(')',fp);
+  } else {
+    Filestring_put_string(fp,"    ");
+    Filestring_put_int(fp,exon_querystart);
+    PUTC('-',fp);
+    Filestring_put_int(fp,exon_queryend);
+    Filestring_put_string(fp,"  ");
     if (chrnum == 0) {
-      FPRINTF(fp,"(%u-%u)",chroffset+exon_genomestart,chroffset+exon_genomeend);
+      PUTC('(',fp);
+      Filestring_put_uint(fp,chroffset+exon_genomestart);
+      PUTC('-',fp);
+      Filestring_put_uint(fp,chroffset+exon_genomeend);
+      PUTC(')',fp);
     } else {
-      FPRINTF(fp,"(%s:%d-%d)",chrstring,exon_genomestart,exon_genomeend);
+      PUTC('(',fp);
+      Filestring_put_string(fp,chrstring);
+      PUTC(':',fp);
+      Filestring_put_int(fp,exon_genomestart);
+      PUTC('-',fp);
+      Filestring_put_int(fp,exon_genomeend);
+      PUTC(')',fp);
     }
   }
   if (den == 0) {
@@ -2366,7 +2418,7 @@ Pair_print_exonsummary (Filestring_T fp, struct T *pairs, int npairs, Chrnum_T c
   } else {
     FPRINTF(fp,"   %d%%",(int) floor(100.0*(double) num/(double) den));
   }
-  FPRINTF(fp,"\n\n");
+  Filestring_put_string(fp,"\n\n");
 
   if (chrstring != NULL) {
     FREE(chrstring);
@@ -2419,11 +2471,12 @@ print_tokens_gff3 (Filestring_T fp, List_T tokens) {
   if (tokens != NULL) {
     p = tokens;
     token = (char *) List_head(p);
-    FPRINTF(fp,"%s",token);
+    Filestring_put_string(fp,token);
 
     for (p = List_next(p); p != NULL; p = List_next(p)) {
       token = (char *) List_head(p);
-      FPRINTF(fp," %s",token);
+      PUTC(' ',fp);
+      Filestring_put_string(fp,token);
     }
   }
 
@@ -2454,54 +2507,74 @@ print_gff3_gene (Filestring_T fp, int pathnum, char *sourcename, char *accession
   
   /* 1: seqid */
   if (chrstring == NULL) {
-    FPRINTF(fp,"%s\t","NA");
+    Filestring_put_string(fp,"NA");
+    PUTC('\t',fp);
   } else {
-    FPRINTF(fp,"%s\t",chrstring);
+    Filestring_put_string(fp,chrstring);
+    PUTC('\t',fp);
   }
-  FPRINTF(fp,"%s\t",sourcename);	/* 2: source */
-  FPRINTF(fp,"gene\t");		/* 3: type */
+  Filestring_put_string(fp,sourcename);
+  PUTC('\t',fp);	/* 2: source */
+  Filestring_put_string(fp,"gene\t");		/* 3: type */
 
   if (start_genomepos < end_genomepos) {
-    FPRINTF(fp,"%u\t%u\t",start_genomepos,end_genomepos); /* 4,5: start, end */
+    Filestring_put_uint(fp,start_genomepos);
+    PUTC('\t',fp);
+    Filestring_put_uint(fp,end_genomepos);
+    PUTC('\t',fp); /* 4,5: start, end */
   } else {
-    FPRINTF(fp,"%u\t%u\t",end_genomepos,start_genomepos); /* 4,5: start, end */
+    Filestring_put_uint(fp,end_genomepos);
+    PUTC('\t',fp);
+    Filestring_put_uint(fp,start_genomepos);
+    PUTC('\t',fp); /* 4,5: start, end */
   }
 
-  FPRINTF(fp,".\t");		/* 6: score */
+  Filestring_put_string(fp,".\t");		/* 6: score */
 
   if (watsonp == true) {
     if (cdna_direction >= 0) {
-      FPRINTF(fp,"+\t");
+      Filestring_put_string(fp,"+\t");
     } else {
-      FPRINTF(fp,"-\t");
+      Filestring_put_string(fp,"-\t");
     }
   } else {
     if (cdna_direction >= 0) {
-      FPRINTF(fp,"-\t");		/* 7: strand */
+      Filestring_put_string(fp,"-\t");		/* 7: strand */
     } else {
-      FPRINTF(fp,"+\t");
+      Filestring_put_string(fp,"+\t");
     }
   }
 
-  FPRINTF(fp,".\t");		/* 8: phase */
+  Filestring_put_string(fp,".\t");		/* 8: phase */
 
   /* 9: features */
   if (accession == NULL) {
-    FPRINTF(fp,"ID=%s.path%d;Name=%s","NA",pathnum,"NA");
+    Filestring_put_string(fp,"ID=");
+    Filestring_put_string(fp,"NA");
+    Filestring_put_string(fp,".path");
+    Filestring_put_int(fp,pathnum);
+    Filestring_put_string(fp,";Name=");
+    Filestring_put_string(fp,"NA");
   } else {
-    FPRINTF(fp,"ID=%s.path%d;Name=%s",accession,pathnum,accession);
+    Filestring_put_string(fp,"ID=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,".path");
+    Filestring_put_int(fp,pathnum);
+    Filestring_put_string(fp,";Name=");
+    Filestring_put_string(fp,accession);
   }
 
   if (fasta_annotation != NULL) {
-    FPRINTF(fp,";%s",fasta_annotation);
+    PUTC(';',fp);
+    Filestring_put_string(fp,fasta_annotation);
   }
 
   if (cdna_direction > 0) {
-    FPRINTF(fp,";Dir=sense");
+    Filestring_put_string(fp,";Dir=sense");
   } else if (cdna_direction < 0) {
-    FPRINTF(fp,";Dir=antisense");
+    Filestring_put_string(fp,";Dir=antisense");
   } else {
-    FPRINTF(fp,";Dir=indeterminate");
+    Filestring_put_string(fp,";Dir=indeterminate");
   }
 
   PUTC('\n',fp);
@@ -2521,55 +2594,81 @@ print_gff3_mrna (Filestring_T fp, int pathnum, T start, T end,
 
   /* 1: seqid */
   if (chrstring == NULL) {
-    FPRINTF(fp,"%s\t","NA");
+    Filestring_put_string(fp,"NA");
+    PUTC('\t',fp);
   } else {
-    FPRINTF(fp,"%s\t",chrstring);
+    Filestring_put_string(fp,chrstring);
+    PUTC('\t',fp);
   }
-  FPRINTF(fp,"%s\t",sourcename);	/* 2: source */
-  FPRINTF(fp,"mRNA\t");		/* 3: type */
+  Filestring_put_string(fp,sourcename);
+  PUTC('\t',fp);	/* 2: source */
+  Filestring_put_string(fp,"mRNA\t");		/* 3: type */
   if (start_genomepos < end_genomepos) {
-    FPRINTF(fp,"%u\t%u\t",start_genomepos,end_genomepos); /* 4,5: start, end */
+    Filestring_put_uint(fp,start_genomepos);
+    PUTC('\t',fp);
+    Filestring_put_uint(fp,end_genomepos);
+    PUTC('\t',fp); /* 4,5: start, end */
   } else {
-    FPRINTF(fp,"%u\t%u\t",end_genomepos,start_genomepos); /* 4,5: start, end */
+    Filestring_put_uint(fp,end_genomepos);
+    PUTC('\t',fp);
+    Filestring_put_uint(fp,start_genomepos);
+    PUTC('\t',fp); /* 4,5: start, end */
   }
 
-  FPRINTF(fp,".\t");		/* 6: score */
+  Filestring_put_string(fp,".\t");		/* 6: score */
 
   if (watsonp == true) {
     if (cdna_direction >= 0) {
-      FPRINTF(fp,"+\t");
+      Filestring_put_string(fp,"+\t");
     } else {
-      FPRINTF(fp,"-\t");
+      Filestring_put_string(fp,"-\t");
     }
   } else {
     if (cdna_direction >= 0) {
-      FPRINTF(fp,"-\t");		/* 7: strand */
+      Filestring_put_string(fp,"-\t");		/* 7: strand */
     } else {
-      FPRINTF(fp,"+\t");
+      Filestring_put_string(fp,"+\t");
     }
   }
 
-  FPRINTF(fp,".\t");		/* 8: phase */
+  Filestring_put_string(fp,".\t");		/* 8: phase */
 
   /* 9: features */
   if (accession == NULL) {
-    FPRINTF(fp,"ID=%s.mrna%d;Name=%s;Parent=%s.path%d",
-	    "NA",pathnum,"NA","NA",pathnum);
-  } else {
-    FPRINTF(fp,"ID=%s.mrna%d;Name=%s;Parent=%s.path%d",
-	    accession,pathnum,accession,accession,pathnum);
+    Filestring_put_string(fp,"ID=");
+    Filestring_put_string(fp,"NA");
+    Filestring_put_string(fp,".mrna");
+    Filestring_put_int(fp,pathnum);
+    Filestring_put_string(fp,";Name=");
+    Filestring_put_string(fp,"NA");
+    Filestring_put_string(fp,";Parent=");
+    Filestring_put_string(fp,"NA");
+    Filestring_put_string(fp,".path");
+    Filestring_put_int(fp,pathnum);
+  } else {
+    Filestring_put_string(fp,"ID=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,".mrna");
+    Filestring_put_int(fp,pathnum);
+    Filestring_put_string(fp,";Name=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,";Parent=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,".path");
+    Filestring_put_int(fp,pathnum);
   }
 
   if (fasta_annotation != NULL) {
-    FPRINTF(fp,";%s",fasta_annotation);
+    PUTC(';',fp);
+    Filestring_put_string(fp,fasta_annotation);
   }
 
   if (cdna_direction > 0) {
-    FPRINTF(fp,";Dir=sense");
+    Filestring_put_string(fp,";Dir=sense");
   } else if (cdna_direction < 0) {
-    FPRINTF(fp,";Dir=antisense");
+    Filestring_put_string(fp,";Dir=antisense");
   } else {
-    FPRINTF(fp,";Dir=indeterminate");
+    Filestring_put_string(fp,";Dir=indeterminate");
   }
 
   querypos1 = start->querypos;
@@ -2592,8 +2691,14 @@ print_gff3_mrna (Filestring_T fp, int pathnum, T start, T end,
     fracidentity = (double) matches/(double) den;
   }
   FPRINTF(fp,";identity=%.1f",((double) rint(1000.0*fracidentity))/10.0);
-  FPRINTF(fp,";matches=%d;mismatches=%d;indels=%d;unknowns=%d",
-	  matches,mismatches,qindels+tindels,unknowns);
+  Filestring_put_string(fp,";matches=");
+  Filestring_put_int(fp,matches);
+  Filestring_put_string(fp,";mismatches=");
+  Filestring_put_int(fp,mismatches);
+  Filestring_put_string(fp,";indels=");
+  Filestring_put_int(fp,qindels+tindels);
+  Filestring_put_string(fp,";unknowns=");
+  Filestring_put_int(fp,unknowns);
 
   PUTC('\n',fp);
 
@@ -2614,53 +2719,93 @@ print_gff3_exon (Filestring_T fp, int exonno, int pathnum, char *sourcename,
   } else {
     /* 1: seqid */
     if (chrstring == NULL) {
-      FPRINTF(fp,"%s\t","NA");
+      Filestring_put_string(fp,"NA");
+      PUTC('\t',fp);
     } else {
-      FPRINTF(fp,"%s\t",chrstring);
+      Filestring_put_string(fp,chrstring);
+      PUTC('\t',fp);
     }
-    FPRINTF(fp,"%s\t",sourcename);	/* 2: source */
-    FPRINTF(fp,"exon\t");		/* 3: type */
+    Filestring_put_string(fp,sourcename);
+    PUTC('\t',fp);	/* 2: source */
+    Filestring_put_string(fp,"exon\t");		/* 3: type */
     if (exon_genomestart < exon_genomeend) {
-      FPRINTF(fp,"%u\t%u\t",exon_genomestart,exon_genomeend); /* 4,5: start, end */
+      Filestring_put_uint(fp,exon_genomestart);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,exon_genomeend);
+      PUTC('\t',fp); /* 4,5: start, end */
     } else {
-      FPRINTF(fp,"%u\t%u\t",exon_genomeend,exon_genomestart); /* 4,5: start, end */
+      Filestring_put_uint(fp,exon_genomeend);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,exon_genomestart);
+      PUTC('\t',fp); /* 4,5: start, end */
     }
-    FPRINTF(fp,"%d\t",pctidentity);	/* 6: score */
+    Filestring_put_int(fp,pctidentity);
+    PUTC('\t',fp);	/* 6: score */
 
     if (watsonp == true) {
       if (cdna_direction >= 0) {
-	FPRINTF(fp,"+\t");
+	Filestring_put_string(fp,"+\t");
       } else {
-	FPRINTF(fp,"-\t");
+	Filestring_put_string(fp,"-\t");
       }
     } else {
       if (cdna_direction >= 0) {
-	FPRINTF(fp,"-\t");		/* 7: strand */
+	Filestring_put_string(fp,"-\t");		/* 7: strand */
       } else {
-	FPRINTF(fp,"+\t");
+	Filestring_put_string(fp,"+\t");
       }
     }
 
-    FPRINTF(fp,".\t");		/* 8: phase */
+    Filestring_put_string(fp,".\t");		/* 8: phase */
 
     /* 9: features */
     if (accession == NULL) {
       accession = "NA";
     }
-    FPRINTF(fp,"ID=%s.mrna%d.exon%d;",accession,pathnum,exonno);
-    FPRINTF(fp,"Name=%s;",accession);
-    FPRINTF(fp,"Parent=%s.mrna%d",accession,pathnum);
+    Filestring_put_string(fp,"ID=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,".mrna");
+    Filestring_put_int(fp,pathnum);
+    Filestring_put_string(fp,".exon");
+    Filestring_put_int(fp,exonno);
+    PUTC(';',fp);
+    Filestring_put_string(fp,"Name=");
+    Filestring_put_string(fp,accession);
+    PUTC(';',fp);
+    Filestring_put_string(fp,"Parent=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,".mrna");
+    Filestring_put_int(fp,pathnum);
 
     if (fasta_annotation != NULL) {
-      FPRINTF(fp,";%s",fasta_annotation);
+      PUTC(';',fp);
+      Filestring_put_string(fp,fasta_annotation);
     }
 
     if (cdna_direction > 0) {
-      FPRINTF(fp,";Target=%s %d %d +\n",accession,exon_querystart,exon_queryend);
+      Filestring_put_string(fp,";Target=");
+      Filestring_put_string(fp,accession);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,exon_querystart);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,exon_queryend);
+      Filestring_put_string(fp," +\n");
     } else if (cdna_direction < 0) {
-      FPRINTF(fp,";Target=%s %d %d -\n",accession,exon_queryend,exon_querystart);
+      Filestring_put_string(fp,";Target=");
+      Filestring_put_string(fp,accession);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,exon_queryend);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,exon_querystart);
+      Filestring_put_string(fp," -\n");
     } else {
-      FPRINTF(fp,";Target=%s %d %d .\n",accession,exon_queryend,exon_querystart);
+      Filestring_put_string(fp,";Target=");
+      Filestring_put_string(fp,accession);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,exon_queryend);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,exon_querystart);
+      Filestring_put_string(fp," .\n");
     }
   }
 
@@ -2682,36 +2827,47 @@ print_gff3_cds (Filestring_T fp, int cdsno, int pathnum,
   } else {
     /* 1: seqid */
     if (chrstring == NULL) {
-      FPRINTF(fp,"%s\t","NA");
+      Filestring_put_string(fp,"NA");
+      PUTC('\t',fp);
     } else {
-      FPRINTF(fp,"%s\t",chrstring);
+      Filestring_put_string(fp,chrstring);
+      PUTC('\t',fp);
     }
-    FPRINTF(fp,"%s\t",sourcename);	/* 2: source */
-    FPRINTF(fp,"CDS\t");		/* 3: type */
+    Filestring_put_string(fp,sourcename);
+    PUTC('\t',fp);	/* 2: source */
+    Filestring_put_string(fp,"CDS\t");		/* 3: type */
     if (cds_genomestart < cds_genomeend) {
-      FPRINTF(fp,"%u\t%u\t",cds_genomestart,cds_genomeend); /* 4,5: start, end */
+      Filestring_put_uint(fp,cds_genomestart);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,cds_genomeend);
+      PUTC('\t',fp); /* 4,5: start, end */
     } else {
-      FPRINTF(fp,"%u\t%u\t",cds_genomeend,cds_genomestart); /* 4,5: start, end */
+      Filestring_put_uint(fp,cds_genomeend);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,cds_genomestart);
+      PUTC('\t',fp); /* 4,5: start, end */
     }
-    FPRINTF(fp,"%d\t",pctidentity);	/* 6: score */
+    Filestring_put_int(fp,pctidentity);
+    PUTC('\t',fp);	/* 6: score */
 
     if (watsonp == true) {
       if (cdna_direction >= 0) {
-	FPRINTF(fp,"+\t");
+	Filestring_put_string(fp,"+\t");
       } else {
-	FPRINTF(fp,"-\t");
+	Filestring_put_string(fp,"-\t");
       }
     } else {
       if (cdna_direction >= 0) {
-	FPRINTF(fp,"-\t");		/* 7: strand */
+	Filestring_put_string(fp,"-\t");		/* 7: strand */
       } else {
-	FPRINTF(fp,"+\t");
+	Filestring_put_string(fp,"+\t");
       }
     }
 
     if (gff3_phase_swap_p == true && cds_phase > 0) {
       /* Some analysis programs want phase in gff3 to be different */
-      FPRINTF(fp,"%d\t",3 - cds_phase);	/* 8: phase */
+      Filestring_put_int(fp,3 - cds_phase);
+      PUTC('\t',fp);	/* 8: phase */
     } else {
       /* This appears to be the specification: a phase of 0 indicates
 	 that the next codon begins at the first base of the region
@@ -2719,27 +2875,58 @@ print_gff3_cds (Filestring_T fp, int cdsno, int pathnum,
 	 next codon begins at the second base of this region, and a
 	 phase of 2 indicates that the codon begins at the third base of
 	 this region. */
-      FPRINTF(fp,"%d\t",cds_phase);	/* 8: phase */
+      Filestring_put_int(fp,cds_phase);
+      PUTC('\t',fp);	/* 8: phase */
     }
 
     /* 9: features */
     if (accession == NULL) {
       accession = "NA";
     }
-    FPRINTF(fp,"ID=%s.mrna%d.cds%d;",accession,pathnum,cdsno);
-    FPRINTF(fp,"Name=%s;",accession);
-    FPRINTF(fp,"Parent=%s.mrna%d",accession,pathnum);
+    Filestring_put_string(fp,"ID=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,".mrna");
+    Filestring_put_int(fp,pathnum);
+    Filestring_put_string(fp,".cds");
+    Filestring_put_int(fp,cdsno);
+    PUTC(';',fp);
+    Filestring_put_string(fp,"Name=");
+    Filestring_put_string(fp,accession);
+    PUTC(';',fp);
+    Filestring_put_string(fp,"Parent=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,".mrna");
+    Filestring_put_int(fp,pathnum);
 
     if (fasta_annotation != NULL) {
-      FPRINTF(fp,";%s",fasta_annotation);
+      PUTC(';',fp);
+      Filestring_put_string(fp,fasta_annotation);
     }
 
     if (cdna_direction > 0) {
-      FPRINTF(fp,";Target=%s %d %d +\n",accession,cds_querystart,cds_queryend);
+      Filestring_put_string(fp,";Target=");
+      Filestring_put_string(fp,accession);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,cds_querystart);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,cds_queryend);
+      Filestring_put_string(fp," +\n");
     } else if (cdna_direction > 0) {
-      FPRINTF(fp,";Target=%s %d %d -\n",accession,cds_queryend,cds_querystart);
+      Filestring_put_string(fp,";Target=");
+      Filestring_put_string(fp,accession);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,cds_queryend);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,cds_querystart);
+      Filestring_put_string(fp," -\n");
     } else {
-      FPRINTF(fp,";Target=%s %d %d .\n",accession,cds_queryend,cds_querystart);
+      Filestring_put_string(fp,";Target=");
+      Filestring_put_string(fp,accession);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,cds_queryend);
+      PUTC(' ',fp);
+      Filestring_put_int(fp,cds_querystart);
+      Filestring_put_string(fp," .\n");
     }
   }
 
@@ -2760,48 +2947,70 @@ print_gff3_cdna_match (Filestring_T fp, int pathnum,
   } else {
     /* 1: seqid */
     if (chrstring == NULL) {
-      FPRINTF(fp,"%s\t","NA");
+      Filestring_put_string(fp,"NA");
+      PUTC('\t',fp);
     } else {
-      FPRINTF(fp,"%s\t",chrstring);
+      Filestring_put_string(fp,chrstring);
+      PUTC('\t',fp);
     }
-    FPRINTF(fp,"%s\t",sourcename);	/* 2: source */
-    FPRINTF(fp,"cDNA_match\t");		/* 3: type */
+    Filestring_put_string(fp,sourcename);
+    PUTC('\t',fp);	/* 2: source */
+    Filestring_put_string(fp,"cDNA_match\t");		/* 3: type */
     if (exon_genomestart < exon_genomeend) {
-      FPRINTF(fp,"%u\t%u\t",exon_genomestart,exon_genomeend); /* 4,5: start, end */
+      Filestring_put_uint(fp,exon_genomestart);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,exon_genomeend);
+      PUTC('\t',fp); /* 4,5: start, end */
     } else {
-      FPRINTF(fp,"%u\t%u\t",exon_genomeend,exon_genomestart); /* 4,5: start, end */
+      Filestring_put_uint(fp,exon_genomeend);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,exon_genomestart);
+      PUTC('\t',fp); /* 4,5: start, end */
     }
-    FPRINTF(fp,"%d\t",pctidentity);	/* 6: score */
+    Filestring_put_int(fp,pctidentity);
+    PUTC('\t',fp);	/* 6: score */
 
     /* 7: strand */
     if (watsonp == true) {
-      FPRINTF(fp,"+\t");
+      Filestring_put_string(fp,"+\t");
     } else {
-      FPRINTF(fp,"-\t");
+      Filestring_put_string(fp,"-\t");
     }
 
-    FPRINTF(fp,".\t");		/* 8: phase */
+    Filestring_put_string(fp,".\t");		/* 8: phase */
 
     /* 9: features */
     if (accession == NULL) {
       accession = "NA";
     }
-    FPRINTF(fp,"ID=%s.path%d;",accession,pathnum);
-    FPRINTF(fp,"Name=%s",accession);
+    Filestring_put_string(fp,"ID=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,".path");
+    Filestring_put_int(fp,pathnum);
+    PUTC(';',fp);
+    Filestring_put_string(fp,"Name=");
+    Filestring_put_string(fp,accession);
 
     if (fasta_annotation != NULL) {
-      FPRINTF(fp,";%s",fasta_annotation);
+      PUTC(';',fp);
+      Filestring_put_string(fp,fasta_annotation);
     }
 
     if (cdna_direction > 0) {
-      FPRINTF(fp,";Dir=sense");
+      Filestring_put_string(fp,";Dir=sense");
     } else if (cdna_direction < 0) {
-      FPRINTF(fp,";Dir=antisense");
+      Filestring_put_string(fp,";Dir=antisense");
     } else {
-      FPRINTF(fp,";Dir=indeterminate");
+      Filestring_put_string(fp,";Dir=indeterminate");
     }
 
-    FPRINTF(fp,";Target=%s %d %d;Gap=",accession,exon_querystart,exon_queryend);
+    Filestring_put_string(fp,";Target=");
+    Filestring_put_string(fp,accession);
+    PUTC(' ',fp);
+    Filestring_put_int(fp,exon_querystart);
+    PUTC(' ',fp);
+    Filestring_put_int(fp,exon_queryend);
+    Filestring_put_string(fp,";Gap=");
     print_tokens_gff3(fp,tokens);
     PUTC('\n',fp);
   }
@@ -2839,47 +3048,71 @@ print_gff3_est_match (Filestring_T fp, int pathnum, T start, T end,
   } else {
     /* 1: seqid */
     if (chrstring == NULL) {
-      FPRINTF(fp,"%s\t","NA");
+      Filestring_put_string(fp,"NA");
+      PUTC('\t',fp);
     } else {
-      FPRINTF(fp,"%s\t",chrstring);
+      Filestring_put_string(fp,chrstring);
+      PUTC('\t',fp);
     }
-    FPRINTF(fp,"%s\t",sourcename);	/* 2: source */
-    FPRINTF(fp,"EST_match\t");	/* 3: type */
+    Filestring_put_string(fp,sourcename);
+    PUTC('\t',fp);	/* 2: source */
+    Filestring_put_string(fp,"EST_match\t");	/* 3: type */
     if (exon_genomestart < exon_genomeend) {
-      FPRINTF(fp,"%u\t%u\t",exon_genomestart,exon_genomeend); /* 4,5: start, end */
+      Filestring_put_uint(fp,exon_genomestart);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,exon_genomeend);
+      PUTC('\t',fp); /* 4,5: start, end */
     } else {
-      FPRINTF(fp,"%u\t%u\t",exon_genomeend,exon_genomestart); /* 4,5: start, end */
+      Filestring_put_uint(fp,exon_genomeend);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,exon_genomestart);
+      PUTC('\t',fp); /* 4,5: start, end */
     }
-    FPRINTF(fp,"%d\t",pctidentity);	/* 6: score */
+    Filestring_put_int(fp,pctidentity);
+    PUTC('\t',fp);	/* 6: score */
 
     /* 7: strand */
     feature_strand = watsonp ? cdna_direction : -cdna_direction;
-    FPRINTF(fp,"%c\t",strand_char(feature_strand));
+    PUTC(strand_char(feature_strand),fp);
+    PUTC('\t',fp);
 
-    FPRINTF(fp,".\t");		/* 8: phase */
+    Filestring_put_string(fp,".\t");		/* 8: phase */
 
     /* 9: features */
     if (accession == NULL) {
       accession = "NA";
     }
-    FPRINTF(fp,"ID=%s.path%d;",accession,pathnum);
-    FPRINTF(fp,"Name=%s",accession);
+    Filestring_put_string(fp,"ID=");
+    Filestring_put_string(fp,accession);
+    Filestring_put_string(fp,".path");
+    Filestring_put_int(fp,pathnum);
+    PUTC(';',fp);
+    Filestring_put_string(fp,"Name=");
+    Filestring_put_string(fp,accession);
 
     if (fasta_annotation != NULL) {
-      FPRINTF(fp,";%s",fasta_annotation);
+      PUTC(';',fp);
+      Filestring_put_string(fp,fasta_annotation);
     }
 
     if (cdna_direction > 0) {
-      FPRINTF(fp,";Dir=sense");
+      Filestring_put_string(fp,";Dir=sense");
     } else if (cdna_direction < 0) {
-      FPRINTF(fp,";Dir=antisense");
+      Filestring_put_string(fp,";Dir=antisense");
     } else {
-      FPRINTF(fp,";Dir=indeterminate");
+      Filestring_put_string(fp,";Dir=indeterminate");
     }
 
     target_strand = cdna_direction != 0 ? cdna_direction : (watsonp ? 1 : -1);
-    FPRINTF(fp,";Target=%s %d %d %c;Gap=",accession,exon_querystart,exon_queryend,
-	    strand_char(target_strand));
+    Filestring_put_string(fp,";Target=");
+    Filestring_put_string(fp,accession);
+    PUTC(' ',fp);
+    Filestring_put_int(fp,exon_querystart);
+    PUTC(' ',fp);
+    Filestring_put_int(fp,exon_queryend);
+    PUTC(' ',fp);
+    PUTC(strand_char(target_strand),fp);
+    Filestring_put_string(fp,";Gap=");
     print_tokens_gff3(fp,tokens);
 
     querypos1 = start->querypos;
@@ -2902,8 +3135,14 @@ print_gff3_est_match (Filestring_T fp, int pathnum, T start, T end,
       fracidentity = (double) matches/(double) den;
     }
     FPRINTF(fp,";identity=%.1f",((double) rint(1000.0*fracidentity))/10.0);
-    FPRINTF(fp,";matches=%d;mismatches=%d;indels=%d;unknowns=%d",
-	    matches,mismatches,qindels+tindels,unknowns);
+    Filestring_put_string(fp,";matches=");
+    Filestring_put_int(fp,matches);
+    Filestring_put_string(fp,";mismatches=");
+    Filestring_put_int(fp,mismatches);
+    Filestring_put_string(fp,";indels=");
+    Filestring_put_int(fp,qindels+tindels);
+    Filestring_put_string(fp,";unknowns=");
+    Filestring_put_int(fp,unknowns);
 
     PUTC('\n',fp);
   }
@@ -3733,7 +3972,7 @@ Pair_print_gff3 (Filestring_T fp, struct T *pairs, int npairs, int pathnum, char
   }
 
   if (gff3_separators_p == true) {
-    FPRINTF(fp,"###\n");		/* Terminates alignment */
+    Filestring_put_string(fp,"###\n");		/* Terminates alignment */
   }
 
   if (chrnum != 0) {
@@ -4729,11 +4968,7 @@ Pair_gsnap_nsegments (int *total_nmismatches, int *total_nindels, int *nintrons,
 static void
 print_chopped (Filestring_T fp, char *contents, int querylength,
 	       int hardclip_start, int hardclip_end) {
-  int i;
-
-  for (i = hardclip_start; i < querylength - hardclip_end; i++) {
-    PUTC(contents[i],fp);
-  }
+  Filestring_puts(fp,&(contents[hardclip_start]),querylength - hardclip_end - hardclip_start);
   return;
 }
 
@@ -4753,17 +4988,11 @@ print_chopped_revcomp (Filestring_T fp, char *contents, int querylength,
 static void
 print_chopped_end (Filestring_T fp, char *contents, int querylength,
 		   int hardclip_start, int hardclip_end) {
-  int i;
-
-  for (i = 0; i < hardclip_start; i++) {
-    PUTC(contents[i],fp);
-  }
+  Filestring_puts(fp,&(contents[0]),hardclip_start);
 
   /* No separator */
 
-  for (i = querylength - hardclip_end; i < querylength; i++) {
-    PUTC(contents[i],fp);
-  }
+  Filestring_puts(fp,&(contents[querylength - hardclip_end]),hardclip_end);
 
   return;
 }
@@ -4917,48 +5146,53 @@ Pair_print_sam_nomapping (Filestring_T fp, char *abbrev, char *acc1, char *acc2,
 
   /* 1. QNAME */
   if (acc2 == NULL) {
-    FPRINTF(fp,"%s",acc1);
+    Filestring_put_string(fp,acc1);
   } else {
-    FPRINTF(fp,"%s,%s",acc1,acc2);
+    Filestring_put_string(fp,acc1);
+    PUTC(',',fp);
+    Filestring_put_string(fp,acc2);
   }
   
   /* 2. FLAG */
   flag = compute_sam_flag_nomate(/*npaths*/0,first_read_p,/*watsonp*/true,sam_paired_p);
-  FPRINTF(fp,"\t%u",flag);
+  PUTC('\t',fp);
+  Filestring_put_uint(fp,flag);
 
   /* 3. RNAME: chr */
-  FPRINTF(fp,"\t*");
+  Filestring_put_string(fp,"\t*");
 
   /* 4. POS: chrpos */
-  FPRINTF(fp,"\t0");
+  Filestring_put_string(fp,"\t0");
 
   /* 5. MAPQ: Mapping quality */
   /* Picard says MAPQ should be 0 for an unmapped read */
-  FPRINTF(fp,"\t0");
+  Filestring_put_string(fp,"\t0");
 
   /* 6. CIGAR */
-  FPRINTF(fp,"\t*");
+  Filestring_put_string(fp,"\t*");
 
   /* 7. MRNM: Mate chr */
   /* 8. MPOS: Mate chrpos */
   /* 9. ISIZE: Insert size */
-  FPRINTF(fp,"\t*\t0\t0\t");
+  Filestring_put_string(fp,"\t*\t0\t0\t");
 
   /* 10. SEQ: queryseq and 11. QUAL: quality scores */
   print_chopped(fp,queryseq_ptr,querylength,/*hardclip_start*/0,/*hardclip_end*/0);
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
   print_quality(fp,quality_string,querylength,/*hardclip_start*/0,/*hardclip_end*/0,
 		quality_shift);
 
   /* 12. TAGS: RG */
   if (sam_read_group_id != NULL) {
-    FPRINTF(fp,"\tRG:Z:%s",sam_read_group_id);
+    Filestring_put_string(fp,"\tRG:Z:");
+    Filestring_put_string(fp,sam_read_group_id);
   }
   
   /* 12. TAGS: XO */
-  FPRINTF(fp,"\tXO:Z:%s",abbrev);
+  Filestring_put_string(fp,"\tXO:Z:");
+  Filestring_put_string(fp,abbrev);
 
-  FPRINTF(fp,"\n");
+  PUTC('\n',fp);
 
   return;
 }
@@ -4972,49 +5206,53 @@ Pair_print_sam_nomapping_flipped (Filestring_T fp, char *abbrev, char *chrstring
 
   /* 1. QNAME */
   if (chrstring == NULL) {
-    FPRINTF(fp,"NA\t");
+    Filestring_put_string(fp,"NA\t");
   } else {
-    FPRINTF(fp,"%s\t",chrstring);	/* The read */
+    Filestring_put_string(fp,chrstring);
+    PUTC('\t',fp);	/* The read */
   }
 
   /* 2. FLAG */
   flag = compute_sam_flag_nomate(/*npaths*/0,first_read_p,/*watsonp*/true,sam_paired_p);
-  FPRINTF(fp,"\t%u",flag);
+  PUTC('\t',fp);
+  Filestring_put_uint(fp,flag);
 
   /* 3. RNAME: chr */
-  FPRINTF(fp,"\t*");		/* Does not align to the query */
+  Filestring_put_string(fp,"\t*");		/* Does not align to the query */
 
   /* 4. POS: chrpos */
-  FPRINTF(fp,"\t0");
+  Filestring_put_string(fp,"\t0");
 
   /* 5. MAPQ: Mapping quality */
   /* Picard says MAPQ should be 0 for an unmapped read */
-  FPRINTF(fp,"\t0");
+  Filestring_put_string(fp,"\t0");
 
   /* 6. CIGAR */
-  FPRINTF(fp,"\t*");
+  Filestring_put_string(fp,"\t*");
 
   /* 7. MRNM: Mate chr */
   /* 8. MPOS: Mate chrpos */
   /* 9. ISIZE: Insert size */
-  FPRINTF(fp,"\t*\t0\t0\t");
+  Filestring_put_string(fp,"\t*\t0\t0\t");
 
   /* 10. SEQ: queryseq and 11. QUAL: quality scores */
   print_chopped(fp,genomicseg,genomiclength,/*hardclip_start*/0,/*hardclip_end*/0);
-  FPRINTF(fp,"\t*");
+  Filestring_put_string(fp,"\t*");
 #if 0
   print_quality(fp,quality_string,querylength,/*hardclip_start*/0,/*hardclip_end*/0,quality_shift);
 #endif
 
   /* 12. TAGS: RG */
   if (sam_read_group_id != NULL) {
-    FPRINTF(fp,"\tRG:Z:%s",sam_read_group_id);
+    Filestring_put_string(fp,"\tRG:Z:");
+    Filestring_put_string(fp,sam_read_group_id);
   }
   
   /* 12. TAGS: XO */
-  FPRINTF(fp,"\tXO:Z:%s",abbrev);
+  Filestring_put_string(fp,"\tXO:Z:");
+  Filestring_put_string(fp,abbrev);
 
-  FPRINTF(fp,"\n");
+  PUTC('\n',fp);
 
   return;
 }
@@ -5188,7 +5426,7 @@ Pair_print_tokens (Filestring_T fp, List_T tokens) {
   
   for (p = tokens; p != NULL; p = List_next(p)) {
     token = (char *) List_head(p);
-    FPRINTF(fp,"%s",token);
+    Filestring_put_string(fp,token);
     /* FREE_OUT(token); -- Now freed within Stage3end_free or Stage3_free */
   }
 
@@ -5874,66 +6112,76 @@ print_sam_line (Filestring_T fp, char *abbrev, char *acc1, char *acc2, char *chr
 
   /* 1. QNAME or Accession */
   if (acc2 != NULL) {
-    FPRINTF(fp,"%s,%s\t",acc1,acc2);
+    Filestring_put_string(fp,acc1);
+    PUTC(',',fp);
+    Filestring_put_string(fp,acc2);
+    PUTC('\t',fp);
   } else if (acc1 != NULL) {
-    FPRINTF(fp,"%s\t",acc1);
+    Filestring_put_string(fp,acc1);
+    PUTC('\t',fp);
   } else {
     /* Can occur with --cmdline option */
     FPRINTF(fp,"NA\t",acc1);
   }
 
   /* 2. Flags */
-  FPRINTF(fp,"%u\t",flag);
+  Filestring_put_uint(fp,flag);
+  PUTC('\t',fp);
 
   /* 3. RNAME or Chrstring */
   /* 4. POS or Chrlow */
   /* Taken from GMAP part of SAM_chromosomal_pos */
   if (chrstring == NULL) {
-    FPRINTF(fp,"NA\t");
+    Filestring_put_string(fp,"NA\t");
   } else {
-    FPRINTF(fp,"%s\t",chrstring);
+    Filestring_put_string(fp,chrstring);
+    PUTC('\t',fp);
   }
   if (chrpos > chrlength) {
-    FPRINTF(fp,"%u\t",chrpos - chrlength /*+ 1*/);
+    Filestring_put_uint(fp,chrpos - chrlength /*+ 1*/);
+    PUTC('\t',fp);
   } else {
-    FPRINTF(fp,"%u\t",chrpos /*+ 1*/);
+    Filestring_put_uint(fp,chrpos /*+ 1*/);
+    PUTC('\t',fp);
   }
 
   /* 5. MAPQ or Mapping quality */
-  FPRINTF(fp,"%d\t",mapq_score);
+  Filestring_put_int(fp,mapq_score);
+  PUTC('\t',fp);
 
   /* 6. CIGAR */
   Pair_print_tokens(fp,cigar_tokens);
 
   /* 7. MRNM: Mate chr */
   /* 8. MPOS: Mate chrpos */
-  FPRINTF(fp,"\t*\t0");
+  Filestring_put_string(fp,"\t*\t0");
 
   /* 9. ISIZE: Insert size */
-  FPRINTF(fp,"\t0");
+  Filestring_put_string(fp,"\t0");
 
   /* 10. SEQ: queryseq and 11. QUAL: quality_scores */
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
   if (watsonp == true) {
     print_chopped(fp,queryseq_ptr,querylength,hardclip_start,hardclip_end);
-    FPRINTF(fp,"\t");
+    PUTC('\t',fp);
     print_quality(fp,quality_string,querylength,hardclip_start,hardclip_end,
 		  quality_shift);
   } else {
     print_chopped_revcomp(fp,queryseq_ptr,querylength,hardclip_start,hardclip_end);
-    FPRINTF(fp,"\t");
+    PUTC('\t',fp);
     print_quality_revcomp(fp,quality_string,querylength,hardclip_start,hardclip_end,
 			  quality_shift);
   }
 
   /* 12. TAGS: RG */
   if (sam_read_group_id != NULL) {
-    FPRINTF(fp,"\tRG:Z:%s",sam_read_group_id);
+    Filestring_put_string(fp,"\tRG:Z:");
+    Filestring_put_string(fp,sam_read_group_id);
   }
 
   /* 12. TAGS: XH and XI */
   if (hardclip_start > 0 || hardclip_end > 0) {
-    FPRINTF(fp,"\tXH:Z:");
+    Filestring_put_string(fp,"\tXH:Z:");
     if (watsonp == true) {
       print_chopped_end(fp,queryseq_ptr,querylength,hardclip_start,hardclip_end);
     } else {
@@ -5941,7 +6189,7 @@ print_sam_line (Filestring_T fp, char *abbrev, char *acc1, char *acc2, char *chr
     }
 
     if (quality_string != NULL) {
-      FPRINTF(fp,"\tXI:Z:");
+      Filestring_put_string(fp,"\tXI:Z:");
       if (watsonp == true) {
 	print_chopped_end_quality(fp,quality_string,querylength,hardclip_start,hardclip_end);
       } else {
@@ -5951,36 +6199,45 @@ print_sam_line (Filestring_T fp, char *abbrev, char *acc1, char *acc2, char *chr
   }
 
   /* 12. TAGS: MD string */
-  FPRINTF(fp,"\tMD:Z:");
+  Filestring_put_string(fp,"\tMD:Z:");
   Pair_print_tokens(fp,md_tokens);
 
   /* 12. TAGS: NH */
-  FPRINTF(fp,"\tNH:i:%d",npaths_primary + npaths_altloc);
+  Filestring_put_string(fp,"\tNH:i:");
+  Filestring_put_int(fp,npaths_primary + npaths_altloc);
   
   /* 12. TAGS: HI */
-  FPRINTF(fp,"\tHI:i:%d",pathnum);
+  Filestring_put_string(fp,"\tHI:i:");
+  Filestring_put_int(fp,pathnum);
 
   /* 12. TAGS: NM */
-  FPRINTF(fp,"\tNM:i:%d",nmismatches_refdiff + nindels);
+  Filestring_put_string(fp,"\tNM:i:");
+  Filestring_put_int(fp,nmismatches_refdiff + nindels);
 
   if (snps_p) {
     /* 12. TAGS: XW and XV */
-    FPRINTF(fp,"\tXW:i:%d",nmismatches_bothdiff);
-    FPRINTF(fp,"\tXV:i:%d",nmismatches_refdiff - nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXW:i:");
+    Filestring_put_int(fp,nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXV:i:");
+    Filestring_put_int(fp,nmismatches_refdiff - nmismatches_bothdiff);
   }
 
 
   /* 12. TAGS: SM */
-  FPRINTF(fp,"\tSM:i:%d",40);
+  Filestring_put_string(fp,"\tSM:i:");
+  Filestring_put_int(fp,40);
 
   /* 12. TAGS: XQ */
-  FPRINTF(fp,"\tXQ:i:%d",absmq_score);
+  Filestring_put_string(fp,"\tXQ:i:");
+  Filestring_put_int(fp,absmq_score);
 
   /* 12. TAGS: X2 */
-  FPRINTF(fp,"\tX2:i:%d",second_absmq);
+  Filestring_put_string(fp,"\tX2:i:");
+  Filestring_put_int(fp,second_absmq);
 
   /* 12. TAGS: XO */
-  FPRINTF(fp,"\tXO:Z:%s",abbrev);
+  Filestring_put_string(fp,"\tXO:Z:");
+  Filestring_put_string(fp,abbrev);
 
   /* 12. TAGS: XS */
   if (novelsplicingp == false && knownsplicingp == false) {
@@ -5988,16 +6245,16 @@ print_sam_line (Filestring_T fp, char *abbrev, char *acc1, char *acc2, char *chr
 
   } else if (sensedir == SENSE_FORWARD) {
     if (watsonp == true) {
-      FPRINTF(fp,"\tXS:A:+");
+      Filestring_put_string(fp,"\tXS:A:+");
     } else {
-      FPRINTF(fp,"\tXS:A:-");
+      Filestring_put_string(fp,"\tXS:A:-");
     }
 
   } else if (sensedir == SENSE_ANTI) {
     if (watsonp == true) {
-      FPRINTF(fp,"\tXS:A:-");
+      Filestring_put_string(fp,"\tXS:A:-");
     } else {
-      FPRINTF(fp,"\tXS:A:+");
+      Filestring_put_string(fp,"\tXS:A:+");
     }
 
   } else if (intronp == false) {
@@ -6008,21 +6265,21 @@ print_sam_line (Filestring_T fp, char *abbrev, char *acc1, char *acc2, char *chr
     /* Don't print XS field for SENSE_NULL */
     /* Could not determine sense, so just report arbitrarily as + */
     /* This option provided for users of Cufflinks, which cannot handle XS:A:? */
-    FPRINTF(fp,"\tXS:A:+");
+    Filestring_put_string(fp,"\tXS:A:+");
     
   } else {
     /* Non-canonical.  Don't report. */
-    FPRINTF(fp,"\tXS:A:?");
+    Filestring_put_string(fp,"\tXS:A:?");
 #endif
   }
 
   /* 12. TAGS: XT */
   if (chimera != NULL) {
-    FPRINTF(fp,"\tXT:Z:");
+    Filestring_put_string(fp,"\tXT:Z:");
     Chimera_print_sam_tag(fp,chimera,chromosome_iit);
   }
 
-  FPRINTF(fp,"\n");
+  PUTC('\n',fp);
 
   return;
 }
@@ -6058,55 +6315,61 @@ print_sam_line_flipped (Filestring_T fp, char *abbrev, char *acc1, char *acc2, c
 
   /* 1. QNAME or Accession */
   if (chrstring == NULL) {
-    FPRINTF(fp,"NA\t");
+    Filestring_put_string(fp,"NA\t");
   } else {
-    FPRINTF(fp,"%s\t",chrstring);	/* The read */
+    Filestring_put_string(fp,chrstring);
+    PUTC('\t',fp);	/* The read */
   }
 
   /* 2. Flags */
-  FPRINTF(fp,"%u\t",flag);
+  Filestring_put_uint(fp,flag);
+  PUTC('\t',fp);
 
   /* 3. RNAME or Chrstring */
   /* 4. POS or Chrlow */
   /* Taken from GMAP part of SAM_chromosomal_pos */
-  FPRINTF(fp,"%s\t",acc1);	/* The query */
+  Filestring_put_string(fp,acc1);
+  PUTC('\t',fp);	/* The query */
 
-  FPRINTF(fp,"%u\t",querypos /*+ 1*/);
+  Filestring_put_uint(fp,querypos /*+ 1*/);
+  PUTC('\t',fp);
 
   /* 5. MAPQ or Mapping quality */
-  FPRINTF(fp,"%d\t",mapq_score);
+  Filestring_put_int(fp,mapq_score);
+  PUTC('\t',fp);
 
   /* 6. CIGAR */
   Pair_print_tokens(fp,cigar_tokens);
 
   /* 7. MRNM: Mate chr */
   /* 8. MPOS: Mate chrpos */
-  FPRINTF(fp,"\t*\t0");
+  Filestring_put_string(fp,"\t*\t0");
 
   /* 9. ISIZE: Insert size */
-  FPRINTF(fp,"\t0");
+  Filestring_put_string(fp,"\t0");
 
   /* 10. SEQ: queryseq and 11. QUAL: quality_scores */
   /* Not handling quality_string until we can store it in the Genome_T object */
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
   if (watsonp == true) {
     print_chopped(fp,genomicseg,genomiclength,hardclip_start,hardclip_end);
-    FPRINTF(fp,"\t*");
+    Filestring_put_string(fp,"\t*");
     /* print_quality(fp,quality_string,genomiclength,hardclip_start,hardclip_end,quality_shift); */
   } else {
     print_chopped_revcomp(fp,genomicseg,genomiclength,hardclip_start,hardclip_end);
-    FPRINTF(fp,"\t*");
+    Filestring_put_string(fp,"\t*");
     /* print_quality_revcomp(fp,quality_string,querylength,hardclip_start,hardclip_end,quality_shift); */
   }
 
   /* 12. TAGS: RG */
   if (sam_read_group_id != NULL) {
-    FPRINTF(fp,"\tRG:Z:%s",sam_read_group_id);
+    Filestring_put_string(fp,"\tRG:Z:");
+    Filestring_put_string(fp,sam_read_group_id);
   }
 
   /* 12. TAGS: XH and XI */
   if (hardclip_start > 0 || hardclip_end > 0) {
-    FPRINTF(fp,"\tXH:Z:");
+    Filestring_put_string(fp,"\tXH:Z:");
     if (watsonp == true) {
       print_chopped_end(fp,genomicseg,genomiclength,hardclip_start,hardclip_end);
     } else {
@@ -6116,7 +6379,7 @@ print_sam_line_flipped (Filestring_T fp, char *abbrev, char *acc1, char *acc2, c
 #if 0
     /* Not handling quality_string until we can store it in the Genome_T object */
     if (quality_string != NULL) {
-      FPRINTF(fp,"\tXI:Z:");
+      Filestring_put_string(fp,"\tXI:Z:");
       if (watsonp == true) {
 	print_chopped_end_quality(fp,genomicseg,genomiclength,hardclip_start,hardclip_end);
       } else {
@@ -6127,36 +6390,45 @@ print_sam_line_flipped (Filestring_T fp, char *abbrev, char *acc1, char *acc2, c
   }
 
   /* 12. TAGS: MD string */
-  FPRINTF(fp,"\tMD:Z:");
+  Filestring_put_string(fp,"\tMD:Z:");
   Pair_print_tokens(fp,md_tokens);
 
   /* 12. TAGS: NH */
-  FPRINTF(fp,"\tNH:i:%d",npaths_primary + npaths_altloc);
+  Filestring_put_string(fp,"\tNH:i:");
+  Filestring_put_int(fp,npaths_primary + npaths_altloc);
   
   /* 12. TAGS: HI */
-  FPRINTF(fp,"\tHI:i:%d",pathnum);
+  Filestring_put_string(fp,"\tHI:i:");
+  Filestring_put_int(fp,pathnum);
 
   /* 12. TAGS: NM */
-  FPRINTF(fp,"\tNM:i:%d",nmismatches_refdiff + nindels);
+  Filestring_put_string(fp,"\tNM:i:");
+  Filestring_put_int(fp,nmismatches_refdiff + nindels);
 
   if (snps_p) {
     /* 12. TAGS: XW and XV */
-    FPRINTF(fp,"\tXW:i:%d",nmismatches_bothdiff);
-    FPRINTF(fp,"\tXV:i:%d",nmismatches_refdiff - nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXW:i:");
+    Filestring_put_int(fp,nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXV:i:");
+    Filestring_put_int(fp,nmismatches_refdiff - nmismatches_bothdiff);
   }
 
 
   /* 12. TAGS: SM */
-  FPRINTF(fp,"\tSM:i:%d",40);
+  Filestring_put_string(fp,"\tSM:i:");
+  Filestring_put_int(fp,40);
 
   /* 12. TAGS: XQ */
-  FPRINTF(fp,"\tXQ:i:%d",absmq_score);
+  Filestring_put_string(fp,"\tXQ:i:");
+  Filestring_put_int(fp,absmq_score);
 
   /* 12. TAGS: X2 */
-  FPRINTF(fp,"\tX2:i:%d",second_absmq);
+  Filestring_put_string(fp,"\tX2:i:");
+  Filestring_put_int(fp,second_absmq);
 
   /* 12. TAGS: XO */
-  FPRINTF(fp,"\tXO:Z:%s",abbrev);
+  Filestring_put_string(fp,"\tXO:Z:");
+  Filestring_put_string(fp,abbrev);
 
   /* 12. TAGS: XS */
   if (novelsplicingp == false && knownsplicingp == false) {
@@ -6164,16 +6436,16 @@ print_sam_line_flipped (Filestring_T fp, char *abbrev, char *acc1, char *acc2, c
 
   } else if (sensedir == SENSE_FORWARD) {
     if (watsonp == true) {
-      FPRINTF(fp,"\tXS:A:+");
+      Filestring_put_string(fp,"\tXS:A:+");
     } else {
-      FPRINTF(fp,"\tXS:A:-");
+      Filestring_put_string(fp,"\tXS:A:-");
     }
 
   } else if (sensedir == SENSE_ANTI) {
     if (watsonp == true) {
-      FPRINTF(fp,"\tXS:A:-");
+      Filestring_put_string(fp,"\tXS:A:-");
     } else {
-      FPRINTF(fp,"\tXS:A:+");
+      Filestring_put_string(fp,"\tXS:A:+");
     }
 
   } else if (intronp == false) {
@@ -6184,21 +6456,21 @@ print_sam_line_flipped (Filestring_T fp, char *abbrev, char *acc1, char *acc2, c
     /* Don't print XS field for SENSE_NULL */
     /* Could not determine sense, so just report arbitrarily as + */
     /* This option provided for users of Cufflinks, which cannot handle XS:A:? */
-    FPRINTF(fp,"\tXS:A:+");
+    Filestring_put_string(fp,"\tXS:A:+");
     
   } else {
     /* Non-canonical.  Don't report. */
-    FPRINTF(fp,"\tXS:A:?");
+    Filestring_put_string(fp,"\tXS:A:?");
 #endif
   }
 
   /* 12. TAGS: XT */
   if (chimera != NULL) {
-    FPRINTF(fp,"\tXT:Z:");
+    Filestring_put_string(fp,"\tXT:Z:");
     Chimera_print_sam_tag(fp,chimera,chromosome_iit);
   }
 
-  FPRINTF(fp,"\n");
+  PUTC('\n',fp);
 
   return;
 }
@@ -0,0 +1,610 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "pass1info.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
+#include "mem.h"
+#include "intlist.h"
+#include "path-learn.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+
+/* The indel table is a chained hash table that does not resize
+   itself, so it starts small and is rebuilt with more buckets each
+   time the number of positions passes indel_table_limit.  Most
+   per-thread tables, and all of those used by --live-splicing, stay
+   small.  Beyond MAX_INDEL_TABLE_LIMIT, the table has as many buckets
+   as Univcoordtable_new gives. */
+#define INITIAL_INDEL_TABLE_LIMIT 1024
+#define MAX_INDEL_TABLE_LIMIT 65536
+
+
+#define T Pass1info_T
+struct T {
+  unsigned long long total_mismatches;
+  unsigned long long total_querylength;
+
+  Univcoordlist_T donor_startpoints;
+  Univcoordlist_T donor_partners;
+  Univcoordlist_T acceptor_startpoints;
+  Univcoordlist_T acceptor_partners;
+  Univcoordlist_T antidonor_startpoints;
+  Univcoordlist_T antidonor_partners;
+  Univcoordlist_T antiacceptor_startpoints;
+  Univcoordlist_T antiacceptor_partners;
+
+  Univcoordtable_T indel_table;	/* Univcoord_T => Intlist_T of adjs */
+  int indel_table_limit;
+  Uintlist_T insertlengths;
+
+  /* For stopping a sampled pass 1 early.  Only allocated by
+     Pass1info_track_novelty */
+  Univcoordtable_T intron_table; /* Donor => Univcoordlist_T of acceptors */
+  unsigned int window_nreads;
+  unsigned int window_nnovel;
+};
+
+
+T
+Pass1info_new () {
+  T new = (T) MALLOC(sizeof(*new));
+
+  new->total_mismatches = 0;
+  new->total_querylength = 0;
+
+  new->donor_startpoints = (Univcoordlist_T) NULL;
+  new->donor_partners = (Univcoordlist_T) NULL;
+  new->acceptor_startpoints = (Univcoordlist_T) NULL;
+  new->acceptor_partners = (Univcoordlist_T) NULL;
+  new->antidonor_startpoints = (Univcoordlist_T) NULL;
+  new->antidonor_partners = (Univcoordlist_T) NULL;
+  new->antiacceptor_startpoints = (Univcoordlist_T) NULL;
+  new->antiacceptor_partners = (Univcoordlist_T) NULL;
+
+  new->indel_table = Univcoordtable_new(/*hint*/INITIAL_INDEL_TABLE_LIMIT);
+  new->indel_table_limit = INITIAL_INDEL_TABLE_LIMIT;
+  new->insertlengths = (Uintlist_T) NULL;
+
+  new->intron_table = (Univcoordtable_T) NULL;
+  new->window_nreads = 0;
+  new->window_nnovel = 0;
+
+  return new;
+}
+
+
+static void
+free_indel_table (Univcoordtable_T *indel_table) {
+  Univcoord_T *keys;
+  Intlist_T indel_adjs;
+  int n, i;
+
+  if ((n = Univcoordtable_length(*indel_table)) > 0) {
+    keys = Univcoordtable_keys(*indel_table,/*sortp*/false);
+    for (i = 0; i < n; i++) {
+      indel_adjs = (Intlist_T) Univcoordtable_get(*indel_table,keys[i]);
+      Intlist_free(&indel_adjs);
+    }
+    FREE(keys);
+  }
+  Univcoordtable_free(&(*indel_table));
+  return;
+}
+
+static void
+free_intron_table (Univcoordtable_T *intron_table) {
+  Univcoord_T *keys;
+  Univcoordlist_T partners;
+  int n, i;
+
+  if ((n = Univcoordtable_length(*intron_table)) > 0) {
+    keys = Univcoordtable_keys(*intron_table,/*sortp*/false);
+    for (i = 0; i < n; i++) {
+      partners = (Univcoordlist_T) Univcoordtable_get(*intron_table,keys[i]);
+      Univcoordlist_free(&partners);
+    }
+    FREE(keys);
+  }
+  Univcoordtable_free(&(*intron_table));
+  return;
+}
+
+
+void
+Pass1info_free (T *old) {
+  if (*old) {
+    Univcoordlist_free(&(*old)->donor_startpoints);
+    Univcoordlist_free(&(*old)->donor_partners);
+    Univcoordlist_free(&(*old)->acceptor_startpoints);
+    Univcoordlist_free(&(*old)->acceptor_partners);
+    Univcoordlist_free(&(*old)->antidonor_startpoints);
+    Univcoordlist_free(&(*old)->antidonor_partners);
+    Univcoordlist_free(&(*old)->antiacceptor_startpoints);
+    Univcoordlist_free(&(*old)->antiacceptor_partners);
+
+    if ((*old)->indel_table != NULL) {
+      free_indel_table(&(*old)->indel_table);
+    }
+    Uintlist_free(&(*old)->insertlengths);
+
+    if ((*old)->intron_table != NULL) {
+      free_intron_table(&(*old)->intron_table);
+    }
+
+    FREE(*old);
+  }
+  return;
+}
+
+
+/* Rebuilds the indel table, if needed, so it has enough buckets for
+   npositions.  The values are moved to the new table. */
+static void
+reserve_indels (T this, int npositions) {
+  Univcoordtable_T new_table;
+  Univcoord_T *keys;
+  int limit = this->indel_table_limit, n, i;
+
+  if (npositions <= limit || limit >= MAX_INDEL_TABLE_LIMIT) {
+    return;
+  } else {
+    while (limit < npositions && limit < MAX_INDEL_TABLE_LIMIT) {
+      limit *= 4;
+    }
+    debug(fprintf(stderr,"Growing indel table from limit %d to %d for %d positions\n",
+		  this->indel_table_limit,limit,npositions));
+
+    new_table = Univcoordtable_new(/*hint*/limit);
+    if ((n = Univcoordtable_length(this->indel_table)) > 0) {
+      keys = Univcoordtable_keys(this->indel_table,/*sortp*/false);
+      for (i = 0; i < n; i++) {
+	Univcoordtable_put(new_table,keys[i],Univcoordtable_get(this->indel_table,keys[i]));
+      }
+      FREE(keys);
+    }
+    Univcoordtable_free(&this->indel_table);
+    this->indel_table = new_table;
+    this->indel_table_limit = limit;
+    return;
+  }
+}
+
+
+unsigned long long
+Pass1info_total_mismatches (T this) {
+  return this->total_mismatches;
+}
+
+unsigned long long
+Pass1info_total_querylength (T this) {
+  return this->total_querylength;
+}
+
+/* The lists still belong to this */
+void
+Pass1info_introns (Univcoordlist_T *donor_startpoints, Univcoordlist_T *donor_partners,
+		   Univcoordlist_T *acceptor_startpoints, Univcoordlist_T *acceptor_partners,
+		   Univcoordlist_T *antidonor_startpoints, Univcoordlist_T *antidonor_partners,
+		   Univcoordlist_T *antiacceptor_startpoints, Univcoordlist_T *antiacceptor_partners,
+		   T this) {
+  *donor_startpoints = this->donor_startpoints;
+  *donor_partners = this->donor_partners;
+  *acceptor_startpoints = this->acceptor_startpoints;
+  *acceptor_partners = this->acceptor_partners;
+  *antidonor_startpoints = this->antidonor_startpoints;
+  *antidonor_partners = this->antidonor_partners;
+  *antiacceptor_startpoints = this->antiacceptor_startpoints;
+  *antiacceptor_partners = this->antiacceptor_partners;
+  return;
+}
+
+/* The lists now belong to the caller */
+void
+Pass1info_transfer_introns (Univcoordlist_T *donor_startpoints, Univcoordlist_T *donor_partners,
+			    Univcoordlist_T *acceptor_startpoints, Univcoordlist_T *acceptor_partners,
+			    Univcoordlist_T *antidonor_startpoints, Univcoordlist_T *antidonor_partners,
+			    Univcoordlist_T *antiacceptor_startpoints, Univcoordlist_T *antiacceptor_partners,
+			    T this) {
+  Pass1info_introns(&(*donor_startpoints),&(*donor_partners),
+		    &(*acceptor_startpoints),&(*acceptor_partners),
+		    &(*antidonor_startpoints),&(*antidonor_partners),
+		    &(*antiacceptor_startpoints),&(*antiacceptor_partners),this);
+  this->donor_startpoints = this->donor_partners = (Univcoordlist_T) NULL;
+  this->acceptor_startpoints = this->acceptor_partners = (Univcoordlist_T) NULL;
+  this->antidonor_startpoints = this->antidonor_partners = (Univcoordlist_T) NULL;
+  this->antiacceptor_startpoints = this->antiacceptor_partners = (Univcoordlist_T) NULL;
+  return;
+}
+
+/* The table and its values now belong to the caller */
+Univcoordtable_T
+Pass1info_transfer_indel_table (T this) {
+  Univcoordtable_T indel_table = this->indel_table;
+
+  this->indel_table = (Univcoordtable_T) NULL;
+  return indel_table;
+}
+
+Uintlist_T
+Pass1info_insertlengths (T this) {
+  return this->insertlengths;
+}
+
+
+/* Keeps a set of the distinct introns seen by this thread, so
+   Pass1info_saturatedp can tell when few new ones are being found */
+void
+Pass1info_track_novelty (T this) {
+  this->intron_table = Univcoordtable_new(/*hint*/100000);
+  return;
+}
+
+/* Adds the introns pushed onto startpoints and partners since
+   old_startpoints to intron_table, and returns how many were new */
+static unsigned int
+add_novel_introns (Univcoordtable_T intron_table, Univcoordlist_T startpoints, Univcoordlist_T partners,
+		   Univcoordlist_T old_startpoints) {
+  unsigned int nnovel = 0;
+  Univcoordlist_T p, q, seen;
+
+  for (p = startpoints, q = partners; p != old_startpoints; p = Univcoordlist_next(p), q = Univcoordlist_next(q)) {
+    seen = (Univcoordlist_T) Univcoordtable_get(intron_table,Univcoordlist_head(p));
+    if (Univcoordlist_find(seen,Univcoordlist_head(q)) == false) {
+      Univcoordtable_put(intron_table,Univcoordlist_head(p),
+			 (void *) Univcoordlist_push(seen,Univcoordlist_head(q)));
+      nnovel++;
+    }
+  }
+
+  return nnovel;
+}
+
+
+/* Called by a worker thread on its own Pass1info_T, so no lock is needed */
+void
+Pass1info_learn_path (T this, Path_T path) {
+  Univcoordlist_T old_donor_startpoints = this->donor_startpoints;
+  Univcoordlist_T old_antidonor_startpoints = this->antidonor_startpoints;
+
+  Path_learn_defect_rate(path,&this->total_mismatches,&this->total_querylength);
+  /* Path_learn_splicesites(path,donor_table,acceptor_table,antidonor_table,antiacceptor_table); */
+  Path_learn_introns(path,&this->donor_startpoints,&this->donor_partners,
+		     &this->acceptor_startpoints,&this->acceptor_partners,
+		     &this->antidonor_startpoints,&this->antidonor_partners,
+		     &this->antiacceptor_startpoints,&this->antiacceptor_partners);
+  Path_learn_indels(path,this->indel_table);
+  reserve_indels(this,Univcoordtable_length(this->indel_table));
+
+  if (this->intron_table != NULL) {
+    /* Each intron is pushed onto both the donor and acceptor lists, so
+       checking the donor lists is enough */
+    this->window_nnovel +=
+      add_novel_introns(this->intron_table,this->donor_startpoints,this->donor_partners,
+			old_donor_startpoints);
+    this->window_nnovel +=
+      add_novel_introns(this->intron_table,this->antidonor_startpoints,this->antidonor_partners,
+			old_antidonor_startpoints);
+  }
+
+  return;
+}
+
+/* Used by --live-splicing, which needs only the introns */
+void
+Pass1info_learn_introns (T this, Path_T path) {
+  Path_learn_introns(path,&this->donor_startpoints,&this->donor_partners,
+		     &this->acceptor_startpoints,&this->acceptor_partners,
+		     &this->antidonor_startpoints,&this->antidonor_partners,
+		     &this->antiacceptor_startpoints,&this->antiacceptor_partners);
+  return;
+}
+
+void
+Pass1info_learn_pathpair (T this, Pathpair_T pathpair) {
+  Pathpair_learn_insertlengths(pathpair,&this->insertlengths);
+  return;
+}
+
+
+/* Called once per request.  At the end of every window of requests,
+   returns true if that window found fewer than min_novel_rate new
+   introns per 1000 requests.  Since the set of introns is per thread,
+   novelty is overestimated when there are several threads, which
+   errs towards running longer. */
+bool
+Pass1info_saturatedp (T this, unsigned int window, double min_novel_rate) {
+  bool saturatedp;
+
+  if (++this->window_nreads < window) {
+    return false;
+  } else {
+    saturatedp = (1000.0*(double) this->window_nnovel/(double) this->window_nreads < min_novel_rate);
+    debug(fprintf(stderr,"Pass1info_saturatedp: %u new introns in %u reads => %d\n",
+		  this->window_nnovel,this->window_nreads,saturatedp));
+    this->window_nreads = 0;
+    this->window_nnovel = 0;
+    return saturatedp;
+  }
+}
+
+
+typedef struct Intron_T *Intron_T;
+struct Intron_T {
+  Univcoord_T startpoint;
+  Univcoord_T partner;
+};
+
+static int
+intron_cmp (const void *x, const void *y) {
+  Intron_T a = (Intron_T) x;
+  Intron_T b = (Intron_T) y;
+
+  if (a->startpoint < b->startpoint) {
+    return -1;
+  } else if (a->startpoint > b->startpoint) {
+    return +1;
+  } else if (a->partner < b->partner) {
+    return -1;
+  } else if (a->partner > b->partner) {
+    return +1;
+  } else {
+    return 0;
+  }
+}
+
+static int
+fill_introns (struct Intron_T *introns, int k, Univcoordlist_T startpoints, Univcoordlist_T partners) {
+  Univcoordlist_T p, q;
+
+  for (p = startpoints, q = partners; p != NULL; p = Univcoordlist_next(p), q = Univcoordlist_next(q)) {
+    introns[k].startpoint = Univcoordlist_head(p);
+    introns[k].partner = Univcoordlist_head(q);
+    k++;
+  }
+  return k;
+}
+
+/* Returns the number of distinct introns, before any filtering by
+   Knownsplicing_new, and how many of them were seen once and twice.
+   Plus and minus strand introns are counted separately. */
+int
+Pass1info_count_introns (int *nsingletons, int *ndoubletons, T this) {
+  int ndistinct = 0, n, nplus, i, j;
+  struct Intron_T *introns;
+
+  *nsingletons = *ndoubletons = 0;
+  nplus = Univcoordlist_length(this->donor_startpoints);
+  if ((n = nplus + Univcoordlist_length(this->antidonor_startpoints)) == 0) {
+    return 0;
+  }
+
+  introns = (struct Intron_T *) MALLOC(n*sizeof(struct Intron_T));
+  fill_introns(introns,/*k*/0,this->donor_startpoints,this->donor_partners);
+  fill_introns(introns,/*k*/nplus,this->antidonor_startpoints,this->antidonor_partners);
+
+  /* Sort each strand separately, so they are not combined */
+  qsort(introns,nplus,sizeof(struct Intron_T),intron_cmp);
+  qsort(&(introns[nplus]),n - nplus,sizeof(struct Intron_T),intron_cmp);
+
+  i = 0;
+  while (i < n) {
+    j = i + 1;
+    while (j < n && j != nplus && intron_cmp(&(introns[j]),&(introns[i])) == 0) {
+      j++;
+    }
+    ndistinct++;
+    if (j - i == 1) {
+      (*nsingletons)++;
+    } else if (j - i == 2) {
+      (*ndoubletons)++;
+    }
+    i = j;
+  }
+
+  FREE(introns);
+  return ndistinct;
+}
+
+
+/************************************************************************
+ *   Merging.  Each category of evidence is independent of the
+ *   others, so each can be combined by its own thread.  Lists are
+ *   concatenated by walking only the list being prepended, so each
+ *   merge is linear in the total evidence.
+ ************************************************************************/
+
+typedef enum {MERGE_DONOR, MERGE_ACCEPTOR, MERGE_ANTIDONOR, MERGE_ANTIACCEPTOR,
+	      MERGE_INDELS, MERGE_INSERTLENGTHS} Mergetype_T;
+#define NMERGETYPES 6
+
+typedef struct Merge_T *Merge_T;
+struct Merge_T {
+  Mergetype_T mergetype;
+  T dest;
+  T *pass1infos;
+  int n;
+};
+
+
+static void
+merge_pairs (Univcoordlist_T *dest_startpoints, Univcoordlist_T *dest_partners,
+	     Univcoordlist_T *source_startpoints, Univcoordlist_T *source_partners) {
+  *dest_startpoints = Univcoordlist_append(*source_startpoints,*dest_startpoints);
+  *dest_partners = Univcoordlist_append(*source_partners,*dest_partners);
+  *source_startpoints = (Univcoordlist_T) NULL;
+  *source_partners = (Univcoordlist_T) NULL;
+  return;
+}
+
+static void
+merge_indels (Univcoordtable_T dest, Univcoordtable_T *source) {
+  Univcoord_T *keys;
+  Intlist_T source_adjs, dest_adjs;
+  int n, i;
+
+  if ((n = Univcoordtable_length(*source)) > 0) {
+    keys = Univcoordtable_keys(*source,/*sortp*/false);
+    for (i = 0; i < n; i++) {
+      source_adjs = (Intlist_T) Univcoordtable_get(*source,keys[i]);
+      dest_adjs = (Intlist_T) Univcoordtable_get(dest,keys[i]);
+      Univcoordtable_put(dest,keys[i],(void *) Intlist_append(source_adjs,dest_adjs));
+    }
+    FREE(keys);
+  }
+  Univcoordtable_free(&(*source));	/* Values have been moved to dest */
+  return;
+}
+
+
+static void *
+merge_thread (void *data) {
+  Merge_T merge = (Merge_T) data;
+  T dest = merge->dest, source;
+  int k;
+
+  for (k = 0; k < merge->n; k++) {
+    source = merge->pass1infos[k];
+
+    switch (merge->mergetype) {
+    case MERGE_DONOR:
+      merge_pairs(&dest->donor_startpoints,&dest->donor_partners,
+		  &source->donor_startpoints,&source->donor_partners);
+      break;
+    case MERGE_ACCEPTOR:
+      merge_pairs(&dest->acceptor_startpoints,&dest->acceptor_partners,
+		  &source->acceptor_startpoints,&source->acceptor_partners);
+      break;
+    case MERGE_ANTIDONOR:
+      merge_pairs(&dest->antidonor_startpoints,&dest->antidonor_partners,
+		  &source->antidonor_startpoints,&source->antidonor_partners);
+      break;
+    case MERGE_ANTIACCEPTOR:
+      merge_pairs(&dest->antiacceptor_startpoints,&dest->antiacceptor_partners,
+		  &source->antiacceptor_startpoints,&source->antiacceptor_partners);
+      break;
+    case MERGE_INDELS:
+      merge_indels(dest->indel_table,&source->indel_table);
+      break;
+    case MERGE_INSERTLENGTHS:
+      dest->insertlengths = Uintlist_append(source->insertlengths,dest->insertlengths);
+      source->insertlengths = (Uintlist_T) NULL;
+      dest->total_mismatches += source->total_mismatches;
+      dest->total_querylength += source->total_querylength;
+      break;
+    }
+  }
+
+  return (void *) NULL;
+}
+
+
+/* Combines the per-thread information into a new Pass1info_T, and
+   frees the inputs.  Entries in pass1infos may be NULL, for threads
+   that were never started. */
+T
+Pass1info_merge (T *pass1infos, int n, int nthreads) {
+  T new = Pass1info_new();
+  struct Merge_T merges[NMERGETYPES];
+  T *sources;
+  int nsources = 0, npositions = 0, k;
+  Mergetype_T mergetype;
+#ifdef HAVE_PTHREAD
+  pthread_t merge_thread_ids[NMERGETYPES];
+  pthread_attr_t thread_attr_join;
+#endif
+
+  sources = (T *) MALLOC(n*sizeof(T));
+  for (k = 0; k < n; k++) {
+    if (pass1infos[k] != NULL) {
+      sources[nsources++] = pass1infos[k];
+    }
+  }
+
+  /* Positions shared by several sources are counted more than once,
+     which errs towards a larger table */
+  for (k = 0; k < nsources; k++) {
+    npositions += Univcoordtable_length(sources[k]->indel_table);
+  }
+  reserve_indels(new,npositions);
+
+  for (mergetype = 0; mergetype < NMERGETYPES; mergetype++) {
+    merges[mergetype].mergetype = mergetype;
+    merges[mergetype].dest = new;
+    merges[mergetype].pass1infos = sources;
+    merges[mergetype].n = nsources;
+  }
+
+#ifdef HAVE_PTHREAD
+  if (nthreads > 1 && nsources > 1) {
+    pthread_attr_init(&thread_attr_join);
+    pthread_attr_setdetachstate(&thread_attr_join,PTHREAD_CREATE_JOINABLE);
+    for (mergetype = 0; mergetype < NMERGETYPES; mergetype++) {
+      pthread_create(&(merge_thread_ids[mergetype]),&thread_attr_join,merge_thread,(void *) &(merges[mergetype]));
+    }
+    for (mergetype = 0; mergetype < NMERGETYPES; mergetype++) {
+      pthread_join(merge_thread_ids[mergetype],NULL);
+    }
+    pthread_attr_destroy(&thread_attr_join);
+
+  } else {
+    for (mergetype = 0; mergetype < NMERGETYPES; mergetype++) {
+      merge_thread((void *) &(merges[mergetype]));
+    }
+  }
+#else
+  for (mergetype = 0; mergetype < NMERGETYPES; mergetype++) {
+    merge_thread((void *) &(merges[mergetype]));
+  }
+#endif
+
+  for (k = 0; k < nsources; k++) {
+    Pass1info_free(&(sources[k]));
+  }
+  FREE(sources);
+  for (k = 0; k < n; k++) {
+    pass1infos[k] = (T) NULL;
+  }
+
+  return new;
+}
+
+
+/* For --pass1-dump */
+void
+Pass1info_dump (T this, FILE *fp) {
+  Path_learn_dump(fp,this->total_mismatches,this->total_querylength,
+		  this->donor_startpoints,this->donor_partners,
+		  this->antidonor_startpoints,this->antidonor_partners,
+		  this->indel_table,this->insertlengths);
+  return;
+}
+
+/* For --pass1-read.  Adds the evidence in fp to this */
+void
+Pass1info_read (T this, FILE *fp, char *filename) {
+  Path_learn_read(fp,filename,&this->total_mismatches,&this->total_querylength,
+		  &this->donor_startpoints,&this->donor_partners,
+		  &this->acceptor_startpoints,&this->acceptor_partners,
+		  &this->antidonor_startpoints,&this->antidonor_partners,
+		  &this->antiacceptor_startpoints,&this->antiacceptor_partners,
+		  this->indel_table,&this->insertlengths);
+  reserve_indels(this,Univcoordtable_length(this->indel_table));
+  return;
+}
+
@@ -0,0 +1,81 @@
+/* $Id$ */
+#ifndef PASS1INFO_INCLUDED
+#define PASS1INFO_INCLUDED
+
+#include <stdio.h>
+#include "bool.h"
+#include "path.h"
+#include "pathpair.h"
+#include "univcoord.h"
+#include "uintlist.h"
+
+
+/* Information learned during pass 1 of two-pass mode.  Each worker
+   thread accumulates into its own Pass1info_T without locking, and
+   the results are combined by Pass1info_merge at the end of pass 1 */
+
+#define T Pass1info_T
+typedef struct T *T;
+
+extern T
+Pass1info_new ();
+
+extern void
+Pass1info_free (T *old);
+
+extern unsigned long long
+Pass1info_total_mismatches (T this);
+
+extern unsigned long long
+Pass1info_total_querylength (T this);
+
+extern void
+Pass1info_introns (Univcoordlist_T *donor_startpoints, Univcoordlist_T *donor_partners,
+		   Univcoordlist_T *acceptor_startpoints, Univcoordlist_T *acceptor_partners,
+		   Univcoordlist_T *antidonor_startpoints, Univcoordlist_T *antidonor_partners,
+		   Univcoordlist_T *antiacceptor_startpoints, Univcoordlist_T *antiacceptor_partners,
+		   T this);
+
+extern void
+Pass1info_transfer_introns (Univcoordlist_T *donor_startpoints, Univcoordlist_T *donor_partners,
+			    Univcoordlist_T *acceptor_startpoints, Univcoordlist_T *acceptor_partners,
+			    Univcoordlist_T *antidonor_startpoints, Univcoordlist_T *antidonor_partners,
+			    Univcoordlist_T *antiacceptor_startpoints, Univcoordlist_T *antiacceptor_partners,
+			    T this);
+
+extern Univcoordtable_T
+Pass1info_transfer_indel_table (T this);
+
+extern Uintlist_T
+Pass1info_insertlengths (T this);
+
+extern void
+Pass1info_track_novelty (T this);
+
+extern void
+Pass1info_learn_path (T this, Path_T path);
+
+extern void
+Pass1info_learn_introns (T this, Path_T path);
+
+extern void
+Pass1info_learn_pathpair (T this, Pathpair_T pathpair);
+
+extern bool
+Pass1info_saturatedp (T this, unsigned int window, double min_novel_rate);
+
+extern int
+Pass1info_count_introns (int *nsingletons, int *ndoubletons, T this);
+
+extern T
+Pass1info_merge (T *pass1infos, int n, int nthreads);
+
+extern void
+Pass1info_dump (T this, FILE *fp);
+
+extern void
+Pass1info_read (T this, FILE *fp, char *filename);
+
+#undef T
+#endif
+
@@ -5,7 +5,11 @@ static char rcsid[] = "$Id: stage3hr.c 225533 2022-12-21 00:40:38Z twu $";
 
 #include "path-learn.h"
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <math.h>
+#include "mem.h"
 #include "junction.h"
 #include "orderstat.h"
 
@@ -254,3 +258,148 @@ Pathpair_analyze_insertlengths (int *expected_pairlength, int *pairlength_deviat
 
   return;
 }
+
+
+/* Pass 1 evidence files, written by --pass1-dump and read by
+   --pass1-read.  The evidence is written before any count-based
+   filtering, one observation per line, so that the files from
+   several --part runs can simply be summed:
+
+     M <mismatches> <querylength>
+     + <donor> <acceptor>
+     - <antidonor> <antiacceptor>
+     X <indel_position> <adj>
+     L <insertlength>
+
+   Acceptor lists are not written, since they are the mirror images of
+   the donor lists */
+
+#define PASS1_DUMP_HEADER "# GSNAP pass 1 evidence"
+
+void
+Path_learn_dump (FILE *fp, unsigned long long total_mismatches, unsigned long long total_querylength,
+		 Univcoordlist_T donor_startpoints, Univcoordlist_T donor_partners,
+		 Univcoordlist_T antidonor_startpoints, Univcoordlist_T antidonor_partners,
+		 Univcoordtable_T indel_table, Uintlist_T insertlengths) {
+  Univcoordlist_T p, q;
+  Univcoord_T *keys;
+  Intlist_T a;
+  Uintlist_T r;
+  int n, i;
+
+  fprintf(fp,"%s\n",PASS1_DUMP_HEADER);
+  fprintf(fp,"M %llu %llu\n",total_mismatches,total_querylength);
+
+  for (p = donor_startpoints, q = donor_partners; p != NULL; p = Univcoordlist_next(p), q = Univcoordlist_next(q)) {
+    fprintf(fp,"+ %llu %llu\n",
+	    (unsigned long long) Univcoordlist_head(p),(unsigned long long) Univcoordlist_head(q));
+  }
+  for (p = antidonor_startpoints, q = antidonor_partners; p != NULL; p = Univcoordlist_next(p), q = Univcoordlist_next(q)) {
+    fprintf(fp,"- %llu %llu\n",
+	    (unsigned long long) Univcoordlist_head(p),(unsigned long long) Univcoordlist_head(q));
+  }
+
+  if ((n = Univcoordtable_length(indel_table)) > 0) {
+    keys = Univcoordtable_keys(indel_table,/*sortp*/false);
+    for (i = 0; i < n; i++) {
+      for (a = (Intlist_T) Univcoordtable_get(indel_table,keys[i]); a != NULL; a = Intlist_next(a)) {
+	fprintf(fp,"X %llu %d\n",(unsigned long long) keys[i],Intlist_head(a));
+      }
+    }
+    FREE(keys);
+  }
+
+  for (r = insertlengths; r != NULL; r = Uintlist_next(r)) {
+    fprintf(fp,"L %u\n",Uintlist_head(r));
+  }
+
+  return;
+}
+
+
+/* Adds the evidence in fp to the existing totals, lists, and table */
+void
+Path_learn_read (FILE *fp, char *filename,
+		 unsigned long long *total_mismatches, unsigned long long *total_querylength,
+		 Univcoordlist_T *donor_startpoints, Univcoordlist_T *donor_partners,
+		 Univcoordlist_T *acceptor_startpoints, Univcoordlist_T *acceptor_partners,
+		 Univcoordlist_T *antidonor_startpoints, Univcoordlist_T *antidonor_partners,
+		 Univcoordlist_T *antiacceptor_startpoints, Univcoordlist_T *antiacceptor_partners,
+		 Univcoordtable_T indel_table, Uintlist_T *insertlengths) {
+  char line[1024];
+  unsigned long long value1, value2;
+  Univcoord_T donor, acceptor, indel_position;
+  Intlist_T indel_adjs;
+  unsigned int insertlength;
+  int adj, lineno = 0;
+
+  if (fgets(line,1024,fp) == NULL || strncmp(line,PASS1_DUMP_HEADER,strlen(PASS1_DUMP_HEADER))) {
+    fprintf(stderr,"File %s does not appear to be a GSNAP pass 1 evidence file\n",filename);
+    exit(9);
+  }
+  lineno++;
+
+  while (fgets(line,1024,fp) != NULL) {
+    lineno++;
+    switch (line[0]) {
+    case 'M':
+      if (sscanf(&(line[1]),"%llu %llu",&value1,&value2) != 2) {
+	fprintf(stderr,"Cannot parse line %d of %s: %s",lineno,filename,line);
+	exit(9);
+      }
+      *total_mismatches += value1;
+      *total_querylength += value2;
+      break;
+
+    case '+':
+    case '-':
+      if (sscanf(&(line[1]),"%llu %llu",&value1,&value2) != 2) {
+	fprintf(stderr,"Cannot parse line %d of %s: %s",lineno,filename,line);
+	exit(9);
+      }
+      donor = (Univcoord_T) value1;
+      acceptor = (Univcoord_T) value2;
+      if (line[0] == '+') {
+	*donor_startpoints = Univcoordlist_push(*donor_startpoints,donor);
+	*donor_partners = Univcoordlist_push(*donor_partners,acceptor);
+	*acceptor_startpoints = Univcoordlist_push(*acceptor_startpoints,acceptor);
+	*acceptor_partners = Univcoordlist_push(*acceptor_partners,donor);
+      } else {
+	*antidonor_startpoints = Univcoordlist_push(*antidonor_startpoints,donor);
+	*antidonor_partners = Univcoordlist_push(*antidonor_partners,acceptor);
+	*antiacceptor_startpoints = Univcoordlist_push(*antiacceptor_startpoints,acceptor);
+	*antiacceptor_partners = Univcoordlist_push(*antiacceptor_partners,donor);
+      }
+      break;
+
+    case 'X':
+      if (sscanf(&(line[1]),"%llu %d",&value1,&adj) != 2) {
+	fprintf(stderr,"Cannot parse line %d of %s: %s",lineno,filename,line);
+	exit(9);
+      }
+      indel_position = (Univcoord_T) value1;
+      indel_adjs = (Intlist_T) Univcoordtable_get(indel_table,indel_position);
+      indel_adjs = Intlist_push(indel_adjs,adj);
+      Univcoordtable_put(indel_table,indel_position,indel_adjs);
+      break;
+
+    case 'L':
+      if (sscanf(&(line[1]),"%u",&insertlength) != 1) {
+	fprintf(stderr,"Cannot parse line %d of %s: %s",lineno,filename,line);
+	exit(9);
+      }
+      *insertlengths = Uintlist_push(*insertlengths,insertlength);
+      break;
+
+    case '#':
+    case '\n':
+      break;
+
+    default:
+      fprintf(stderr,"Cannot parse line %d of %s: %s",lineno,filename,line);
+      exit(9);
+    }
+  }
+
+  return;
+}
@@ -3,6 +3,7 @@
 #define PATH_LEARN_INCLUDED
 
 
+#include <stdio.h>
 #include "path.h"
 #include "pathpair.h"
 #include "univcoord.h"
@@ -29,6 +30,21 @@ extern void
 Pathpair_analyze_insertlengths (int *expected_pairlength, int *pairlength_deviation,
 				Uintlist_T insertlengths);
 
+extern void
+Path_learn_dump (FILE *fp, unsigned long long total_mismatches, unsigned long long total_querylength,
+		 Univcoordlist_T donor_startpoints, Univcoordlist_T donor_partners,
+		 Univcoordlist_T antidonor_startpoints, Univcoordlist_T antidonor_partners,
+		 Univcoordtable_T indel_table, Uintlist_T insertlengths);
+
+extern void
+Path_learn_read (FILE *fp, char *filename,
+		 unsigned long long *total_mismatches, unsigned long long *total_querylength,
+		 Univcoordlist_T *donor_startpoints, Univcoordlist_T *donor_partners,
+		 Univcoordlist_T *acceptor_startpoints, Univcoordlist_T *acceptor_partners,
+		 Univcoordlist_T *antidonor_startpoints, Univcoordlist_T *antidonor_partners,
+		 Univcoordlist_T *antiacceptor_startpoints, Univcoordlist_T *antiacceptor_partners,
+		 Univcoordtable_T indel_table, Uintlist_T *insertlengths);
+
 #endif
 
 
@@ -73,7 +73,7 @@ print_lc (Filestring_T fp, char *string, int n) {
   int i;
   
   for (i = 0; i < n; i++) {
-    FPRINTF(fp,"%c",(char) tolower(string[i]));
+    PUTC((char) tolower(string[i]),fp);
   }
   return;
 }
@@ -90,7 +90,7 @@ print_revcomp_lc (Filestring_T fp, char *nt, int len) {
   int i;
 
   for (i = len-1; i >= 0; --i) {
-    FPRINTF(fp,"%c",(char) tolower(complCode[(int) nt[i]]));
+    PUTC((char) tolower(complCode[(int) nt[i]]),fp);
   }
   return;
 }
@@ -308,8 +308,10 @@ print_genomic (Filestring_T fp, char *genomic_diff, int querystart, int queryend
     Shortread_print_left_chop_symbols(fp,queryseq);
   }
 
-  FPRINTF(fp,"\t");
-  FPRINTF(fp,"%d..%d",1 + querystart_choplength + querystart,querystart_choplength + queryend);
+  PUTC('\t',fp);
+  Filestring_put_int(fp,1 + querystart_choplength + querystart);
+  Filestring_put_string(fp,"..");
+  Filestring_put_int(fp,querystart_choplength + queryend);
   FREE_OUT(fragment);
 
   return;
@@ -325,21 +327,33 @@ print_coordinates (Filestring_T fp, Univcoord_T univdiagonal, int querystart, in
     qstart = querystart;
     qend = queryend;
     if (print_univdiagonal_p == true) {
-      FPRINTF(fp,"+%u..%u",univdiagonal - querylength + qstart + 1,
-	      univdiagonal - querylength + qend);
+      PUTC('+',fp);
+      Filestring_put_uint(fp,univdiagonal - querylength + qstart + 1);
+      Filestring_put_string(fp,"..");
+      Filestring_put_uint(fp,univdiagonal - querylength + qend);
     } else {
-      FPRINTF(fp,"+%s:%u..%u",chr,univdiagonal - querylength + qstart - chroffset + 1,
-	      univdiagonal - querylength + qend - chroffset);
+      PUTC('+',fp);
+      Filestring_put_string(fp,chr);
+      PUTC(':',fp);
+      Filestring_put_uint(fp,univdiagonal - querylength + qstart - chroffset + 1);
+      Filestring_put_string(fp,"..");
+      Filestring_put_uint(fp,univdiagonal - querylength + qend - chroffset);
     }
   } else {
     qstart = querylength - queryend;
     qend = querylength - querystart;
     if (print_univdiagonal_p == true) {
-      FPRINTF(fp,"-%u..%u",univdiagonal - querylength + qend,
-	      univdiagonal - querylength + qstart + 1);
+      PUTC('-',fp);
+      Filestring_put_uint(fp,univdiagonal - querylength + qend);
+      Filestring_put_string(fp,"..");
+      Filestring_put_uint(fp,univdiagonal - querylength + qstart + 1);
     } else {
-      FPRINTF(fp,"-%s:%u..%u",chr,univdiagonal - querylength + qend - chroffset,
-	      univdiagonal - querylength + qstart - chroffset + 1);
+      PUTC('-',fp);
+      Filestring_put_string(fp,chr);
+      PUTC(':',fp);
+      Filestring_put_uint(fp,univdiagonal - querylength + qend - chroffset);
+      Filestring_put_string(fp,"..");
+      Filestring_put_uint(fp,univdiagonal - querylength + qstart - chroffset + 1);
     }
   }
 
@@ -481,15 +495,20 @@ print_substring (Filestring_T fp, Substring_T substring, Path_T path, Shortread_
 		extraleft,extraright,substring->plusp,path->plusp,queryseq,invertp);
 
   FREE(deletion_string);
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
   print_coordinates(fp,substring->univdiagonal,substring->querystart,substring->queryend,
 		    path->querylength,chr,substring->chroffset,substring->plusp,invertp);
 
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
 
 #ifdef DEBUG1
-  FPRINTF(fp,"segment_plusp:%d,main_plusp:%d,invertp:%d",substring->plusp,path->plusp,invertp);
-  FPRINTF(fp,"\t");
+  Filestring_put_string(fp,"segment_plusp:");
+  Filestring_put_int(fp,substring->plusp);
+  Filestring_put_string(fp,",main_plusp:");
+  Filestring_put_int(fp,path->plusp);
+  Filestring_put_string(fp,",invertp:");
+  Filestring_put_int(fp,invertp);
+  PUTC('\t',fp);
 #endif
 
   if (substring->pre_junction == NULL) {
@@ -501,7 +520,8 @@ print_substring (Filestring_T fp, Substring_T substring, Path_T path, Shortread_
       } else if (path->splicetype3 == DONOR || path->splicetype3 == ANTIDONOR) {
 	FPRINTF(fp,"donor:%.2f",path->ambig_prob_3);
       } else {
-	FPRINTF(fp,"start:%d",substring->querystart);
+	Filestring_put_string(fp,"start:");
+	Filestring_put_int(fp,substring->querystart);
       }
 
     } else {
@@ -511,15 +531,18 @@ print_substring (Filestring_T fp, Substring_T substring, Path_T path, Shortread_
       } else if (path->splicetype3 == ACCEPTOR || path->splicetype3 == ANTIACCEPTOR) {
 	FPRINTF(fp,"acceptor:%.2f",path->ambig_prob_3);
       } else {
-	FPRINTF(fp,"start:%d",substring->querystart);
+	Filestring_put_string(fp,"start:");
+	Filestring_put_int(fp,substring->querystart);
       }
     }
 
   } else if ((type1 = Junction_type(substring->pre_junction)) == INS_JUNCTION) {
-    FPRINTF(fp,"ins:%d",Junction_nindels(substring->pre_junction));
+    Filestring_put_string(fp,"ins:");
+    Filestring_put_int(fp,Junction_nindels(substring->pre_junction));
 
   } else if (type1 == DEL_JUNCTION) {
-    FPRINTF(fp,"del:%d",Junction_nindels(substring->pre_junction));
+    Filestring_put_string(fp,"del:");
+    Filestring_put_int(fp,Junction_nindels(substring->pre_junction));
 
   } else if (type1 == SPLICE_JUNCTION || type1 == CHIMERA_JUNCTION) {
     if (sense_forward_p == invertp) {
@@ -534,7 +557,7 @@ print_substring (Filestring_T fp, Substring_T substring, Path_T path, Shortread_
     abort();
   }
 
-  FPRINTF(fp,"..");
+  Filestring_put_string(fp,"..");
 
   if (substring->post_junction == NULL) {
     type2 = NO_JUNCTION;
@@ -545,7 +568,8 @@ print_substring (Filestring_T fp, Substring_T substring, Path_T path, Shortread_
       } else if (path->splicetype3 == ACCEPTOR || path->splicetype3 == ANTIACCEPTOR) {
 	FPRINTF(fp,"acceptor:%.2f",path->ambig_prob_3);
       } else {
-	FPRINTF(fp,"end:%d",path->querylength - substring->queryend);
+	Filestring_put_string(fp,"end:");
+	Filestring_put_int(fp,path->querylength - substring->queryend);
       }
 
     } else {
@@ -555,15 +579,18 @@ print_substring (Filestring_T fp, Substring_T substring, Path_T path, Shortread_
       } else if (path->splicetype3 == DONOR || path->splicetype3 == ANTIDONOR) {
 	FPRINTF(fp,"donor:%.2f",path->ambig_prob_3);
       } else {
-	FPRINTF(fp,"end:%d",path->querylength - substring->queryend);
+	Filestring_put_string(fp,"end:");
+	Filestring_put_int(fp,path->querylength - substring->queryend);
       }
     }
 
   } else if ((type2 = Junction_type(substring->post_junction)) == INS_JUNCTION) {
-    FPRINTF(fp,"ins:%d",Junction_nindels(substring->post_junction));
+    Filestring_put_string(fp,"ins:");
+    Filestring_put_int(fp,Junction_nindels(substring->post_junction));
 
   } else if (type2 == DEL_JUNCTION) {
-    FPRINTF(fp,"del:%d",Junction_nindels(substring->post_junction));
+    Filestring_put_string(fp,"del:");
+    Filestring_put_int(fp,Junction_nindels(substring->post_junction));
 
   } else if (type2 == SPLICE_JUNCTION || type2 == CHIMERA_JUNCTION) {
     if (sense_forward_p == invertp) {
@@ -580,9 +607,15 @@ print_substring (Filestring_T fp, Substring_T substring, Path_T path, Shortread_
 
 
 #ifdef TO_FIX
-  FPRINTF(fp,",matches:%d,sub:%d",nmatches,nmismatches);
+  Filestring_put_string(fp,",matches:");
+  Filestring_put_int(fp,nmatches);
+  Filestring_put_string(fp,",sub:");
+  Filestring_put_int(fp,nmismatches);
   if (print_nsnpdiffs_p) {
-    FPRINTF(fp,"+%d=%d",substring->nmismatches_refdiff - substring->nmismatches_bothdiff,substring->nmismatches_refdiff);
+    PUTC('+',fp);
+    Filestring_put_int(fp,substring->nmismatches_refdiff - substring->nmismatches_bothdiff);
+    PUTC('=',fp);
+    Filestring_put_int(fp,substring->nmismatches_refdiff);
     if (print_snplabels_p && substring->nmismatches_refdiff > substring->nmismatches_bothdiff) {
       print_snp_labels(fp,substring,queryseq);
     }
@@ -592,46 +625,52 @@ print_substring (Filestring_T fp, Substring_T substring, Path_T path, Shortread_
 
   if (type1 == SPLICE_JUNCTION && type2 == SPLICE_JUNCTION) {
     if (sense_forward_p == invertp) {
-      FPRINTF(fp,",dir:antisense");
+      Filestring_put_string(fp,",dir:antisense");
     } else {
-      FPRINTF(fp,",dir:sense");
+      Filestring_put_string(fp,",dir:sense");
     }
     splice_distance_1 = Junction_splice_distance(substring->pre_junction);
     splice_distance_2 = Junction_splice_distance(substring->post_junction);
     if (splice_distance_1 == 0 && splice_distance_2 == 0) {
       /* Skip */
     } else if (splice_distance_1 == 0) {
-      FPRINTF(fp,",splice_type:consistent");
-      FPRINTF(fp,",splice_dist_2:%u",splice_distance_2);
+      Filestring_put_string(fp,",splice_type:consistent");
+      Filestring_put_string(fp,",splice_dist_2:");
+      Filestring_put_uint(fp,splice_distance_2);
     } else if (splice_distance_2 == 0) {
-      FPRINTF(fp,",splice_type:consistent");
-      FPRINTF(fp,",splice_dist_1:%u",splice_distance_1);
+      Filestring_put_string(fp,",splice_type:consistent");
+      Filestring_put_string(fp,",splice_dist_1:");
+      Filestring_put_uint(fp,splice_distance_1);
     } else {
-      FPRINTF(fp,",splice_type:consistent");
-      FPRINTF(fp,",splice_dist_1:%u",splice_distance_1);
-      FPRINTF(fp,",splice_dist_2:%u",splice_distance_2);
+      Filestring_put_string(fp,",splice_type:consistent");
+      Filestring_put_string(fp,",splice_dist_1:");
+      Filestring_put_uint(fp,splice_distance_1);
+      Filestring_put_string(fp,",splice_dist_2:");
+      Filestring_put_uint(fp,splice_distance_2);
     }
 
   } else if (type1 == SPLICE_JUNCTION) {
     if (sense_forward_p == invertp) {
-      FPRINTF(fp,",dir:antisense");
+      Filestring_put_string(fp,",dir:antisense");
     } else {
-      FPRINTF(fp,",dir:sense");
+      Filestring_put_string(fp,",dir:sense");
     }
     if ((splice_distance_1 = Junction_splice_distance(substring->pre_junction)) > 0) {
-      FPRINTF(fp,",splice_type:consistent");
-      FPRINTF(fp,",splice_dist_1:%u",splice_distance_1);
+      Filestring_put_string(fp,",splice_type:consistent");
+      Filestring_put_string(fp,",splice_dist_1:");
+      Filestring_put_uint(fp,splice_distance_1);
     }
 
   } else if (type2 == SPLICE_JUNCTION) {
     if (sense_forward_p == invertp) {
-      FPRINTF(fp,",dir:antisense");
+      Filestring_put_string(fp,",dir:antisense");
     } else {
-      FPRINTF(fp,",dir:sense");
+      Filestring_put_string(fp,",dir:sense");
     }
     if ((splice_distance_2 = Junction_splice_distance(substring->post_junction)) > 0) {
-      FPRINTF(fp,",splice_type:consistent");
-      FPRINTF(fp,",splice_dist_2:%u",splice_distance_2);
+      Filestring_put_string(fp,",splice_type:consistent");
+      Filestring_put_string(fp,",splice_dist_2:");
+      Filestring_put_uint(fp,splice_distance_2);
     }
   }
 
@@ -647,7 +686,9 @@ static void
 print_pair_info (Filestring_T fp, Pairtype_T pairtype, int insertlength) {
 
 #ifdef TO_FIX
-  FPRINTF(fp,"pair_score:%d,",pairscore);
+  Filestring_put_string(fp,"pair_score:");
+  Filestring_put_int(fp,pairscore);
+  PUTC(',',fp);
 #endif
 #ifndef NO_COMPARE
   /* FPRINTF(fp,"insert_length:%d",insertlength); */
@@ -674,7 +715,7 @@ print_substring_list (Filestring_T fp, List_T substrings, Path_T path, Pathpair_
   List_T p;
 
   /* First line */
-  FPRINTF(fp," ");
+  PUTC(' ',fp);
   substring = List_head(substrings);
   print_substring(fp,substring,path,queryseq,invertp);
 
@@ -689,19 +730,19 @@ print_substring_list (Filestring_T fp, List_T substrings, Path_T path, Pathpair_
 #if 0
   /* Print pairing info */
   if (pathpair != NULL) {
-    FPRINTF(fp,"\t");
+    PUTC('\t',fp);
     print_pair_info(fp,pathpair->pairtype,pathpair->insertlength);
   }
 #endif
-  FPRINTF(fp,"\n");
+  PUTC('\n',fp);
 
 
   /* Remaining lines */
   for (p = List_next(substrings); p != NULL; p = List_next(p)) {
-    FPRINTF(fp,",");
+    PUTC(',',fp);
     substring = List_head(p);
     print_substring(fp,substring,path,queryseq,invertp);
-    FPRINTF(fp,"\n");
+    PUTC('\n',fp);
   }
 
   return;
@@ -208,8 +208,8 @@ Path_cigar_md (int *hardclip_low, int *hardclip_high,
 
   if (this == NULL) {
     *hardclip_low = *hardclip_high = 0;
-    FPRINTF(*cigar_fp,"*");
-    FPRINTF(*md_fp,"*");
+    PUTC('*',*cigar_fp);
+    PUTC('*',*md_fp);
 
   } else {
     ninserts = 0;
@@ -245,11 +245,11 @@ Path_cigar_md (int *hardclip_low, int *hardclip_high,
     p += qpos;			/* Ignore choplength, which is not in genomic_diff */
 
     if (softclip > 0) {
-      FPRINTF(*cigar_fp,"%dS",softclip);
+      Filestring_put_cigar(*cigar_fp,softclip,'S');
     }
     
     if (*hardclip_low > 0) {
-      FPRINTF(*cigar_fp,"%dH",*hardclip_low);
+      Filestring_put_cigar(*cigar_fp,*hardclip_low,'H');
     }
 
     while (j != NULL) {
@@ -258,7 +258,7 @@ Path_cigar_md (int *hardclip_low, int *hardclip_high,
 		   Intlist_head(q) - qpos,Intlist_head(q),qpos,nconsecutive));
       n = Intlist_head(q) - qpos;
       if (n > 0 || sam_insert_0M_p == true) {
-	FPRINTF(*cigar_fp,"%dM",n);
+	Filestring_put_cigar(*cigar_fp,n,'M');
       }
       for (i = 0; i < n; i++) {
 	debug(printf("isupper %c, nconsecutive %d\n",*p,nconsecutive));
@@ -268,17 +268,19 @@ Path_cigar_md (int *hardclip_low, int *hardclip_high,
 
 	} else if (nconsecutive > 0) {
 	  /* Mismatch */
-	  FPRINTF(*md_fp,"%d%c",nconsecutive,toupper(c));
+	  Filestring_put_int(*md_fp,nconsecutive);
+	  PUTC(toupper(c),*md_fp);
 	  nconsecutive = 0;
 	  md_startp = false;
 	  
 	} else if (md_startp == false) {
 	  /* Consecutive mismatches */
-	  FPRINTF(*md_fp,"%c",toupper(c));
+	  PUTC(toupper(c),*md_fp);
 	  
 	} else {
 	  /* Initial mismatch: MD string needs to start with a number */
-	  FPRINTF(*md_fp,"0%c",toupper(c));
+	  PUTC('0',*md_fp);
+	  PUTC(toupper(c),*md_fp);
 	  md_startp = false;
 	}
       }
@@ -287,24 +289,26 @@ Path_cigar_md (int *hardclip_low, int *hardclip_high,
       ninserts = 0;
       junction = (Junction_T) List_head(j);
       if (junction == JUNCTION_UNSOLVED) {
-	FPRINTF(*cigar_fp,"X");
+	PUTC('X',*cigar_fp);
 
       } else if ((type = Junction_type(junction)) == DEL_JUNCTION) {
-	FPRINTF(*cigar_fp,"%dD",Junction_nindels(junction));
+	Filestring_put_cigar(*cigar_fp,Junction_nindels(junction),'D');
 
 	deletion_string = Junction_deletion_string(junction);
-	FPRINTF(*md_fp,"%d^%s",nconsecutive,deletion_string);
+	Filestring_put_int(*md_fp,nconsecutive);
+	PUTC('^',*md_fp);
+	Filestring_put_string(*md_fp,deletion_string);
 	FREE(deletion_string);
 
 	nconsecutive = 0;
 	md_startp = false;
 
       } else if (type == INS_JUNCTION) {
-	FPRINTF(*cigar_fp,"%dI",ninserts = Junction_nindels(junction));
+	Filestring_put_cigar(*cigar_fp,ninserts = Junction_nindels(junction),'I');
 	p += ninserts;
 
       } else if (type == SPLICE_JUNCTION) {
-	FPRINTF(*cigar_fp,"%dN",Junction_splice_distance(junction));
+	Filestring_put_cigar(*cigar_fp,Junction_splice_distance(junction),'N');
 
       } else {
 	fprintf(stderr,"Unknown junction type %d\n",type);
@@ -320,7 +324,7 @@ Path_cigar_md (int *hardclip_low, int *hardclip_high,
 		 Intlist_head(q) - qpos,Intlist_head(q),qpos,nconsecutive));
     n = Intlist_head(q) - qpos;
     if (n > 0 || sam_insert_0M_p == true) {
-      FPRINTF(*cigar_fp,"%dM",n);
+      Filestring_put_cigar(*cigar_fp,n,'M');
     }
     for (i = 0; i < n; i++) {
       debug(printf("isupper %c, nconsecutive %d\n",*p,nconsecutive));
@@ -330,24 +334,26 @@ Path_cigar_md (int *hardclip_low, int *hardclip_high,
 
       } else if (nconsecutive > 0) {
 	/* Mismatch */
-	FPRINTF(*md_fp,"%d%c",nconsecutive,toupper(c));
+	Filestring_put_int(*md_fp,nconsecutive);
+	PUTC(toupper(c),*md_fp);
 	nconsecutive = 0;
 	md_startp = false;
 	  
       } else if (md_startp == false) {
 	/* Consecutive mismatches */
-	FPRINTF(*md_fp,"%c",toupper(c));
+	PUTC(toupper(c),*md_fp);
 	  
       } else {
 	/* Initial mismatch: MD string needs to start with a number */
-	FPRINTF(*md_fp,"0%c",toupper(c));
+	PUTC('0',*md_fp);
+	PUTC(toupper(c),*md_fp);
 	md_startp = false;
       }
     }
     debug(printf("After cigar M, nconsecutive is %d\n",nconsecutive));
 
     /* Previously checked for nconsecutive > 0, but MD string needs to end with a number */
-    FPRINTF(*md_fp,"%d",nconsecutive);
+    Filestring_put_int(*md_fp,nconsecutive);
 
     /* Compute softclip from chop */
     if (this->plusp == true) {
@@ -373,11 +379,11 @@ Path_cigar_md (int *hardclip_low, int *hardclip_high,
     }
 
     if (*hardclip_high > 0) {
-      FPRINTF(*cigar_fp,"%dH",*hardclip_high);
+      Filestring_put_cigar(*cigar_fp,*hardclip_high,'H');
     }
 
     if (softclip > 0) {
-      FPRINTF(*cigar_fp,"%dS",softclip);
+      Filestring_put_cigar(*cigar_fp,softclip,'S');
     }
   }
 
@@ -444,18 +450,18 @@ Path_supplemental_cigar_md (int *hardclip_low, int *hardclip_high,
   p += (segment_plusp == query_plusp) ? +qpos : -qpos;
 
   if (softclip > 0) {
-    FPRINTF(*cigar_fp,"%dS",softclip);
+    Filestring_put_cigar(*cigar_fp,softclip,'S');
   }
     
   if (*hardclip_low > 0) {
-    FPRINTF(*cigar_fp,"%dH",*hardclip_low);
+    Filestring_put_cigar(*cigar_fp,*hardclip_low,'H');
   }
 
   while (j != NULL) {
     q = Intlist_next(q);
     n = Intlist_head(q) - qpos;
     if (n > 0 || sam_insert_0M_p == true) {
-      FPRINTF(*cigar_fp,"%dM",n);
+      Filestring_put_cigar(*cigar_fp,n,'M');
     }
     for (i = 0; i < n; i++) {
       c = (segment_plusp != query_plusp) ? complCode[(int) *p--] : *p++;
@@ -465,17 +471,19 @@ Path_supplemental_cigar_md (int *hardclip_low, int *hardclip_high,
 
       } else if (nconsecutive > 0) {
 	/* Mismatch */
-	FPRINTF(*md_fp,"%d%c",nconsecutive,toupper(c));
+	Filestring_put_int(*md_fp,nconsecutive);
+	PUTC(toupper(c),*md_fp);
 	nconsecutive = 0;
 	md_startp = false;
 	  
       } else if (md_startp == false) {
 	/* Consecutive mismatches */
-	FPRINTF(*md_fp,"%c",toupper(c));
+	PUTC(toupper(c),*md_fp);
 	  
       } else {
 	/* Initial mismatch: MD string needs to start with a number */
-	FPRINTF(*md_fp,"0%c",toupper(c));
+	PUTC('0',*md_fp);
+	PUTC(toupper(c),*md_fp);
 	md_startp = false;
       }
     }
@@ -483,24 +491,26 @@ Path_supplemental_cigar_md (int *hardclip_low, int *hardclip_high,
     ninserts = 0;
     junction = (Junction_T) List_head(j);
     if (junction == JUNCTION_UNSOLVED) {
-      FPRINTF(*cigar_fp,"X");
+      PUTC('X',*cigar_fp);
 
     } else if ((type = Junction_type(junction)) == DEL_JUNCTION) {
-      FPRINTF(*cigar_fp,"%dD",Junction_nindels(junction));
+      Filestring_put_cigar(*cigar_fp,Junction_nindels(junction),'D');
 
       deletion_string = Junction_deletion_string(junction);
-      FPRINTF(*md_fp,"%d^%s",nconsecutive,deletion_string);
+      Filestring_put_int(*md_fp,nconsecutive);
+      PUTC('^',*md_fp);
+      Filestring_put_string(*md_fp,deletion_string);
       FREE(deletion_string);
 
       nconsecutive = 0;
       md_startp = false;
 
     } else if (type == INS_JUNCTION) {
-      FPRINTF(*cigar_fp,"%dI",ninserts = Junction_nindels(junction));
+      Filestring_put_cigar(*cigar_fp,ninserts = Junction_nindels(junction),'I');
       p += ninserts;
 
     } else if (type == SPLICE_JUNCTION) {
-      FPRINTF(*cigar_fp,"%dN",Junction_splice_distance(junction));
+      Filestring_put_cigar(*cigar_fp,Junction_splice_distance(junction),'N');
 
     } else {
       fprintf(stderr,"Unknown junction type %d\n",type);
@@ -514,7 +524,7 @@ Path_supplemental_cigar_md (int *hardclip_low, int *hardclip_high,
   q = Intlist_next(q);
   n = Intlist_head(q) - qpos;
   if (n > 0 || sam_insert_0M_p == true) {
-    FPRINTF(*cigar_fp,"%dM",n);
+    Filestring_put_cigar(*cigar_fp,n,'M');
   }
   for (i = 0; i < n; i++) {
     c = (segment_plusp != query_plusp) ? complCode[(int) *p--] : *p++;
@@ -524,23 +534,25 @@ Path_supplemental_cigar_md (int *hardclip_low, int *hardclip_high,
 
     } else if (nconsecutive > 0) {
       /* Mismatch */
-      FPRINTF(*md_fp,"%d%c",nconsecutive,toupper(c));
+      Filestring_put_int(*md_fp,nconsecutive);
+      PUTC(toupper(c),*md_fp);
       nconsecutive = 0;
       md_startp = false;
 	  
     } else if (md_startp == false) {
       /* Consecutive mismatches */
-      FPRINTF(*md_fp,"%c",toupper(c));
+      PUTC(toupper(c),*md_fp);
 	  
     } else {
       /* Initial mismatch: MD string needs to start with a number */
-      FPRINTF(*md_fp,"0%c",toupper(c));
+      PUTC('0',*md_fp);
+      PUTC(toupper(c),*md_fp);
       md_startp = false;
     }
   }
 
   /* Previously checked for nconsecutive > 0, but MD string needs to end with a number */
-  FPRINTF(*md_fp,"%d",nconsecutive);
+  Filestring_put_int(*md_fp,nconsecutive);
 
   /* Compute softclip from chop */
   if (segment_plusp == true) {
@@ -561,11 +573,11 @@ Path_supplemental_cigar_md (int *hardclip_low, int *hardclip_high,
   }
 
   if (*hardclip_high > 0) {
-    FPRINTF(*cigar_fp,"%dH",*hardclip_high);
+    Filestring_put_cigar(*cigar_fp,*hardclip_high,'H');
   }
 
   if (softclip > 0) {
-    FPRINTF(*cigar_fp,"%dS",softclip);
+    Filestring_put_cigar(*cigar_fp,softclip,'S');
   }
     
   /* Filestring_stringify required before Filestring_merge */
@@ -605,9 +617,11 @@ Path_print_sam_nomapping (Filestring_T fp, char *abbrev, Shortread_T queryseq, S
 
   /* 1. QNAME */
   if (acc2 == NULL) {
-    FPRINTF(fp,"%s",acc1);
+    Filestring_put_string(fp,acc1);
   } else {
-    FPRINTF(fp,"%s,%s",acc1,acc2);
+    Filestring_put_string(fp,acc1);
+    PUTC(',',fp);
+    Filestring_put_string(fp,acc2);
   }
   
   /* 2. FLAG */
@@ -619,17 +633,22 @@ Path_print_sam_nomapping (Filestring_T fp, char *abbrev, Shortread_T queryseq, S
 		      /*pathnum*/0,/*npaths*/0,artificial_mate_p,npaths_mate,
 		      /*absmq_score*/0,/*first_absmq*/0,invertp,invert_mate_p,
 		      /*supplementaryp*/false);
-  FPRINTF(fp,"\t%u\t*\t0\t0\t*",flag);
+  PUTC('\t',fp);
+  Filestring_put_uint(fp,flag);
+  Filestring_put_string(fp,"\t*\t0\t0\t*");
 
   /* 7. MRNM: Mate chr */
   /* 8. MPOS: Mate chrpos */
   if (mate == (Path_T) NULL) {
-    FPRINTF(fp,"\t*\t0");
+    Filestring_put_string(fp,"\t*\t0");
   } else if ((mate_chrpos_low = Path_genomiclow_softclipped(mate)) == 0U) {
-    FPRINTF(fp,"\t*\t0");
+    Filestring_put_string(fp,"\t*\t0");
   } else {
     chr = Univ_IIT_label(chromosome_iit,mate->chrnum,&allocp);
-    FPRINTF(fp,"\t%s\t%u",chr,mate_chrpos_low - mate->chroffset + 1U);
+    PUTC('\t',fp);
+    Filestring_put_string(fp,chr);
+    PUTC('\t',fp);
+    Filestring_put_uint(fp,mate_chrpos_low - mate->chroffset + 1U);
     if (allocp == true) {
       FREE(chr);
     }
@@ -637,13 +656,13 @@ Path_print_sam_nomapping (Filestring_T fp, char *abbrev, Shortread_T queryseq, S
 
 
   /* 9. ISIZE: Insert size */
-  FPRINTF(fp,"\t0");
+  Filestring_put_string(fp,"\t0");
 
   /* 10. SEQ: queryseq and 11. QUAL: quality scores */
   /* Since there is no mapping, we print the original query sequence. */
   if (sam_sparse_secondaries_p == true && (flag & NOT_PRIMARY) != 0) {
     /* SAM format specification says that secondary mappings should not print SEQ or QUAL to reduce file size */
-    FPRINTF(fp,"\t*\t*");
+    Filestring_put_string(fp,"\t*\t*");
 
   } else if (invertp == false) {
 #if 0
@@ -674,23 +693,27 @@ Path_print_sam_nomapping (Filestring_T fp, char *abbrev, Shortread_T queryseq, S
     /* Previously checked if queryseq_mate == NULL */
     /* Unpaired alignment.  Don't print XM. */
   } else {
-    FPRINTF(fp,"\tXM:Z:");
+    Filestring_put_string(fp,"\tXM:Z:");
     Filestring_merge(fp,mate_cigar_fp);
-    FPRINTF(fp,"\tXD:Z:");
+    Filestring_put_string(fp,"\tXD:Z:");
     Filestring_merge(fp,mate_md_fp);
-    FPRINTF(fp,"\tXN:i:%d",Path_ndiffs(mate));
+    Filestring_put_string(fp,"\tXN:i:");
+    Filestring_put_int(fp,Path_ndiffs(mate));
   }
 
   /* 12. TAGS: RG */
   if (sam_read_group_id != NULL) {
-    FPRINTF(fp,"\tRG:Z:%s",sam_read_group_id);
+    Filestring_put_string(fp,"\tRG:Z:");
+    Filestring_put_string(fp,sam_read_group_id);
   }
   
   /* 12. TAGS: NH */
   if (npaths_primary + npaths_altloc > 0) {
-    FPRINTF(fp,"\tNH:i:%d",npaths_primary + npaths_altloc);
+    Filestring_put_string(fp,"\tNH:i:");
+    Filestring_put_int(fp,npaths_primary + npaths_altloc);
     if (add_paired_nomappers_p == true) {
-      FPRINTF(fp,"\tHI:i:%d",pathnum);
+      Filestring_put_string(fp,"\tHI:i:");
+      Filestring_put_int(fp,pathnum);
     }
   }
 
@@ -704,14 +727,15 @@ Path_print_sam_nomapping (Filestring_T fp, char *abbrev, Shortread_T queryseq, S
 #endif
 
   /* 12. TAGS: XO */
-  FPRINTF(fp,"\tXO:Z:%s",abbrev);
+  Filestring_put_string(fp,"\tXO:Z:");
+  Filestring_put_string(fp,abbrev);
 
   /* 12. TAGS: (BC,) CB, CR, CY, UR, UY */
   if (single_cell_infoseq != NULL) {
     Single_cell_print_fields(fp,single_cell_infoseq);
   }
 
-  FPRINTF(fp,"\n");
+  PUTC('\n',fp);
 
   Filestring_free(&mate_md_fp,/*free_string_p*/true);
   Filestring_free(&mate_cigar_fp,/*free_string_p*/true);
@@ -765,29 +789,37 @@ print_substrings (int *hardclip_low, int *hardclip_high,
 
   /* 1. QNAME */
   if (acc2 == NULL) {
-    FPRINTF(fp,"%s",acc1);
+    Filestring_put_string(fp,acc1);
   } else {
-    FPRINTF(fp,"%s,%s",acc1,acc2);
+    Filestring_put_string(fp,acc1);
+    PUTC(',',fp);
+    Filestring_put_string(fp,acc2);
   }
 
   /* 2. FLAG */
   flag = compute_flag(path->plusp,mate,resulttype,first_read_p,
 		      pathnum,npaths_primary + npaths_altloc,artificial_mate_p,npaths_mate,
 		      absmq_score,first_absmq,invertp,invert_mate_p,/*supplementaryp*/false);
-  FPRINTF(fp,"\t%u",flag);
+  PUTC('\t',fp);
+  Filestring_put_uint(fp,flag);
 
   /* 3. RNAME: chr */
   /* 4. POS: chrpos */
   chr = Univ_IIT_label(chromosome_iit,path->chrnum,&allocp);
   univcoord_low = Path_genomiclow_softclipped(path);
-  FPRINTF(fp,"\t%s\t%u",chr,univcoord_low - path->chroffset + 1U);
+  PUTC('\t',fp);
+  Filestring_put_string(fp,chr);
+  PUTC('\t',fp);
+  Filestring_put_uint(fp,univcoord_low - path->chroffset + 1U);
   assert(univcoord_low >= path->chroffset);
   if (allocp == true) {
     FREE(chr);
   }
 
   /* 5. MAPQ: Mapping quality */
-  FPRINTF(fp,"\t%d\t",mapq_score);
+  PUTC('\t',fp);
+  Filestring_put_int(fp,mapq_score);
+  PUTC('\t',fp);
 
   /* 6. CIGAR */
   Filestring_merge(fp,cigar_fp);
@@ -795,14 +827,18 @@ print_substrings (int *hardclip_low, int *hardclip_high,
   /* 7. MRNM: Mate chr */
   /* 8. MPOS: Mate chrpos */
   if (mate == (Path_T) NULL) {
-    FPRINTF(fp,"\t*\t0");
+    Filestring_put_string(fp,"\t*\t0");
   } else {
     mate_univcoord_low = Path_genomiclow_softclipped(mate);
     if (mate->chrnum == path->chrnum) {
-      FPRINTF(fp,"\t=\t%u",mate_univcoord_low - mate->chroffset + 1U);
+      Filestring_put_string(fp,"\t=\t");
+      Filestring_put_uint(fp,mate_univcoord_low - mate->chroffset + 1U);
     } else {
       chr = Univ_IIT_label(chromosome_iit,mate->chrnum,&allocp);
-      FPRINTF(fp,"\t%s\t%u",chr,mate_univcoord_low - mate->chroffset + 1U);
+      PUTC('\t',fp);
+      Filestring_put_string(fp,chr);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,mate_univcoord_low - mate->chroffset + 1U);
       if (allocp == true) {
 	FREE(chr);
       }
@@ -813,34 +849,44 @@ print_substrings (int *hardclip_low, int *hardclip_high,
   if (resulttype == CONCORDANT_UNIQ || resulttype == CONCORDANT_TRANSLOC || resulttype == CONCORDANT_MULT) {
     if (pair_relationship > 0) {
       if (first_read_p == true) {
-	FPRINTF(fp,"\t%d",pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,pairedlength);
       } else {
-	FPRINTF(fp,"\t%d",-pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,-pairedlength);
       }
 
     } else if (pair_relationship < 0) {
       if (first_read_p == true) {
-	FPRINTF(fp,"\t%d",-pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,-pairedlength);
       } else {
-	FPRINTF(fp,"\t%d",pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,pairedlength);
       }
 
     } else if (path->plusp == invertp) {
-      FPRINTF(fp,"\t%d",-pairedlength);
+      PUTC('\t',fp);
+      Filestring_put_int(fp,-pairedlength);
     } else {
-      FPRINTF(fp,"\t%d",pairedlength);
+      PUTC('\t',fp);
+      Filestring_put_int(fp,pairedlength);
     }
 
   } else if (mate == (Path_T) NULL) {
-    FPRINTF(fp,"\t0");
+    Filestring_put_string(fp,"\t0");
   } else if (univcoord_low < mate_univcoord_low) {
-    FPRINTF(fp,"\t%d",pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,pairedlength);
   } else if (univcoord_low > mate_univcoord_low) {
-    FPRINTF(fp,"\t%d",-pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,-pairedlength);
   } else if (first_read_p == true) {
-    FPRINTF(fp,"\t%d",pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,pairedlength);
   } else {
-    FPRINTF(fp,"\t%d",-pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,-pairedlength);
   }
 
 
@@ -848,7 +894,7 @@ print_substrings (int *hardclip_low, int *hardclip_high,
   /* Queryseq has already been inverted, so just measure plusp relative to its current state */
   if (sam_sparse_secondaries_p == true && (flag & NOT_PRIMARY) != 0) {
     /* SAM format specification says that secondary mappings should not print SEQ or QUAL to reduce file size */
-    FPRINTF(fp,"\t*\t*");
+    Filestring_put_string(fp,"\t*\t*");
 
   } else if (path->plusp == true) {
 #if 0
@@ -880,21 +926,23 @@ print_substrings (int *hardclip_low, int *hardclip_high,
     /* Previously checked if queryseq_mate == NULL */
     /* Unpaired alignment.  Don't print XM. */
   } else {
-    FPRINTF(fp,"\tXM:Z:");
+    Filestring_put_string(fp,"\tXM:Z:");
     Filestring_merge(fp,mate_cigar_fp);
-    FPRINTF(fp,"\tXD:Z:");
+    Filestring_put_string(fp,"\tXD:Z:");
     Filestring_merge(fp,mate_md_fp);
-    FPRINTF(fp,"\tXN:i:%d",Path_ndiffs(mate));
+    Filestring_put_string(fp,"\tXN:i:");
+    Filestring_put_int(fp,Path_ndiffs(mate));
   }
 
   /* 12. TAGS: RG */
   if (sam_read_group_id != NULL) {
-    FPRINTF(fp,"\tRG:Z:%s",sam_read_group_id);
+    Filestring_put_string(fp,"\tRG:Z:");
+    Filestring_put_string(fp,sam_read_group_id);
   }
 
   /* 12. TAGS: XH and XI */
   if (*hardclip_low > 0 || *hardclip_high > 0) {
-    FPRINTF(fp,"\tXH:Z:");
+    Filestring_put_string(fp,"\tXH:Z:");
     if (path->plusp == true) {
       Shortread_print_chopped_end(fp,queryseq,*hardclip_low,*hardclip_high);
     } else {
@@ -902,7 +950,7 @@ print_substrings (int *hardclip_low, int *hardclip_high,
     }
 
     if (Shortread_quality_string(queryseq) != NULL) {
-      FPRINTF(fp,"\tXI:Z:");
+      Filestring_put_string(fp,"\tXI:Z:");
       if (path->plusp == true) {
 	Shortread_print_chopped_end_quality(fp,queryseq,*hardclip_low,*hardclip_high,quality_shift);
       } else {
@@ -921,73 +969,90 @@ print_substrings (int *hardclip_low, int *hardclip_high,
 #endif
 
   /* 12. TAGS: MD */
-  FPRINTF(fp,"\tMD:Z:");
+  Filestring_put_string(fp,"\tMD:Z:");
   Filestring_merge(fp,md_fp);
 
   /* 12. TAGS: NH */
   /* 12. TAGS: HI */
-  FPRINTF(fp,"\tNH:i:%d\tHI:i:%d",npaths_primary + npaths_altloc,pathnum);
+  Filestring_put_string(fp,"\tNH:i:");
+  Filestring_put_int(fp,npaths_primary + npaths_altloc);
+  Filestring_put_string(fp,"\tHI:i:");
+  Filestring_put_int(fp,pathnum);
 
   /* 12. TAGS: NM (mismatches) */
-  FPRINTF(fp,"\tNM:i:%d",Path_ndiffs(path));
+  Filestring_put_string(fp,"\tNM:i:");
+  Filestring_put_int(fp,Path_ndiffs(path));
   
   /* 12. TAGS: XE */
 #ifdef TO_FIX
   if (maskedp) {
-    FPRINTF(fp,"\tXE:i:%d",nmatches_exonic);
+    Filestring_put_string(fp,"\tXE:i:");
+    Filestring_put_int(fp,nmatches_exonic);
   }
 #endif
 
 #ifdef TO_FIX
   if (snps_iit) {
     /* 12. TAGS: XW and XV */
-    FPRINTF(fp,"\tXW:i:%d",nmismatches_bothdiff);
-    FPRINTF(fp,"\tXV:i:%d",nmismatches_refdiff - nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXW:i:");
+    Filestring_put_int(fp,nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXV:i:");
+    Filestring_put_int(fp,nmismatches_refdiff - nmismatches_bothdiff);
   }
 #endif
 
   /* 12. TAGS: SM */
   /* 12. TAGS: XQ */
   /* 12. TAGS: X2 */
-  FPRINTF(fp,"\tSM:i:%d\tXQ:i:%d\tX2:i:%d",mapq_score,absmq_score,second_absmq);
+  Filestring_put_string(fp,"\tSM:i:");
+  Filestring_put_int(fp,mapq_score);
+  Filestring_put_string(fp,"\tXQ:i:");
+  Filestring_put_int(fp,absmq_score);
+  Filestring_put_string(fp,"\tX2:i:");
+  Filestring_put_int(fp,second_absmq);
 
   /* 12. TAGS: XO */
-  FPRINTF(fp,"\tXO:Z:%s",abbrev);
+  Filestring_put_string(fp,"\tXO:Z:");
+  Filestring_put_string(fp,abbrev);
 
   /* 12. TAGS: XA */
   if (path->qstart_alts != NULL || path->qend_alts != NULL) {
-    FPRINTF(fp,"\tXA:Z:");
+    Filestring_put_string(fp,"\tXA:Z:");
 
     if (path->qstart_alts != NULL) {
       alts_coords = path->qstart_alts->coords;
       n = path->qstart_alts->ncoords;
 #ifdef PRINT_ALTS_COORDS
-      FPRINTF(fp,"%u",alts_coords[0] - path->chroffset + 1U);
+      Filestring_put_uint(fp,alts_coords[0] - path->chroffset + 1U);
       for (i = 1; i < n; i++) {
-	FPRINTF(fp,",%u",alts_coords[i] - path->chroffset + 1U);
+	PUTC(',',fp);
+	Filestring_put_uint(fp,alts_coords[i] - path->chroffset + 1U);
       }
 #else
       splicecoord = Univcoordlist_head(path->univdiagonals) - path->querylength + Intlist_head(path->endpoints);
-      FPRINTF(fp,"%u",splicecoord - alts_coords[0]);
+      Filestring_put_uint(fp,splicecoord - alts_coords[0]);
       for (i = 1; i < n; i++) {
-	FPRINTF(fp,",%u",splicecoord - alts_coords[i]);
+	PUTC(',',fp);
+	Filestring_put_uint(fp,splicecoord - alts_coords[i]);
       }
 #endif
     }
-    FPRINTF(fp,"|");
+    PUTC('|',fp);
     if (path->qend_alts != NULL) {
       alts_coords = path->qend_alts->coords;
       n = path->qend_alts->ncoords;
 #ifdef PRINT_ALTS_COORDS
-      FPRINTF(fp,"%u",alts_coords[0] - path->chroffset + 1U);
+      Filestring_put_uint(fp,alts_coords[0] - path->chroffset + 1U);
       for (i = 1; i < n; i++) {
-	FPRINTF(fp,",%u",alts_coords[i] - path->chroffset + 1U);
+	PUTC(',',fp);
+	Filestring_put_uint(fp,alts_coords[i] - path->chroffset + 1U);
       }
 #else
       splicecoord = Univcoordlist_last_value(path->univdiagonals) - path->querylength + Intlist_last_value(path->endpoints);
-      FPRINTF(fp,"%u",alts_coords[0] - splicecoord);
+      Filestring_put_uint(fp,alts_coords[0] - splicecoord);
       for (i = 1; i < n; i++) {
-	FPRINTF(fp,",%u",alts_coords[i] - splicecoord);
+	PUTC(',',fp);
+	Filestring_put_uint(fp,alts_coords[i] - splicecoord);
       }
 #endif
     }
@@ -1051,16 +1116,16 @@ print_substrings (int *hardclip_low, int *hardclip_high,
   }
     
   if (transcript_genestrand > 0) {
-    FPRINTF(fp,"\tXS:A:+");
+    Filestring_put_string(fp,"\tXS:A:+");
   } else if (transcript_genestrand < 0) {
-    FPRINTF(fp,"\tXS:A:-");
+    Filestring_put_string(fp,"\tXS:A:-");
   }
 
 
 #if 0
   /* 12. TAGS: XC */
   if (circularp == true) {
-    FPRINTF(fp,"\tXC:A:+");
+    Filestring_put_string(fp,"\tXC:A:+");
   }
 #endif
 
@@ -1080,7 +1145,7 @@ print_substrings (int *hardclip_low, int *hardclip_high,
     Single_cell_print_fields(fp,single_cell_infoseq);
   }
 
-  FPRINTF(fp,"\n");
+  PUTC('\n',fp);
 
   Filestring_free(&mate_md_fp,/*free_string_p*/true);
   Filestring_free(&md_fp,/*free_string_p*/true);
@@ -1142,29 +1207,37 @@ print_circular (Filestring_T fp, char *abbrev, T path,
 
   /* 1. QNAME */
   if (acc2 == NULL) {
-    FPRINTF(fp,"%s",acc1);
+    Filestring_put_string(fp,acc1);
   } else {
-    FPRINTF(fp,"%s,%s",acc1,acc2);
+    Filestring_put_string(fp,acc1);
+    PUTC(',',fp);
+    Filestring_put_string(fp,acc2);
   }
 
   /* 2. FLAG */
   flag = compute_flag(path->plusp,mate,resulttype,first_read_p,
 		      pathnum,npaths_primary + npaths_altloc,artificial_mate_p,npaths_mate,
 		      absmq_score,first_absmq,invertp,invert_mate_p,/*supplementaryp*/true);
-  FPRINTF(fp,"\t%u",flag);
+  PUTC('\t',fp);
+  Filestring_put_uint(fp,flag);
 
   /* 3. RNAME: chr */
   /* 4. POS: chrpos */
   chr = Univ_IIT_label(chromosome_iit,path->chrnum,&allocp);
   univcoord_low = Path_genomiclow_circular_softclipped(path);
   assert(univcoord_low >= path->chroffset);
-  FPRINTF(fp,"\t%s\t%u",chr,univcoord_low - path->chroffset + 1U);
+  PUTC('\t',fp);
+  Filestring_put_string(fp,chr);
+  PUTC('\t',fp);
+  Filestring_put_uint(fp,univcoord_low - path->chroffset + 1U);
   if (allocp == true) {
     FREE(chr);
   }
 
   /* 5. MAPQ: Mapping quality */
-  FPRINTF(fp,"\t%d\t",mapq_score);
+  PUTC('\t',fp);
+  Filestring_put_int(fp,mapq_score);
+  PUTC('\t',fp);
 
   /* 6. CIGAR */
   Filestring_merge(fp,cigar_fp);
@@ -1172,14 +1245,18 @@ print_circular (Filestring_T fp, char *abbrev, T path,
   /* 7. MRNM: Mate chr */
   /* 8. MPOS: Mate chrpos */
   if (mate == (Path_T) NULL) {
-    FPRINTF(fp,"\t*\t0");
+    Filestring_put_string(fp,"\t*\t0");
   } else {
     mate_univcoord_low = Path_genomiclow_softclipped(mate);
     if (mate->chrnum == path->chrnum) {
-      FPRINTF(fp,"\t=\t%u",mate_univcoord_low - mate->chroffset + 1U);
+      Filestring_put_string(fp,"\t=\t");
+      Filestring_put_uint(fp,mate_univcoord_low - mate->chroffset + 1U);
     } else {
       chr = Univ_IIT_label(chromosome_iit,mate->chrnum,&allocp);
-      FPRINTF(fp,"\t%s\t%u",chr,mate_univcoord_low - mate->chroffset + 1U);
+      PUTC('\t',fp);
+      Filestring_put_string(fp,chr);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,mate_univcoord_low - mate->chroffset + 1U);
       if (allocp == true) {
 	FREE(chr);
       }
@@ -1190,34 +1267,44 @@ print_circular (Filestring_T fp, char *abbrev, T path,
   if (resulttype == CONCORDANT_UNIQ || resulttype == CONCORDANT_TRANSLOC || resulttype == CONCORDANT_MULT) {
     if (pair_relationship > 0) {
       if (first_read_p == true) {
-	FPRINTF(fp,"\t%d",pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,pairedlength);
       } else {
-	FPRINTF(fp,"\t%d",-pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,-pairedlength);
       }
 
     } else if (pair_relationship < 0) {
       if (first_read_p == true) {
-	FPRINTF(fp,"\t%d",-pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,-pairedlength);
       } else {
-	FPRINTF(fp,"\t%d",pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,pairedlength);
       }
 
     } else if (path->plusp == invertp) {
-      FPRINTF(fp,"\t%d",-pairedlength);
+      PUTC('\t',fp);
+      Filestring_put_int(fp,-pairedlength);
     } else {
-      FPRINTF(fp,"\t%d",pairedlength);
+      PUTC('\t',fp);
+      Filestring_put_int(fp,pairedlength);
     }
 
   } else if (mate == (Path_T) NULL) {
-    FPRINTF(fp,"\t0");
+    Filestring_put_string(fp,"\t0");
   } else if (univcoord_low < mate_univcoord_low) {
-    FPRINTF(fp,"\t%d",pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,pairedlength);
   } else if (univcoord_low > mate_univcoord_low) {
-    FPRINTF(fp,"\t%d",-pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,-pairedlength);
   } else if (first_read_p == true) {
-    FPRINTF(fp,"\t%d",pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,pairedlength);
   } else {
-    FPRINTF(fp,"\t%d",-pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,-pairedlength);
   }
 
 
@@ -1227,7 +1314,7 @@ print_circular (Filestring_T fp, char *abbrev, T path,
   if (sam_sparse_secondaries_p == true && (flag & NOT_PRIMARY) != 0) {
     /* SAM format specification says that secondary mappings should not print SEQ or QUAL to reduce file size */
     /* We can use the XH field in the primary mapping to reconstruct the original sequence */
-    FPRINTF(fp,"\t*\t*");
+    Filestring_put_string(fp,"\t*\t*");
 
   } else if (path->plusp == true) {
 #if 0
@@ -1257,16 +1344,18 @@ print_circular (Filestring_T fp, char *abbrev, T path,
     /* Previously checked if queryseq_mate == NULL */
     /* Unpaired alignment.  Don't print XM. */
   } else {
-    FPRINTF(fp,"\tXM:Z:");
+    Filestring_put_string(fp,"\tXM:Z:");
     Filestring_merge(fp,mate_cigar_fp);
-    FPRINTF(fp,"\tXD:Z:");
+    Filestring_put_string(fp,"\tXD:Z:");
     Filestring_merge(fp,mate_md_fp);
-    FPRINTF(fp,"\tXN:i:%d",Path_ndiffs(mate));
+    Filestring_put_string(fp,"\tXN:i:");
+    Filestring_put_int(fp,Path_ndiffs(mate));
   }
 
   /* 12. TAGS: RG */
   if (sam_read_group_id != NULL) {
-    FPRINTF(fp,"\tRG:Z:%s",sam_read_group_id);
+    Filestring_put_string(fp,"\tRG:Z:");
+    Filestring_put_string(fp,sam_read_group_id);
   }
 
   /* 12. TAGS: XH and XI.  Not in supplemental. */
@@ -1278,7 +1367,7 @@ print_circular (Filestring_T fp, char *abbrev, T path,
   /* Shortread_print_chop(fp,queryseq,invertp); */
 
   /* 12. TAGS: MD */
-  FPRINTF(fp,"\tMD:Z:");
+  Filestring_put_string(fp,"\tMD:Z:");
   Filestring_merge(fp,md_fp);
 
   /* 12. TAGS: NH.  Not in supplemental */
@@ -1286,20 +1375,24 @@ print_circular (Filestring_T fp, char *abbrev, T path,
   FPRINTF(fp,"\tHI:i:%d",npaths_primary + npaths_altloc,pathnum);
 
   /* 12. TAGS: NM (mismatches) */
-  FPRINTF(fp,"\tNM:i:%d",Path_ndiffs(path));
+  Filestring_put_string(fp,"\tNM:i:");
+  Filestring_put_int(fp,Path_ndiffs(path));
   
   /* 12. TAGS: XE */
 #ifdef TO_FIX
   if (maskedp) {
-    FPRINTF(fp,"\tXE:i:%d",nmatches_exonic);
+    Filestring_put_string(fp,"\tXE:i:");
+    Filestring_put_int(fp,nmatches_exonic);
   }
 #endif
 
 #ifdef TO_FIX
   if (snps_iit) {
     /* 12. TAGS: XW and XV */
-    FPRINTF(fp,"\tXW:i:%d",nmismatches_bothdiff);
-    FPRINTF(fp,"\tXV:i:%d",nmismatches_refdiff - nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXW:i:");
+    Filestring_put_int(fp,nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXV:i:");
+    Filestring_put_int(fp,nmismatches_refdiff - nmismatches_bothdiff);
   }
 #endif
 
@@ -1307,14 +1400,15 @@ print_circular (Filestring_T fp, char *abbrev, T path,
   /* FPRINTF(fp,"\tSM:i:%d\tXQ:i:%d\tX2:i:%d",mapq_score,absmq_score,second_absmq); */
 
   /* 12. TAGS: XO */
-  FPRINTF(fp,"\tXO:Z:%s",abbrev);
+  Filestring_put_string(fp,"\tXO:Z:");
+  Filestring_put_string(fp,abbrev);
 
   /* 12. TAGS: (BC,) CB, CR, CY, UR, UY */
   if (single_cell_infoseq != NULL) {
     Single_cell_print_fields(fp,single_cell_infoseq);
   }
 
-  FPRINTF(fp,"\n");
+  PUTC('\n',fp);
 
   Filestring_free(&mate_md_fp,/*free_string_p*/true);
   Filestring_free(&md_fp,/*free_string_p*/true);
@@ -1389,29 +1483,37 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
   /* Printing the supplemental (fusion) part */
   /* 1. QNAME */
   if (acc2 == NULL) {
-    FPRINTF(fp,"%s",acc1);
+    Filestring_put_string(fp,acc1);
   } else {
-    FPRINTF(fp,"%s,%s",acc1,acc2);
+    Filestring_put_string(fp,acc1);
+    PUTC(',',fp);
+    Filestring_put_string(fp,acc2);
   }
 
   /* 2. FLAG */
   flag = compute_flag(path->fusion_plusp,mate,resulttype,first_read_p,
 		      pathnum,npaths_primary + npaths_altloc,artificial_mate_p,npaths_mate,
 		      absmq_score,first_absmq,invertp,invert_mate_p,/*supplementaryp*/true);
-  FPRINTF(fp,"\t%u",flag);
+  PUTC('\t',fp);
+  Filestring_put_uint(fp,flag);
 
   /* 3. RNAME: chr */
   /* 4. POS: chrpos */
   chr = Univ_IIT_label(chromosome_iit,path->fusion_chrnum,&allocp);
   univcoord_low = Path_genomiclow_fusion_softclipped(path);
-  FPRINTF(fp,"\t%s\t%u",chr,univcoord_low - path->fusion_chroffset + 1U);
+  PUTC('\t',fp);
+  Filestring_put_string(fp,chr);
+  PUTC('\t',fp);
+  Filestring_put_uint(fp,univcoord_low - path->fusion_chroffset + 1U);
   assert(univcoord_low >= path->fusion_chroffset);
   if (allocp == true) {
     FREE(chr);
   }
 
   /* 5. MAPQ: Mapping quality */
-  FPRINTF(fp,"\t%d\t",mapq_score);
+  PUTC('\t',fp);
+  Filestring_put_int(fp,mapq_score);
+  PUTC('\t',fp);
 
   /* 6. CIGAR */
   Filestring_merge(fp,cigar_fp);
@@ -1419,14 +1521,18 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
   /* 7. MRNM: Mate chr */
   /* 8. MPOS: Mate chrpos */
   if (mate == (Path_T) NULL) {
-    FPRINTF(fp,"\t*\t0");
+    Filestring_put_string(fp,"\t*\t0");
   } else {
     mate_univcoord_low = Path_genomiclow_softclipped(mate);
     if (mate->chrnum == path->fusion_chrnum) {
-      FPRINTF(fp,"\t=\t%u",mate_univcoord_low - mate->chroffset + 1U);
+      Filestring_put_string(fp,"\t=\t");
+      Filestring_put_uint(fp,mate_univcoord_low - mate->chroffset + 1U);
     } else {
       chr = Univ_IIT_label(chromosome_iit,mate->chrnum,&allocp);
-      FPRINTF(fp,"\t%s\t%u",chr,mate_univcoord_low - mate->chroffset + 1U);
+      PUTC('\t',fp);
+      Filestring_put_string(fp,chr);
+      PUTC('\t',fp);
+      Filestring_put_uint(fp,mate_univcoord_low - mate->chroffset + 1U);
       if (allocp == true) {
 	FREE(chr);
       }
@@ -1437,34 +1543,44 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
   if (resulttype == CONCORDANT_UNIQ || resulttype == CONCORDANT_TRANSLOC || resulttype == CONCORDANT_MULT) {
     if (pair_relationship > 0) {
       if (first_read_p == true) {
-	FPRINTF(fp,"\t%d",pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,pairedlength);
       } else {
-	FPRINTF(fp,"\t%d",-pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,-pairedlength);
       }
 
     } else if (pair_relationship < 0) {
       if (first_read_p == true) {
-	FPRINTF(fp,"\t%d",-pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,-pairedlength);
       } else {
-	FPRINTF(fp,"\t%d",pairedlength);
+	PUTC('\t',fp);
+	Filestring_put_int(fp,pairedlength);
       }
 
     } else if (path->plusp == invertp) {
-      FPRINTF(fp,"\t%d",-pairedlength);
+      PUTC('\t',fp);
+      Filestring_put_int(fp,-pairedlength);
     } else {
-      FPRINTF(fp,"\t%d",pairedlength);
+      PUTC('\t',fp);
+      Filestring_put_int(fp,pairedlength);
     }
 
   } else if (mate == (Path_T) NULL) {
-    FPRINTF(fp,"\t0");
+    Filestring_put_string(fp,"\t0");
   } else if (univcoord_low < mate_univcoord_low) {
-    FPRINTF(fp,"\t%d",pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,pairedlength);
   } else if (univcoord_low > mate_univcoord_low) {
-    FPRINTF(fp,"\t%d",-pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,-pairedlength);
   } else if (first_read_p == true) {
-    FPRINTF(fp,"\t%d",pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,pairedlength);
   } else {
-    FPRINTF(fp,"\t%d",-pairedlength);
+    PUTC('\t',fp);
+    Filestring_put_int(fp,-pairedlength);
   }
 
 
@@ -1474,10 +1590,10 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
   if (sam_sparse_secondaries_p == true && (flag & NOT_PRIMARY) != 0) {
     /* SAM format specification says that secondary mappings should not print SEQ or QUAL to reduce file size */
     /* We can use the XH field in the primary mapping to reconstruct the original sequence */
-    FPRINTF(fp,"\t*\t*");
+    Filestring_put_string(fp,"\t*\t*");
 
   } else {
-    FPRINTF(fp,"\t");
+    PUTC('\t',fp);
     if (path->plusp == true && path->fusion_plusp == true) {
       Shortread_print_chopped_end(fp,queryseq,hardclip_low,hardclip_high);
     } else if (path->plusp == true && path->fusion_plusp == false) {
@@ -1489,9 +1605,9 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
     }
 
     if (Shortread_quality_string(queryseq) == NULL) {
-      FPRINTF(fp,"\t*");
+      Filestring_put_string(fp,"\t*");
     } else {
-      FPRINTF(fp,"\t");
+      PUTC('\t',fp);
       if (path->plusp == true && path->fusion_plusp == true) {
 	Shortread_print_chopped_end_quality(fp,queryseq,hardclip_low,hardclip_high,quality_shift);
       } else if (path->plusp == true && path->fusion_plusp == false) {
@@ -1510,16 +1626,18 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
     /* Previously checked if queryseq_mate == NULL */
     /* Unpaired alignment.  Don't print XM. */
   } else {
-    FPRINTF(fp,"\tXM:Z:");
+    Filestring_put_string(fp,"\tXM:Z:");
     Filestring_merge(fp,mate_cigar_fp);
-    FPRINTF(fp,"\tXD:Z:");
+    Filestring_put_string(fp,"\tXD:Z:");
     Filestring_merge(fp,mate_md_fp);
-    FPRINTF(fp,"\tXN:i:%d",Path_ndiffs(mate));
+    Filestring_put_string(fp,"\tXN:i:");
+    Filestring_put_int(fp,Path_ndiffs(mate));
   }
 
   /* 12. TAGS: RG */
   if (sam_read_group_id != NULL) {
-    FPRINTF(fp,"\tRG:Z:%s",sam_read_group_id);
+    Filestring_put_string(fp,"\tRG:Z:");
+    Filestring_put_string(fp,sam_read_group_id);
   }
 
   /* 12. TAGS: XH and XI.  Not in supplemental */
@@ -1531,7 +1649,7 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
   /* Shortread_print_chop(fp,queryseq,invertp); */
 
   /* 12. TAGS: MD */
-  FPRINTF(fp,"\tMD:Z:");
+  Filestring_put_string(fp,"\tMD:Z:");
   Filestring_merge(fp,md_fp);
 
   /* 12. TAGS: NH.  Not in supplemental */
@@ -1539,20 +1657,24 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
   FPRINTF(fp,"\tHI:i:%d",npaths_primary + npaths_altloc,pathnum);
 
   /* 12. TAGS: NM (mismatches) */
-  FPRINTF(fp,"\tNM:i:%d",Path_ndiffs(path));
+  Filestring_put_string(fp,"\tNM:i:");
+  Filestring_put_int(fp,Path_ndiffs(path));
   
   /* 12. TAGS: XE */
 #ifdef TO_FIX
   if (maskedp) {
-    FPRINTF(fp,"\tXE:i:%d",nmatches_exonic);
+    Filestring_put_string(fp,"\tXE:i:");
+    Filestring_put_int(fp,nmatches_exonic);
   }
 #endif
 
 #ifdef TO_FIX
   if (snps_iit) {
     /* 12. TAGS: XW and XV */
-    FPRINTF(fp,"\tXW:i:%d",nmismatches_bothdiff);
-    FPRINTF(fp,"\tXV:i:%d",nmismatches_refdiff - nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXW:i:");
+    Filestring_put_int(fp,nmismatches_bothdiff);
+    Filestring_put_string(fp,"\tXV:i:");
+    Filestring_put_int(fp,nmismatches_refdiff - nmismatches_bothdiff);
   }
 #endif
 
@@ -1560,7 +1682,8 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
   /* FPRINTF(fp,"\tSM:i:%d\tXQ:i:%d\tX2:i:%d",mapq_score,absmq_score,second_absmq); */
 
   /* 12. TAGS: XO */
-  FPRINTF(fp,"\tXO:Z:%s",abbrev);
+  Filestring_put_string(fp,"\tXO:Z:");
+  Filestring_put_string(fp,abbrev);
 
   /* 12. TAGS: XT */
   /* Add 1 to calls to Intlist_head, but not to Intlist_last_value */
@@ -1770,8 +1893,16 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
 	  fusion_junction->donor1,fusion_junction->donor2,
 	  fusion_junction->acceptor2,fusion_junction->acceptor1,
 	  fusion_junction->donor_prob,fusion_junction->acceptor_prob);
-  FPRINTF(fp,",%c%s@%u..%c%s@%u",donor_strand,donor_chr,donor_chrpos,
-	  acceptor_strand,acceptor_chr,acceptor_chrpos);
+  PUTC(',',fp);
+  PUTC(donor_strand,fp);
+  Filestring_put_string(fp,donor_chr);
+  PUTC('@',fp);
+  Filestring_put_uint(fp,donor_chrpos);
+  Filestring_put_string(fp,"..");
+  PUTC(acceptor_strand,fp);
+  Filestring_put_string(fp,acceptor_chr);
+  PUTC('@',fp);
+  Filestring_put_uint(fp,acceptor_chrpos);
   
 
   /* 12. TAGS: XX, XY */
@@ -1794,38 +1925,42 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
   /* TO_FIX: Use fusion_alts */
   /* 12. TAGS: XA */
   if (path->fusion_alts != NULL) {
-    FPRINTF(fp,"\tXA:Z:");
+    Filestring_put_string(fp,"\tXA:Z:");
 
     if (path->plusp == true) {
       alts_coords = path->qstart_alts->coords;
       n = path->qstart_alts->ncoords;
 #ifdef PRINT_ALTS_COORDS
-      FPRINTF(fp,"%u",alts_coords[0] - path->chroffset + 1U);
+      Filestring_put_uint(fp,alts_coords[0] - path->chroffset + 1U);
       for (i = 1; i < n; i++) {
-	FPRINTF(fp,",%u",alts_coords[i] - path->chroffset + 1U);
+	PUTC(',',fp);
+	Filestring_put_uint(fp,alts_coords[i] - path->chroffset + 1U);
       }
 #else
       splicecoord = Univcoordlist_head(path->univdiagonals) - path->querylength + Intlist_head(path->endpoints);
-      FPRINTF(fp,"%u",splicecoord - alts_coords[0]);
+      Filestring_put_uint(fp,splicecoord - alts_coords[0]);
       for (i = 1; i < n; i++) {
-	FPRINTF(fp,",%u",splicecoord - alts_coords[i]);
+	PUTC(',',fp);
+	Filestring_put_uint(fp,splicecoord - alts_coords[i]);
       }
 #endif
     }
-    FPRINTF(fp,"|");
+    PUTC('|',fp);
     if (path->qend_alts != NULL) {
       alts_coords = path->qend_alts->coords;
       n = path->qend_alts->ncoords;
 #ifdef PRINT_ALTS_COORDS
-      FPRINTF(fp,"%u",alts_coords[0] - path->chroffset + 1U);
+      Filestring_put_uint(fp,alts_coords[0] - path->chroffset + 1U);
       for (i = 1; i < n; i++) {
-	FPRINTF(fp,",%u",alts_coords[i] - path->chroffset + 1U);
+	PUTC(',',fp);
+	Filestring_put_uint(fp,alts_coords[i] - path->chroffset + 1U);
       }
 #else
       splicecoord = Univcoordlist_last_value(path->univdiagonals) - path->querylength + Intlist_last_value(path->endpoints);
-      FPRINTF(fp,"%u",alts_coords[0] - splicecoord);
+      Filestring_put_uint(fp,alts_coords[0] - splicecoord);
       for (i = 1; i < n; i++) {
-	FPRINTF(fp,",%u",alts_coords[i] - splicecoord);
+	PUTC(',',fp);
+	Filestring_put_uint(fp,alts_coords[i] - splicecoord);
       }
 #endif
     }
@@ -1837,7 +1972,7 @@ print_fusion (Filestring_T fp, char *abbrev, T path,
     Single_cell_print_fields(fp,single_cell_infoseq);
   }
 
-  FPRINTF(fp,"\n");
+  PUTC('\n',fp);
 
   Filestring_free(&mate_md_fp,/*free_string_p*/true);
   Filestring_free(&md_fp,/*free_string_p*/true);
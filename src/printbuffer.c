@@ -11,6 +11,7 @@ static char rcsid[] = "$Id: 2dd3ad12e9b7a144f7cd36167c6a4d1ed9b0416e $";
 #include "mem.h"
 #include "list.h"
 #include "samheader.h"
+#include "outwriter.h"
 
 
 /* If we define USE_SETVBUF in outbuffer.c, this value may need to match */
@@ -294,7 +295,7 @@ print_lines (FILE *fp_output, List_T *output_list, List_T *tail) {
 #ifdef USE_WRITE
 	write(fileno(fp_output),buffer,OUTPUTLEN*sizeof(char));
 #else
-	fwrite(buffer,sizeof(char),OUTPUTLEN,fp_output);
+	Outwriter_fwrite(buffer,sizeof(char),OUTPUTLEN,fp_output);
 #endif
 
 	ptr = &(buffer[0]);
@@ -316,7 +317,7 @@ print_lines (FILE *fp_output, List_T *output_list, List_T *tail) {
 #ifdef USE_WRITE
     write(fileno(fp_output),buffer,total_linelength*sizeof(char));
 #else
-    fwrite(buffer,sizeof(char),total_linelength,fp_output);
+    Outwriter_fwrite(buffer,sizeof(char),total_linelength,fp_output);
 #endif
   }
 
@@ -364,7 +365,7 @@ print_lines (FILE *fp_output, List_T *output_list, List_T *tail) {
 #ifdef USE_WRITE
   write(fileno(fp_output),buffer,total_linelength*sizeof(char));
 #else
-  fwrite(buffer,sizeof(char),total_linelength,fp_output);
+  Outwriter_fwrite(buffer,sizeof(char),total_linelength,fp_output);
 #endif
 
   FREE_OUT(buffer);
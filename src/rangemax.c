@@ -0,0 +1,181 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "rangemax.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <limits.h>		/* For INT_MIN */
+#include "mem.h"
+#include "bool.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+
+#define T Rangemax_T
+struct T {
+  int n;
+  int nleaves;			/* Power of 2 */
+
+  /* Node i has children 2i and 2i+1.  Leaf for index k is at
+     nleaves + k.  Unused leaves hold INT_MIN. */
+  int *maxima;
+
+  int *hits;
+  Chrpos_T *positions;
+};
+
+
+void
+Rangemax_free (T *old) {
+  if (*old) {
+    FREE((*old)->positions);
+    FREE((*old)->hits);
+    FREE((*old)->maxima);
+    FREE(*old);
+  }
+  return;
+}
+
+
+/* Takes ownership of hits and positions.  scores is copied. */
+T
+Rangemax_new (int *hits, Chrpos_T *positions, int *scores, int n) {
+  T new = (T) MALLOC(sizeof(*new));
+  int node, k;
+
+  new->n = n;
+  new->nleaves = 1;
+  while (new->nleaves < n) {
+    new->nleaves *= 2;
+  }
+
+  new->maxima = (int *) MALLOC(2*new->nleaves*sizeof(int));
+  for (k = 0; k < n; k++) {
+    new->maxima[new->nleaves + k] = scores[k];
+  }
+  for ( ; k < new->nleaves; k++) {
+    new->maxima[new->nleaves + k] = INT_MIN;
+  }
+  for (node = new->nleaves - 1; node >= 1; node--) {
+    if (new->maxima[2*node] >= new->maxima[2*node+1]) {
+      new->maxima[node] = new->maxima[2*node];
+    } else {
+      new->maxima[node] = new->maxima[2*node+1];
+    }
+  }
+
+  new->hits = hits;
+  new->positions = positions;
+
+  return new;
+}
+
+
+int
+Rangemax_length (T this) {
+  return this->n;
+}
+
+/* Returns the index of hit, which must be in the tree */
+int
+Rangemax_index (T this, int hit) {
+  int lowi = 0, highi = this->n - 1, middlei;
+  bool ascendingp = (this->hits[0] <= this->hits[this->n - 1]);
+
+  while (lowi < highi) {
+    middlei = lowi + (highi - lowi)/2;
+    if (this->hits[middlei] == hit) {
+      return middlei;
+    } else if ((this->hits[middlei] < hit) == ascendingp) {
+      lowi = middlei + 1;
+    } else {
+      highi = middlei - 1;
+    }
+  }
+
+  debug(if (this->hits[lowi] != hit) {
+      printf("Rangemax_index: hit %d not found\n",hit);
+      abort();
+    });
+  return lowi;
+}
+
+int
+Rangemax_hit (T this, int index) {
+  return this->hits[index];
+}
+
+Chrpos_T
+Rangemax_position (T this, int index) {
+  return this->positions[index];
+}
+
+int
+Rangemax_score (T this, int index) {
+  return this->maxima[this->nleaves + index];
+}
+
+
+/* Returns the highest score for indices lo..hi-1 */
+int
+Rangemax_max (T this, int lo, int hi) {
+  int max = INT_MIN;
+
+  lo += this->nleaves;
+  hi += this->nleaves;
+  while (lo < hi) {
+    if (lo & 1) {
+      if (this->maxima[lo] > max) {
+	max = this->maxima[lo];
+      }
+      lo++;
+    }
+    if (hi & 1) {
+      hi--;
+      if (this->maxima[hi] > max) {
+	max = this->maxima[hi];
+      }
+    }
+    lo >>= 1;
+    hi >>= 1;
+  }
+
+  return max;
+}
+
+
+static int
+first_atleast (int *maxima, int node, int nodelo, int nodehi,
+	       int lo, int hi, int threshold) {
+  int middle, index;
+
+  if (nodehi <= lo || hi <= nodelo || maxima[node] < threshold) {
+    return -1;
+  } else if (nodehi - nodelo == 1) {
+    return nodelo;
+  } else {
+    middle = nodelo + (nodehi - nodelo)/2;
+    if ((index = first_atleast(maxima,2*node,nodelo,middle,lo,hi,threshold)) >= 0) {
+      return index;
+    } else {
+      return first_atleast(maxima,2*node+1,middle,nodehi,lo,hi,threshold);
+    }
+  }
+}
+
+/* Returns the lowest index in lo..hi-1 with a score of at least
+   threshold, or -1 if there is none */
+int
+Rangemax_first_atleast (T this, int lo, int hi, int threshold) {
+  return first_atleast(this->maxima,/*node*/1,/*nodelo*/0,/*nodehi*/this->nleaves,
+		       lo,hi,threshold);
+}
+
@@ -0,0 +1,45 @@
+/* $Id$ */
+#ifndef RANGEMAX_INCLUDED
+#define RANGEMAX_INCLUDED
+
+#include "genomicpos.h"
+
+
+/* Range-maximum tree over the active hits at one querypos, used by
+   the sparse chainer in Stage 2.  Hits are kept in the order of the
+   active list, so positions are ascending for lookback and descending
+   for lookforward.  Queries are on indices into that order. */
+
+#define T Rangemax_T
+typedef struct T *T;
+
+extern void
+Rangemax_free (T *old);
+
+extern T
+Rangemax_new (int *hits, Chrpos_T *positions, int *scores, int n);
+
+extern int
+Rangemax_length (T this);
+
+extern int
+Rangemax_index (T this, int hit);
+
+extern int
+Rangemax_hit (T this, int index);
+
+extern Chrpos_T
+Rangemax_position (T this, int index);
+
+extern int
+Rangemax_score (T this, int index);
+
+extern int
+Rangemax_max (T this, int lo, int hi);
+
+extern int
+Rangemax_first_atleast (T this, int lo, int hi, int threshold);
+
+#undef T
+#endif
+
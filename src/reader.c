@@ -75,6 +75,18 @@ Reader_new (char *sequence, int querystart, int queryend, int oligosize) {
   return new;
 }
 
+/* Points an existing reader at a new sequence */
+void
+Reader_reinit (T this, char *sequence, int querystart, int queryend) {
+  this->querystart_save = this->querystart = querystart;
+  this->queryend_save = this->queryend = queryend;
+
+  this->startinit = sequence;
+  this->startbound = this->startptr = &(sequence[querystart]);
+  this->endbound = this->endptr = &(sequence[queryend-1]);
+  return;
+}
+
 void
 Reader_free (T *old) {
   if (*old) {
@@ -67,6 +67,8 @@ Reader_reset_ends (T this);
 extern T
 Reader_new (char *sequence, int querystart, int queryend, int oligosize);
 extern void
+Reader_reinit (T this, char *sequence, int querystart, int queryend);
+extern void
 Reader_free (T *old);
 
 #ifndef GSNAP
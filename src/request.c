@@ -25,6 +25,7 @@ struct T {
 #elif defined(GEXACT)
   Shortread_T queryseq1;
 #elif defined(GSNAP)
+  unsigned int inputid;		/* Position in the full input, before --part and filtering */
   Shortread_T queryseq1;
   Shortread_T queryseq2;
 #else
@@ -71,6 +72,13 @@ Request_free (T *old) {
 
 #elif defined(GSNAP) || defined(GFILTER)
 
+#if defined(GSNAP)
+unsigned int
+Request_inputid (T this) {
+  return this->inputid;
+}
+#endif
+
 Shortread_T
 Request_queryseq1 (T this) {
   return this->queryseq1;
@@ -82,10 +90,13 @@ Request_queryseq2 (T this) {
 }
 
 T
-Request_new (unsigned int id, Shortread_T queryseq1, Shortread_T queryseq2) {
+Request_new (unsigned int id, unsigned int inputid, Shortread_T queryseq1, Shortread_T queryseq2) {
   T new = (T) MALLOC_IN(sizeof(*new));
 
   new->id = id;
+#if defined(GSNAP)
+  new->inputid = inputid;
+#endif
   new->queryseq1 = queryseq1;
   new->queryseq2 = queryseq2;
   return new;
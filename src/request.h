@@ -29,12 +29,16 @@ Request_new (unsigned int id, Shortread_T queryseq1);
 
 #elif defined(GSNAP) || defined(GFILTER)
 
+#if defined(GSNAP)
+extern unsigned int
+Request_inputid (T this);
+#endif
 extern Shortread_T
 Request_queryseq1 (T this);
 extern Shortread_T
 Request_queryseq2 (T this);
 extern T
-Request_new (unsigned int id, Shortread_T queryseq1, Shortread_T queryseq2);
+Request_new (unsigned int id, unsigned int inputid, Shortread_T queryseq1, Shortread_T queryseq2);
 
 #else
 
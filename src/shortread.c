@@ -4726,13 +4726,13 @@ Shortread_print_oneline (Filestring_T fp, T this) {
   int i = 0;
 
   for (i = 0; i < this->left_choplength; i++) {
-    FPRINTF(fp,"%c",this->left_chop[i]);
+    PUTC(this->left_chop[i],fp);
   }
   for (i = 0; i < this->fulllength; i++) {
-    FPRINTF(fp,"%c",this->contents[i]);
+    PUTC(this->contents[i],fp);
   }
   for (i = 0; i < this->right_choplength; i++) {
-    FPRINTF(fp,"%c",this->right_chop[i]);
+    PUTC(this->right_chop[i],fp);
   }
 
   return;
@@ -4745,7 +4745,7 @@ Shortread_print_oneline_revcomp (Filestring_T fp, T this) {
 
 #if 0
   for (i = this->fulllength-1; i >= 0; --i) {
-    FPRINTF(fp,"%c",complCode[(int) this->contents[i]]);
+    PUTC(complCode[(int) this->contents[i]],fp);
   }
 #else
   FPRINTF(fp,"%.*R",this->fulllength,this->contents);
@@ -4753,7 +4753,7 @@ Shortread_print_oneline_revcomp (Filestring_T fp, T this) {
 
 #if 0
   for (i = this->choplength-1; i >= 0; --i) {
-    FPRINTF(fp,"%c",complCode[(int) this->chop[i]]);
+    PUTC(complCode[(int) this->chop[i]],fp);
   }
 #else
   FPRINTF(fp,"%.*R",this->left_choplength,this->left_chop);
@@ -4770,11 +4770,11 @@ Shortread_print_chopped_sam (Filestring_T fp, T this, int hardclip_low, int hard
 #endif
 
 #ifdef PRINT_INDIVIDUAL_CHARS
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
   for (i = hardclip_low; i < this->fulllength - hardclip_high; i++) {
-    FPRINTF(fp,"%c",this->contents[i]);
+    PUTC(this->contents[i],fp);
   }
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
 #else
   FPRINTF(fp,"\t%.*s\t",this->fulllength - hardclip_high - hardclip_low,&(this->contents[hardclip_low]));
 #endif
@@ -4786,11 +4786,11 @@ void
 Shortread_print_chopped_revcomp_sam (Filestring_T fp, T this, int hardclip_low, int hardclip_high) {
 
 #ifdef PRINT_INDIVIDUAL_CHARS
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
   for (i = this->fulllength - 1 - hardclip_low; i >= hardclip_high; --i) {
-    FPRINTF(fp,"%c",complCode[(int) this->contents[i]]);
+    PUTC(complCode[(int) this->contents[i]],fp);
   }
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
 #else
   FPRINTF(fp,"\t%.*R\t",this->fulllength - hardclip_high - hardclip_low,&(this->contents[hardclip_high]));
 #endif
@@ -4810,13 +4810,13 @@ Shortread_print_hardclipped_sam (Filestring_T fp, T this, int hardclip_low, int
     hardclip_high -= this->right_choplength;
   }
 
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
   if (this->left_chop != NULL && hardclip_low == 0) {
-    FPRINTF(fp,"%s",this->left_chop);
+    Filestring_put_string(fp,this->left_chop);
   }
   FPRINTF(fp,"%.*s",this->fulllength - hardclip_high - hardclip_low,&(this->contents[hardclip_low]));
   if (this->right_chop != NULL && hardclip_high == 0) {
-    FPRINTF(fp,"%s",this->right_chop);
+    Filestring_put_string(fp,this->right_chop);
   }
 
   return;
@@ -4834,7 +4834,7 @@ Shortread_print_hardclipped_revcomp_sam (Filestring_T fp, T this, int hardclip_l
     hardclip_high -= this->left_choplength;
   }
 
-  FPRINTF(fp,"\t");
+  PUTC('\t',fp);
   if (this->right_chop != NULL && hardclip_low == 0) {
     FPRINTF(fp,"%R",this->right_chop);
   }
@@ -4855,7 +4855,7 @@ Shortread_print_hardclipped_quality (Filestring_T fp, T this, int hardclip_low,
   int c;
 
   if (this->quality == NULL) {
-    FPRINTF(fp,"\t*");
+    Filestring_put_string(fp,"\t*");
 
   } else {
     if (this->left_chop_quality != NULL && hardclip_low > 0) {
@@ -4866,23 +4866,23 @@ Shortread_print_hardclipped_quality (Filestring_T fp, T this, int hardclip_low,
     }
 
     if (shift == 0) {
-      FPRINTF(fp,"\t");
+      PUTC('\t',fp);
       if (this->left_chop_quality != NULL && hardclip_low == 0) {
-	FPRINTF(fp,"%s",this->left_chop_quality);
+	Filestring_put_string(fp,this->left_chop_quality);
       }
       FPRINTF(fp,"%.*s",this->fulllength - hardclip_high - hardclip_low,&(this->quality[hardclip_low]));
       if (this->right_chop_quality != NULL && hardclip_high == 0) {
-	FPRINTF(fp,"%s",this->right_chop_quality);
+	Filestring_put_string(fp,this->right_chop_quality);
       }
 
     } else {
-      FPRINTF(fp,"\t");
+      PUTC('\t',fp);
       if (this->left_chop_quality != NULL && hardclip_low == 0) {
 	for (i = 0; i < this->left_choplength; i++) {
 	  if ((c = this->left_chop_quality[i] + shift) <= 32) {
 	    abort();
 	  } else {
-	    FPRINTF(fp,"%c",c);
+	    PUTC(c,fp);
 	  }
 	}
       }
@@ -4891,7 +4891,7 @@ Shortread_print_hardclipped_quality (Filestring_T fp, T this, int hardclip_low,
 	if ((c = this->quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
 
@@ -4900,7 +4900,7 @@ Shortread_print_hardclipped_quality (Filestring_T fp, T this, int hardclip_low,
 	  if ((c = this->right_chop_quality[i] + shift) <= 32) {
 	    abort();
 	  } else {
-	    FPRINTF(fp,"%c",c);
+	    PUTC(c,fp);
 	  }
 	}
       }
@@ -4919,7 +4919,7 @@ Shortread_print_hardclipped_reverse_quality (Filestring_T fp, T this, int hardcl
   int c;
 
   if (this->quality == NULL) {
-    FPRINTF(fp,"\t*");
+    Filestring_put_string(fp,"\t*");
 
   } else {
     /* Hardclip on same side as chop includes choplength */
@@ -4931,7 +4931,7 @@ Shortread_print_hardclipped_reverse_quality (Filestring_T fp, T this, int hardcl
     }
 
     if (shift == 0) {
-      FPRINTF(fp,"\t");
+      PUTC('\t',fp);
       if (this->right_chop != NULL && hardclip_low == 0) {
 	FPRINTF(fp,"%r",this->right_chop_quality);
       }
@@ -4941,13 +4941,13 @@ Shortread_print_hardclipped_reverse_quality (Filestring_T fp, T this, int hardcl
       }
 
     } else {
-      FPRINTF(fp,"\t");
+      PUTC('\t',fp);
       if (this->right_chop_quality != NULL && hardclip_low == 0) {
 	for (i = this->right_choplength - 1; i >= 0; --i) {
 	  if ((c = this->right_chop_quality[i] + shift) <= 32) {
 	    abort();
 	  } else {
-	    FPRINTF(fp,"%c",c);
+	    PUTC(c,fp);
 	  }
 	}
       }
@@ -4956,7 +4956,7 @@ Shortread_print_hardclipped_reverse_quality (Filestring_T fp, T this, int hardcl
 	if ((c = this->quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
 
@@ -4965,7 +4965,7 @@ Shortread_print_hardclipped_reverse_quality (Filestring_T fp, T this, int hardcl
 	  if ((c = this->left_chop_quality[i] + shift) <= 32) {
 	    abort();
 	  } else {
-	    FPRINTF(fp,"%c",c);
+	    PUTC(c,fp);
 	  }
 	}
       }
@@ -4986,7 +4986,7 @@ Shortread_print_chopped_end (Filestring_T fp, T this, int hardclip_low, int hard
       FPRINTF(fp,"%.*s",hardclip_low,&(this->contents[0]));
     } else {
       hardclip_low -= this->left_choplength;
-      FPRINTF(fp,"%s",this->left_chop);
+      Filestring_put_string(fp,this->left_chop);
       FPRINTF(fp,"%.*s",hardclip_low,&(this->contents[0]));
     }
     
@@ -4996,7 +4996,7 @@ Shortread_print_chopped_end (Filestring_T fp, T this, int hardclip_low, int hard
     } else {
       hardclip_high -= this->right_choplength;
       FPRINTF(fp,"%.*s",hardclip_high,&(this->contents[this->fulllength - hardclip_high]));
-      FPRINTF(fp,"%s",this->right_chop);
+      Filestring_put_string(fp,this->right_chop);
     }
   }
 
@@ -5037,7 +5037,7 @@ Shortread_print_chopped_end_quality (Filestring_T fp, T this, int hardclip_low,
   int c;
 
   if (this->quality == NULL) {
-    FPRINTF(fp,"*");
+    PUTC('*',fp);
     return;
 
   } else if (hardclip_low > 0) {
@@ -5046,7 +5046,7 @@ Shortread_print_chopped_end_quality (Filestring_T fp, T this, int hardclip_low,
 	FPRINTF(fp,"%.*s",hardclip_low,&(this->quality[0]));
       } else {
 	hardclip_low -= this->left_choplength;
-	FPRINTF(fp,"%s",this->left_chop_quality);
+	Filestring_put_string(fp,this->left_chop_quality);
 	FPRINTF(fp,"%.*s",hardclip_low,&(this->quality[0]));
       }
 
@@ -5056,14 +5056,14 @@ Shortread_print_chopped_end_quality (Filestring_T fp, T this, int hardclip_low,
 	if ((c = this->left_chop_quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
       for (i = 0; i < hardclip_low; i++) {
 	if ((c = this->quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
     }
@@ -5075,7 +5075,7 @@ Shortread_print_chopped_end_quality (Filestring_T fp, T this, int hardclip_low,
       } else {
 	hardclip_high -= this->right_choplength;
 	FPRINTF(fp,"%.*s",hardclip_high,&(this->quality[this->fulllength - hardclip_high]));
-	FPRINTF(fp,"%s",this->right_chop_quality);
+	Filestring_put_string(fp,this->right_chop_quality);
       }
     } else {
       hardclip_high -= this->right_choplength;
@@ -5083,14 +5083,14 @@ Shortread_print_chopped_end_quality (Filestring_T fp, T this, int hardclip_low,
 	if ((c = this->quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
       for (i = 0; i < this->right_choplength; i++) {
 	if ((c = this->right_chop_quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
     }
@@ -5108,7 +5108,7 @@ Shortread_print_chopped_end_quality_reverse (Filestring_T fp, T this, int hardcl
   int c;
 
   if (this->quality == NULL) {
-    FPRINTF(fp,"*");
+    PUTC('*',fp);
     return;
 
   } else if (hardclip_low > 0) {
@@ -5127,14 +5127,14 @@ Shortread_print_chopped_end_quality_reverse (Filestring_T fp, T this, int hardcl
 	if ((c = this->right_chop_quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
       for (i = this->fulllength - 1; i >= this->fulllength - hardclip_low; --i) {
 	if ((c = this->quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
     }
@@ -5155,14 +5155,14 @@ Shortread_print_chopped_end_quality_reverse (Filestring_T fp, T this, int hardcl
 	if ((c = this->quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
       for (i = this->left_choplength - 1; i >= 0; --i) {
 	if ((c = this->left_chop_quality[i] + shift) <= 32) {
 	  abort();
 	} else {
-	  FPRINTF(fp,"%c",c);
+	  PUTC(c,fp);
 	}
       }
     }
@@ -5176,7 +5176,8 @@ void
 Shortread_print_barcode (Filestring_T fp, T this) {
 
   if (this->barcode != NULL) {
-    FPRINTF(fp,"\tXB:Z:%s",this->barcode);
+    Filestring_put_string(fp,"\tXB:Z:");
+    Filestring_put_string(fp,this->barcode);
   }
     
   return;
@@ -5186,13 +5187,13 @@ void
 Shortread_print_chop (Filestring_T fp, T this, bool invertp) {
 
   if (this->right_chop != NULL) {
-    FPRINTF(fp,"\tXP:Z:");
+    Filestring_put_string(fp,"\tXP:Z:");
     if (invertp == false) {
       FPRINTF(fp,"%.*s",this->right_choplength,this->right_chop);
     } else {
 #ifdef PRINT_INDIVIDUAL_CHARS
       for (i = this->right_choplength - 1; i >= 0; i--) {
-	FPRINTF(fp,"%c",complCode[(int) this->right_chop[i]]);
+	PUTC(complCode[(int) this->right_chop[i]],fp);
       }
 #else
       FPRINTF(fp,"%.*R",this->right_choplength,this->right_chop);
@@ -5209,7 +5210,7 @@ Shortread_print_left_chop_symbols (Filestring_T fp, T this) {
   int i;
 
   for (i = 0; i < this->left_choplength; i++) {
-    FPRINTF(fp,"*");
+    PUTC('*',fp);
   }
   return;
 }
@@ -5220,7 +5221,7 @@ Shortread_print_right_chop_symbols (Filestring_T fp, T this) {
   int i;
 
   for (i = 0; i < this->right_choplength; i++) {
-    FPRINTF(fp,"*");
+    PUTC('*',fp);
   }
   return;
 }
@@ -5233,7 +5234,7 @@ Shortread_print_quality (Filestring_T fp, T this, int hardclip_low, int hardclip
   int c;
 
   if (this->quality == NULL) {
-    FPRINTF(fp,"*");
+    PUTC('*',fp);
 
   } else if (shift == 0) {
     FPRINTF(fp,"%.*s",this->fulllength - hardclip_high - hardclip_low,&(this->quality[hardclip_low]));
@@ -5245,7 +5246,7 @@ Shortread_print_quality (Filestring_T fp, T this, int hardclip_low, int hardclip
 		shift,this->quality[i]);
 	abort();
       } else {
-	FPRINTF(fp,"%c",c);
+	PUTC(c,fp);
       }
     }
 
@@ -5261,7 +5262,7 @@ Shortread_print_quality (Filestring_T fp, T this, int hardclip_low, int hardclip
 		    shift,this->right_chop_quality[i]);
 	    abort();
 	  } else {
-	    FPRINTF(fp,"%c",c);
+	    PUTC(c,fp);
 	  }
 	}
       }
@@ -5279,7 +5280,7 @@ Shortread_print_quality_revcomp (Filestring_T fp, T this, int hardclip_low, int
   int c;
 
   if (this->quality == NULL) {
-    FPRINTF(fp,"*");
+    PUTC('*',fp);
 
   } else if (shift == 0) {
     FPRINTF(fp,"%.*r",this->fulllength - hardclip_low - hardclip_high,&(this->quality[hardclip_high]));
@@ -5291,7 +5292,7 @@ Shortread_print_quality_revcomp (Filestring_T fp, T this, int hardclip_low, int
 		shift,this->quality[i]);
 	abort();
       } else {
-	FPRINTF(fp,"%c",c);
+	PUTC(c,fp);
       }
     }
 
@@ -5307,7 +5308,7 @@ Shortread_print_quality_revcomp (Filestring_T fp, T this, int hardclip_low, int
 		    shift,this->right_chop_quality[i]);
 	    abort();
 	  } else {
-	    FPRINTF(fp,"%c",c);
+	    PUTC(c,fp);
 	  }
 	}
       }
@@ -5323,19 +5324,19 @@ Shortread_print_subseq_uc (Filestring_T fp, T this, int querystart, int queryend
   int i;
 
   for (i = 0; i < querystart; i++) {
-    FPRINTF(fp,"-");
+    PUTC('-',fp);
   }
 
 #ifdef PRINT_INDIVIDUAL_CHARS
   for ( ; i < queryend; i++) {
-    FPRINTF(fp,"%c",this->contents_uc[i]);
+    PUTC(this->contents_uc[i],fp);
   }
 #else
   FPRINTF(fp,"%.*s",queryend - querystart,&(this->contents_uc[querystart]));
 #endif
 
   for (i = queryend; i < this->fulllength; i++) {
-    FPRINTF(fp,"-");
+    PUTC('-',fp);
   }
 
   return;
@@ -5347,19 +5348,19 @@ Shortread_print_subseq_revcomp_uc (Filestring_T fp, T this, int querystart, int
   int i;
 
   for (i = this->fulllength-1; i >= queryend; --i) {
-    FPRINTF(fp,"-");
+    PUTC('-',fp);
   }
 
 #ifdef PRINT_INDIVIDUAL_CHARS
   for (i = queryend-1; i >= querystart; --i) {
-    FPRINTF(fp,"%c",complCode[(int) this->contents_uc[i]]);
+    PUTC(complCode[(int) this->contents_uc[i]],fp);
   }
 #else
   FPRINTF(fp,"%.*R",queryend - querystart,&(this->contents_uc[querystart]));
 #endif
 
   for (i = querystart-1; i >= 0; --i) {
-    FPRINTF(fp,"-");
+    PUTC('-',fp);
   }
 
   return;
@@ -0,0 +1,558 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "snapshot.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>		/* For strerror */
+#include <errno.h>
+#include <time.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
+#ifdef HAVE_SYS_TYPES_H
+#include <sys/types.h>
+#endif
+#ifdef HAVE_SYS_STAT_H
+#include <sys/stat.h>
+#endif
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h>
+#endif
+#ifdef HAVE_DIRENT_H
+#include <dirent.h>
+#endif
+#include <sys/mman.h>
+#include <sys/file.h>		/* For flock */
+
+#include "assert.h"
+#include "mem.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+#define LOCKS_FILE "/proc/locks"
+
+#ifdef __APPLE__
+#define MTIME_NSEC(sb) ((sb)->st_mtimespec.tv_nsec)
+#else
+#define MTIME_NSEC(sb) ((sb)->st_mtim.tv_nsec)
+#endif
+
+
+static char *
+snapshot_name (char *snapshot_dir, char *filename, struct stat *sb) {
+  char *name, *basename;
+
+  if ((basename = strrchr(filename,'/')) == NULL) {
+    basename = filename;
+  } else {
+    basename++;
+  }
+
+  name = (char *) MALLOC((strlen(snapshot_dir)+strlen("/")+strlen(SNAPSHOT_PREFIX)+strlen(basename)+
+			  5*(16+1)+strlen(SNAPSHOT_SUFFIX)+1)*sizeof(char));
+  sprintf(name,"%s/%s%s.%llx-%llx-%llx.%llx-%llx%s",snapshot_dir,SNAPSHOT_PREFIX,basename,
+	  (unsigned long long) sb->st_dev,(unsigned long long) sb->st_ino,
+	  (unsigned long long) sb->st_mtime,(unsigned long long) MTIME_NSEC(sb),
+	  (unsigned long long) sb->st_size,SNAPSHOT_SUFFIX);
+  return name;
+}
+
+/* Whether the trailer was made from the source file as it is now.
+   The size and nanoseconds catch a file rewritten in place within the
+   same second. */
+static bool
+source_current_p (struct Snapshot_trailer_T *trailer, struct stat *sb) {
+  if (trailer->source_dev != (UINT8) sb->st_dev || trailer->source_ino != (UINT8) sb->st_ino) {
+    return false;
+  } else if (trailer->source_mtime != (UINT8) sb->st_mtime ||
+	     trailer->source_mtime_nsec != (UINT8) MTIME_NSEC(sb)) {
+    return false;
+  } else if (trailer->source_size != (UINT8) sb->st_size) {
+    return false;
+  } else {
+    return true;
+  }
+}
+
+static char *
+snapshot_path (char *snapshot_dir, char *name) {
+  char *path;
+
+  if (strchr(name,'/') != NULL) {
+    path = (char *) MALLOC((strlen(name)+1)*sizeof(char));
+    strcpy(path,name);
+  } else {
+    path = (char *) MALLOC((strlen(snapshot_dir)+strlen("/")+strlen(name)+1)*sizeof(char));
+    sprintf(path,"%s/%s",snapshot_dir,name);
+  }
+  return path;
+}
+
+
+/* 64-bit FNV-1a, taken a word at a time */
+static UINT8
+checksum (unsigned char *memory, size_t len) {
+  UINT8 hash = 0xcbf29ce484222325ULL, word;
+  size_t i;
+
+  for (i = 0; i + sizeof(UINT8) <= len; i += sizeof(UINT8)) {
+    memcpy(&word,&(memory[i]),sizeof(UINT8));
+    hash = (hash ^ word) * 0x100000001b3ULL;
+  }
+  for ( ; i < len; i++) {
+    hash = (hash ^ memory[i]) * 0x100000001b3ULL;
+  }
+
+  return hash;
+}
+
+
+/* Counts the shared flocks on the inode.  Returns -1 if the
+   information is not available. */
+static int
+snapshot_nusers (ino_t ino) {
+  FILE *fp;
+  char line[1024], locktype[32], mode[32];
+  unsigned long long lock_ino;
+  int nusers = 0;
+
+  if ((fp = fopen(LOCKS_FILE,"r")) == NULL) {
+    return -1;
+  } else {
+    /* Lines look like "1: FLOCK  ADVISORY  READ  1234 00:19:5678 0 EOF" */
+    while (fgets(line,1024,fp) != NULL) {
+      if (sscanf(line,"%*d: %31s %*s %31s %*d %*x:%*x:%llu",locktype,mode,&lock_ino) == 3 &&
+	  !strcmp(locktype,"FLOCK") && !strcmp(mode,"READ") && lock_ino == (unsigned long long) ino) {
+	nusers++;
+      }
+    }
+    fclose(fp);
+    return nusers;
+  }
+}
+
+
+static bool
+read_trailer (struct Snapshot_trailer_T *trailer, int fd, off_t filesize) {
+  if (filesize < (off_t) sizeof(struct Snapshot_trailer_T)) {
+    return false;
+  } else if (pread(fd,trailer,sizeof(struct Snapshot_trailer_T),
+		   filesize - sizeof(struct Snapshot_trailer_T)) != sizeof(struct Snapshot_trailer_T)) {
+    return false;
+  } else if (memcmp(trailer->magic,SNAPSHOT_MAGIC,8) || trailer->format != SNAPSHOT_FORMAT) {
+    return false;
+  } else if (trailer->len + sizeof(struct Snapshot_trailer_T) != (UINT8) filesize) {
+    return false;
+  } else {
+    trailer->source[SNAPSHOT_MAXPATH-1] = '\0';
+    return true;
+  }
+}
+
+
+/* Returns a read-only mapping of the contents of a current snapshot
+   of filename, or NULL if there is none.  The caller releases the
+   snapshot with munmap(memory,len) and close(fd). */
+void *
+Snapshot_attach (int *fd, int *nusers, char *snapshot_dir, char *filename, size_t len, size_t eltsize) {
+  void *memory;
+  struct Snapshot_trailer_T trailer;
+  struct stat sb, snapshot_sb;
+  char *name;
+
+  if (stat(filename,&sb) != 0) {
+    return (void *) NULL;
+  }
+
+  name = snapshot_name(snapshot_dir,filename,&sb);
+  if ((*fd = open(name,O_RDONLY,0764)) < 0) {
+    FREE(name);
+    return (void *) NULL;
+  }
+  FREE(name);
+
+  if (flock(*fd,LOCK_SH) != 0 || fstat(*fd,&snapshot_sb) != 0 ||
+      read_trailer(&trailer,*fd,snapshot_sb.st_size) == false) {
+    close(*fd);
+    return (void *) NULL;
+  } else if (trailer.len != (UINT8) len || trailer.eltsize != (UINT4) eltsize ||
+	     source_current_p(&trailer,&sb) == false) {
+    close(*fd);
+    return (void *) NULL;
+  } else if ((memory = mmap(NULL,len,PROT_READ,MAP_SHARED,*fd,0)) == MAP_FAILED) {
+    close(*fd);
+    return (void *) NULL;
+  } else {
+    *nusers = snapshot_nusers(snapshot_sb.st_ino);
+    return memory;
+  }
+}
+
+
+/* Returns a writable mapping of len bytes for a new snapshot of
+   filename, to be filled by the caller and then passed to
+   Snapshot_create_commit, or NULL if the snapshot directory cannot
+   hold it */
+void *
+Snapshot_create_begin (int *fd, char **tmpfile, char *snapshot_dir, char *filename, size_t len) {
+  void *memory;
+  struct stat sb;
+  char *name;
+  int error;
+
+  if (stat(filename,&sb) != 0) {
+    return (void *) NULL;
+  }
+
+  name = snapshot_name(snapshot_dir,filename,&sb);
+  *tmpfile = (char *) MALLOC((strlen(name)+strlen(".tmp.")+20+1)*sizeof(char));
+  sprintf(*tmpfile,"%s.tmp.%ld",name,(long) getpid());
+  FREE(name);
+
+  if ((*fd = open(*tmpfile,O_RDWR | O_CREAT | O_EXCL,0644)) < 0) {
+    fprintf(stderr,"Cannot create snapshot file %s: %s\n",*tmpfile,strerror(errno));
+    FREE(*tmpfile);
+    return (void *) NULL;
+  }
+
+  /* Reserve the space now, since running out of space in a tmpfs
+     mapping gives a SIGBUS */
+  if ((error = posix_fallocate(*fd,0,len + sizeof(struct Snapshot_trailer_T))) != 0) {
+    fprintf(stderr,"Cannot reserve %llu bytes for snapshot file %s: %s\n",
+	    (unsigned long long) (len + sizeof(struct Snapshot_trailer_T)),*tmpfile,strerror(error));
+    close(*fd);
+    unlink(*tmpfile);
+    FREE(*tmpfile);
+    return (void *) NULL;
+  } else if ((memory = mmap(NULL,len,PROT_READ | PROT_WRITE,MAP_SHARED,*fd,0)) == MAP_FAILED) {
+    fprintf(stderr,"Cannot map snapshot file %s: %s\n",*tmpfile,strerror(errno));
+    close(*fd);
+    unlink(*tmpfile);
+    FREE(*tmpfile);
+    return (void *) NULL;
+  } else {
+    return memory;
+  }
+}
+
+void
+Snapshot_create_abort (int fd, void *memory, char *tmpfile, size_t len) {
+  munmap(memory,len);
+  close(fd);
+  unlink(tmpfile);
+  FREE(tmpfile);
+  return;
+}
+
+
+/* Adds the trailer and makes the snapshot visible to other
+   processes.  If another process has made a snapshot of the same file
+   in the meantime, uses that one instead.  Returns a read-only
+   mapping, as from Snapshot_attach. */
+void *
+Snapshot_create_commit (int *fd, void *memory, char *tmpfile, char *snapshot_dir, char *filename,
+			size_t len, size_t eltsize) {
+  struct Snapshot_trailer_T trailer;
+  struct stat sb;
+  char *name;
+  void *existing;
+  int existing_fd, nusers;
+
+  if (stat(filename,&sb) != 0) {
+    fprintf(stderr,"Cannot stat %s: %s\n",filename,strerror(errno));
+    Snapshot_create_abort(*fd,memory,tmpfile,len);
+    return (void *) NULL;
+  }
+
+  memset(&trailer,0,sizeof(struct Snapshot_trailer_T));
+  memcpy(trailer.magic,SNAPSHOT_MAGIC,8);
+  trailer.format = SNAPSHOT_FORMAT;
+  trailer.eltsize = (UINT4) eltsize;
+  trailer.len = (UINT8) len;
+  trailer.checksum = checksum((unsigned char *) memory,len);
+  trailer.source_dev = (UINT8) sb.st_dev;
+  trailer.source_ino = (UINT8) sb.st_ino;
+  trailer.source_mtime = (UINT8) sb.st_mtime;
+  trailer.source_mtime_nsec = (UINT8) MTIME_NSEC(&sb);
+  trailer.source_size = (UINT8) sb.st_size;
+  trailer.creation_time = (UINT8) time(NULL);
+  if (realpath(filename,trailer.source) == NULL) {
+    strncpy(trailer.source,filename,SNAPSHOT_MAXPATH-1);
+  }
+
+  if (pwrite(*fd,&trailer,sizeof(struct Snapshot_trailer_T),len) != sizeof(struct Snapshot_trailer_T)) {
+    fprintf(stderr,"Cannot write trailer of snapshot file %s: %s\n",tmpfile,strerror(errno));
+    Snapshot_create_abort(*fd,memory,tmpfile,len);
+    return (void *) NULL;
+  }
+  munmap(memory,len);
+
+  /* Lock before the snapshot becomes visible, so it cannot be evicted
+     as idle */
+  flock(*fd,LOCK_SH);
+
+  name = snapshot_name(snapshot_dir,filename,&sb);
+  if (link(tmpfile,name) == 0) {
+    unlink(tmpfile);
+
+  } else if (errno == EEXIST &&
+	     (existing = Snapshot_attach(&existing_fd,&nusers,snapshot_dir,filename,len,eltsize)) != NULL) {
+    /* Created by another process */
+    close(*fd);
+    unlink(tmpfile);
+    FREE(tmpfile);
+    FREE(name);
+    *fd = existing_fd;
+    return existing;
+
+  } else if (rename(tmpfile,name) != 0) {
+    /* Existing file is not a valid snapshot, or directory does not support hard links */
+    fprintf(stderr,"Cannot rename snapshot file %s to %s: %s\n",tmpfile,name,strerror(errno));
+    close(*fd);
+    unlink(tmpfile);
+    FREE(tmpfile);
+    FREE(name);
+    return (void *) NULL;
+  }
+  FREE(tmpfile);
+  FREE(name);
+
+  if ((memory = mmap(NULL,len,PROT_READ,MAP_SHARED,*fd,0)) == MAP_FAILED) {
+    close(*fd);
+    return (void *) NULL;
+  } else {
+    return memory;
+  }
+}
+
+
+/************************************************************************
+ *   Management
+ ************************************************************************/
+
+static bool
+snapshot_file_p (char *name) {
+  size_t namelength = strlen(name);
+
+  if (strncmp(name,SNAPSHOT_PREFIX,strlen(SNAPSHOT_PREFIX))) {
+    return false;
+  } else if (namelength < strlen(SNAPSHOT_PREFIX) + strlen(SNAPSHOT_SUFFIX)) {
+    return false;
+  } else if (strcmp(&(name[namelength - strlen(SNAPSHOT_SUFFIX)]),SNAPSHOT_SUFFIX)) {
+    return false;
+  } else {
+    return true;
+  }
+}
+
+/* Returns the paths of all snapshots in snapshot_dir, or of those in
+   names if nnames > 0 */
+static char **
+snapshot_paths (int *npaths, char *snapshot_dir, char **names, int nnames) {
+  char **paths;
+  DIR *dp;
+  struct dirent *entry;
+  int i;
+
+  if (nnames > 0) {
+    paths = (char **) MALLOC(nnames*sizeof(char *));
+    for (i = 0; i < nnames; i++) {
+      paths[i] = snapshot_path(snapshot_dir,names[i]);
+    }
+    *npaths = nnames;
+    return paths;
+
+  } else if ((dp = opendir(snapshot_dir)) == NULL) {
+    fprintf(stderr,"Cannot open snapshot directory %s: %s\n",snapshot_dir,strerror(errno));
+    *npaths = 0;
+    return (char **) NULL;
+
+  } else {
+    *npaths = 0;
+    while ((entry = readdir(dp)) != NULL) {
+      if (snapshot_file_p(entry->d_name) == true) {
+	(*npaths)++;
+      }
+    }
+    rewinddir(dp);
+
+    paths = (char **) MALLOC(((*npaths) + 1)*sizeof(char *));
+    i = 0;
+    while ((entry = readdir(dp)) != NULL && i < *npaths) {
+      if (snapshot_file_p(entry->d_name) == true) {
+	paths[i++] = snapshot_path(snapshot_dir,entry->d_name);
+      }
+    }
+    *npaths = i;
+    closedir(dp);
+    return paths;
+  }
+}
+
+static void
+free_paths (char **paths, int npaths) {
+  int i;
+
+  for (i = 0; i < npaths; i++) {
+    FREE(paths[i]);
+  }
+  if (paths != NULL) {
+    FREE(paths);
+  }
+  return;
+}
+
+
+typedef enum {SNAPSHOT_CURRENT, SNAPSHOT_STALE, SNAPSHOT_ORPHANED, SNAPSHOT_INVALID} Snapshot_state_T;
+
+static char *state_names[] = {"current", "stale", "orphaned", "invalid"};
+
+/* A snapshot is stale if its source file has changed, and orphaned if
+   the source file no longer exists */
+static Snapshot_state_T
+snapshot_state (struct Snapshot_trailer_T *trailer, int fd, off_t filesize) {
+  struct stat sb;
+
+  if (read_trailer(&(*trailer),fd,filesize) == false) {
+    return SNAPSHOT_INVALID;
+  } else if (stat(trailer->source,&sb) != 0) {
+    return SNAPSHOT_ORPHANED;
+  } else if (source_current_p(&(*trailer),&sb) == false) {
+    return SNAPSHOT_STALE;
+  } else {
+    return SNAPSHOT_CURRENT;
+  }
+}
+
+
+void
+Snapshot_list (char *snapshot_dir) {
+  char **paths, *basename, timestring[32];
+  struct Snapshot_trailer_T trailer;
+  Snapshot_state_T state;
+  struct stat sb;
+  time_t creation_time;
+  int npaths, i, fd, nusers;
+
+  paths = snapshot_paths(&npaths,snapshot_dir,/*names*/NULL,/*nnames*/0);
+  printf("%-8s %10s %5s %-19s %s\n","state","MB","users","created","snapshot (source)");
+  for (i = 0; i < npaths; i++) {
+    basename = strrchr(paths[i],'/') + 1;
+    if ((fd = open(paths[i],O_RDONLY,0764)) < 0 || fstat(fd,&sb) != 0) {
+      fprintf(stderr,"Cannot open %s: %s\n",paths[i],strerror(errno));
+    } else {
+      state = snapshot_state(&trailer,fd,sb.st_size);
+      if ((nusers = snapshot_nusers(sb.st_ino)) < 0) {
+	/* Can at least tell whether the snapshot is in use */
+	nusers = (flock(fd,LOCK_EX | LOCK_NB) == 0) ? 0 : 1;
+      }
+      if (state == SNAPSHOT_INVALID) {
+	printf("%-8s %10.1f %5d %-19s %s\n",state_names[state],(double) sb.st_size/1048576.0,nusers,
+	       "",basename);
+      } else {
+	creation_time = (time_t) trailer.creation_time;
+	strftime(timestring,32,"%Y-%m-%d %H:%M:%S",localtime(&creation_time));
+	printf("%-8s %10.1f %5d %-19s %s (%s)\n",state_names[state],(double) trailer.len/1048576.0,nusers,
+	       timestring,basename,trailer.source);
+      }
+    }
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+  free_paths(paths,npaths);
+
+  return;
+}
+
+
+/* Returns the number of snapshots that fail */
+int
+Snapshot_verify (char *snapshot_dir, char **names, int nnames) {
+  char **paths;
+  struct Snapshot_trailer_T trailer;
+  struct stat sb;
+  void *memory;
+  int npaths, i, fd, nfailures = 0;
+
+  paths = snapshot_paths(&npaths,snapshot_dir,names,nnames);
+  for (i = 0; i < npaths; i++) {
+    if ((fd = open(paths[i],O_RDONLY,0764)) < 0 || fstat(fd,&sb) != 0) {
+      printf("%s: cannot open: %s\n",paths[i],strerror(errno));
+      nfailures++;
+    } else if (read_trailer(&trailer,fd,sb.st_size) == false) {
+      printf("%s: invalid trailer\n",paths[i]);
+      nfailures++;
+    } else if (trailer.len == 0) {
+      printf("%s: OK\n",paths[i]);
+    } else if ((memory = mmap(NULL,trailer.len,PROT_READ,MAP_SHARED,fd,0)) == MAP_FAILED) {
+      printf("%s: cannot map: %s\n",paths[i],strerror(errno));
+      nfailures++;
+    } else {
+      if (checksum((unsigned char *) memory,trailer.len) != trailer.checksum) {
+	printf("%s: checksum FAILED\n",paths[i]);
+	nfailures++;
+      } else {
+	printf("%s: OK\n",paths[i]);
+      }
+      munmap(memory,trailer.len);
+    }
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+  free_paths(paths,npaths);
+
+  return nfailures;
+}
+
+
+/* Removes the given snapshots, or all snapshots if nnames is 0, or
+   only the stale, orphaned, and invalid ones if stalep is true.
+   Snapshots in use are skipped unless forcep is true, in which case
+   processes using them keep their mappings until they exit.  Returns
+   the number removed. */
+int
+Snapshot_evict (char *snapshot_dir, char **names, int nnames, bool stalep, bool forcep) {
+  char **paths;
+  struct Snapshot_trailer_T trailer;
+  struct stat sb;
+  int npaths, i, fd, nusers, nevicted = 0;
+
+  paths = snapshot_paths(&npaths,snapshot_dir,names,nnames);
+  for (i = 0; i < npaths; i++) {
+    if ((fd = open(paths[i],O_RDONLY,0764)) < 0 || fstat(fd,&sb) != 0) {
+      fprintf(stderr,"Cannot open %s: %s\n",paths[i],strerror(errno));
+
+    } else if (stalep == true && snapshot_state(&trailer,fd,sb.st_size) == SNAPSHOT_CURRENT) {
+      /* Keep */
+
+    } else if (flock(fd,LOCK_EX | LOCK_NB) != 0 && forcep == false) {
+      nusers = snapshot_nusers(sb.st_ino);
+      fprintf(stderr,"Keeping %s, because it is being used by %d processes.  To remove anyway, use --force\n",
+	      paths[i],nusers < 1 ? 1 : nusers);
+
+    } else if (unlink(paths[i]) != 0) {
+      fprintf(stderr,"Cannot remove %s: %s\n",paths[i],strerror(errno));
+
+    } else {
+      fprintf(stderr,"Removed %s\n",paths[i]);
+      nevicted++;
+    }
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+  free_paths(paths,npaths);
+
+  return nevicted;
+}
@@ -0,0 +1,65 @@
+/* $Id$ */
+#ifndef SNAPSHOT_INCLUDED
+#define SNAPSHOT_INCLUDED
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stddef.h>		/* For size_t */
+#include "bool.h"
+#include "types.h"
+
+
+/* Snapshots are copies of allocated index files, as loaded into
+   memory, kept as files in a memory-backed directory such as
+   /dev/shm.  Each snapshot is named by the source file and its
+   device, inode, modification time to the nanosecond, and size, so
+   an index that is rebuilt, even in place, gets a new snapshot.  The
+   file has the contents, followed by a trailer (struct
+   Snapshot_trailer_T).  Each process using a snapshot holds a shared
+   flock on it, which the kernel releases when the process exits,
+   even after a crash. */
+
+#define SNAPSHOT_DEFAULT_DIR "/dev/shm"
+#define SNAPSHOT_PREFIX "gmap-"
+#define SNAPSHOT_SUFFIX ".snap"
+#define SNAPSHOT_MAGIC "GMAPSNAP"
+#define SNAPSHOT_FORMAT 1
+#define SNAPSHOT_MAXPATH 4016	/* Makes the trailer 4096 bytes */
+
+typedef struct Snapshot_trailer_T *Snapshot_trailer_T;
+struct Snapshot_trailer_T {
+  char magic[8];
+  UINT4 format;
+  UINT4 eltsize;
+  UINT8 len;			/* Bytes of contents, before the trailer */
+  UINT8 checksum;		/* Of the contents */
+  UINT8 source_dev;
+  UINT8 source_ino;
+  UINT8 source_mtime;
+  UINT8 source_mtime_nsec;
+  UINT8 source_size;
+  UINT8 creation_time;
+  char source[SNAPSHOT_MAXPATH];
+};
+
+extern void *
+Snapshot_attach (int *fd, int *nusers, char *snapshot_dir, char *filename, size_t len, size_t eltsize);
+
+extern void *
+Snapshot_create_begin (int *fd, char **tmpfile, char *snapshot_dir, char *filename, size_t len);
+extern void *
+Snapshot_create_commit (int *fd, void *memory, char *tmpfile, char *snapshot_dir, char *filename,
+			size_t len, size_t eltsize);
+extern void
+Snapshot_create_abort (int fd, void *memory, char *tmpfile, size_t len);
+
+extern void
+Snapshot_list (char *snapshot_dir);
+extern int
+Snapshot_verify (char *snapshot_dir, char **names, int nnames);
+extern int
+Snapshot_evict (char *snapshot_dir, char **names, int nnames, bool stalep, bool forcep);
+
+#endif
+
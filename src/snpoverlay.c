@@ -0,0 +1,259 @@
+static char rcsid[] = "$Id$";
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "snpoverlay.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "mem.h"
+#include "assert.h"
+#include "popcount.h"
+
+
+#ifdef DEBUG
+#define debug(x) x
+#else
+#define debug(x)
+#endif
+
+
+/* Positions are split into a page number, implied by page_starts, and
+   a 16-bit offset within the page */
+#define PAGE_SHIFT 16
+#define PAGE_MASK 0xFFFF
+
+#define T Snpoverlay_T
+struct T {
+  Univcoord_T nblocks;
+  UINT4 nsnps;
+
+  Univcoord_T npages;
+  UINT4 *page_starts;		/* npages + 1 entries, indexing offsets */
+  UINT2 *offsets;		/* nsnps entries */
+  UINT4 *alleles;		/* 2 bits per SNP, 16 SNPs per word */
+
+  UINT4 *block_bitmap;		/* 1 bit per 32-nt block */
+};
+
+static char ACGT[4] = {'A','C','G','T'};
+
+
+void
+Snpoverlay_free (T *old) {
+  if (*old) {
+    FREE((*old)->block_bitmap);
+    FREE((*old)->alleles);
+    FREE((*old)->offsets);
+    FREE((*old)->page_starts);
+    FREE(*old);
+  }
+  return;
+}
+
+
+/* An alt genome from snpindex differs from the reference only at SNP
+   positions, each of which has its flag bit set */
+T
+Snpoverlay_new (Genomecomp_T *ref_high_blocks, Genomecomp_T *ref_low_blocks, Genomecomp_T *ref_flags_blocks,
+		Genomecomp_T *alt_high_blocks, Genomecomp_T *alt_low_blocks, Genomecomp_T *alt_flags_blocks,
+		Univcoord_T nblocks) {
+  T new = (T) MALLOC(sizeof(*new));
+  Univcoord_T blocki, position, page;
+  Genomecomp_T diff;
+  UINT4 snpi, nsnps = 0;
+  int bit, code;
+
+  /* First pass: count SNPs and mark blocks */
+  new->nblocks = nblocks;
+  new->block_bitmap = (UINT4 *) CALLOC((nblocks + 31)/32,sizeof(UINT4));
+  for (blocki = 0; blocki < nblocks; blocki++) {
+    diff = (ref_high_blocks[blocki] ^ alt_high_blocks[blocki]) |
+      (ref_low_blocks[blocki] ^ alt_low_blocks[blocki]) |
+      (ref_flags_blocks[blocki] ^ alt_flags_blocks[blocki]);
+    if (diff != 0) {
+      if ((diff & ~alt_flags_blocks[blocki]) != 0) {
+	fprintf(stderr,"SNP genome differs from the reference at an unflagged position in block %llu\n",
+		(unsigned long long) blocki);
+	exit(9);
+      }
+      new->block_bitmap[blocki/32] |= (1U << (blocki % 32));
+      nsnps += popcount_ones_32(diff);
+    }
+  }
+  new->nsnps = nsnps;
+  debug(printf("Found %u SNPs in %llu blocks\n",nsnps,(unsigned long long) nblocks));
+
+  /* Second pass: record positions and alleles */
+  new->npages = (nblocks*32 + PAGE_MASK) >> PAGE_SHIFT;
+  new->page_starts = (UINT4 *) MALLOC((new->npages + 1)*sizeof(UINT4));
+  new->offsets = (UINT2 *) MALLOC((nsnps + 1)*sizeof(UINT2));
+  new->alleles = (UINT4 *) CALLOC(nsnps/16 + 1,sizeof(UINT4));
+
+  snpi = 0;
+  page = 0;
+  new->page_starts[0] = 0;
+  for (blocki = 0; blocki < nblocks; blocki++) {
+    if ((new->block_bitmap[blocki/32] & (1U << (blocki % 32))) != 0) {
+      diff = (ref_high_blocks[blocki] ^ alt_high_blocks[blocki]) |
+	(ref_low_blocks[blocki] ^ alt_low_blocks[blocki]) |
+	(ref_flags_blocks[blocki] ^ alt_flags_blocks[blocki]);
+      for (bit = 0; bit < 32; bit++) {
+	if ((diff & (1U << bit)) == 0) {
+	  continue;
+	}
+	position = blocki*32 + bit;
+	while (page < (position >> PAGE_SHIFT)) {
+	  new->page_starts[++page] = snpi;
+	}
+	code = (((alt_high_blocks[blocki] >> bit) & 0x1) << 1) | ((alt_low_blocks[blocki] >> bit) & 0x1);
+	new->offsets[snpi] = (UINT2) (position & PAGE_MASK);
+	new->alleles[snpi/16] |= ((UINT4) code << (2*(snpi % 16)));
+	snpi++;
+      }
+    }
+  }
+  while (page < new->npages) {
+    new->page_starts[++page] = snpi;
+  }
+  assert(snpi == nsnps);
+
+  return new;
+}
+
+
+UINT4
+Snpoverlay_nsnps (T this) {
+  return this->nsnps;
+}
+
+size_t
+Snpoverlay_nbytes (T this) {
+  return (this->npages + 1)*sizeof(UINT4) + this->nsnps*sizeof(UINT2) +
+    (this->nsnps/16 + 1)*sizeof(UINT4) + (this->nblocks + 31)/32*sizeof(UINT4);
+}
+
+
+/* Returns true if any block in startblocki..endblocki has a SNP */
+bool
+Snpoverlay_blocks_p (T this, Univcoord_T startblocki, Univcoord_T endblocki) {
+  Univcoord_T startword, endword, wordi;
+  int startbit, endbit;
+  UINT4 endmask;
+
+  startword = startblocki/32;
+  endword = endblocki/32;
+  startbit = startblocki % 32;
+  endbit = endblocki % 32;
+  endmask = (endbit == 31) ? ~0U : ((1U << (endbit + 1)) - 1);
+
+  if (startword == endword) {
+    return ((this->block_bitmap[startword] & endmask) >> startbit) != 0;
+  } else if ((this->block_bitmap[startword] >> startbit) != 0) {
+    return true;
+  } else {
+    for (wordi = startword + 1; wordi < endword; wordi++) {
+      if (this->block_bitmap[wordi] != 0) {
+	return true;
+      }
+    }
+    return (this->block_bitmap[endword] & endmask) != 0;
+  }
+}
+
+
+/* Returns the index of the first SNP at or after position */
+static UINT4
+first_snp (T this, Univcoord_T position) {
+  Univcoord_T page = position >> PAGE_SHIFT;
+  UINT2 offset = (UINT2) (position & PAGE_MASK);
+  UINT4 lowi, highi, middlei;
+
+  lowi = this->page_starts[page];
+  highi = this->page_starts[page+1];
+  while (lowi < highi) {
+    middlei = lowi + (highi - lowi)/2;
+    if (this->offsets[middlei] < offset) {
+      lowi = middlei + 1;
+    } else {
+      highi = middlei;
+    }
+  }
+
+  return lowi;
+}
+
+
+/* Applies the alt alleles to nwords of bit planes, where bit b of
+   word w represents genomic position startpos + 32*w + b.
+   startpos need not be aligned to a block. */
+void
+Snpoverlay_patch_bits (T this, Genomecomp_T *high, Genomecomp_T *low, Genomecomp_T *flags,
+		       Univcoord_T startpos, int nwords) {
+  Univcoord_T endpos = startpos + 32*nwords, page, position;
+  UINT4 snpi, endi;
+  Genomecomp_T mask;
+  int relpos, wordi, code;
+
+  if ((page = startpos >> PAGE_SHIFT) >= this->npages) {
+    return;
+  }
+
+  snpi = first_snp(this,startpos);
+  while (page < this->npages && (page << PAGE_SHIFT) < endpos) {
+    endi = this->page_starts[page+1];
+    while (snpi < endi) {
+      if ((position = (page << PAGE_SHIFT) + this->offsets[snpi]) >= endpos) {
+	return;
+      }
+      relpos = position - startpos;
+      wordi = relpos/32;
+      mask = 1U << (relpos % 32);
+      code = (this->alleles[snpi/16] >> (2*(snpi % 16))) & 0x3;
+      debug(printf("Patching SNP at %llu with code %d\n",(unsigned long long) position,code));
+
+      flags[wordi] |= mask;
+      high[wordi] = (code & 0x2) ? (high[wordi] | mask) : (high[wordi] & ~mask);
+      low[wordi] = (code & 0x1) ? (low[wordi] | mask) : (low[wordi] & ~mask);
+      snpi++;
+    }
+    page++;
+  }
+
+  return;
+}
+
+
+/* Applies the alt alleles to buffer, which holds reference characters
+   for startpos..endpos-1.  Reference N's are kept, as for an alt
+   genome decoded with the reference flags. */
+void
+Snpoverlay_patch_chars (T this, char *buffer, Univcoord_T startpos, Univcoord_T endpos) {
+  Univcoord_T page, position;
+  UINT4 snpi, endi;
+  int code;
+
+  if ((page = startpos >> PAGE_SHIFT) >= this->npages) {
+    return;
+  }
+
+  snpi = first_snp(this,startpos);
+  while (page < this->npages && (page << PAGE_SHIFT) < endpos) {
+    endi = this->page_starts[page+1];
+    while (snpi < endi) {
+      if ((position = (page << PAGE_SHIFT) + this->offsets[snpi]) >= endpos) {
+	return;
+      }
+      if (buffer[position - startpos] != 'N') {
+	code = (this->alleles[snpi/16] >> (2*(snpi % 16))) & 0x3;
+	buffer[position - startpos] = ACGT[code];
+      }
+      snpi++;
+    }
+    page++;
+  }
+
+  return;
+}
+
@@ -0,0 +1,51 @@
+/* $Id$ */
+#ifndef SNPOVERLAY_INCLUDED
+#define SNPOVERLAY_INCLUDED
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stddef.h>
+#include "bool.h"
+#include "types.h"
+#include "univcoord.h"
+
+
+/* Sparse representation of a SNP genome built by snpindex.  An alt
+   genome equals the reference except at SNP positions, where the flag
+   bit is set and the 2-bit code holds the alternate allele.  Instead
+   of a second full copy of the genome, the overlay keeps only those
+   positions, as 16-bit offsets within 64K-nt pages, plus a 2-bit
+   allele per SNP and a bitmap with one bit per 32-nt block, so that
+   callers can skip SNP-free blocks and use the reference directly. */
+
+#define T Snpoverlay_T
+typedef struct T *T;
+
+extern void
+Snpoverlay_free (T *old);
+
+extern T
+Snpoverlay_new (Genomecomp_T *ref_high_blocks, Genomecomp_T *ref_low_blocks, Genomecomp_T *ref_flags_blocks,
+		Genomecomp_T *alt_high_blocks, Genomecomp_T *alt_low_blocks, Genomecomp_T *alt_flags_blocks,
+		Univcoord_T nblocks);
+
+extern UINT4
+Snpoverlay_nsnps (T this);
+
+extern size_t
+Snpoverlay_nbytes (T this);
+
+extern bool
+Snpoverlay_blocks_p (T this, Univcoord_T startblocki, Univcoord_T endblocki);
+
+extern void
+Snpoverlay_patch_bits (T this, Genomecomp_T *high, Genomecomp_T *low, Genomecomp_T *flags,
+		       Univcoord_T startpos, int nwords);
+
+extern void
+Snpoverlay_patch_chars (T this, char *buffer, Univcoord_T startpos, Univcoord_T endpos);
+
+#undef T
+#endif
+
@@ -80,6 +80,13 @@ static char rcsid[] = "$Id: 1c5095d5e4aa04edfd5bcc317e9a54e070b33168 $";
 
 #define MAXEXONS 3
 
+/* For the minimizer path */
+#define MINIMIZER_MAXOCC 500	/* Minimizers with more genomic positions are skipped */
+#define MINIMIZER_LOOKBACK 50	/* Predecessors tried per anchor when chaining */
+#define MINIMIZER_MIN_CHAINSCORE 30
+#define MINIMIZER_INTRONLEN 50	/* Genomic gap beyond the query gap treated as an intron */
+#define MINIMIZER_INTRON_PENALTY 4
+
 /* Once a match at a genomic location has PROMISCUOUS matches locally,
    it is unlikely that further matches will help define that candidate
    segment.  Allowing PROMISCUOUS to be greater than 1 allows more
@@ -4270,3 +4277,326 @@ Stage1_compute_nonstranded (bool *lowidentityp, Sequence_T queryuc,
   return gregionlist;
 }
 
+
+
+#ifndef PMAP
+
+/* Minimizer path, for long noisy queries.  Anchors are the genomic
+   positions of the query minimizers on each strand.  They are chained
+   in genomic order, allowing small indels and introns up to
+   maxtotallen, and each chain within half of the best score becomes
+   a gregion. */
+
+typedef struct Anchor_T *Anchor_T;
+struct Anchor_T {
+  Univcoord_T position;		/* Genomic start of the kmer */
+  int querypos;			/* Start of the kmer on the scanned strand */
+  int chrnum;
+  int score;
+  int prev;
+  int nexons;
+  bool usedp;
+};
+
+typedef struct Chain_T *Chain_T;
+struct Chain_T {
+  int score;
+  int firsti;
+  int lasti;
+  int nexons;
+  bool plusp;
+};
+
+
+static int
+Anchor_position_cmp (const void *a, const void *b) {
+  Anchor_T x = (Anchor_T) a;
+  Anchor_T y = (Anchor_T) b;
+
+  if (x->position < y->position) {
+    return -1;
+  } else if (y->position < x->position) {
+    return +1;
+  } else if (x->querypos < y->querypos) {
+    return -1;
+  } else if (y->querypos < x->querypos) {
+    return +1;
+  } else {
+    return 0;
+  }
+}
+
+static int
+Chain_score_cmp (const void *a, const void *b) {
+  Chain_T x = (Chain_T) a;
+  Chain_T y = (Chain_T) b;
+
+  if (x->score > y->score) {
+    return -1;
+  } else if (y->score > x->score) {
+    return +1;
+  } else {
+    return 0;
+  }
+}
+
+
+static int
+log2_int (Chrpos_T x) {
+  int log = 0;
+
+  while (x > 1) {
+    x >>= 1;
+    log++;
+  }
+  return log;
+}
+
+
+static struct Anchor_T *
+minimizer_anchors (int *nanchors, char *sequence, int querylength, Minindex_T minindex,
+		   UINT4 *keys, int *querypositions, Univ_IIT_T chromosome_iit,
+		   Univcoord_T chrsubset_start, Univcoord_T chrsubset_end) {
+  struct Anchor_T *anchors;
+  UINT4 **positions, *p;
+  int *npositions, nminimizers, i, j;
+  int k = Minindex_k(minindex);
+
+  nminimizers = Minindex_scan(keys,querypositions,sequence,querylength,k,Minindex_w(minindex));
+  if (nminimizers == 0) {
+    *nanchors = 0;
+    return (struct Anchor_T *) NULL;
+  }
+
+  /* Look up each minimizer once, and keep the result for filling anchors */
+  positions = (UINT4 **) MALLOC(nminimizers*sizeof(UINT4 *));
+  npositions = (int *) MALLOC(nminimizers*sizeof(int));
+
+  *nanchors = 0;
+  for (i = 0; i < nminimizers; i++) {
+    if ((npositions[i] = Minindex_read(&(positions[i]),minindex,keys[i])) <= MINIMIZER_MAXOCC) {
+      *nanchors += npositions[i];
+    }
+  }
+  if (*nanchors == 0) {
+    FREE(npositions);
+    FREE(positions);
+    return (struct Anchor_T *) NULL;
+  }
+
+  anchors = (struct Anchor_T *) MALLOC((*nanchors)*sizeof(struct Anchor_T));
+  *nanchors = 0;
+  for (i = 0; i < nminimizers; i++) {
+    if (npositions[i] <= MINIMIZER_MAXOCC) {
+      p = positions[i];
+      for (j = 0; j < npositions[i]; j++) {
+	if ((Univcoord_T) p[j] >= chrsubset_start && (Univcoord_T) p[j] + k <= chrsubset_end) {
+	  anchors[*nanchors].position = (Univcoord_T) p[j];
+	  anchors[*nanchors].querypos = querypositions[i];
+	  anchors[*nanchors].chrnum = Univ_IIT_get_one(chromosome_iit,p[j],p[j]);
+	  anchors[*nanchors].usedp = false;
+	  (*nanchors)++;
+	}
+      }
+    }
+  }
+  FREE(npositions);
+  FREE(positions);
+
+  qsort(anchors,*nanchors,sizeof(struct Anchor_T),Anchor_position_cmp);
+  return anchors;
+}
+
+
+static void
+chain_anchors (struct Anchor_T *anchors, int nanchors, int k, Chrpos_T maxtotallen) {
+  Anchor_T anchor, prev;
+  Chrpos_T genomedist, gap;
+  int querydist, matches, cost, score, nexons, i, j;
+
+  for (i = 0; i < nanchors; i++) {
+    anchor = &(anchors[i]);
+    anchor->score = k;
+    anchor->prev = -1;
+    anchor->nexons = 1;
+
+    for (j = i - 1; j >= 0 && j >= i - MINIMIZER_LOOKBACK; j--) {
+      prev = &(anchors[j]);
+      if (prev->chrnum != anchor->chrnum || anchor->position - prev->position > maxtotallen) {
+	break;
+      } else if ((querydist = anchor->querypos - prev->querypos) > 0 && anchor->position > prev->position) {
+	genomedist = anchor->position - prev->position;
+	matches = (querydist < k) ? querydist : k;
+	if ((Chrpos_T) querydist > genomedist + MINIMIZER_INTRONLEN) {
+	  /* Too large an insertion in the query */
+	  cost = -1;
+	} else if ((Chrpos_T) querydist >= genomedist) {
+	  gap = querydist - genomedist;
+	  cost = (gap == 0) ? 0 : gap/4 + log2_int(gap)/2 + 1;
+	  nexons = prev->nexons;
+	} else if ((gap = genomedist - querydist) < MINIMIZER_INTRONLEN) {
+	  cost = gap/4 + log2_int(gap)/2 + 1;
+	  nexons = prev->nexons;
+	} else {
+	  cost = MINIMIZER_INTRON_PENALTY + log2_int(gap)/2;
+	  nexons = prev->nexons + 1;
+	}
+
+	if (cost >= 0 && (score = prev->score + matches - cost) > anchor->score) {
+	  anchor->score = score;
+	  anchor->prev = j;
+	  anchor->nexons = nexons;
+	}
+      }
+    }
+  }
+
+  return;
+}
+
+
+/* Takes chains from the highest-scoring ends down.  A chain that runs
+   into anchors of an earlier chain keeps only its own part. */
+static int
+find_minimizer_chains (struct Chain_T *chains, int nchains, struct Anchor_T *anchors, int nanchors,
+		       bool plusp) {
+  struct Chain_T *ends;
+  int score, endi, i, j, lastj;
+
+  ends = (struct Chain_T *) MALLOC(nanchors*sizeof(struct Chain_T));
+  for (i = 0; i < nanchors; i++) {
+    ends[i].score = anchors[i].score;
+    ends[i].lasti = i;
+  }
+  qsort(ends,nanchors,sizeof(struct Chain_T),Chain_score_cmp);
+
+  for (i = 0; i < nanchors && ends[i].score >= MINIMIZER_MIN_CHAINSCORE; i++) {
+    endi = ends[i].lasti;
+    if (anchors[endi].usedp == false) {
+      j = lastj = endi;
+      while (j >= 0 && anchors[j].usedp == false) {
+	anchors[j].usedp = true;
+	lastj = j;
+	j = anchors[j].prev;
+      }
+      score = anchors[endi].score - ((j >= 0) ? anchors[j].score : 0);
+      if (score >= MINIMIZER_MIN_CHAINSCORE) {
+	chains[nchains].score = score;
+	chains[nchains].firsti = lastj;
+	chains[nchains].lasti = endi;
+	chains[nchains].nexons = anchors[endi].nexons - ((j >= 0) ? anchors[j].nexons - 1 : 0);
+	chains[nchains].plusp = plusp;
+	nchains++;
+      }
+    }
+  }
+
+  FREE(ends);
+  return nchains;
+}
+
+
+List_T
+Stage1_compute_minimizers (bool *lowidentityp, Sequence_T queryuc, Minindex_T minindex,
+			   Univ_IIT_T chromosome_iit, Univcoord_T chrsubset_start, Univcoord_T chrsubset_end,
+			   Diagnostic_T diagnostic, Stopwatch_T stopwatch, int nbest) {
+  List_T gregionlist = NULL;
+  Gregion_T gregion;
+  Sequence_T queryrc;
+  struct Anchor_T *plus_anchors, *minus_anchors, *anchors;
+  struct Chain_T *chains;
+  Anchor_T first, last;
+  UINT4 *keys;
+  int *querypositions;
+  int querylength, trimlength, plus_nanchors, minus_nanchors, nchains, querystart, queryend, i;
+  int k = Minindex_k(minindex);
+  Chrpos_T maxtotallen;
+
+  *lowidentityp = false;
+  querylength = Sequence_fulllength(queryuc);
+  if (querylength < k + Minindex_w(minindex) - 1) {
+    return (List_T) NULL;
+  }
+
+  Stopwatch_start(stopwatch);
+  diagnostic->sampling_rounds = 0;
+  diagnostic->sampling_nskip = 0;
+
+  trimlength = Sequence_trimlength(queryuc);
+  if (trimlength <= SINGLEEXONLENGTH) {
+    maxtotallen = 40 + trimlength;
+  } else {
+    maxtotallen = trimlength*SLOPE;
+    if (maxtotallen < 10000) {
+      maxtotallen = 10000;
+    } else if (maxtotallen > maxtotallen_bound) {
+      maxtotallen = maxtotallen_bound;
+    }
+  }
+
+  keys = (UINT4 *) MALLOC(querylength*sizeof(UINT4));
+  querypositions = (int *) MALLOC(querylength*sizeof(int));
+
+  plus_anchors = minimizer_anchors(&plus_nanchors,Sequence_fullpointer(queryuc),querylength,minindex,
+				   keys,querypositions,chromosome_iit,chrsubset_start,chrsubset_end);
+  queryrc = Sequence_revcomp(queryuc);
+  minus_anchors = minimizer_anchors(&minus_nanchors,Sequence_fullpointer(queryrc),querylength,minindex,
+				    keys,querypositions,chromosome_iit,chrsubset_start,chrsubset_end);
+  Sequence_free(&queryrc);
+  FREE(querypositions);
+  FREE(keys);
+  debug(printf("Minimizer anchors: %d plus, %d minus\n",plus_nanchors,minus_nanchors));
+
+  chains = (struct Chain_T *) MALLOC((plus_nanchors + minus_nanchors + 1)*sizeof(struct Chain_T));
+  nchains = 0;
+  if (plus_nanchors > 0) {
+    chain_anchors(plus_anchors,plus_nanchors,k,maxtotallen);
+    nchains = find_minimizer_chains(chains,nchains,plus_anchors,plus_nanchors,/*plusp*/true);
+  }
+  if (minus_nanchors > 0) {
+    chain_anchors(minus_anchors,minus_nanchors,k,maxtotallen);
+    nchains = find_minimizer_chains(chains,nchains,minus_anchors,minus_nanchors,/*plusp*/false);
+  }
+  qsort(chains,nchains,sizeof(struct Chain_T),Chain_score_cmp);
+
+  if (nchains == 0) {
+    *lowidentityp = true;
+  }
+
+  for (i = 0; i < nchains && i < nbest && chains[i].score >= chains[0].score/2; i++) {
+    anchors = (chains[i].plusp == true) ? plus_anchors : minus_anchors;
+    first = &(anchors[chains[i].firsti]);
+    last = &(anchors[chains[i].lasti]);
+    if (chains[i].plusp == true) {
+      querystart = first->querypos;
+      queryend = last->querypos + k - 1;
+    } else {
+      /* Anchors are on the reverse complement of the query */
+      querystart = querylength - k - last->querypos;
+      queryend = querylength - 1 - first->querypos;
+    }
+    debug(printf("Minimizer chain %d: score %d, %d exons, %s, query %d..%d, genome %llu..%llu\n",
+		 i,chains[i].score,chains[i].nexons,chains[i].plusp ? "plus" : "minus",querystart,queryend,
+		 (unsigned long long) first->position,(unsigned long long) last->position + k - 1));
+
+    gregion = Gregion_new(chains[i].nexons,first->position,last->position + k - 1,chains[i].plusp,
+			  /*genestrand*/0,chromosome_iit,querystart,queryend,querylength,
+			  /*matchsize*/k,Sequence_trim_start(queryuc),Sequence_trim_end(queryuc),
+			  circular_typeint);
+    Gregion_extend(gregion,/*extension5*/0,/*extension3*/0,querylength);
+    gregionlist = List_push(gregionlist,(void *) gregion);
+  }
+
+  FREE(chains);
+  FREE(minus_anchors);
+  FREE(plus_anchors);
+
+  gregionlist = Gregion_filter_unique(gregionlist);
+
+  diagnostic->stage1_runtime = Stopwatch_stop(stopwatch);
+  diagnostic->ngregions = List_length(gregionlist);
+
+  return gregionlist;
+}
+
+#endif
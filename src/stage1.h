@@ -13,6 +13,7 @@
 #include "genome.h"
 #include "stopwatch.h"
 #include "diagnostic.h"
+#include "minindex.h"
 
 
 #define T Stage1_T
@@ -43,6 +44,13 @@ Stage1_compute_nonstranded (bool *lowidentityp, Sequence_T queryuc,
 			    Matchpool_T matchpool, int stutterhits, Diagnostic_T diagnostic, Stopwatch_T stopwatch,
 			    int nbest);
 
+#ifndef PMAP
+extern List_T
+Stage1_compute_minimizers (bool *lowidentityp, Sequence_T queryuc, Minindex_T minindex,
+			   Univ_IIT_T chromosome_iit, Univcoord_T chrsubset_start, Univcoord_T chrsubset_end,
+			   Diagnostic_T diagnostic, Stopwatch_T stopwatch, int nbest);
+#endif
+
 #undef T
 #endif
 
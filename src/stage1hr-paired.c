@@ -5357,6 +5357,7 @@ solve_all (bool *completep, int *found_score, Shortread_T queryseq,
 /* final_pairtype can be CONCORDANT_TRANSLOCATIONS, CONCORDANT, PAIRED_INVERSION, PAIRED_SCRAMBLE, PAIRED_TOOLONG, UNPAIRED */
 Pathpair_T *
 Stage1_paired_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, int *second_absmq, Pairtype_T *final_pairtype,
+		    Method_T *final_method,
 		    Path_T **patharray5, int *npaths5_primary, int *npaths5_altloc, int *first_absmq5, int *second_absmq5,
 		    Path_T **patharray3, int *npaths3_primary, int *npaths3_altloc, int *first_absmq3, int *second_absmq3,
 		    Shortread_T queryseq5, Shortread_T queryseq3, EF64_T repetitive_ef64,
@@ -5406,6 +5407,10 @@ Stage1_paired_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, i
   T this5, this3;
 
 
+  /* Positions decoded for the previous read are no longer referenced */
+  Indexdb_reset_decoded();
+
+  *final_method = METHOD_INIT;
   if ((querylength5 = Shortread_fulllength(queryseq5)) < index1part + index1interval - 1 ||
       (querylength3 = Shortread_fulllength(queryseq3)) < index1part + index1interval - 1) {
     return (Pathpair_T *) NULL;
@@ -5529,6 +5534,7 @@ Stage1_paired_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, i
 
 				   trdiagpool,auxinfopool,intlistpool,uintlistpool,univcoordlistpool,
 				   listpool,trpathpool,pathpool,transcriptpool,vectorpool,hitlistpool);
+      *final_method = TR_EXT;
     }
 
     if (genome_align_p == true) {
@@ -5556,6 +5562,7 @@ Stage1_paired_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, i
 				      pathpool,transcriptpool,vectorpool,hitlistpool,
 				      spliceendsgen5,spliceendsgen3);
       }
+      *final_method = (last_method_5 > last_method_3) ? last_method_5 : last_method_3;
     }
   }
 
@@ -5565,6 +5572,8 @@ Stage1_paired_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, i
      will call Pathpair_resolve */
 
   if (pathpairs == NULL) {
+    *final_method = LOCAL_MATE;
+
     /* Univdiagonals solved paths vs Exhaustive */
     /* Does yield results, since we might have been too strict on complete_p for the mates */
     pathpairs = paths5_mates(&found_score_paired,&found_score_3,&unresolved_pathpairs,
@@ -5673,6 +5682,8 @@ Stage1_paired_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, i
 
   debug(printf("Beginning paired_search_exhaustive\n"));
   if (pathpairs == NULL) {
+    *final_method = EXHAUSTIVE;
+
     /* Exhaustive vs Exhaustive.  Takes counts into account, so should
        be better than univdiagonals_mates procedures */
     pathpairs = paired_search_exhaustive(&found_score_paired,&found_score_5,&found_score_3,
@@ -27,9 +27,11 @@
 #include "spliceendsgen.h"
 
 #include "pass.h"
+#include "method.h"
 
 extern Pathpair_T *
 Stage1_paired_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, int *second_absmq, Pairtype_T *final_pairtype,
+		    Method_T *final_method,
 		    Path_T **patharray5, int *nhits5_primary, int *nhits5_altloc, int *first_absmq5, int *second_absmq5,
 		    Path_T **patharray3, int *nhits3_primary, int *nhits3_altloc, int *first_absmq3, int *second_absmq3,
 		    Shortread_T queryseq5, Shortread_T queryseq3, EF64_T repetitive_ef64,
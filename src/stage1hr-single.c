@@ -1216,7 +1216,7 @@ single_read_gen_paths (int *found_score, Method_T *last_method,
 
 Path_T *
 Stage1_single_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, int *second_absmq,
-		    Shortread_T queryseq, EF64_T repetitive_ef64,
+		    Method_T *final_method, Shortread_T queryseq, EF64_T repetitive_ef64,
 		    Knownsplicing_T knownsplicing, Knownindels_T knownindels, Localdb_T localdb,
 		    Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool, Auxinfopool_T auxinfopool,
 		    Intlistpool_T intlistpool, Uintlistpool_T uintlistpool,
@@ -1260,6 +1260,10 @@ Stage1_single_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, i
   }
 #endif
 
+  /* Positions decoded for the previous read are no longer referenced */
+  Indexdb_reset_decoded();
+
+  *final_method = METHOD_INIT;
   if ((querylength = Shortread_fulllength(queryseq)) < index1part + index1interval - 1) {
     *npaths_primary = *npaths_altloc = 0;
     return (Path_T *) NULL;
@@ -1383,7 +1387,10 @@ Stage1_single_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, i
 				 queryseq,knownsplicing,nmismatches_allowed,
 				 univdiagpool,intlistpool,uintlistpool,univcoordlistpool,
 				 listpool,pathpool,transcriptpool,vectorpool,hitlistpool);
+      last_method = FUSION;
     }
+
+    *final_method = last_method;
   }
 
   if (paths != NULL) {
@@ -31,6 +31,7 @@
 #include "spliceendsgen.h"
 
 #include "pass.h"
+#include "method.h"
 
 #define T Stage1_T
 
@@ -73,7 +74,7 @@ single_read_unsolved_tr_paths (int *found_score,
 
 extern Path_T *
 Stage1_single_read (int *npaths_primary, int *npaths_altloc, int *first_absmq, int *second_absmq,
-		    Shortread_T queryseq, EF64_T repetitive_ef64,
+		    Method_T *final_method, Shortread_T queryseq, EF64_T repetitive_ef64,
 		    Knownsplicing_T knownsplicing, Knownindels_T knownindels, Localdb_T localdb,
 		    Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool, Auxinfopool_T auxinfopool,
 		    Intlistpool_T intlistpool, Uintlistpool_T uintlistpool,
@@ -33,6 +33,10 @@ static char rcsid[] = "$Id: aad83e354a46014c89a0ec6bd990f52c482ed857 $";
 #include "path-solve.h"
 #include "path-eval.h"
 
+#ifdef HAVE_PTHREAD
+#include <pthread.h>
+#endif
+
 
 /* Note FORMULA: formulas for querypos <-> diagonal (diagterm in call to Indexdb_read) are:
 
@@ -183,10 +187,49 @@ static Transcriptome_T transcriptome;
 
 
 #define T Stage1_T
-T
-Stage1_new (char *queryuc_ptr, int querylength, bool first_read_p) {
-  T new = (T) MALLOC(sizeof(*new));
 
+/* Stage1_T objects are kept by each thread between reads.  The arrays
+   that depend on the query are sized for the longest query seen so
+   far and are reset, rather than reallocated, for each read.  Results
+   handed over by other modules (all_univdiagonals, exhaustive, and
+   trdiagonals) are still freed at the end of each read. */
+
+#define NCACHED 2		/* Paired-end reads hold two at once */
+
+typedef struct Cache_T *Cache_T;
+struct Cache_T {
+  T objects[NCACHED];
+  int n;
+#ifdef MEMUSAGE
+  long int nbuilt;
+  long int nreused;
+#endif
+};
+
+#ifdef HAVE_PTHREAD
+static pthread_key_t cache_key;
+static pthread_once_t cache_once = PTHREAD_ONCE_INIT;
+#else
+static Cache_T cache_global = NULL;
+#endif
+
+
+#ifdef MEMUSAGE
+/* Constructors such as Indelinfo_new allocate from the standard pool,
+   which is expected to be empty after each read, so memory they
+   allocate for a kept object is taken out of that count by hand */
+static long int
+std_heap_keep (long int memusage_start) {
+  long int nbytes = Mem_usage_report_std_heap() - memusage_start;
+
+  Mem_usage_std_heap_add(-nbytes);
+  return nbytes;
+}
+#endif
+
+
+static void
+alloc_arrays (T this, char *queryuc_ptr, int querylength) {
   int overhang = index1interval - 1;
   int overhang_tr = index1interval_tr - 1;
 
@@ -199,6 +242,324 @@ Stage1_new (char *queryuc_ptr, int querylength, bool first_read_p) {
     max_nstreams = 2 * querylength;
   }
 
+  this->querylength_alloc = querylength;
+
+  this->reader = Reader_new(queryuc_ptr,/*querystart*/0,/*queryend*/querylength,/*oligosize*/index1part);
+  this->validp = (bool *) MALLOC_KEEP((querylength+overhang)*sizeof(bool));
+  this->forward_oligos = (Oligospace_T *) MALLOC_KEEP((querylength+overhang)*sizeof(Oligospace_T));
+  this->revcomp_oligos = (Oligospace_T *) MALLOC_KEEP((querylength+overhang)*sizeof(Oligospace_T));
+
+  if (transcriptome == NULL) {
+    this->tr_reader = (Reader_T) NULL;
+    this->tr_validp = (bool *) NULL;
+    this->tr_forward_oligos = this->tr_revcomp_oligos = (Oligospace_T *) NULL;
+
+  } else if (index1part_tr == index1part) {
+    this->tr_reader = this->reader;
+    this->tr_validp = this->validp;
+    this->tr_forward_oligos = this->forward_oligos;
+    this->tr_revcomp_oligos = this->revcomp_oligos;
+
+  } else {
+    this->tr_reader = Reader_new(queryuc_ptr,/*querystart*/0,/*queryend*/querylength,/*oligosize*/index1part_tr);
+    this->tr_validp = (bool *) MALLOC_KEEP((querylength+overhang_tr)*sizeof(bool));
+    this->tr_forward_oligos = (Oligospace_T *) MALLOC_KEEP((querylength+overhang_tr)*sizeof(Oligospace_T));
+    this->tr_revcomp_oligos = (Oligospace_T *) MALLOC_KEEP((querylength+overhang_tr)*sizeof(Oligospace_T));
+  }
+
+  this->retrievedp_allocated = (bool *) MALLOC_KEEP(2 * (querylength+overhang)*sizeof(bool));
+#ifdef LARGE_GENOMES
+  this->positions_high_allocated = (unsigned char **) MALLOC_KEEP(2 * (querylength+overhang)*sizeof(unsigned char *));
+#endif
+  this->positions_allocated = (UINT4 **) MALLOC_KEEP(2 * (querylength+overhang)*sizeof(UINT4 *));
+  this->npositions_allocated = (int *) MALLOC_KEEP(2 * (querylength+overhang)*sizeof(int));
+  this->plus_diagterms = (int *) MALLOC_KEEP(querylength*sizeof(int));
+  this->minus_diagterms = (int *) MALLOC_KEEP(querylength*sizeof(int));
+
+  if (transcriptome == NULL) {
+    this->tr_retrievedp_allocated = (bool *) NULL;
+    this->tr_positions_allocated = (UINT4 **) NULL;
+    this->tr_npositions_allocated = (int *) NULL;
+  } else {
+    this->tr_retrievedp_allocated = (bool *) MALLOC_KEEP(2 * (querylength+overhang_tr)*sizeof(bool));
+    this->tr_positions_allocated = (UINT4 **) MALLOC_KEEP(2 * (querylength+overhang_tr)*sizeof(UINT4 *));
+    this->tr_npositions_allocated = (int *) MALLOC_KEEP(2 * (querylength+overhang_tr)*sizeof(int));
+  }
+  this->tr_plus_diagterms = (int *) MALLOC_KEEP(querylength*sizeof(int));
+  this->tr_minus_diagterms = (int *) MALLOC_KEEP(querylength*sizeof(int));
+
+
+  /* Need to allocate (max_mismatches+MISMATCH_EXTRA), where
+     max_mismatches is provided to Genomebits_mismatches_left or
+     Genome_mismatches_right */
+  /* this->mismatch_positions_alloc = (int *) MALLOC((querylength+MISMATCH_EXTR)*sizeof(int)); */
+  this->positions_alloc = (int *) MALLOC_KEEP((querylength+1)*sizeof(int));
+  this->indelinfo = Indelinfo_new(querylength);
+  this->spliceinfo = Spliceinfo_new(querylength);
+
+  /* mergeinfo_tr used only on trdiagonals, not for localdb */
+  this->mergeinfo_tr = Mergeinfo_uint4_new(querylength,/*max_localdb_distance*/0);
+#ifdef LARGE_GENOMES
+  this->mergeinfo = Mergeinfo_uint8_new(querylength,positive_gap_distance);
+#else
+  this->mergeinfo = Mergeinfo_uint4_new(querylength,positive_gap_distance);
+#endif
+
+  /* Memory allocated for Segment_identify in segment-search.c, and
+     Merge_diagonals in kmer-search.c (which needs four sets of
+     arrays) */
+#ifdef LARGE_GENOMES
+  this->stream_high_alloc = (unsigned char **) MALLOC_KEEP(4*querylength*sizeof(unsigned char *));
+  this->stream_low_alloc = (UINT4 **) MALLOC_KEEP(4*querylength*sizeof(UINT4 *));
+#endif
+
+  /* Previously allocated 4*querylength, for Kmer_exact2, when shortsplice_dist < 65536 */
+  this->streamptr_alloc = (Univcoord_T **) MALLOC_KEEP(max_nstreams*sizeof(Univcoord_T *));
+  this->streamsize_alloc = (int *) MALLOC_KEEP(max_nstreams * sizeof(int));
+
+  /* Previously needed 4*querylength for Kmer_exact2 */
+  this->querypos_diagterm_alloc = (int *) MALLOC_KEEP(2*querylength*sizeof(int));
+
+  return;
+}
+
+
+static void
+free_arrays (T this) {
+
+  /* FREE_KEEP(this->mismatch_positions_alloc); */
+  FREE_KEEP(this->positions_alloc);
+
+  Mergeinfo_uint4_free(&this->mergeinfo_tr);
+#ifdef LARGE_GENOMES
+  Mergeinfo_uint8_free(&this->mergeinfo);
+#else
+  Mergeinfo_uint4_free(&this->mergeinfo);
+#endif
+  Spliceinfo_free(&this->spliceinfo);
+  Indelinfo_free(&this->indelinfo);
+
+#ifdef LARGE_GENOMES
+  FREE_KEEP(this->stream_high_alloc);
+  FREE_KEEP(this->stream_low_alloc);
+#endif
+  FREE_KEEP(this->streamptr_alloc);
+  FREE_KEEP(this->streamsize_alloc);
+  FREE_KEEP(this->querypos_diagterm_alloc);
+
+  FREE_KEEP(this->retrievedp_allocated);
+#ifdef LARGE_GENOMES
+  FREE_KEEP(this->positions_high_allocated);
+#endif
+  FREE_KEEP(this->positions_allocated);
+  FREE_KEEP(this->npositions_allocated);
+  if (transcriptome == NULL) {
+    /* Skip */
+  } else {
+    FREE_KEEP(this->tr_retrievedp_allocated);
+    FREE_KEEP(this->tr_positions_allocated);
+    FREE_KEEP(this->tr_npositions_allocated);
+  }
+
+  FREE_KEEP(this->plus_diagterms);
+  FREE_KEEP(this->minus_diagterms);
+  FREE_KEEP(this->tr_plus_diagterms);
+  FREE_KEEP(this->tr_minus_diagterms);
+
+  FREE_KEEP(this->revcomp_oligos);
+  FREE_KEEP(this->forward_oligos);
+  FREE_KEEP(this->validp);
+  Reader_free(&this->reader);
+
+  if (transcriptome == NULL) {
+    /* Skip */
+  } else if (index1part_tr == index1part) {
+    /* Skip */
+  } else {
+    FREE_KEEP(this->tr_revcomp_oligos);
+    FREE_KEEP(this->tr_forward_oligos);
+    FREE_KEEP(this->tr_validp);
+    Reader_free(&this->tr_reader);
+  }
+
+  return;
+}
+
+
+static T
+object_new (char *queryuc_ptr, int querylength) {
+  T new = (T) MALLOC_KEEP(sizeof(*new));
+  int max_localdb_nregions = (positive_gap_distance + LOCALDB_REGION_SIZE) / LOCALDB_REGION_SIZE + 1;
+#ifdef MEMUSAGE
+  long int memusage_start = Mem_usage_report_std_heap();
+#endif
+
+  alloc_arrays(new,queryuc_ptr,querylength);
+
+  new->streamspace_max_alloc = max_localdb_nregions * LOCALDB_REGION_SIZE;
+  MALLOC_ALIGN(new->streamspace_alloc,new->streamspace_max_alloc * sizeof(Univcoord_T)); /* aligned */
+
+  new->extension_gplus = (Univcoord_T *) NULL;
+  new->extension_qstart_gplus = (int *) NULL;
+  new->extension_qend_gplus = (int *) NULL;
+  new->extension_gplus_alloc = 0;
+
+  new->extension_gminus = (Univcoord_T *) NULL;
+  new->extension_qstart_gminus = (int *) NULL;
+  new->extension_qend_gminus = (int *) NULL;
+  new->extension_gminus_alloc = 0;
+
+#ifdef MEMUSAGE
+  new->memusage_std_kept = std_heap_keep(memusage_start);
+#endif
+
+  return new;
+}
+
+static void
+object_free (T *old) {
+
+#ifdef MEMUSAGE
+  Mem_usage_std_heap_add((*old)->memusage_std_kept);
+#endif
+
+  free_arrays(*old);
+  FREE_ALIGN((*old)->streamspace_alloc);
+
+  FREE_KEEP((*old)->extension_gplus);
+  FREE_KEEP((*old)->extension_qstart_gplus);
+  FREE_KEEP((*old)->extension_qend_gplus);
+  FREE_KEEP((*old)->extension_gminus);
+  FREE_KEEP((*old)->extension_qstart_gminus);
+  FREE_KEEP((*old)->extension_qend_gminus);
+
+  FREE_KEEP(*old);
+  return;
+}
+
+
+static void
+cache_free (void *data) {
+  Cache_T cache = (Cache_T) data;
+  int i;
+
+  for (i = 0; i < cache->n; i++) {
+    object_free(&(cache->objects[i]));
+  }
+  FREE_KEEP(cache);
+  return;
+}
+
+#ifdef HAVE_PTHREAD
+static void
+cache_key_create (void) {
+  pthread_key_create(&cache_key,cache_free);
+  return;
+}
+#endif
+
+static Cache_T
+cache_get (void) {
+  Cache_T cache;
+
+#ifdef HAVE_PTHREAD
+  pthread_once(&cache_once,cache_key_create);
+  if ((cache = (Cache_T) pthread_getspecific(cache_key)) == NULL) {
+#else
+  if ((cache = cache_global) == NULL) {
+#endif
+    cache = (Cache_T) MALLOC_KEEP(sizeof(*cache));
+    cache->n = 0;
+#ifdef MEMUSAGE
+    cache->nbuilt = 0;
+    cache->nreused = 0;
+#endif
+#ifdef HAVE_PTHREAD
+    pthread_setspecific(cache_key,(void *) cache);
+#else
+    cache_global = cache;
+#endif
+  }
+
+  return cache;
+}
+
+
+#ifdef MEMUSAGE
+void
+Stage1_report_reuse (long int *nbuilt, long int *nreused) {
+  Cache_T cache = cache_get();
+
+  *nbuilt = cache->nbuilt;
+  *nreused = cache->nreused;
+  return;
+}
+#endif
+
+
+/* Copies extension results into arrays kept with this object */
+void
+Stage1_reserve_extension (T this, int nextension_gplus, int nextension_gminus) {
+
+  if (nextension_gplus > this->extension_gplus_alloc) {
+    FREE_KEEP(this->extension_gplus);
+    FREE_KEEP(this->extension_qstart_gplus);
+    FREE_KEEP(this->extension_qend_gplus);
+    this->extension_gplus = (Univcoord_T *) MALLOC_KEEP(nextension_gplus*sizeof(Univcoord_T));
+    this->extension_qstart_gplus = (int *) MALLOC_KEEP(nextension_gplus*sizeof(int));
+    this->extension_qend_gplus = (int *) MALLOC_KEEP(nextension_gplus*sizeof(int));
+    this->extension_gplus_alloc = nextension_gplus;
+  }
+
+  if (nextension_gminus > this->extension_gminus_alloc) {
+    FREE_KEEP(this->extension_gminus);
+    FREE_KEEP(this->extension_qstart_gminus);
+    FREE_KEEP(this->extension_qend_gminus);
+    this->extension_gminus = (Univcoord_T *) MALLOC_KEEP(nextension_gminus*sizeof(Univcoord_T));
+    this->extension_qstart_gminus = (int *) MALLOC_KEEP(nextension_gminus*sizeof(int));
+    this->extension_qend_gminus = (int *) MALLOC_KEEP(nextension_gminus*sizeof(int));
+    this->extension_gminus_alloc = nextension_gminus;
+  }
+
+  return;
+}
+
+
+T
+Stage1_new (char *queryuc_ptr, int querylength, bool first_read_p) {
+  T new;
+  Cache_T cache = cache_get();
+  int overhang = index1interval - 1;
+  int overhang_tr = index1interval_tr - 1;
+#ifdef MEMUSAGE
+  long int memusage_start;
+#endif
+
+  if (cache->n == 0) {
+    new = object_new(queryuc_ptr,querylength);
+#ifdef MEMUSAGE
+    cache->nbuilt += 1;
+#endif
+
+  } else {
+    new = cache->objects[--cache->n];
+    if (new->querylength_alloc >= querylength) {
+#ifdef MEMUSAGE
+      cache->nreused += 1;
+#endif
+    } else {
+#ifdef MEMUSAGE
+      memusage_start = Mem_usage_report_std_heap();
+#endif
+      free_arrays(new);
+      alloc_arrays(new,queryuc_ptr,querylength);
+#ifdef MEMUSAGE
+      new->memusage_std_kept += std_heap_keep(memusage_start);
+      cache->nbuilt += 1;
+#endif
+    }
+  }
+
   new->first_read_p = first_read_p;
 
   new->sense_trnums = (Trnum_T *) NULL;
@@ -229,14 +590,8 @@ Stage1_new (char *queryuc_ptr, int querylength, bool first_read_p) {
   new->all_nunivdiagonals_gplus = 0;
   new->all_nunivdiagonals_gminus = 0;
 
-  new->extension_gplus = (Univcoord_T *) NULL;
-  new->extension_qstart_gplus = (int *) NULL;
-  new->extension_qend_gplus = (int *) NULL;
+  /* Extension arrays are kept, and filled by Stage1_reserve_extension */
   new->nextension_gplus = 0;
-
-  new->extension_gminus = (Univcoord_T *) NULL;
-  new->extension_qstart_gminus = (int *) NULL;
-  new->extension_qend_gminus = (int *) NULL;
   new->nextension_gminus = 0;
 
   new->exhaustive_gplus = (Univcoord_T *) NULL; /* aligned */
@@ -268,179 +623,74 @@ Stage1_new (char *queryuc_ptr, int querylength, bool first_read_p) {
   new->antisense_paths_gplus = (Path_T *) NULL;
   new->antisense_paths_gminus = (Path_T *) NULL;
 
-#if 0
-  new->sense_coords_gplus = (Univcoord_T *) NULL; /* aligned */
-  new->sense_coords_gminus = (Univcoord_T *) NULL; /* aligned */
-  new->antisense_coords_gplus = (Univcoord_T *) NULL; /* aligned */
-  new->antisense_coords_gminus = (Univcoord_T *) NULL; /* aligned */
-
-  new->sense_indices_gplus = (int *) NULL;
-  new->sense_indices_gminus = (int *) NULL;
-  new->antisense_indices_gplus = (int *) NULL;
-  new->antisense_indices_gminus = (int *) NULL;
-
-  new->n_sense_paths_gplus = 0;
-  new->n_sense_paths_gminus = 0;
-  new->n_antisense_paths_gplus = 0;
-  new->n_antisense_paths_gminus = 0;
-
-  new->nunique_sense_coords_gplus = 0;
-  new->nunique_sense_coords_gminus = 0;
-  new->nunique_antisense_coords_gplus = 0;
-  new->nunique_antisense_coords_gminus = 0;
-#endif
-
-  new->reader = Reader_new(queryuc_ptr,/*querystart*/0,/*queryend*/querylength,/*oligosize*/index1part);
-
-  new->validp = (bool *) CALLOC(querylength+overhang,sizeof(bool));
+  /* Kept arrays are reset to their state after allocation in earlier versions */
+  Reader_reinit(new->reader,queryuc_ptr,/*querystart*/0,/*queryend*/querylength);
+  memset(new->validp,0,(querylength+overhang)*sizeof(bool));
 
   new->all_oligos_gen_filledp = false;
   new->all_positions_gen_filledp = false;
 
-  new->forward_oligos = (Oligospace_T *) MALLOC((querylength+overhang)*sizeof(Oligospace_T));
-  new->revcomp_oligos = (Oligospace_T *) MALLOC((querylength+overhang)*sizeof(Oligospace_T));
-
-  if (transcriptome == NULL) {
-    new->tr_reader = (Reader_T) NULL;
-    new->tr_validp = (bool *) NULL;
-    new->tr_forward_oligos = new->tr_revcomp_oligos = (Oligospace_T *) NULL;
-
-  } else if (index1part_tr == index1part) {
-    new->tr_reader = new->reader;
-    new->tr_validp = new->validp;
-    new->tr_forward_oligos = new->forward_oligos;
-    new->tr_revcomp_oligos = new->revcomp_oligos;
-
+  if (transcriptome == NULL || index1part_tr == index1part) {
+    /* tr_reader and tr_validp are either NULL or shared */
   } else {
-    new->tr_reader = Reader_new(queryuc_ptr,/*querystart*/0,/*queryend*/querylength,/*oligosize*/index1part_tr);
-    new->tr_validp = (bool *) CALLOC(querylength+overhang_tr,sizeof(bool));
-    new->tr_forward_oligos = (Oligospace_T *) MALLOC((querylength+overhang_tr)*sizeof(Oligospace_T));
-    new->tr_revcomp_oligos = (Oligospace_T *) MALLOC((querylength+overhang_tr)*sizeof(Oligospace_T));
+    Reader_reinit(new->tr_reader,queryuc_ptr,/*querystart*/0,/*queryend*/querylength);
+    memset(new->tr_validp,0,(querylength+overhang_tr)*sizeof(bool));
   }
 
-  new->retrievedp_allocated = (bool *) CALLOC(2 * (querylength+overhang),sizeof(bool));
+  memset(new->retrievedp_allocated,0,2 * (querylength+overhang)*sizeof(bool));
   new->plus_retrievedp = &(new->retrievedp_allocated[overhang]);
   new->minus_retrievedp = &(new->retrievedp_allocated[(querylength+overhang)+overhang]);
 
 #ifdef LARGE_GENOMES
-  new->positions_high_allocated = (unsigned char **) CALLOC(2 * (querylength+overhang),sizeof(unsigned char *));
+  memset(new->positions_high_allocated,0,2 * (querylength+overhang)*sizeof(unsigned char *));
   new->plus_positions_high = &(new->positions_high_allocated[overhang]);
   new->minus_positions_high = &(new->positions_high_allocated[(querylength+overhang)+overhang]);
 #endif
-  new->positions_allocated = (UINT4 **) CALLOC(2 * (querylength+overhang),sizeof(UINT4 *));
+  memset(new->positions_allocated,0,2 * (querylength+overhang)*sizeof(UINT4 *));
   new->plus_positions = &(new->positions_allocated[overhang]);
   new->minus_positions = &(new->positions_allocated[(querylength+overhang)+overhang]);
 
-  new->npositions_allocated = (int *) CALLOC(2 * (querylength+overhang),sizeof(int));
+  memset(new->npositions_allocated,0,2 * (querylength+overhang)*sizeof(int));
   new->plus_npositions = &(new->npositions_allocated[overhang]);
   new->minus_npositions = &(new->npositions_allocated[(querylength+overhang)+overhang]);
-  new->plus_diagterms = (int *) MALLOC(querylength*sizeof(int));
-  new->minus_diagterms = (int *) MALLOC(querylength*sizeof(int));
 
   if (transcriptome == NULL) {
-    new->tr_retrievedp_allocated = (bool *) NULL;
     new->tr_plus_retrievedp = new->tr_minus_retrievedp = (bool *) NULL;
-
-    new->tr_positions_allocated = (UINT4 **) NULL;
     new->tr_plus_positions = new->tr_minus_positions = (UINT4 **) NULL;
-
-    new->tr_npositions_allocated = (int *) NULL;
     new->tr_plus_npositions = new->tr_minus_npositions = (int *) NULL;
 
   } else {
-    new->tr_retrievedp_allocated = (bool *) CALLOC(2 * (querylength+overhang_tr),sizeof(bool));
+    memset(new->tr_retrievedp_allocated,0,2 * (querylength+overhang_tr)*sizeof(bool));
     new->tr_plus_retrievedp = &(new->tr_retrievedp_allocated[overhang_tr]);
     new->tr_minus_retrievedp = &(new->tr_retrievedp_allocated[(querylength+overhang_tr)+overhang_tr]);
 
-    new->tr_positions_allocated = (UINT4 **) CALLOC(2 * (querylength+overhang_tr),sizeof(UINT4 *));
+    memset(new->tr_positions_allocated,0,2 * (querylength+overhang_tr)*sizeof(UINT4 *));
     new->tr_plus_positions = &(new->tr_positions_allocated[overhang_tr]);
     new->tr_minus_positions = &(new->tr_positions_allocated[(querylength+overhang_tr)+overhang_tr]);
 
-    new->tr_npositions_allocated = (int *) CALLOC(2 * (querylength+overhang_tr),sizeof(int));
+    memset(new->tr_npositions_allocated,0,2 * (querylength+overhang_tr)*sizeof(int));
     new->tr_plus_npositions = &(new->tr_npositions_allocated[overhang_tr]);
     new->tr_minus_npositions = &(new->tr_npositions_allocated[(querylength+overhang_tr)+overhang_tr]);
   }
-  new->tr_plus_diagterms = (int *) MALLOC(querylength*sizeof(int));
-  new->tr_minus_diagterms = (int *) MALLOC(querylength*sizeof(int));
-
-
-  /* Need to allocate (max_mismatches+MISMATCH_EXTRA), where
-     max_mismatches is provided to Genomebits_mismatches_left or
-     Genome_mismatches_right */
-  /* new->mismatch_positions_alloc = (int *) MALLOC((querylength+MISMATCH_EXTR)*sizeof(int)); */
-  new->positions_alloc = (int *) MALLOC((querylength+1)*sizeof(int));
-  new->indelinfo = Indelinfo_new(querylength);
-  new->spliceinfo = Spliceinfo_new(querylength);
-
-  /* mergeinfo_tr used only on trdiagonals, not for localdb */
-  new->mergeinfo_tr = Mergeinfo_uint4_new(querylength,/*max_localdb_distance*/0);
-#ifdef LARGE_GENOMES
-  new->mergeinfo = Mergeinfo_uint8_new(querylength,positive_gap_distance);
-#else
-  new->mergeinfo = Mergeinfo_uint4_new(querylength,positive_gap_distance);
-#endif
 
-  /* Memory allocated for Segment_identify in segment-search.c, and
-     Merge_diagonals in kmer-search.c (which needs four sets of
-     arrays) */
 #ifdef LARGE_GENOMES
-  new->stream_high_alloc = (unsigned char **) MALLOC(4*querylength*sizeof(unsigned char *));
   new->gplus_stream_high_array_5 = &(new->stream_high_alloc[0]);
   new->gminus_stream_high_array_5 = &(new->stream_high_alloc[querylength]);
   new->gplus_stream_high_array_3 = &(new->stream_high_alloc[2*querylength]);
   new->gminus_stream_high_array_3 = &(new->stream_high_alloc[3*querylength]);
 
-  new->stream_low_alloc = (UINT4 **) MALLOC(4*querylength*sizeof(UINT4 *));
   new->gplus_stream_low_array_5 = &(new->stream_low_alloc[0]);
   new->gminus_stream_low_array_5 = &(new->stream_low_alloc[querylength]);
   new->gplus_stream_low_array_3 = &(new->stream_low_alloc[2*querylength]);
   new->gminus_stream_low_array_3 = &(new->stream_low_alloc[3*querylength]);
 #endif
 
-  new->streamspace_max_alloc = max_localdb_nregions * LOCALDB_REGION_SIZE;
-  MALLOC_ALIGN(new->streamspace_alloc,new->streamspace_max_alloc * sizeof(Univcoord_T)); /* aligned */
-
-  /* Previously allocated 4*querylength, for Kmer_exact2, when shortsplice_dist < 65536 */
-  new->streamptr_alloc = (Univcoord_T **) MALLOC(max_nstreams*sizeof(Univcoord_T *));
-
-#if 0
-  /* Used for Kmer_exact2 */
-  new->gplus_stream_array_5 = &(new->streamptr_alloc[0]);
-  new->gminus_stream_array_5 = &(new->streamptr_alloc[querylength]);
-  new->gplus_stream_array_3 = &(new->streamptr_alloc[2*querylength]);
-  new->gminus_stream_array_3 = &(new->streamptr_alloc[3*querylength]);
-
-#ifdef LARGE_GENOMES
-  new->tplus_stream_array = new->gplus_stream_low_array_5;
-  new->tminus_stream_array = new->gminus_stream_low_array_5;
-#else
-  new->tplus_stream_array = new->gplus_stream_array_5;
-  new->tminus_stream_array = new->gminus_stream_array_5;
-#endif
-#endif
-
-  new->streamsize_alloc = (int *) MALLOC(max_nstreams * sizeof(int));
   new->tplus_streamsize_array = &(new->streamsize_alloc[0]);
   new->tminus_streamsize_array = &(new->streamsize_alloc[querylength]);
 
-
-  /* Used for Kmer_exact2 */
-  /* new->gplus_streamsize_array_5 = &(new->streamsize_alloc[0]); */
-  /* new->gminus_streamsize_array_5 = &(new->streamsize_alloc[querylength]); */
-  /* new->gplus_streamsize_array_3 = &(new->streamsize_alloc[2*querylength]); */
-  /* new->gminus_streamsize_array_3 = &(new->streamsize_alloc[3*querylength]); */
-
-  /* Previously needed 4*querylength for Kmer_exact2 */
-  new->querypos_diagterm_alloc = (int *) MALLOC(2*querylength*sizeof(int));
   new->tplus_diagterm_array = &(new->querypos_diagterm_alloc[0]);
   new->tminus_diagterm_array = &(new->querypos_diagterm_alloc[querylength]);
 
-  /* Used for Kmer_exact2 */
-  /* new->gplus_diagterm_array_5 = &(new->querypos_diagterm_alloc[0]); */
-  /* new->gminus_diagterm_array_5 = &(new->querypos_diagterm_alloc[querylength]); */
-  /* new->gplus_diagterm_array_3 = &(new->querypos_diagterm_alloc[2*querylength]); */
-  /* new->gminus_diagterm_array_3 = &(new->querypos_diagterm_alloc[3*querylength]); */
-
   /* Uses Listpool_T procedures */
   new->queryfwd_plus_set = (List_T) NULL;
   new->queryfwd_minus_set = (List_T) NULL;
@@ -1589,6 +1839,7 @@ Stage1_free (T *old, Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool,
 	     Uintlistpool_T uintlistpool, Univcoordlistpool_T univcoordlistpool,
 	     Listpool_T listpool, Pathpool_T pathpool, Trpathpool_T trpathpool,
 	     Transcriptpool_T transcriptpool, Hitlistpool_T hitlistpool, bool free_paths_p) {
+  Cache_T cache;
 
   /* Stage1hr_check(*old); */
 
@@ -1607,13 +1858,6 @@ Stage1_free (T *old, Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool,
     FREE_ALIGN((*old)->all_univdiagonals_gplus);
     FREE_ALIGN((*old)->all_univdiagonals_gminus);
 
-    FREE((*old)->extension_gplus); /* Not aligned */
-    FREE((*old)->extension_qstart_gplus);
-    FREE((*old)->extension_qend_gplus);
-    FREE((*old)->extension_gminus);
-    FREE((*old)->extension_qstart_gminus);
-    FREE((*old)->extension_qend_gminus);
-
     FREE_ALIGN((*old)->exhaustive_gplus);
     FREE((*old)->exhaustive_qstart_gplus);
     FREE((*old)->exhaustive_qend_gplus);
@@ -1632,82 +1876,6 @@ Stage1_free (T *old, Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool,
 
     }
 
-#if 0
-    /* Now pointing to data structure, and not copying values */
-    for (i = 0; i <= query_lastpos; i++) {
-      if ((*old)->plus_retrievedp[i] == true) {
-#ifdef LARGE_GENOMES
-	FREE((*old)->plus_positions_high[i]);
-#endif
-	FREE((*old)->plus_positions[i]);
-      }
-
-      if ((*old)->minus_retrievedp[i] == true) {
-#ifdef LARGE_GENOMES
-	FREE((*old)->minus_positions_high[i]);
-#endif
-	FREE((*old)->minus_positions[i]);
-      }
-    }
-#endif
-
-    /* FREE((*old)->mismatch_positions_alloc); */
-    FREE((*old)->positions_alloc);
-
-    Mergeinfo_uint4_free(&(*old)->mergeinfo_tr);
-#ifdef LARGE_GENOMES
-    Mergeinfo_uint8_free(&(*old)->mergeinfo);
-#else
-    Mergeinfo_uint4_free(&(*old)->mergeinfo);
-#endif
-    Spliceinfo_free(&(*old)->spliceinfo);
-    Indelinfo_free(&(*old)->indelinfo);
-
-#ifdef LARGE_GENOMES
-    FREE((*old)->stream_high_alloc);
-    FREE((*old)->stream_low_alloc);
-#endif
-    FREE_ALIGN((*old)->streamspace_alloc);
-    FREE((*old)->streamptr_alloc);
-    FREE((*old)->streamsize_alloc);
-    FREE((*old)->querypos_diagterm_alloc);
-
-
-    FREE((*old)->retrievedp_allocated);
-#ifdef LARGE_GENOMES
-    FREE((*old)->positions_high_allocated);
-#endif
-    FREE((*old)->positions_allocated);
-    FREE((*old)->npositions_allocated);
-    if (transcriptome == NULL) {
-      /* Skip */
-    } else {
-      FREE((*old)->tr_retrievedp_allocated);
-      FREE((*old)->tr_positions_allocated);
-      FREE((*old)->tr_npositions_allocated);
-    }
-
-    FREE((*old)->plus_diagterms);
-    FREE((*old)->minus_diagterms);
-    FREE((*old)->tr_plus_diagterms);
-    FREE((*old)->tr_minus_diagterms);
-
-    FREE((*old)->revcomp_oligos);
-    FREE((*old)->forward_oligos);
-    FREE((*old)->validp);
-    Reader_free(&(*old)->reader);
-
-    if (transcriptome == NULL) {
-      /* Skip */
-    } else if (index1part_tr == index1part) {
-      /* Skip */
-    } else {
-      FREE((*old)->tr_revcomp_oligos);
-      FREE((*old)->tr_forward_oligos);
-      FREE((*old)->tr_validp);
-      Reader_free(&(*old)->tr_reader);
-    }
-
     Elt_gc(&(*old)->queryfwd_plus_set,listpool,univdiagpool);
     Elt_gc(&(*old)->queryfwd_minus_set,listpool,univdiagpool);
     Elt_gc(&(*old)->queryrev_plus_set,listpool,univdiagpool);
@@ -1718,7 +1886,14 @@ Stage1_free (T *old, Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool,
     Tr_elt_gc(&(*old)->tr_queryrev_plus_set,listpool,trdiagpool);
     Tr_elt_gc(&(*old)->tr_queryrev_minus_set,listpool,trdiagpool);
 
-    FREE(*old);
+    /* Keep for the next read in this thread */
+    cache = cache_get();
+    if (cache->n < NCACHED) {
+      cache->objects[cache->n++] = *old;
+      *old = (T) NULL;
+    } else {
+      object_free(&(*old));
+    }
   }
 
   return;
@@ -77,11 +77,13 @@ struct T {
   int *extension_qstart_gplus;
   int *extension_qend_gplus;
   int nextension_gplus;
+  int extension_gplus_alloc;	/* Capacity, kept between reads */
 
   Univcoord_T *extension_gminus;
   int *extension_qstart_gminus;
   int *extension_qend_gminus;
   int nextension_gminus;
+  int extension_gminus_alloc;
 
   /* Additional result from Kmer_prevalent, used for anchoring */
   Univcoord_T *exhaustive_gplus; /* Memory is aligned */
@@ -159,6 +161,12 @@ struct T {
 #endif
 
 
+  /* Arrays from here on are kept between reads, sized for the longest query so far */
+  int querylength_alloc;
+#ifdef MEMUSAGE
+  long int memusage_std_kept;	/* Allocated by constructors from the standard pool */
+#endif
+
   Reader_T reader;
   Reader_T tr_reader;
 
@@ -307,6 +315,14 @@ Stage1_free (T *old, Trdiagpool_T trdiagpool, Univdiagpool_T univdiagpool,
 extern T
 Stage1_new (char *queryuc_ptr, int querylength, bool first_read_p);
 
+extern void
+Stage1_reserve_extension (T this, int nextension_gplus, int nextension_gminus);
+
+#ifdef MEMUSAGE
+extern void
+Stage1_report_reuse (long int *nbuilt, long int *nreused);
+#endif
+
 extern void
 Stage1_collect_unextended_paths (List_T *unextended_sense_paths_gplus,
 				 List_T *unextended_sense_paths_gminus,
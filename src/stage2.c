@@ -8,6 +8,7 @@ static char rcsid[] = "$Id: stage2.c 225436 2022-12-07 01:34:49Z twu $";
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <limits.h>		/* For INT_MIN */
 
 #include "assert.h"
 #include "mem.h"
@@ -19,6 +20,7 @@ static char rcsid[] = "$Id: stage2.c 225436 2022-12-07 01:34:49Z twu $";
 #include "genome_canonical.h"
 #include "complement.h"
 #include "maxent_hr.h"
+#include "rangemax.h"
 
 
 /* Tests whether genomicseg == query in convert_to_nucleotides, and
@@ -68,6 +70,12 @@ static char rcsid[] = "$Id: stage2.c 225436 2022-12-07 01:34:49Z twu $";
 
 #define INFINITE 1000000
 
+/* The sparse chainer builds a range-maximum tree for a querypos with
+   at least SPARSE_MIN_NACTIVE active hits, and scans range 2 directly
+   when it has at most SPARSE_SCAN_LENGTH hits */
+#define SPARSE_MIN_NACTIVE 64
+#define SPARSE_SCAN_LENGTH 16
+
 /* EQUAL_DISTANCE used to be 3 for PMAP and 6 for GMAP, but that
    allowed indels in repetitive regions.  Now have separate
    variables. */
@@ -123,13 +131,14 @@ static bool snps_p;
 static int sufflookback;
 static int nsufflookback;
 static int maxintronlen;
+static bool sparse_chaining_p;
 
 
 void
 Stage2_setup (bool splicingp_in, bool cross_species_p,
 	      int suboptimal_score_start_in, int suboptimal_score_end_in,
 	      int sufflookback_in, int nsufflookback_in, int maxintronlen_in,
-	      Mode_T mode_in, bool snps_p_in) {
+	      Mode_T mode_in, bool snps_p_in, bool sparse_chaining_p_in) {
   splicingp = splicingp_in;
   if (splicingp == true) {
     use_canonical_ends_p = true;
@@ -150,6 +159,7 @@ Stage2_setup (bool splicingp_in, bool cross_species_p,
 
   mode = mode_in;
   snps_p = snps_p_in;
+  sparse_chaining_p = sparse_chaining_p_in;
   return;
 }
 
@@ -1069,11 +1079,265 @@ while (prevhit + 4 < high_hit) {
 #endif
 
 
+/* Canonical tests for range 2, as in the scans below */
+static bool
+canonical_lookback_p (Genome_T genome, Genome_T genomealt, Chrpos_T prevposition, Chrpos_T position,
+		      int querydistance, int indexsize_nt, Univcoord_T chroffset, Univcoord_T chrhigh,
+		      bool plusp) {
+  Univcoord_T prevpos, currpos;
+
+  if (plusp == true) {
+    prevpos = chroffset + prevposition + indexsize_nt;
+    currpos = chroffset + position - querydistance + indexsize_nt;
+    if (prevpos < GREEDY_ADVANCE || currpos < GREEDY_ADVANCE) {
+      return false;
+    } else if (Genome_sense_canonicalp(genome,genomealt,
+				       /*donor_rightbound*/prevpos + MISS_BEHIND,
+				       /*donor_leftbound*/prevpos - GREEDY_ADVANCE,
+				       /*acceptor_rightbound*/currpos + MISS_BEHIND,
+				       /*acceptor_leftbound*/currpos - GREEDY_ADVANCE,
+				       chroffset) == true) {
+      return true;
+    } else {
+      return Genome_antisense_canonicalp(genome,genomealt,
+					 /*donor_rightbound*/currpos + MISS_BEHIND,
+					 /*donor_leftbound*/currpos - GREEDY_ADVANCE,
+					 /*acceptor_rightbound*/prevpos + MISS_BEHIND,
+					 /*acceptor_leftbound*/prevpos - GREEDY_ADVANCE,
+					 chroffset);
+    }
+
+  } else {
+    prevpos = chrhigh + 1 - prevposition - indexsize_nt;
+    currpos = chrhigh + 1 - position + querydistance - indexsize_nt;
+    if (currpos < MISS_BEHIND || prevpos < MISS_BEHIND) {
+      return false;
+    } else if (Genome_sense_canonicalp(genome,genomealt,
+				       /*donor_rightbound*/currpos + GREEDY_ADVANCE,
+				       /*donor_leftbound*/currpos - MISS_BEHIND,
+				       /*acceptor_rightbound*/prevpos + GREEDY_ADVANCE,
+				       /*acceptor_leftbound*/prevpos - MISS_BEHIND,
+				       chroffset) == true) {
+      return true;
+    } else {
+      return Genome_antisense_canonicalp(genome,genomealt,
+					 /*donor_rightbound*/prevpos + GREEDY_ADVANCE,
+					 /*donor_leftbound*/prevpos - MISS_BEHIND,
+					 /*acceptor_rightbound*/currpos + GREEDY_ADVANCE,
+					 /*acceptor_leftbound*/currpos - MISS_BEHIND,
+					 chroffset);
+    }
+  }
+}
+
+static bool
+canonical_lookforward_p (Genome_T genome, Genome_T genomealt, Chrpos_T prevposition, Chrpos_T position,
+			 int querydistance, Univcoord_T chroffset, Univcoord_T chrhigh, bool plusp) {
+  Univcoord_T prevpos, currpos;
+
+  if (plusp == true) {
+    prevpos = chroffset + prevposition;
+    currpos = chroffset + position + querydistance;
+    if (currpos < MISS_BEHIND || prevpos < MISS_BEHIND) {
+      return false;
+    } else if (Genome_sense_canonicalp(genome,genomealt,
+				       /*donor_rightbound*/currpos + GREEDY_ADVANCE,
+				       /*donor_leftbound*/currpos - MISS_BEHIND,
+				       /*acceptor_rightbound*/prevpos + GREEDY_ADVANCE,
+				       /*acceptor_leftbound*/prevpos - MISS_BEHIND,
+				       chroffset) == true) {
+      return true;
+    } else {
+      return Genome_antisense_canonicalp(genome,genomealt,
+					 /*donor_rightbound*/prevpos + GREEDY_ADVANCE,
+					 /*donor_leftbound*/prevpos - MISS_BEHIND,
+					 /*acceptor_rightbound*/currpos + GREEDY_ADVANCE,
+					 /*acceptor_leftbound*/currpos - MISS_BEHIND,
+					 chroffset);
+    }
+
+  } else {
+    prevpos = chrhigh + 1 - prevposition;
+    currpos = chrhigh + 1 - position - querydistance;
+    if (prevpos < GREEDY_ADVANCE || currpos < GREEDY_ADVANCE) {
+      return false;
+    } else if (Genome_sense_canonicalp(genome,genomealt,
+				       /*donor_rightbound*/prevpos + MISS_BEHIND,
+				       /*donor_leftbound*/prevpos - GREEDY_ADVANCE,
+				       /*acceptor_rightbound*/currpos + MISS_BEHIND,
+				       /*acceptor_leftbound*/currpos - GREEDY_ADVANCE,
+				       chroffset) == true) {
+      return true;
+    } else {
+      return Genome_antisense_canonicalp(genome,genomealt,
+					 /*donor_rightbound*/currpos + MISS_BEHIND,
+					 /*donor_leftbound*/currpos - GREEDY_ADVANCE,
+					 /*acceptor_rightbound*/prevpos + MISS_BEHIND,
+					 /*acceptor_leftbound*/prevpos - GREEDY_ADVANCE,
+					 chroffset);
+    }
+  }
+}
+
+
+/* diffdistance for the hit at index, which is positive in range 2 */
+static long long
+sparse_diffdistance (Rangemax_T rangemax, int index, Chrpos_T position, int querydistance,
+		     bool lookforwardp) {
+  if (lookforwardp == true) {
+    return (long long) Rangemax_position(rangemax,index) - (long long) position - querydistance;
+  } else {
+    return (long long) position - querydistance - (long long) Rangemax_position(rangemax,index);
+  }
+}
+
+/* diffdistance decreases along the active list.  Returns the first
+   index in lo..hi-1 where it is at most bound, or hi */
+static int
+sparse_first_within (Rangemax_T rangemax, int lo, int hi, Chrpos_T position, int querydistance,
+		     bool lookforwardp, long long bound) {
+  int middle;
+
+  while (lo < hi) {
+    middle = lo + (hi - lo)/2;
+    if (sparse_diffdistance(rangemax,middle,position,querydistance,lookforwardp) <= bound) {
+      hi = middle;
+    } else {
+      lo = middle + 1;
+    }
+  }
+  return lo;
+}
+
+
+/* Range 2 for the sparse chainer, with splicing.  Gives the same
+   result as the scan, where the first hit with the best score wins.
+   The penalty diffdistance/TEN_THOUSAND + 1 is constant over each
+   bucket of TEN_THOUSAND positions, so one range-maximum query per
+   bucket gives the best score before the canonical penalty.  That
+   penalty lowers a score by at most non_canonical_penalty, so only
+   hits within that much of the best need their splice sites checked.
+   Sets *winner to the hit that beats best_score, or -1, and returns
+   the first hit after range 2. */
+static int
+sparse_range2 (int *winner, int *winner_score, Rangemax_T rangemax, int prevhit,
+	       Chrpos_T position, int querydistance, int querydist_credit, int best_score,
+	       Genome_T genome, Genome_T genomealt, Univcoord_T chroffset, Univcoord_T chrhigh,
+	       bool plusp, int indexsize_nt, bool use_canonical_p, int non_canonical_penalty,
+	       bool lookforwardp) {
+  int n = Rangemax_length(rangemax), lo, end, bucketstart, bucketend, index;
+  int bucket, upper_bound, max, threshold, score;
+  bool canonicalp;
+
+  *winner = -1;
+  lo = Rangemax_index(rangemax,prevhit);
+  end = sparse_first_within(rangemax,lo,n,position,querydistance,lookforwardp,
+			    /*bound*/EQUAL_DISTANCE_NOT_SPLICING);
+
+  if (end - lo <= SPARSE_SCAN_LENGTH) {
+    upper_bound = INT_MIN;	/* Every hit is a candidate */
+  } else {
+    upper_bound = INT_MIN;
+    for (bucketstart = lo; bucketstart < end; bucketstart = bucketend) {
+      bucket = (int) (sparse_diffdistance(rangemax,bucketstart,position,querydistance,lookforwardp)/TEN_THOUSAND);
+      bucketend = sparse_first_within(rangemax,bucketstart,end,position,querydistance,lookforwardp,
+				      /*bound*/(long long) bucket*TEN_THOUSAND - 1);
+      if ((max = Rangemax_max(rangemax,bucketstart,bucketend) - (bucket + 1)) > upper_bound) {
+	upper_bound = max;
+      }
+    }
+    if (use_canonical_p == true) {
+      upper_bound -= non_canonical_penalty;
+    }
+  }
+
+  for (bucketstart = lo; bucketstart < end; bucketstart = bucketend) {
+    bucket = (int) (sparse_diffdistance(rangemax,bucketstart,position,querydistance,lookforwardp)/TEN_THOUSAND);
+    bucketend = sparse_first_within(rangemax,bucketstart,end,position,querydistance,lookforwardp,
+				    /*bound*/(long long) bucket*TEN_THOUSAND - 1);
+
+    /* Needs to reach upper_bound, and to beat best_score before any canonical penalty */
+    if (upper_bound == INT_MIN) {
+      threshold = best_score - querydist_credit + bucket + 2;
+    } else if ((threshold = upper_bound + bucket + 1) < best_score - querydist_credit + bucket + 2) {
+      threshold = best_score - querydist_credit + bucket + 2;
+    }
+
+    index = bucketstart;
+    while ((index = Rangemax_first_atleast(rangemax,index,bucketend,threshold)) >= 0) {
+      score = Rangemax_score(rangemax,index) + querydist_credit - (bucket + 1);
+      if (use_canonical_p == true) {
+	if (lookforwardp == true) {
+	  canonicalp = canonical_lookforward_p(genome,genomealt,Rangemax_position(rangemax,index),position,
+					       querydistance,chroffset,chrhigh,plusp);
+	} else {
+	  canonicalp = canonical_lookback_p(genome,genomealt,Rangemax_position(rangemax,index),position,
+					    querydistance,indexsize_nt,chroffset,chrhigh,plusp);
+	}
+	if (canonicalp == false) {
+	  score -= non_canonical_penalty;
+	}
+      }
+
+      /* Disallow ties, as in the scan */
+      if (score > best_score) {
+	best_score = score;
+	*winner = Rangemax_hit(rangemax,index);
+	*winner_score = score;
+	if (threshold < best_score - querydist_credit + bucket + 2) {
+	  threshold = best_score - querydist_credit + bucket + 2;
+	}
+      }
+      index++;
+    }
+  }
+
+  if (end < n) {
+    return Rangemax_hit(rangemax,end);
+  } else {
+    return -1;
+  }
+}
+
+
+/* Called after revise_active_lookback or revise_active_lookforward,
+   when the scores at querypos are final */
+static void
+sparse_build (Rangemax_T *rangemaxes, int querypos, int **active, int *firstactive, int *nactive,
+	      Chrpos_T **mappings, int **fwd_scores) {
+  int *hits, *scores, hit, k;
+  Chrpos_T *positions;
+
+  if (rangemaxes[querypos] != NULL) {
+    Rangemax_free(&(rangemaxes[querypos]));
+  }
+
+  if (nactive[querypos] >= SPARSE_MIN_NACTIVE) {
+    hits = (int *) MALLOC(nactive[querypos]*sizeof(int));
+    positions = (Chrpos_T *) MALLOC(nactive[querypos]*sizeof(Chrpos_T));
+    scores = (int *) MALLOCA(nactive[querypos]*sizeof(int));
+
+    k = 0;
+    for (hit = firstactive[querypos]; hit != -1; hit = active[querypos][hit]) {
+      hits[k] = hit;
+      positions[k] = mappings[querypos][hit];
+      scores[k] = fwd_scores[querypos][hit];
+      k++;
+    }
+    rangemaxes[querypos] = Rangemax_new(hits,positions,scores,k);
+    FREEA(scores);
+  }
+
+  return;
+}
+
+
 static void
 score_querypos_lookback_one (int *fwd_tracei, Link_T currlink, int curr_querypos, int currhit,
 			     unsigned int position,
 			     struct Link_T **links, int **fwd_scores, Chrpos_T **mappings,
-			     int **active, int *firstactive, Genome_T genome, Genome_T genomealt,
+			     int **active, int *firstactive, Rangemax_T *rangemaxes,
+			     Genome_T genome, Genome_T genomealt,
 			     Univcoord_T chroffset, Univcoord_T chrhigh, bool plusp,
 			     int indexsize, Intlist_T processed,
 #ifdef MOVE_TO_STAGE3
@@ -1097,7 +1361,7 @@ score_querypos_lookback_one (int *fwd_tracei, Link_T currlink, int curr_querypos
   int canonicalsgn = 0;
 #endif
   bool donep;
-  int prev_querypos, prevhit;
+  int prev_querypos, prevhit, winnerhit;
   Chrpos_T prevposition;
   int gendistance;
   Univcoord_T prevpos, currpos;
@@ -1232,6 +1496,34 @@ score_querypos_lookback_one (int *fwd_tracei, Link_T currlink, int curr_querypos
 	}
       }
 
+      /* Range 2 with the sparse chainer.  Leaves prevhit at range 4 */
+      if (rangemaxes != NULL && rangemaxes[prev_querypos] != NULL && prevhit != -1 && splicingp == true) {
+	prevhit = sparse_range2(&winnerhit,&fwd_score,rangemaxes[prev_querypos],prevhit,position,
+				querydistance,querydist_credit,best_fwd_score,genome,genomealt,
+				chroffset,chrhigh,plusp,indexsize_nt,use_canonical_p,non_canonical_penalty,
+				/*lookforwardp*/false);
+	if (winnerhit >= 0) {
+	  prevlink = &(prev_links[winnerhit]);
+	  diffdistance = position - prev_mappings[winnerhit] - querydistance;
+	  if (diffdistance <= EQUAL_DISTANCE_FOR_CONSECUTIVE) {
+	    best_fwd_consecutive = prevlink->fwd_consecutive + querydistance;
+	  } else {
+	    best_fwd_consecutive = 0;
+	  }
+	  best_fwd_rootposition = prevlink->fwd_rootposition;
+	  best_fwd_score = fwd_score;
+	  best_fwd_prevpos = prev_querypos;
+	  best_fwd_prevhit = winnerhit;
+	  best_fwd_tracei = ++*fwd_tracei;
+#ifdef DEBUG9
+	  best_fwd_intronnfwd = prevlink->fwd_intronnfwd;
+	  best_fwd_intronnrev = prevlink->fwd_intronnrev;
+	  best_fwd_intronnunk = prevlink->fwd_intronnunk;
+#endif
+	  debug9(printf("\tD2 (sparse). Fwd mismatch qpos %d,%d => Best fwd at %d\n",prev_querypos,winnerhit,fwd_score));
+	}
+      }
+
       /* Range 2: From maxintronlen to (prev_querypos + EQUAL_DISTANCE_NOT_SPLICING) */
       /* This is equivalent to +diffdistance > EQUAL_DISTANCE_NOT_SPLICING */
       while (prevhit != -1 && (prevposition = /*mappings[prev_querypos]*/prev_mappings[prevhit]) + EQUAL_DISTANCE_NOT_SPLICING + querydistance < position) {
@@ -1470,7 +1762,7 @@ static void
 score_querypos_lookback_mult (int *fwd_tracei, int low_hit, int high_hit, int curr_querypos,
 			      unsigned int *positions,
 			      struct Link_T **links, int **fwd_scores,
-			      Chrpos_T **mappings, int **active, int *firstactive,
+			      Chrpos_T **mappings, int **active, int *firstactive, Rangemax_T *rangemaxes,
 			      Genome_T genome, Genome_T genomealt,
 			      Univcoord_T chroffset, Univcoord_T chrhigh, bool plusp,
 			      int indexsize, Intlist_T processed,
@@ -1496,7 +1788,7 @@ score_querypos_lookback_mult (int *fwd_tracei, int low_hit, int high_hit, int cu
   int best_fwd_intronnfwd, best_fwd_intronnrev, best_fwd_intronnunk;
   int canonicalsgn = 0;
 #endif
-  int adj_querypos, adj_querydistance, prev_querypos, prevhit, adj_frontier, *frontier;
+  int adj_querypos, adj_querydistance, prev_querypos, prevhit, winnerhit, adj_frontier, *frontier;
   Chrpos_T prevposition, position;
   int gendistance;
   Univcoord_T prevpos, currpos;
@@ -1660,9 +1952,9 @@ score_querypos_lookback_mult (int *fwd_tracei, int low_hit, int high_hit, int cu
 #else
     adj_querydistance = curr_querypos - adj_querypos;
 #endif
-    nprocessed = Intlist_length(processed);
-    frontier = (int *) MALLOCA(nprocessed * sizeof(int));
-
+    /* querydistance increases along processed, so entries past the
+       lookback are never used.  Stopping there keeps this from being
+       quadratic in the query length. */
     nseen = 0;
     for (p = processed; p != NULL; p = Intlist_next(p)) {
       prev_querypos = Intlist_head(p);
@@ -1673,9 +1965,16 @@ score_querypos_lookback_mult (int *fwd_tracei, int low_hit, int high_hit, int cu
       }
       if (nseen <= /*nlookback*/nsufflookback || querydistance - indexsize_nt <= /*lookback*/sufflookback) {
 	max_nonadjacent_nseen = nseen;
+      } else {
+	break;
       }
+      nseen++;
+    }
 
-      frontier[nseen++] = firstactive[prev_querypos];
+    nprocessed = max_nonadjacent_nseen + 1;
+    frontier = (int *) MALLOCA(nprocessed * sizeof(int));
+    for (p = processed, nseen = 0; nseen < nprocessed; p = Intlist_next(p)) {
+      frontier[nseen++] = firstactive[Intlist_head(p)];
     }
     
 
@@ -1797,6 +2096,34 @@ score_querypos_lookback_mult (int *fwd_tracei, int low_hit, int high_hit, int cu
 	    }
 	    frontier[nseen] = prevhit;	/* Store as starting point for next hiti */
 
+	    /* Range 2 with the sparse chainer.  Leaves prevhit at range 4 */
+	    if (rangemaxes != NULL && rangemaxes[prev_querypos] != NULL && prevhit != -1 && splicingp == true) {
+	      prevhit = sparse_range2(&winnerhit,&fwd_score,rangemaxes[prev_querypos],prevhit,position,
+				      querydistance,querydist_credit,best_fwd_score,genome,genomealt,
+				      chroffset,chrhigh,plusp,indexsize_nt,use_canonical_p,non_canonical_penalty,
+				      /*lookforwardp*/false);
+	      if (winnerhit >= 0) {
+		prevlink = &(prev_links[winnerhit]);
+		diffdistance = position - prev_mappings[winnerhit] - querydistance;
+		if (diffdistance <= EQUAL_DISTANCE_FOR_CONSECUTIVE) {
+		  best_fwd_consecutive = prevlink->fwd_consecutive + querydistance;
+		} else {
+		  best_fwd_consecutive = 0;
+		}
+		best_fwd_rootposition = prevlink->fwd_rootposition;
+		best_fwd_score = fwd_score;
+		best_fwd_prevpos = prev_querypos;
+		best_fwd_prevhit = winnerhit;
+		best_fwd_tracei = ++*fwd_tracei;
+#ifdef DEBUG9
+		best_fwd_intronnfwd = prevlink->fwd_intronnfwd;
+		best_fwd_intronnrev = prevlink->fwd_intronnrev;
+		best_fwd_intronnunk = prevlink->fwd_intronnunk;
+#endif
+		debug9(printf("\tD2 (sparse). Fwd mismatch qpos %d,%d => Best fwd at %d\n",prev_querypos,winnerhit,fwd_score));
+	      }
+	    }
+
 	    /* Range 2: From maxintronlen to (prev_querypos + EQUAL_DISTANCE_NOT_SPLICING) */
 	    /* This is equivalent to +diffdistance > EQUAL_DISTANCE_NOT_SPLICING */
 	    while (prevhit != -1 && (prevposition = /*mappings[prev_querypos]*/prev_mappings[prevhit]) + EQUAL_DISTANCE_NOT_SPLICING + querydistance < position) {
@@ -2020,7 +2347,7 @@ static void
 score_querypos_lookforward_one (int *fwd_tracei, Link_T currlink, int curr_querypos, int currhit,
 				unsigned int position,
 				struct Link_T **links, int **fwd_scores,
-				Chrpos_T **mappings, int **active, int *firstactive,
+				Chrpos_T **mappings, int **active, int *firstactive, Rangemax_T *rangemaxes,
 				Genome_T genome, Genome_T genomealt,
 				Univcoord_T chroffset, Univcoord_T chrhigh, bool plusp,
 				int indexsize, Intlist_T processed,
@@ -2044,7 +2371,7 @@ score_querypos_lookforward_one (int *fwd_tracei, Link_T currlink, int curr_query
   int canonicalsgn = 0;
 #endif
   bool donep;
-  int prev_querypos, prevhit;
+  int prev_querypos, prevhit, winnerhit;
   Chrpos_T prevposition;
   int gendistance;
   Univcoord_T prevpos, currpos;
@@ -2175,6 +2502,34 @@ score_querypos_lookforward_one (int *fwd_tracei, Link_T currlink, int curr_query
 	}
       }
 
+      /* Range 2 with the sparse chainer.  Leaves prevhit at range 4 */
+      if (rangemaxes != NULL && rangemaxes[prev_querypos] != NULL && prevhit != -1 && splicingp == true) {
+	prevhit = sparse_range2(&winnerhit,&fwd_score,rangemaxes[prev_querypos],prevhit,position,
+				querydistance,querydist_credit,best_fwd_score,genome,genomealt,
+				chroffset,chrhigh,plusp,indexsize_nt,use_canonical_p,non_canonical_penalty,
+				/*lookforwardp*/true);
+	if (winnerhit >= 0) {
+	  prevlink = &(prev_links[winnerhit]);
+	  diffdistance = prev_mappings[winnerhit] - position - querydistance;
+	  if (diffdistance <= EQUAL_DISTANCE_FOR_CONSECUTIVE) {
+	    best_fwd_consecutive = prevlink->fwd_consecutive + querydistance;
+	  } else {
+	    best_fwd_consecutive = 0;
+	  }
+	  best_fwd_rootposition = prevlink->fwd_rootposition;
+	  best_fwd_score = fwd_score;
+	  best_fwd_prevpos = prev_querypos;
+	  best_fwd_prevhit = winnerhit;
+	  best_fwd_tracei = ++*fwd_tracei;
+#ifdef DEBUG9
+	  best_fwd_intronnfwd = prevlink->fwd_intronnfwd;
+	  best_fwd_intronnrev = prevlink->fwd_intronnrev;
+	  best_fwd_intronnunk = prevlink->fwd_intronnunk;
+#endif
+	  debug9(printf("\tD2 (sparse). Fwd mismatch qpos %d,%d => Best fwd at %d\n",prev_querypos,winnerhit,fwd_score));
+	}
+      }
+
       /* Range 2: From maxintronlen to (prev_querypos + EQUAL_DISTANCE_NOT_SPLICING) */
       /* This is equivalent to +diffdistance > EQUAL_DISTANCE_NOT_SPLICING */
       while (prevhit != -1 && (prevposition = /*mappings[prev_querypos]*/prev_mappings[prevhit]) > position + EQUAL_DISTANCE_NOT_SPLICING + querydistance) {
@@ -2404,7 +2759,7 @@ static void
 score_querypos_lookforward_mult (int *fwd_tracei, int low_hit, int high_hit, int curr_querypos,
 				 unsigned int *positions,
 				 struct Link_T **links, int **fwd_scores,
-				 Chrpos_T **mappings, int **active, int *firstactive,
+				 Chrpos_T **mappings, int **active, int *firstactive, Rangemax_T *rangemaxes,
 				 Genome_T genome, Genome_T genomealt,
 				 Univcoord_T chroffset, Univcoord_T chrhigh, bool plusp,
 				 int indexsize, Intlist_T processed,
@@ -2430,7 +2785,7 @@ score_querypos_lookforward_mult (int *fwd_tracei, int low_hit, int high_hit, int
   int best_fwd_intronnfwd, best_fwd_intronnrev, best_fwd_intronnunk;
   int canonicalsgn = 0;
 #endif
-  int adj_querypos, adj_querydistance, prev_querypos, prevhit, adj_frontier, *frontier;
+  int adj_querypos, adj_querydistance, prev_querypos, prevhit, winnerhit, adj_frontier, *frontier;
   Chrpos_T prevposition, position;
   int gendistance;
   Univcoord_T prevpos, currpos;
@@ -2594,9 +2949,9 @@ score_querypos_lookforward_mult (int *fwd_tracei, int low_hit, int high_hit, int
     adj_querydistance = adj_querypos - curr_querypos;
 #endif
 
-    nprocessed = Intlist_length(processed);
-    frontier = (int *) MALLOCA(nprocessed * sizeof(int));
-
+    /* querydistance increases along processed, so entries past the
+       lookback are never used.  Stopping there keeps this from being
+       quadratic in the query length. */
     nseen = 0;
     for (p = processed; p != NULL; p = Intlist_next(p)) {
       prev_querypos = Intlist_head(p);
@@ -2607,9 +2962,16 @@ score_querypos_lookforward_mult (int *fwd_tracei, int low_hit, int high_hit, int
       }
       if (nseen <= /*nlookback*/nsufflookback || querydistance - indexsize_nt <= /*lookback*/sufflookback) {
 	max_nonadjacent_nseen = nseen;
+      } else {
+	break;
       }
+      nseen++;
+    }
 
-      frontier[nseen++] = firstactive[prev_querypos];
+    nprocessed = max_nonadjacent_nseen + 1;
+    frontier = (int *) MALLOCA(nprocessed * sizeof(int));
+    for (p = processed, nseen = 0; nseen < nprocessed; p = Intlist_next(p)) {
+      frontier[nseen++] = firstactive[Intlist_head(p)];
     }
 
 
@@ -2731,6 +3093,34 @@ score_querypos_lookforward_mult (int *fwd_tracei, int low_hit, int high_hit, int
 	    frontier[nseen] = prevhit;	/* Store as starting point for next hiti */
 	    
 	    
+	    /* Range 2 with the sparse chainer.  Leaves prevhit at range 4 */
+	    if (rangemaxes != NULL && rangemaxes[prev_querypos] != NULL && prevhit != -1 && splicingp == true) {
+	      prevhit = sparse_range2(&winnerhit,&fwd_score,rangemaxes[prev_querypos],prevhit,position,
+				      querydistance,querydist_credit,best_fwd_score,genome,genomealt,
+				      chroffset,chrhigh,plusp,indexsize_nt,use_canonical_p,non_canonical_penalty,
+				      /*lookforwardp*/true);
+	      if (winnerhit >= 0) {
+		prevlink = &(prev_links[winnerhit]);
+		diffdistance = prev_mappings[winnerhit] - position - querydistance;
+		if (diffdistance <= EQUAL_DISTANCE_FOR_CONSECUTIVE) {
+		  best_fwd_consecutive = prevlink->fwd_consecutive + querydistance;
+		} else {
+		  best_fwd_consecutive = 0;
+		}
+		best_fwd_rootposition = prevlink->fwd_rootposition;
+		best_fwd_score = fwd_score;
+		best_fwd_prevpos = prev_querypos;
+		best_fwd_prevhit = winnerhit;
+		best_fwd_tracei = ++*fwd_tracei;
+#ifdef DEBUG9
+		best_fwd_intronnfwd = prevlink->fwd_intronnfwd;
+		best_fwd_intronnrev = prevlink->fwd_intronnrev;
+		best_fwd_intronnunk = prevlink->fwd_intronnunk;
+#endif
+		debug9(printf("\tD2 (sparse). Fwd mismatch qpos %d,%d => Best fwd at %d\n",prev_querypos,winnerhit,fwd_score));
+	      }
+	    }
+
 	    /* Range 2: From maxintronlen to (prev_querypos + EQUAL_DISTANCE_NOT_SPLICING) */
 	    /* This is equivalent to +diffdistance > EQUAL_DISTANCE_NOT_SPLICING */
 	    while (prevhit != -1 && (prevposition = /*mappings[prev_querypos]*/prev_mappings[prevhit]) > position + EQUAL_DISTANCE_NOT_SPLICING + querydistance) {
@@ -3702,6 +4092,7 @@ align_compute_scores_lookback (int *ncells, struct Link_T **links, int **fwd_sco
 #endif
 #endif
   int **active;
+  Rangemax_T *rangemaxes = NULL;
   Chrpos_T position, prevposition;
   int fwd_tracei = 0;
 #if 0
@@ -3737,6 +4128,9 @@ align_compute_scores_lookback (int *ncells, struct Link_T **links, int **fwd_sco
   } else {
     active = intmatrix_2d_new(querylength,npositions);
   }
+  if (sparse_chaining_p == true && splicingp == true) {
+    rangemaxes = (Rangemax_T *) CALLOC(querylength,sizeof(Rangemax_T));
+  }
 
 #if 0
   firstactive = (int *) MALLOC(querylength * sizeof(int));
@@ -3813,6 +4207,9 @@ align_compute_scores_lookback (int *ncells, struct Link_T **links, int **fwd_sco
 #endif
     }
     revise_active_lookback(active,firstactive,nactive,0,npositions[curr_querypos],fwd_scores,curr_querypos);
+    if (rangemaxes != NULL) {
+      sparse_build(rangemaxes,curr_querypos,active,firstactive,nactive,mappings,fwd_scores);
+    }
   }
 
   grand_fwd_score = 0;
@@ -3897,7 +4294,7 @@ align_compute_scores_lookback (int *ncells, struct Link_T **links, int **fwd_sco
 			curr_querypos,low_hit,position,active[curr_querypos][low_hit],oligo,processed ? Intlist_head(processed) : -1));
 	  
 	  score_querypos_lookback_one(&fwd_tracei,currlink,curr_querypos,low_hit,position,
-				      links,fwd_scores,mappings,active,firstactive,
+				      links,fwd_scores,mappings,active,firstactive,rangemaxes,
 				      genome,genomealt,chroffset,chrhigh,plusp,
 				      indexsize,processed,localp,splicingp,use_canonical_p,
 				      non_canonical_penalty);
@@ -3917,7 +4314,7 @@ align_compute_scores_lookback (int *ncells, struct Link_T **links, int **fwd_sco
 
 	  score_querypos_lookback_mult(&fwd_tracei,low_hit,high_hit,curr_querypos,
 				       /*positions*/&(mappings[curr_querypos][low_hit]),
-				       links,fwd_scores,mappings,active,firstactive,
+				       links,fwd_scores,mappings,active,firstactive,rangemaxes,
 				       genome,genomealt,chroffset,chrhigh,plusp,
 				       indexsize,processed,localp,splicingp,use_canonical_p,
 				       non_canonical_penalty);
@@ -4068,6 +4465,9 @@ align_compute_scores_lookback (int *ncells, struct Link_T **links, int **fwd_sco
       }
 
       revise_active_lookback(active,firstactive,nactive,low_hit,high_hit,fwd_scores,curr_querypos);
+      if (rangemaxes != NULL) {
+	sparse_build(rangemaxes,curr_querypos,active,firstactive,nactive,mappings,fwd_scores);
+      }
 
       /* Need to push querypos, even if firstactive[curr_querypos] == -1 */
       /* Want to skip npositions[curr_querypos] == 0, so we can find adjacent despite mismatch or overabundance */
@@ -4087,6 +4487,15 @@ align_compute_scores_lookback (int *ncells, struct Link_T **links, int **fwd_sco
   FREE(firstactive);
 #endif
 
+  if (rangemaxes != NULL) {
+    for (curr_querypos = 0; curr_querypos < querylength; curr_querypos++) {
+      if (rangemaxes[curr_querypos] != NULL) {
+	Rangemax_free(&(rangemaxes[curr_querypos]));
+      }
+    }
+    FREE(rangemaxes);
+  }
+
   if (oned_matrix_p == true) {
     intmatrix_1d_free(&active);
   } else {
@@ -4644,6 +5053,7 @@ align_compute_scores_lookforward (int *ncells, struct Link_T **links, int **fwd_
 #endif
 #endif
   int **active;
+  Rangemax_T *rangemaxes = NULL;
   Chrpos_T position, prevposition;
   int fwd_tracei = 0;
 #if 0
@@ -4678,6 +5088,9 @@ align_compute_scores_lookforward (int *ncells, struct Link_T **links, int **fwd_
   } else {
     active = intmatrix_2d_new(querylength,npositions);
   }
+  if (sparse_chaining_p == true && splicingp == true) {
+    rangemaxes = (Rangemax_T *) CALLOC(querylength,sizeof(Rangemax_T));
+  }
 
 #if 0
   firstactive = (int *) MALLOC(querylength * sizeof(int));
@@ -4754,6 +5167,9 @@ align_compute_scores_lookforward (int *ncells, struct Link_T **links, int **fwd_
 #endif
     }
     revise_active_lookforward(active,firstactive,nactive,0,npositions[curr_querypos],fwd_scores,curr_querypos);
+    if (rangemaxes != NULL) {
+      sparse_build(rangemaxes,curr_querypos,active,firstactive,nactive,mappings,fwd_scores);
+    }
   }
 
 
@@ -4838,7 +5254,7 @@ align_compute_scores_lookforward (int *ncells, struct Link_T **links, int **fwd_
 	  debug9(printf("Finding link looking forward from querypos %d,%d at %ux%d (%s).  prev_querypos was %d\n",
 			curr_querypos,low_hit,position,active[curr_querypos][low_hit],oligo,processed ? Intlist_head(processed) : -1));
 	  score_querypos_lookforward_one(&fwd_tracei,currlink,curr_querypos,low_hit,position,
-					 links,fwd_scores,mappings,active,firstactive,
+					 links,fwd_scores,mappings,active,firstactive,rangemaxes,
 					 genome,genomealt,chroffset,chrhigh,plusp,
 					 indexsize,processed,localp,splicingp,use_canonical_p,
 					 non_canonical_penalty);
@@ -4857,7 +5273,7 @@ align_compute_scores_lookforward (int *ncells, struct Link_T **links, int **fwd_
 	
 	  score_querypos_lookforward_mult(&fwd_tracei,low_hit,high_hit,curr_querypos,
 					  /*positions*/&(mappings[curr_querypos][low_hit]),
-					  links,fwd_scores,mappings,active,firstactive,
+					  links,fwd_scores,mappings,active,firstactive,rangemaxes,
 					  genome,genomealt,chroffset,chrhigh,plusp,
 					  indexsize,processed,localp,splicingp,use_canonical_p,
 					  non_canonical_penalty);
@@ -5009,6 +5425,9 @@ align_compute_scores_lookforward (int *ncells, struct Link_T **links, int **fwd_
       }
 
       revise_active_lookforward(active,firstactive,nactive,low_hit,high_hit,fwd_scores,curr_querypos);
+      if (rangemaxes != NULL) {
+	sparse_build(rangemaxes,curr_querypos,active,firstactive,nactive,mappings,fwd_scores);
+      }
 
       /* Need to push curr_querypos, even if firstactive[curr_querypos] == -1 */
       /* Want to skip npositions[curr_querypos] == 0, so we can find adjacent despite mismatch or overabundance */
@@ -5029,6 +5448,15 @@ align_compute_scores_lookforward (int *ncells, struct Link_T **links, int **fwd_
   FREE(firstactive);
 #endif
 
+  if (rangemaxes != NULL) {
+    for (curr_querypos = 0; curr_querypos < querylength; curr_querypos++) {
+      if (rangemaxes[curr_querypos] != NULL) {
+	Rangemax_free(&(rangemaxes[curr_querypos]));
+      }
+    }
+    FREE(rangemaxes);
+  }
+
   if (oned_matrix_p == true) {
     intmatrix_1d_free(&active);
   } else {
@@ -42,7 +42,7 @@ extern void
 Stage2_setup (bool splicingp_in, bool cross_species_p,
 	      int suboptimal_score_start_in, int suboptimal_score_end_in,	
 	      int sufflookback_in, int nsufflookback_in, int maxintronlen_in,
-	      Mode_T mode_in, bool snps_p_in);
+	      Mode_T mode_in, bool snps_p_in, bool sparse_chaining_p_in);
 	    
 extern void
 Stage2_free (T *old);
@@ -170,7 +170,8 @@ Transcriptome_new (char *genomesubdir, char *genome_fileroot, char *transcriptom
 							filename,sizeof(UINT4));
   }
   comma = Genomicpos_commafmt(new->offsetsmeta_len);
-  fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+  fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	  Access_mbps(new->offsetsmeta_len,seconds));
   FREE(comma);
   FREE(filename);
 
@@ -186,7 +187,8 @@ Transcriptome_new (char *genomesubdir, char *genome_fileroot, char *transcriptom
 							 filename,sizeof(UINT4));
   }
   comma = Genomicpos_commafmt(new->offsetsstrm_len);
-  fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+  fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	  Access_mbps(new->offsetsstrm_len,seconds));
   FREE(comma);
   FREE(filename);
 
@@ -204,7 +206,8 @@ Transcriptome_new (char *genomesubdir, char *genome_fileroot, char *transcriptom
 						      filename,sizeof(UINT4));
   }
   comma = Genomicpos_commafmt(new->exoninfo_len);
-  fprintf(stderr,"done (%s bytes, %.2f sec)\n",comma,seconds);
+  fprintf(stderr,"done (%s bytes, %.2f sec, %.0f MB/s)\n",comma,seconds,
+	  Access_mbps(new->exoninfo_len,seconds));
   FREE(comma);
   FREE(filename);
     
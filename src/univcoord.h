@@ -22,6 +22,8 @@ typedef Uint8list_T Univcoordlist_T;
 #define Univcoordlist_head_set Uint8list_head_set
 #define Univcoordlist_last_value Uint8list_last_value
 #define Univcoordlist_free Uint8list_free
+#define Univcoordlist_find Uint8list_find
+#define Univcoordlist_copy Uint8list_copy
 #define Univcoordlist_keep_one Uint8list_keep_one
 #define Univcoordlist_min Uint8list_min
 #define Univcoordlist_max Uint8list_max
@@ -97,6 +99,8 @@ typedef Uintlist_T Univcoordlist_T;
 #define Univcoordlist_head_set Uintlist_head_set
 #define Univcoordlist_last_value Uintlist_last_value
 #define Univcoordlist_free Uintlist_free
+#define Univcoordlist_find Uintlist_find
+#define Univcoordlist_copy Uintlist_copy
 #define Univcoordlist_keep_one Uintlist_keep_one
 #define Univcoordlist_min Uintlist_min
 #define Univcoordlist_max Uintlist_max